@@ -0,0 +1,766 @@
+/// A microbenchmark for the ray-object intersection kernels that dominate ray tracing time.
+/// Rays are generated from a fixed seed for several distributions (mostly hitting, mostly missing,
+/// and grazing the surfaces), so results are comparable between runs and machines.  Before timing,
+/// each kernel is validated against a simple double-precision reference implementation.
+///
+/// Objects supporting packet intersections are also benchmarked with packets of consecutive rays, so that
+/// the packet kernels can be compared against testing the same rays one at a time.
+///
+/// Usage: SoftwareRendererIntersectionBenchmark.exe [output_json_filepath]
+/// Results are written as JSON to standard output and, if specified, the output file.
+/// The exit code is non-zero if any kernel disagrees with the reference implementation.
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "Graphics/RayTracing/Disc.h"
+#include "Graphics/RayTracing/Ray.h"
+#include "Graphics/RayTracing/RayPacket.h"
+#include "Graphics/RayTracing/Sphere.h"
+#include "Graphics/Triangle.h"
+#include "Math/CounterBasedRandomNumberGenerator.h"
+#include "Math/Vector3.h"
+
+// CONSTANTS.
+/// The seed for generating all rays, fixed so that every run tests the same rays.
+constexpr std::uint32_t RAY_SEED = 0x5EED1234;
+/// The number of rays generated for each distribution.
+constexpr std::size_t RAY_COUNT = 1 << 16;
+/// The number of times all rays are tested within a single timed repetition.
+constexpr unsigned int PASS_COUNT_PER_REPETITION = 32;
+/// The number of timed repetitions, with the fastest used to minimize noise from other processes.
+constexpr unsigned int REPETITION_COUNT = 5;
+/// The distance of ray origins from the objects being intersected.
+constexpr float RAY_ORIGIN_DISTANCE = 10.0f;
+/// The proportion of rays in the miss-heavy distribution that hit.
+constexpr float MISS_HEAVY_HIT_PROPORTION = 0.1f;
+/// How far (as a proportion of object size) grazing rays deviate from exactly touching the surface.
+constexpr float GRAZING_DEVIATION = 0.001f;
+/// How close (as a proportion of object size) a ray must be to an object's boundary for single-precision
+/// and double-precision results to reasonably disagree on whether it hits.
+constexpr double BOUNDARY_TOLERANCE = 0.0001;
+/// The maximum allowed relative difference between intersection distances from a kernel and the reference.
+constexpr double DISTANCE_EPSILON = 0.001;
+
+/// The distributions of rays that kernels are tested against.
+enum class RayDistribution
+{
+    /// Nearly all rays hit the object.
+    HIT_HEAVY,
+    /// Most rays miss the object.
+    MISS_HEAVY,
+    /// Rays pass tangent to spheres (barely hitting or missing) or hit flat objects at a shallow angle.
+    GRAZING,
+    /// The number of different distributions.
+    COUNT
+};
+
+/// The result of a reference intersection test.
+class ReferenceIntersection
+{
+public:
+    // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+    /// The distance along the ray to the intersection (in units of the ray); infinity if the ray misses.
+    double Distance = std::numeric_limits<double>::infinity();
+    /// How far (as a proportion of object size) the ray is from the boundary between hitting and missing.
+    double BoundaryMargin = 0.0;
+};
+
+/// The measurements from benchmarking a single kernel on a single ray distribution.
+class BenchmarkResult
+{
+public:
+    // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+    /// The name of the object type.
+    std::string ObjectName = "";
+    /// The name of the ray distribution.
+    std::string DistributionName = "";
+    /// The name of the kernel.
+    std::string KernelName = "";
+    /// The total number of intersection tests in each repetition.
+    std::size_t TestCountPerRepetition = 0;
+    /// The proportion of rays that hit the object.
+    double HitProportion = 0.0;
+    /// The fastest time per intersection test across repetitions.
+    double NanosecondsPerTest = 0.0;
+    /// The median time per intersection test across repetitions.
+    double MedianNanosecondsPerTest = 0.0;
+    /// A value computed from all results to prevent the kernel from being optimized away.
+    double Checksum = 0.0;
+    /// The number of rays with results disagreeing with the reference implementation.
+    std::size_t MismatchCount = 0;
+    /// The largest relative difference between intersection distances from the kernel and the reference.
+    double MaxRelativeDistanceError = 0.0;
+};
+
+/// Gets the name of a ray distribution.
+/// @param[in]  distribution - The distribution to get the name of.
+/// @return The name of the distribution.
+static const char* DistributionName(const RayDistribution distribution)
+{
+    switch (distribution)
+    {
+        case RayDistribution::HIT_HEAVY:
+            return "hit_heavy";
+        case RayDistribution::MISS_HEAVY:
+            return "miss_heavy";
+        case RayDistribution::GRAZING:
+            return "grazing";
+        default:
+            return "unknown";
+    }
+}
+
+/// Generates a random unit direction, uniformly distributed over the sphere.
+/// @param[in,out]  random_number_generator - The generator for random numbers.
+/// @return A random unit direction.
+static MATH::Vector3f RandomUnitDirection(MATH::CounterBasedRandomNumberGenerator& random_number_generator)
+{
+    float z = 2.0f * random_number_generator.NextUniformFloat() - 1.0f;
+    float angle_in_radians = 2.0f * 3.14159265f * random_number_generator.NextUniformFloat();
+    float xy_length = std::sqrt(std::max(0.0f, 1.0f - z * z));
+    MATH::Vector3f direction(xy_length * std::cos(angle_in_radians), xy_length * std::sin(angle_in_radians), z);
+    return direction;
+}
+
+/// Generates rays toward a unit sphere centered at the origin.
+/// @param[in]  distribution - The distribution of rays to generate.
+/// @return The generated rays, each with a unit direction.
+static std::vector<GRAPHICS::RAY_TRACING::Ray> GenerateSphereRays(const RayDistribution distribution)
+{
+    std::vector<GRAPHICS::RAY_TRACING::Ray> rays;
+    rays.reserve(RAY_COUNT);
+    MATH::CounterBasedRandomNumberGenerator random_number_generator(MATH::CounterBasedRandomNumberGenerator::HashCombine(RAY_SEED, 1 + static_cast<std::uint32_t>(distribution)));
+    for (std::size_t ray_index = 0; ray_index < RAY_COUNT; ++ray_index)
+    {
+        // CHOOSE HOW CLOSE TO THE CENTER THE RAY PASSES.
+        float closest_distance_to_center = 0.0f;
+        switch (distribution)
+        {
+            case RayDistribution::HIT_HEAVY:
+                closest_distance_to_center = 0.99f * std::sqrt(random_number_generator.NextUniformFloat());
+                break;
+            case RayDistribution::MISS_HEAVY:
+            {
+                bool ray_hits = (random_number_generator.NextUniformFloat() < MISS_HEAVY_HIT_PROPORTION);
+                closest_distance_to_center = ray_hits ?
+                    0.99f * std::sqrt(random_number_generator.NextUniformFloat()) :
+                    1.01f + 2.0f * random_number_generator.NextUniformFloat();
+                break;
+            }
+            case RayDistribution::GRAZING:
+            default:
+                closest_distance_to_center = 1.0f + GRAZING_DEVIATION * (2.0f * random_number_generator.NextUniformFloat() - 1.0f);
+                break;
+        }
+
+        // AIM THE RAY FROM A RANDOM DIRECTION TO PASS THE CENTER AT THAT DISTANCE.
+        // The ray is aimed at a point in the plane through the center perpendicular to the origin's direction,
+        // offset by an amount that gives the desired closest distance to the center.
+        MATH::Vector3f origin_direction = RandomUnitDirection(random_number_generator);
+        MATH::Vector3f origin = MATH::Vector3f::Scale(RAY_ORIGIN_DISTANCE, origin_direction);
+        MATH::Vector3f offset_axis = MATH::Vector3f::Normalize(MATH::Vector3f::CrossProduct(origin_direction, RandomUnitDirection(random_number_generator)));
+        float offset_distance = RAY_ORIGIN_DISTANCE * closest_distance_to_center / std::sqrt(
+            RAY_ORIGIN_DISTANCE * RAY_ORIGIN_DISTANCE - closest_distance_to_center * closest_distance_to_center);
+        MATH::Vector3f target = MATH::Vector3f::Scale(offset_distance, offset_axis);
+        MATH::Vector3f direction = MATH::Vector3f::Normalize(target - origin);
+        rays.emplace_back(origin, direction);
+    }
+    return rays;
+}
+
+/// Generates rays toward the triangle from \ref CreateBenchmarkTriangle.
+/// @param[in]  distribution - The distribution of rays to generate.
+/// @return The generated rays, each with a unit direction.
+static std::vector<GRAPHICS::RAY_TRACING::Ray> GenerateTriangleRays(const RayDistribution distribution)
+{
+    std::vector<GRAPHICS::RAY_TRACING::Ray> rays;
+    rays.reserve(RAY_COUNT);
+    MATH::CounterBasedRandomNumberGenerator random_number_generator(MATH::CounterBasedRandomNumberGenerator::HashCombine(RAY_SEED, 101 + static_cast<std::uint32_t>(distribution)));
+    for (std::size_t ray_index = 0; ray_index < RAY_COUNT; ++ray_index)
+    {
+        // CHOOSE A TARGET POINT INSIDE OR OUTSIDE THE TRIANGLE.
+        // The triangle is in the XY plane with vertices (-1,-1), (1,-1), and (0,1).
+        bool ray_hits = (RayDistribution::MISS_HEAVY != distribution) || (random_number_generator.NextUniformFloat() < MISS_HEAVY_HIT_PROPORTION);
+        MATH::Vector3f target;
+        if (ray_hits)
+        {
+            // PICK A UNIFORM POINT WELL INSIDE THE TRIANGLE.
+            float first_weight = random_number_generator.NextUniformFloat();
+            float second_weight = random_number_generator.NextUniformFloat();
+            if (first_weight + second_weight > 1.0f)
+            {
+                first_weight = 1.0f - first_weight;
+                second_weight = 1.0f - second_weight;
+            }
+            constexpr float INSET_SCALE = 0.98f;
+            target = MATH::Vector3f(
+                INSET_SCALE * (-1.0f + 2.0f * first_weight + second_weight),
+                INSET_SCALE * (-1.0f + 2.0f * second_weight) - (1.0f - INSET_SCALE) / 3.0f,
+                0.0f);
+        }
+        else
+        {
+            // PICK A POINT IN THE PLANE CLEARLY OUTSIDE THE TRIANGLE.
+            // Points are rejected until one is outside the slightly enlarged triangle.
+            bool target_outside_triangle = false;
+            while (!target_outside_triangle)
+            {
+                target = MATH::Vector3f(
+                    6.0f * random_number_generator.NextUniformFloat() - 3.0f,
+                    6.0f * random_number_generator.NextUniformFloat() - 3.0f,
+                    0.0f);
+                constexpr float MARGIN = 0.02f;
+                bool below_bottom_edge = (target.Y < -1.0f - MARGIN);
+                bool beyond_right_edge = (target.Y > 1.0f - 2.0f * target.X + MARGIN);
+                bool beyond_left_edge = (target.Y > 1.0f + 2.0f * target.X + MARGIN);
+                target_outside_triangle = (below_bottom_edge || beyond_right_edge || beyond_left_edge);
+            }
+        }
+
+        // CHOOSE WHERE THE RAY COMES FROM.
+        // Grazing rays come from nearly within the plane of the triangle.
+        MATH::Vector3f origin_direction = RandomUnitDirection(random_number_generator);
+        if (RayDistribution::GRAZING == distribution)
+        {
+            float side = (origin_direction.Z < 0.0f) ? -1.0f : 1.0f;
+            float elevation = side * GRAZING_DEVIATION * (0.5f + random_number_generator.NextUniformFloat());
+            origin_direction.Z = 0.0f;
+            origin_direction = MATH::Vector3f::Normalize(origin_direction);
+            origin_direction.Z = elevation;
+        }
+        MATH::Vector3f origin = target + MATH::Vector3f::Scale(RAY_ORIGIN_DISTANCE, origin_direction);
+        MATH::Vector3f direction = MATH::Vector3f::Normalize(target - origin);
+        rays.emplace_back(origin, direction);
+    }
+    return rays;
+}
+
+/// Creates the triangle that rays are intersected with.
+/// @return A triangle in the XY plane with vertices (-1,-1), (1,-1), and (0,1).
+static GRAPHICS::Triangle CreateBenchmarkTriangle()
+{
+    GRAPHICS::Triangle triangle(nullptr, std::array<MATH::Vector3f, GRAPHICS::Triangle::VERTEX_COUNT>
+    {
+        MATH::Vector3f(-1.0f, -1.0f, 0.0f),
+        MATH::Vector3f(1.0f, -1.0f, 0.0f),
+        MATH::Vector3f(0.0f, 1.0f, 0.0f),
+    });
+    return triangle;
+}
+
+/// Generates rays toward a unit disc centered at the origin in the XY plane.
+/// @param[in]  distribution - The distribution of rays to generate.
+/// @return The generated rays, each with a unit direction.
+static std::vector<GRAPHICS::RAY_TRACING::Ray> GenerateDiscRays(const RayDistribution distribution)
+{
+    std::vector<GRAPHICS::RAY_TRACING::Ray> rays;
+    rays.reserve(RAY_COUNT);
+    MATH::CounterBasedRandomNumberGenerator random_number_generator(MATH::CounterBasedRandomNumberGenerator::HashCombine(RAY_SEED, 201 + static_cast<std::uint32_t>(distribution)));
+    for (std::size_t ray_index = 0; ray_index < RAY_COUNT; ++ray_index)
+    {
+        // CHOOSE A TARGET POINT INSIDE OR OUTSIDE THE DISC.
+        bool ray_hits = (RayDistribution::MISS_HEAVY != distribution) || (random_number_generator.NextUniformFloat() < MISS_HEAVY_HIT_PROPORTION);
+        float distance_from_center = ray_hits ?
+            0.99f * std::sqrt(random_number_generator.NextUniformFloat()) :
+            1.01f + 2.0f * random_number_generator.NextUniformFloat();
+        float angle_in_radians = 2.0f * 3.14159265f * random_number_generator.NextUniformFloat();
+        MATH::Vector3f target(distance_from_center * std::cos(angle_in_radians), distance_from_center * std::sin(angle_in_radians), 0.0f);
+
+        // CHOOSE WHERE THE RAY COMES FROM.
+        // Grazing rays come from nearly within the plane of the disc.
+        MATH::Vector3f origin_direction = RandomUnitDirection(random_number_generator);
+        if (RayDistribution::GRAZING == distribution)
+        {
+            float side = (origin_direction.Z < 0.0f) ? -1.0f : 1.0f;
+            float elevation = side * GRAZING_DEVIATION * (0.5f + random_number_generator.NextUniformFloat());
+            origin_direction.Z = 0.0f;
+            origin_direction = MATH::Vector3f::Normalize(origin_direction);
+            origin_direction.Z = elevation;
+        }
+        MATH::Vector3f origin = target + MATH::Vector3f::Scale(RAY_ORIGIN_DISTANCE, origin_direction);
+        MATH::Vector3f direction = MATH::Vector3f::Normalize(target - origin);
+        rays.emplace_back(origin, direction);
+    }
+    return rays;
+}
+
+/// Intersects a ray with a sphere in double precision using the geometric (rather than quadratic) method.
+/// @param[in]  ray - The ray to intersect.
+/// @param[in]  sphere - The sphere to intersect.
+/// @return The reference intersection.
+static ReferenceIntersection IntersectSphereReference(const GRAPHICS::RAY_TRACING::Ray& ray, const GRAPHICS::RAY_TRACING::Sphere& sphere)
+{
+    // FIND THE CLOSEST POINT ON THE RAY'S LINE TO THE CENTER.
+    double direction[3] = { ray.Direction.X, ray.Direction.Y, ray.Direction.Z };
+    double center_to_origin[3] =
+    {
+        static_cast<double>(ray.Origin.X) - sphere.CenterPosition.X,
+        static_cast<double>(ray.Origin.Y) - sphere.CenterPosition.Y,
+        static_cast<double>(ray.Origin.Z) - sphere.CenterPosition.Z,
+    };
+    double direction_length_squared = direction[0] * direction[0] + direction[1] * direction[1] + direction[2] * direction[2];
+    double closest_point_distance = -(center_to_origin[0] * direction[0] + center_to_origin[1] * direction[1] + center_to_origin[2] * direction[2]) / direction_length_squared;
+    double closest_offset_squared = 0.0;
+    for (std::size_t axis = 0; axis < 3; ++axis)
+    {
+        double closest_offset = center_to_origin[axis] + closest_point_distance * direction[axis];
+        closest_offset_squared += closest_offset * closest_offset;
+    }
+
+    // CHECK IF THE LINE PASSES THROUGH THE SPHERE.
+    double radius = sphere.Radius;
+    ReferenceIntersection intersection;
+    intersection.BoundaryMargin = std::abs(std::sqrt(closest_offset_squared) - radius) / radius;
+    double radius_squared = radius * radius;
+    if (closest_offset_squared > radius_squared)
+    {
+        return intersection;
+    }
+
+    // FIND THE CLOSEST INTERSECTION IN FRONT OF THE RAY.
+    double half_chord_distance = std::sqrt((radius_squared - closest_offset_squared) / direction_length_squared);
+    double near_distance = closest_point_distance - half_chord_distance;
+    double far_distance = closest_point_distance + half_chord_distance;
+    if (near_distance >= 0.0)
+    {
+        intersection.Distance = near_distance;
+    }
+    else if (far_distance >= 0.0)
+    {
+        intersection.Distance = far_distance;
+    }
+    return intersection;
+}
+
+/// Intersects a ray with a triangle in double precision using the Moller-Trumbore method.
+/// @param[in]  ray - The ray to intersect.
+/// @param[in]  triangle - The triangle to intersect.
+/// @return The reference intersection.
+static ReferenceIntersection IntersectTriangleReference(const GRAPHICS::RAY_TRACING::Ray& ray, const GRAPHICS::Triangle& triangle)
+{
+    // DEFINE DOUBLE-PRECISION VECTOR HELPERS.
+    using Vector = std::array<double, 3>;
+    auto to_vector = [](const MATH::Vector3f& vector) { return Vector { vector.X, vector.Y, vector.Z }; };
+    auto subtract = [](const Vector& lhs, const Vector& rhs) { return Vector { lhs[0] - rhs[0], lhs[1] - rhs[1], lhs[2] - rhs[2] }; };
+    auto dot = [](const Vector& lhs, const Vector& rhs) { return lhs[0] * rhs[0] + lhs[1] * rhs[1] + lhs[2] * rhs[2]; };
+    auto cross = [](const Vector& lhs, const Vector& rhs)
+    {
+        return Vector { lhs[1] * rhs[2] - lhs[2] * rhs[1], lhs[2] * rhs[0] - lhs[0] * rhs[2], lhs[0] * rhs[1] - lhs[1] * rhs[0] };
+    };
+
+    // CHECK IF THE RAY IS PARALLEL TO THE TRIANGLE.
+    Vector origin = to_vector(ray.Origin);
+    Vector direction = to_vector(ray.Direction);
+    Vector first_vertex = to_vector(triangle.Vertices[0]);
+    Vector first_edge = subtract(to_vector(triangle.Vertices[1]), first_vertex);
+    Vector second_edge = subtract(to_vector(triangle.Vertices[2]), first_vertex);
+    Vector direction_cross_second_edge = cross(direction, second_edge);
+    double determinant = dot(first_edge, direction_cross_second_edge);
+    ReferenceIntersection intersection;
+    if (0.0 == determinant)
+    {
+        return intersection;
+    }
+
+    // COMPUTE THE BARYCENTRIC COORDINATES OF THE INTERSECTION WITH THE TRIANGLE'S PLANE.
+    double inverse_determinant = 1.0 / determinant;
+    Vector first_vertex_to_origin = subtract(origin, first_vertex);
+    double second_vertex_weight = inverse_determinant * dot(first_vertex_to_origin, direction_cross_second_edge);
+    Vector origin_cross_first_edge = cross(first_vertex_to_origin, first_edge);
+    double third_vertex_weight = inverse_determinant * dot(direction, origin_cross_first_edge);
+    double first_vertex_weight = 1.0 - second_vertex_weight - third_vertex_weight;
+    double distance = inverse_determinant * dot(second_edge, origin_cross_first_edge);
+
+    // CHECK IF THE INTERSECTION IS WITHIN THE TRIANGLE AND IN FRONT OF THE RAY.
+    double min_weight = std::min({ first_vertex_weight, second_vertex_weight, third_vertex_weight });
+    intersection.BoundaryMargin = std::abs(min_weight);
+    if ((min_weight >= 0.0) && (distance >= 0.0))
+    {
+        intersection.Distance = distance;
+    }
+    return intersection;
+}
+
+/// Intersects a ray with a disc in double precision.
+/// @param[in]  ray - The ray to intersect.
+/// @param[in]  disc - The disc to intersect.
+/// @return The reference intersection.
+static ReferenceIntersection IntersectDiscReference(const GRAPHICS::RAY_TRACING::Ray& ray, const GRAPHICS::RAY_TRACING::Disc& disc)
+{
+    // CHECK IF THE RAY IS PARALLEL TO THE DISC.
+    double normal[3] = { disc.UnitNormal.X, disc.UnitNormal.Y, disc.UnitNormal.Z };
+    double direction[3] = { ray.Direction.X, ray.Direction.Y, ray.Direction.Z };
+    double origin_to_center[3] =
+    {
+        static_cast<double>(disc.CenterPosition.X) - ray.Origin.X,
+        static_cast<double>(disc.CenterPosition.Y) - ray.Origin.Y,
+        static_cast<double>(disc.CenterPosition.Z) - ray.Origin.Z,
+    };
+    double direction_along_normal = normal[0] * direction[0] + normal[1] * direction[1] + normal[2] * direction[2];
+    ReferenceIntersection intersection;
+    if (0.0 == direction_along_normal)
+    {
+        return intersection;
+    }
+
+    // FIND HOW FAR FROM THE CENTER THE RAY CROSSES THE DISC'S PLANE.
+    double distance = (normal[0] * origin_to_center[0] + normal[1] * origin_to_center[1] + normal[2] * origin_to_center[2]) / direction_along_normal;
+    double squared_distance_from_center = 0.0;
+    for (std::size_t axis = 0; axis < 3; ++axis)
+    {
+        double center_to_intersection = distance * direction[axis] - origin_to_center[axis];
+        squared_distance_from_center += center_to_intersection * center_to_intersection;
+    }
+
+    // CHECK IF THE INTERSECTION IS WITHIN THE DISC AND IN FRONT OF THE RAY.
+    double radius = disc.Radius;
+    double distance_from_center = std::sqrt(squared_distance_from_center);
+    intersection.BoundaryMargin = std::abs(distance_from_center - radius) / radius;
+    if ((distance_from_center <= radius) && (distance >= 0.0))
+    {
+        intersection.Distance = distance;
+    }
+    return intersection;
+}
+
+/// Validates distances computed by a kernel against the reference implementation.
+/// Rays too close to the boundary of an object may reasonably hit in one implementation and miss in the other.
+/// @param[in]  rays - The rays that were tested.
+/// @param[in]  kernel_distances - The distance computed by the kernel for each ray (infinity for misses).
+/// @param[in]  reference - The reference implementation to validate the kernel against.
+/// @param[in]  kernel_computes_distance - True if the kernel's distances should be validated;
+///     false if they only indicate whether rays hit.
+/// @param[in,out] result - The result to fill in with the hit proportion and any mismatches.
+static void Validate(
+    const std::vector<GRAPHICS::RAY_TRACING::Ray>& rays,
+    const std::vector<float>& kernel_distances,
+    const std::function<ReferenceIntersection(const GRAPHICS::RAY_TRACING::Ray&)>& reference,
+    const bool kernel_computes_distance,
+    BenchmarkResult& result)
+{
+    std::size_t hit_count = 0;
+    for (std::size_t ray_index = 0; ray_index < rays.size(); ++ray_index)
+    {
+        float kernel_distance = kernel_distances[ray_index];
+        ReferenceIntersection reference_intersection = reference(rays[ray_index]);
+        bool kernel_hit = std::isfinite(kernel_distance);
+        bool reference_hit = std::isfinite(reference_intersection.Distance);
+        if (kernel_hit)
+        {
+            ++hit_count;
+        }
+
+        bool near_boundary = (reference_intersection.BoundaryMargin < BOUNDARY_TOLERANCE);
+        if (near_boundary)
+        {
+            continue;
+        }
+
+        if (kernel_hit != reference_hit)
+        {
+            ++result.MismatchCount;
+            continue;
+        }
+
+        if (kernel_hit && kernel_computes_distance)
+        {
+            double relative_distance_error = std::abs(kernel_distance - reference_intersection.Distance) / std::max(1.0, reference_intersection.Distance);
+            result.MaxRelativeDistanceError = std::max(result.MaxRelativeDistanceError, relative_distance_error);
+            if (relative_distance_error > DISTANCE_EPSILON)
+            {
+                ++result.MismatchCount;
+            }
+        }
+    }
+    result.HitProportion = static_cast<double>(hit_count) / static_cast<double>(rays.size());
+}
+
+/// Records the fastest and median times across repetitions in a result.
+/// @param[in]  nanoseconds_per_test_by_repetition - The time per intersection test for each repetition.
+/// @param[in,out] result - The result to fill in with timings.
+static void RecordTimes(std::vector<double>& nanoseconds_per_test_by_repetition, BenchmarkResult& result)
+{
+    std::sort(nanoseconds_per_test_by_repetition.begin(), nanoseconds_per_test_by_repetition.end());
+    result.NanosecondsPerTest = nanoseconds_per_test_by_repetition.front();
+    result.MedianNanosecondsPerTest = nanoseconds_per_test_by_repetition[nanoseconds_per_test_by_repetition.size() / 2];
+}
+
+/// Benchmarks a single intersection kernel on a set of rays.
+/// @param[in]  rays - The rays to test.
+/// @param[in]  kernel - The kernel to benchmark, returning the intersection distance for a ray
+///     (infinity if the ray misses or if the kernel doesn't compute distances but the ray hits).
+/// @param[in]  reference - The reference implementation to validate the kernel against.
+/// @param[in]  kernel_computes_distance - True if the kernel returns intersection distances that should be validated;
+///     false if it only indicates whether rays hit (by returning any finite value).
+/// @param[out] result - The result to fill in with measurements (names must already be filled in).
+/// @tparam Kernel - The type of the kernel, as a template parameter to avoid timing indirect calls to it.
+template <typename Kernel>
+static void Benchmark(
+    const std::vector<GRAPHICS::RAY_TRACING::Ray>& rays,
+    const Kernel& kernel,
+    const std::function<ReferenceIntersection(const GRAPHICS::RAY_TRACING::Ray&)>& reference,
+    const bool kernel_computes_distance,
+    BenchmarkResult& result)
+{
+    // VALIDATE THE KERNEL AGAINST THE REFERENCE.
+    std::vector<float> kernel_distances;
+    kernel_distances.reserve(rays.size());
+    for (const GRAPHICS::RAY_TRACING::Ray& ray : rays)
+    {
+        kernel_distances.push_back(kernel(ray));
+    }
+    Validate(rays, kernel_distances, reference, kernel_computes_distance, result);
+
+    // TIME SEVERAL REPETITIONS OF THE KERNEL.
+    result.TestCountPerRepetition = rays.size() * PASS_COUNT_PER_REPETITION;
+    std::vector<double> nanoseconds_per_test_by_repetition;
+    for (unsigned int repetition = 0; repetition < REPETITION_COUNT; ++repetition)
+    {
+        // The checksum depends on every result so that no tests can be skipped by the compiler.
+        double checksum = 0.0;
+        std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+        for (unsigned int pass = 0; pass < PASS_COUNT_PER_REPETITION; ++pass)
+        {
+            for (const GRAPHICS::RAY_TRACING::Ray& ray : rays)
+            {
+                float distance = kernel(ray);
+                checksum += std::isfinite(distance) ? distance : 1.0;
+            }
+        }
+        std::chrono::steady_clock::duration elapsed_time = std::chrono::steady_clock::now() - start_time;
+
+        double elapsed_nanoseconds = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed_time).count());
+        nanoseconds_per_test_by_repetition.push_back(elapsed_nanoseconds / static_cast<double>(result.TestCountPerRepetition));
+        result.Checksum = checksum;
+    }
+
+    RecordTimes(nanoseconds_per_test_by_repetition, result);
+}
+
+/// Benchmarks the packet intersection kernel of an object on a set of rays.
+/// Rays are grouped into packets in order, so results are comparable with testing the same rays one at a time.
+/// @param[in]  rays - The rays to test.
+/// @param[in]  object_3D - The object to intersect, which must support packet intersections.
+/// @param[in]  reference - The reference implementation to validate the kernel against.
+/// @param[out] result - The result to fill in with measurements (names must already be filled in).
+static void BenchmarkPackets(
+    const std::vector<GRAPHICS::RAY_TRACING::Ray>& rays,
+    const GRAPHICS::RAY_TRACING::IObject3D& object_3D,
+    const std::function<ReferenceIntersection(const GRAPHICS::RAY_TRACING::Ray&)>& reference,
+    BenchmarkResult& result)
+{
+    // GROUP THE RAYS INTO PACKETS.
+    std::vector<GRAPHICS::RAY_TRACING::RayPacket> ray_packets;
+    for (const GRAPHICS::RAY_TRACING::Ray& ray : rays)
+    {
+        bool ray_added = !ray_packets.empty() && ray_packets.back().Add(ray);
+        if (!ray_added)
+        {
+            ray_packets.emplace_back();
+            ray_packets.back().Add(ray);
+        }
+    }
+
+    // VALIDATE THE KERNEL AGAINST THE REFERENCE.
+    std::vector<float> kernel_distances;
+    kernel_distances.reserve(rays.size());
+    std::array<float, GRAPHICS::RAY_TRACING::RayPacket::MAX_RAY_COUNT> distances;
+    for (const GRAPHICS::RAY_TRACING::RayPacket& ray_packet : ray_packets)
+    {
+        object_3D.IntersectPacket(ray_packet, distances);
+        kernel_distances.insert(kernel_distances.end(), distances.cbegin(), distances.cbegin() + ray_packet.RayCount);
+    }
+    Validate(rays, kernel_distances, reference, true, result);
+
+    // TIME SEVERAL REPETITIONS OF THE KERNEL.
+    result.TestCountPerRepetition = rays.size() * PASS_COUNT_PER_REPETITION;
+    std::vector<double> nanoseconds_per_test_by_repetition;
+    for (unsigned int repetition = 0; repetition < REPETITION_COUNT; ++repetition)
+    {
+        // The checksum depends on every result so that no tests can be skipped by the compiler.
+        double checksum = 0.0;
+        std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+        for (unsigned int pass = 0; pass < PASS_COUNT_PER_REPETITION; ++pass)
+        {
+            for (const GRAPHICS::RAY_TRACING::RayPacket& ray_packet : ray_packets)
+            {
+                object_3D.IntersectPacket(ray_packet, distances);
+                for (std::size_t ray_index = 0; ray_index < ray_packet.RayCount; ++ray_index)
+                {
+                    checksum += std::isfinite(distances[ray_index]) ? distances[ray_index] : 1.0;
+                }
+            }
+        }
+        std::chrono::steady_clock::duration elapsed_time = std::chrono::steady_clock::now() - start_time;
+
+        double elapsed_nanoseconds = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed_time).count());
+        nanoseconds_per_test_by_repetition.push_back(elapsed_nanoseconds / static_cast<double>(result.TestCountPerRepetition));
+        result.Checksum = checksum;
+    }
+
+    RecordTimes(nanoseconds_per_test_by_repetition, result);
+}
+
+/// Formats benchmark results as JSON.
+/// @param[in]  results - The results to format.
+/// @return The results as a JSON document.
+static std::string FormatJson(const std::vector<BenchmarkResult>& results)
+{
+    std::ostringstream json;
+    json.precision(9);
+    json << "{\n";
+    json << "    \"benchmark\": \"intersection\",\n";
+    json << "    \"ray_seed\": " << RAY_SEED << ",\n";
+    json << "    \"ray_count\": " << RAY_COUNT << ",\n";
+    json << "    \"repetition_count\": " << REPETITION_COUNT << ",\n";
+    json << "    \"results\":\n";
+    json << "    [\n";
+    for (std::size_t result_index = 0; result_index < results.size(); ++result_index)
+    {
+        const BenchmarkResult& result = results[result_index];
+        double million_tests_per_second = 1000.0 / result.NanosecondsPerTest;
+        json << "        {";
+        json << " \"object\": \"" << result.ObjectName << "\",";
+        json << " \"distribution\": \"" << result.DistributionName << "\",";
+        json << " \"kernel\": \"" << result.KernelName << "\",";
+        json << " \"tests_per_repetition\": " << result.TestCountPerRepetition << ",";
+        json << " \"hit_proportion\": " << result.HitProportion << ",";
+        json << " \"ns_per_test\": " << result.NanosecondsPerTest << ",";
+        json << " \"median_ns_per_test\": " << result.MedianNanosecondsPerTest << ",";
+        json << " \"million_tests_per_second\": " << million_tests_per_second << ",";
+        json << " \"checksum\": " << result.Checksum << ",";
+        json << " \"mismatch_count\": " << result.MismatchCount << ",";
+        json << " \"max_relative_distance_error\": " << result.MaxRelativeDistanceError;
+        json << " }" << ((result_index + 1 < results.size()) ? "," : "") << "\n";
+    }
+    json << "    ]\n";
+    json << "}\n";
+    return json.str();
+}
+
+/// The entry point for the benchmark.
+/// @param[in]  argument_count - The number of command line arguments.
+/// @param[in]  arguments - The command line arguments, with an optional output JSON filepath after the program name.
+/// @return 0 if all kernels agreed with the reference implementations; 1 otherwise.
+int main(int argument_count, char* arguments[])
+{
+    // CREATE THE OBJECTS TO INTERSECT.
+    GRAPHICS::RAY_TRACING::Sphere sphere;
+    sphere.CenterPosition = MATH::Vector3f(0.0f, 0.0f, 0.0f);
+    sphere.Radius = 1.0f;
+    GRAPHICS::Triangle triangle = CreateBenchmarkTriangle();
+    GRAPHICS::RAY_TRACING::Disc disc;
+    disc.CenterPosition = MATH::Vector3f(0.0f, 0.0f, 0.0f);
+    disc.UnitNormal = MATH::Vector3f(0.0f, 0.0f, 1.0f);
+    disc.Radius = 1.0f;
+
+    // BENCHMARK EACH KERNEL FOR EACH OBJECT AND RAY DISTRIBUTION.
+    // Occlusion tests are included since shadow rays use them instead of finding the closest intersection.
+    // Packet tests are included for objects supporting them since primary rays may be traced in packets.
+    std::vector<BenchmarkResult> results;
+    for (std::size_t distribution_index = 0; distribution_index < static_cast<std::size_t>(RayDistribution::COUNT); ++distribution_index)
+    {
+        RayDistribution distribution = static_cast<RayDistribution>(distribution_index);
+        class BenchmarkObject
+        {
+        public:
+            const char* ObjectName;
+            const GRAPHICS::RAY_TRACING::IObject3D* Object;
+            std::vector<GRAPHICS::RAY_TRACING::Ray> Rays;
+            std::function<ReferenceIntersection(const GRAPHICS::RAY_TRACING::Ray&)> Reference;
+        };
+        std::vector<BenchmarkObject> objects;
+        objects.push_back(BenchmarkObject
+        {
+            "Sphere",
+            &sphere,
+            GenerateSphereRays(distribution),
+            [&sphere](const GRAPHICS::RAY_TRACING::Ray& ray) { return IntersectSphereReference(ray, sphere); },
+        });
+        objects.push_back(BenchmarkObject
+        {
+            "Triangle",
+            &triangle,
+            GenerateTriangleRays(distribution),
+            [&triangle](const GRAPHICS::RAY_TRACING::Ray& ray) { return IntersectTriangleReference(ray, triangle); },
+        });
+        objects.push_back(BenchmarkObject
+        {
+            "Disc",
+            &disc,
+            GenerateDiscRays(distribution),
+            [&disc](const GRAPHICS::RAY_TRACING::Ray& ray) { return IntersectDiscReference(ray, disc); },
+        });
+
+        for (const BenchmarkObject& object : objects)
+        {
+            BenchmarkResult intersect_result;
+            intersect_result.ObjectName = object.ObjectName;
+            intersect_result.DistributionName = DistributionName(distribution);
+            intersect_result.KernelName = "Intersect";
+            const GRAPHICS::RAY_TRACING::IObject3D* object_3D = object.Object;
+            auto intersect = [object_3D](const GRAPHICS::RAY_TRACING::Ray& ray)
+            {
+                std::optional<GRAPHICS::RAY_TRACING::RayObjectIntersection> intersection = object_3D->Intersect(ray);
+                return intersection ? intersection->DistanceFromRayToObject : std::numeric_limits<float>::infinity();
+            };
+            Benchmark(object.Rays, intersect, object.Reference, true, intersect_result);
+            results.push_back(intersect_result);
+
+            BenchmarkResult occludes_result;
+            occludes_result.ObjectName = object.ObjectName;
+            occludes_result.DistributionName = DistributionName(distribution);
+            occludes_result.KernelName = "Occludes";
+            auto occludes = [object_3D](const GRAPHICS::RAY_TRACING::Ray& ray)
+            {
+                bool occluded = object_3D->Occludes(ray, 0.0f, std::numeric_limits<float>::infinity());
+                return occluded ? 0.0f : std::numeric_limits<float>::infinity();
+            };
+            Benchmark(object.Rays, occludes, object.Reference, false, occludes_result);
+            results.push_back(occludes_result);
+
+            std::array<float, GRAPHICS::RAY_TRACING::RayPacket::MAX_RAY_COUNT> distances;
+            bool packets_supported = object_3D->IntersectPacket(GRAPHICS::RAY_TRACING::RayPacket(), distances);
+            if (packets_supported)
+            {
+                BenchmarkResult intersect_packet_result;
+                intersect_packet_result.ObjectName = object.ObjectName;
+                intersect_packet_result.DistributionName = DistributionName(distribution);
+                intersect_packet_result.KernelName = "IntersectPacket";
+                BenchmarkPackets(object.Rays, *object_3D, object.Reference, intersect_packet_result);
+                results.push_back(intersect_packet_result);
+            }
+        }
+    }
+
+    // OUTPUT THE RESULTS.
+    std::string json = FormatJson(results);
+    std::cout << json;
+    bool output_filepath_specified = (argument_count > 1);
+    if (output_filepath_specified)
+    {
+        std::ofstream output_file(arguments[1]);
+        output_file << json;
+    }
+
+    // INDICATE IF ANY KERNELS DISAGREED WITH THE REFERENCE.
+    bool all_kernels_valid = std::all_of(results.cbegin(), results.cend(), [](const BenchmarkResult& result) { return 0 == result.MismatchCount; });
+    if (!all_kernels_valid)
+    {
+        std::cerr << "Some kernels disagreed with the reference implementation." << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,351 @@
+/// An end-to-end benchmark that renders the demo's content without a window.
+/// It replays each example ray tracing scene, rasterizes the cube and OBJ models with each type of shading,
+/// and rasterizes the cube with each lighting configuration, all at several resolutions.  Each configuration
+/// is rendered for some warm-up frames before its frames are timed, so that caches and lazily built data
+/// don't skew results.
+///
+/// Usage: SoftwareRendererSceneBenchmark.exe [output_json_filepath] [measured_frame_count]
+/// Results are written as JSON to standard output and, if specified, the output file.  Each result includes
+/// a checksum of the rendered image, so changes in output can be caught alongside changes in frame time.
+/// Assets are loaded relative to the working directory like the demo, so this should be run from the build directory.
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "Graphics/Camera.h"
+#include "Graphics/Cube.h"
+#include "Graphics/ExampleLighting.h"
+#include "Graphics/ExampleMaterials.h"
+#include "Graphics/Modeling/WavefrontObjectModel.h"
+#include "Graphics/Object3D.h"
+#include "Graphics/RayTracing/ExampleScenes.h"
+#include "Graphics/RayTracing/RayTracingAlgorithm.h"
+#include "Graphics/Renderer.h"
+#include "Graphics/RenderTarget.h"
+#include "Graphics/Texture.h"
+#include "Math/CounterBasedRandomNumberGenerator.h"
+
+// CONSTANTS.
+/// The number of frames rendered for each configuration before any are timed.
+constexpr unsigned int WARM_UP_FRAME_COUNT = 1;
+/// The default number of timed frames for each configuration.  The slowest scenes take seconds per frame,
+/// so this is kept low enough for a full run to finish in minutes, at the cost of a noisier 99th percentile.
+constexpr unsigned int DEFAULT_MEASURED_FRAME_COUNT = 10;
+/// The resolutions that each configuration is rendered at, as width and height in pixels.
+constexpr std::array<std::array<unsigned int, 2>, 3> RESOLUTIONS =
+{
+    std::array<unsigned int, 2> { 160, 120 },
+    std::array<unsigned int, 2> { 320, 240 },
+    std::array<unsigned int, 2> { 640, 480 },
+};
+/// The fixed rotation of rasterized objects, so that multiple faces are visible without animating.
+constexpr float RASTERIZED_OBJECT_ROTATION_IN_RADIANS = 0.5f;
+/// The index of the lighting configuration used when comparing types of shading (full white ambient light).
+constexpr std::size_t DEFAULT_LIGHT_CONFIGURATION_INDEX = 0;
+
+/// A configuration of content and settings to benchmark.
+class BenchmarkConfiguration
+{
+public:
+    // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+    /// The category of the configuration (ray tracing, shading, or lighting).
+    std::string Category = "";
+    /// The name of the configuration within its category.
+    std::string Name = "";
+    /// Renders a single frame of the configuration into the render target, including any clearing.
+    std::function<void(GRAPHICS::RenderTarget& render_target)> RenderFrame = nullptr;
+};
+
+/// The measurements from benchmarking a single configuration at a single resolution.
+class BenchmarkResult
+{
+public:
+    // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+    /// The category of the configuration.
+    std::string Category = "";
+    /// The name of the configuration.
+    std::string Name = "";
+    /// The width of the rendered images.
+    unsigned int WidthInPixels = 0;
+    /// The height of the rendered images.
+    unsigned int HeightInPixels = 0;
+    /// The fastest frame time.
+    double MinFrameTimeInMilliseconds = 0.0;
+    /// The median frame time.
+    double MedianFrameTimeInMilliseconds = 0.0;
+    /// The 99th percentile frame time.
+    double P99FrameTimeInMilliseconds = 0.0;
+    /// A hash of the pixels of the last rendered image.
+    std::uint32_t ImageChecksum = 0;
+    /// True if every timed frame rendered an identical image; false otherwise.
+    bool Deterministic = true;
+};
+
+/// Computes a hash of all pixels in a render target.
+/// @param[in]  render_target - The render target to hash.
+/// @return A hash of the render target's dimensions and pixels.
+static std::uint32_t ComputeImageChecksum(const GRAPHICS::RenderTarget& render_target)
+{
+    unsigned int width_in_pixels = render_target.GetWidthInPixels();
+    unsigned int height_in_pixels = render_target.GetHeightInPixels();
+    std::uint32_t checksum = MATH::CounterBasedRandomNumberGenerator::Hash(width_in_pixels);
+    checksum = MATH::CounterBasedRandomNumberGenerator::HashCombine(checksum, height_in_pixels);
+
+    const std::uint32_t* pixels = render_target.GetRawData();
+    std::size_t pixel_count = static_cast<std::size_t>(width_in_pixels) * static_cast<std::size_t>(height_in_pixels);
+    for (std::size_t pixel_index = 0; pixel_index < pixel_count; ++pixel_index)
+    {
+        checksum = MATH::CounterBasedRandomNumberGenerator::HashCombine(checksum, pixels[pixel_index]);
+    }
+    return checksum;
+}
+
+/// Gets a percentile of sorted values, using the nearest-rank method.
+/// @param[in]  sorted_values - The values, in ascending order.  Must not be empty.
+/// @param[in]  percentile - The percentile [0, 100] to get.
+/// @return The value at the percentile.
+static double Percentile(const std::vector<double>& sorted_values, const double percentile)
+{
+    double rank = std::ceil(percentile / 100.0 * static_cast<double>(sorted_values.size()));
+    std::size_t index = static_cast<std::size_t>(std::max(rank, 1.0)) - 1;
+    return sorted_values[std::min(index, sorted_values.size() - 1)];
+}
+
+/// Benchmarks a single configuration at a single resolution.
+/// @param[in]  configuration - The configuration to benchmark.
+/// @param[in]  width_in_pixels - The width of images to render.
+/// @param[in]  height_in_pixels - The height of images to render.
+/// @param[in]  measured_frame_count - The number of frames to time.
+/// @return The measurements for the configuration.
+static BenchmarkResult Benchmark(
+    const BenchmarkConfiguration& configuration,
+    const unsigned int width_in_pixels,
+    const unsigned int height_in_pixels,
+    const unsigned int measured_frame_count)
+{
+    // WARM UP.
+    GRAPHICS::RenderTarget render_target(width_in_pixels, height_in_pixels, GRAPHICS::ColorFormat::ARGB);
+    for (unsigned int frame_index = 0; frame_index < WARM_UP_FRAME_COUNT; ++frame_index)
+    {
+        configuration.RenderFrame(render_target);
+    }
+
+    // TIME EACH FRAME.
+    BenchmarkResult result;
+    result.Category = configuration.Category;
+    result.Name = configuration.Name;
+    result.WidthInPixels = width_in_pixels;
+    result.HeightInPixels = height_in_pixels;
+    std::vector<double> frame_times_in_milliseconds;
+    for (unsigned int frame_index = 0; frame_index < measured_frame_count; ++frame_index)
+    {
+        std::chrono::steady_clock::time_point frame_start_time = std::chrono::steady_clock::now();
+        configuration.RenderFrame(render_target);
+        std::chrono::steady_clock::duration frame_time = std::chrono::steady_clock::now() - frame_start_time;
+        frame_times_in_milliseconds.push_back(std::chrono::duration<double, std::milli>(frame_time).count());
+
+        // CHECK THAT THE IMAGE MATCHES PREVIOUS FRAMES.
+        // This is done outside of the timed region since it isn't part of rendering.
+        std::uint32_t image_checksum = ComputeImageChecksum(render_target);
+        bool first_frame = (0 == frame_index);
+        if (!first_frame && (image_checksum != result.ImageChecksum))
+        {
+            result.Deterministic = false;
+        }
+        result.ImageChecksum = image_checksum;
+    }
+
+    // COMPUTE FRAME TIME STATISTICS.
+    std::sort(frame_times_in_milliseconds.begin(), frame_times_in_milliseconds.end());
+    result.MinFrameTimeInMilliseconds = frame_times_in_milliseconds.front();
+    result.MedianFrameTimeInMilliseconds = Percentile(frame_times_in_milliseconds, 50.0);
+    result.P99FrameTimeInMilliseconds = Percentile(frame_times_in_milliseconds, 99.0);
+    return result;
+}
+
+/// Formats benchmark results as JSON.
+/// @param[in]  results - The results to format.
+/// @param[in]  measured_frame_count - The number of timed frames for each result.
+/// @return The results as a JSON document.
+static std::string FormatJson(const std::vector<BenchmarkResult>& results, const unsigned int measured_frame_count)
+{
+    std::ostringstream json;
+    json.precision(6);
+    json << std::fixed;
+    json << "{\n";
+    json << "    \"benchmark\": \"scenes\",\n";
+    json << "    \"warm_up_frame_count\": " << WARM_UP_FRAME_COUNT << ",\n";
+    json << "    \"measured_frame_count\": " << measured_frame_count << ",\n";
+    json << "    \"results\":\n";
+    json << "    [\n";
+    for (std::size_t result_index = 0; result_index < results.size(); ++result_index)
+    {
+        const BenchmarkResult& result = results[result_index];
+        json << "        {";
+        json << " \"category\": \"" << result.Category << "\",";
+        json << " \"configuration\": \"" << result.Name << "\",";
+        json << " \"width\": " << result.WidthInPixels << ",";
+        json << " \"height\": " << result.HeightInPixels << ",";
+        json << " \"min_ms\": " << result.MinFrameTimeInMilliseconds << ",";
+        json << " \"median_ms\": " << result.MedianFrameTimeInMilliseconds << ",";
+        json << " \"p99_ms\": " << result.P99FrameTimeInMilliseconds << ",";
+        json << " \"image_checksum\": " << result.ImageChecksum << ",";
+        json << " \"deterministic\": " << (result.Deterministic ? "true" : "false");
+        json << " }" << ((result_index + 1 < results.size()) ? "," : "") << "\n";
+    }
+    json << "    ]\n";
+    json << "}\n";
+    return json.str();
+}
+
+/// Creates a configuration that rasterizes a single object.
+/// @param[in]  category - The category of the configuration.
+/// @param[in]  name - The name of the configuration.
+/// @param[in]  renderer - The renderer to use.
+/// @param[in]  object_3D - The object to render.
+/// @param[in]  lights - The lights illuminating the object.
+/// @return The rasterization configuration.
+static BenchmarkConfiguration CreateRasterizationConfiguration(
+    const std::string& category,
+    const std::string& name,
+    const std::shared_ptr<GRAPHICS::Renderer>& renderer,
+    const GRAPHICS::Object3D& object_3D,
+    const std::vector<GRAPHICS::Light>& lights)
+{
+    BenchmarkConfiguration configuration;
+    configuration.Category = category;
+    configuration.Name = name;
+    configuration.RenderFrame = [renderer, object_3D, lights](GRAPHICS::RenderTarget& render_target)
+    {
+        render_target.FillPixels(GRAPHICS::Color::BLACK);
+        renderer->Render(object_3D, lights, render_target);
+    };
+    return configuration;
+}
+
+/// The entry point for the benchmark.
+/// @param[in]  argument_count - The number of command line arguments.
+/// @param[in]  arguments - The command line arguments, with an optional output JSON filepath
+///     and optional number of timed frames after the program name.
+/// @return 0 if all configurations were benchmarked; 1 if any content couldn't be loaded.
+int main(int argument_count, char* arguments[])
+{
+    // READ THE COMMAND LINE ARGUMENTS.
+    unsigned int measured_frame_count = DEFAULT_MEASURED_FRAME_COUNT;
+    bool measured_frame_count_specified = (argument_count > 2);
+    if (measured_frame_count_specified)
+    {
+        measured_frame_count = static_cast<unsigned int>(std::max(1, std::atoi(arguments[2])));
+    }
+
+    // LOAD CONTENT SHARED WITH THE DEMO.
+    std::shared_ptr<GRAPHICS::Texture> texture = GRAPHICS::Texture::Load("../assets/test_texture1.bmp");
+    std::optional<GRAPHICS::Object3D> cube_from_file = GRAPHICS::MODELING::WavefrontObjectModel::Load("../assets/default_cube.obj");
+    bool content_loaded = (texture && cube_from_file);
+    if (!content_loaded)
+    {
+        std::cerr << "Failed to load assets.  Run from the build directory." << std::endl;
+        return EXIT_FAILURE;
+    }
+    std::array<std::shared_ptr<GRAPHICS::Material>, static_cast<std::size_t>(GRAPHICS::ShadingType::COUNT)> materials_by_shading_type =
+        GRAPHICS::ExampleMaterials::CreateForEachShadingType(texture);
+    std::vector< std::vector<GRAPHICS::Light> > light_configurations = GRAPHICS::ExampleLighting::CreateConfigurations();
+
+    std::vector<BenchmarkConfiguration> configurations;
+
+    // ADD CONFIGURATIONS FOR EACH RAY TRACING SCENE.
+    // The camera matches the initial camera in the demo.
+    for (unsigned int scene_number = 0; scene_number < GRAPHICS::RAY_TRACING::ExampleScenes::COUNT; ++scene_number)
+    {
+        std::shared_ptr<GRAPHICS::RAY_TRACING::Scene> scene = GRAPHICS::RAY_TRACING::ExampleScenes::Create(scene_number);
+        auto ray_tracer = std::make_shared<GRAPHICS::RAY_TRACING::RayTracingAlgorithm>();
+        ray_tracer->Camera = GRAPHICS::Camera::LookAtFrom(MATH::Vector3f(0.0f, 0.0f, 0.0f), MATH::Vector3f(0.0f, 0.0f, 1.0f));
+
+        BenchmarkConfiguration configuration;
+        configuration.Category = "ray_tracing";
+        configuration.Name = "scene_" + std::to_string(scene_number);
+        configuration.RenderFrame = [scene, ray_tracer](GRAPHICS::RenderTarget& render_target)
+        {
+            ray_tracer->Render(*scene, render_target);
+        };
+        configurations.push_back(configuration);
+    }
+
+    // ADD CONFIGURATIONS FOR RASTERIZING WITH EACH TYPE OF SHADING.
+    // The camera and object placement match the demo, except that rotation is fixed.
+    auto renderer = std::make_shared<GRAPHICS::Renderer>();
+    renderer->Camera = GRAPHICS::Camera::LookAtFrom(MATH::Vector3f(0.0f, 0.0f, 0.0f), MATH::Vector3f(0.0f, 0.0f, 100.0f));
+    auto place_object = [](GRAPHICS::Object3D& object_3D)
+    {
+        object_3D.RotationInRadians.X = MATH::Angle<float>::Radians(RASTERIZED_OBJECT_ROTATION_IN_RADIANS);
+        object_3D.RotationInRadians.Y = MATH::Angle<float>::Radians(RASTERIZED_OBJECT_ROTATION_IN_RADIANS);
+        object_3D.RotationInRadians.Z = MATH::Angle<float>::Radians(RASTERIZED_OBJECT_ROTATION_IN_RADIANS);
+    };
+    const std::vector<GRAPHICS::Light>& default_lights = light_configurations.at(DEFAULT_LIGHT_CONFIGURATION_INDEX);
+    for (std::size_t shading_index = 0; shading_index < materials_by_shading_type.size(); ++shading_index)
+    {
+        GRAPHICS::Object3D cube = GRAPHICS::Cube::Create(materials_by_shading_type[shading_index]);
+        cube.Scale = MATH::Vector3f(10.0f, 10.0f, 10.0f);
+        place_object(cube);
+        configurations.push_back(CreateRasterizationConfiguration(
+            "shading",
+            "cube_shading_" + std::to_string(shading_index),
+            renderer,
+            cube,
+            default_lights));
+    }
+
+    GRAPHICS::Object3D obj_cube = *cube_from_file;
+    place_object(obj_cube);
+    configurations.push_back(CreateRasterizationConfiguration("shading", "obj_cube", renderer, obj_cube, default_lights));
+
+    // ADD CONFIGURATIONS FOR RASTERIZING WITH EACH LIGHTING CONFIGURATION.
+    // Gouraud shading is used since it's affected by all types of lights.
+    GRAPHICS::Object3D lit_cube = GRAPHICS::Cube::Create(materials_by_shading_type[static_cast<std::size_t>(GRAPHICS::ShadingType::GOURAUD)]);
+    lit_cube.Scale = MATH::Vector3f(10.0f, 10.0f, 10.0f);
+    place_object(lit_cube);
+    for (std::size_t light_configuration_index = 0; light_configuration_index < light_configurations.size(); ++light_configuration_index)
+    {
+        configurations.push_back(CreateRasterizationConfiguration(
+            "lighting",
+            "cube_lighting_" + std::to_string(light_configuration_index),
+            renderer,
+            lit_cube,
+            light_configurations[light_configuration_index]));
+    }
+
+    // BENCHMARK EACH CONFIGURATION AT EACH RESOLUTION.
+    std::vector<BenchmarkResult> results;
+    for (const BenchmarkConfiguration& configuration : configurations)
+    {
+        for (const std::array<unsigned int, 2>& resolution : RESOLUTIONS)
+        {
+            std::cerr << configuration.Name << " at " << resolution[0] << "x" << resolution[1] << std::endl;
+            results.push_back(Benchmark(configuration, resolution[0], resolution[1], measured_frame_count));
+        }
+    }
+
+    // OUTPUT THE RESULTS.
+    std::string json = FormatJson(results, measured_frame_count);
+    std::cout << json;
+    bool output_filepath_specified = (argument_count > 1);
+    if (output_filepath_specified)
+    {
+        std::ofstream output_file(arguments[1]);
+        output_file << json;
+    }
+
+    return EXIT_SUCCESS;
+}
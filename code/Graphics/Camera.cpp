@@ -150,6 +150,42 @@ namespace GRAPHICS
         return camera;
     }
 
+    /// Equality operator.  Direct equality comparison is used for all parameters,
+    /// so any change to a camera (however small) makes it unequal to its previous state.
+    /// @param[in]  rhs - The camera on the right-hand side of the operator.
+    /// @return True if the cameras are equal; false otherwise.
+    bool Camera::operator==(const Camera& rhs) const
+    {
+        bool projections_match = (this->Projection == rhs.Projection);
+        bool positions_match = (this->WorldPosition == rhs.WorldPosition);
+        bool coordinate_frames_match = (
+            (this->CoordinateFrame.Up == rhs.CoordinateFrame.Up) &&
+            (this->CoordinateFrame.Right == rhs.CoordinateFrame.Right) &&
+            (this->CoordinateFrame.Forward == rhs.CoordinateFrame.Forward));
+        bool fields_of_view_match = (this->FieldOfView == rhs.FieldOfView);
+        bool viewing_planes_match = (
+            (this->ViewingPlane.FocalLength == rhs.ViewingPlane.FocalLength) &&
+            (this->ViewingPlane.Width == rhs.ViewingPlane.Width) &&
+            (this->ViewingPlane.Height == rhs.ViewingPlane.Height));
+
+        bool cameras_match = (
+            projections_match &&
+            positions_match &&
+            coordinate_frames_match &&
+            fields_of_view_match &&
+            viewing_planes_match);
+        return cameras_match;
+    }
+
+    /// Inequality operator.
+    /// @param[in]  rhs - The camera on the right-hand side of the operator.
+    /// @return True if the cameras are unequal; false otherwise.
+    bool Camera::operator!=(const Camera& rhs) const
+    {
+        bool cameras_match = (*this == rhs);
+        return !cameras_match;
+    }
+
     /// Computes the view transformation of the camera to transform
     /// world space coordinates to camera space coordinates.
     /// @return The view transformation matrix for the camera.
@@ -190,14 +226,38 @@ namespace GRAPHICS
         const MATH::Vector2ui& pixel_coordinates,
         const RenderTarget& render_target) const
     {
-        // CONVERT THE PIXEL COORDINATES TO THE RANGE OF THE VIEWING PLANE.
-        // In order to convert the current pixel coordinate to proper coordinates for the viewing ray,
+        // COMPUTE THE RAY THROUGH THE CENTER OF THE PIXEL.
+        // Each pixel may be thought of as a box.  For most consistent rendering,
+        // the ray should go through the center of each pixel.
+        constexpr float OFFSET_TO_CENTER_OF_PIXEL = 0.5f;
+        MATH::Vector2f pixel_center(
+            pixel_coordinates.X + OFFSET_TO_CENTER_OF_PIXEL,
+            pixel_coordinates.Y + OFFSET_TO_CENTER_OF_PIXEL);
+        RAY_TRACING::Ray ray = ViewingRay(pixel_center, render_target);
+        return ray;
+    }
+
+    /// Computes a viewing ray coming from this camera through an arbitrary position on the screen.
+    /// Unlike using integral pixel coordinates, this allows rays through any part of a pixel
+    /// (for example, for multiple samples per pixel).
+    /// @param[in]  screen_position - The continuous position on the render target through which to
+    ///     compute the viewing ray.  Pixel (x, y) covers positions from (x, y) up to (x + 1, y + 1),
+    ///     so its center is at (x + 0.5, y + 0.5).
+    /// @param[in]  render_target - The render target for which the viewing ray is to
+    ///     be computed.
+    /// @return The viewing ray from the camera through the specified position;
+    ///     the exact ray will vary depending on the type of projection this camera
+    ///     is using.
+    RAY_TRACING::Ray Camera::ViewingRay(
+        const MATH::Vector2f& screen_position,
+        const RenderTarget& render_target) const
+    {
+        // CONVERT THE SCREEN POSITION TO THE RANGE OF THE VIEWING PLANE.
+        // In order to convert the current screen position to proper coordinates for the viewing ray,
         // several transformations are needed to convert from a [0, pixel dimension] range to
         // a range for the viewing plane:
-        // 1. Each pixel may be thought of as a box.  For most consistent rendering,
-        //      the ray should go through the center of each pixel.
-        constexpr float OFFSET_TO_CENTER_OF_PIXEL = 0.5f;
-        float x_pixel_center = pixel_coordinates.X + OFFSET_TO_CENTER_OF_PIXEL;
+        // 1. The screen position is used directly (already being at any pixel centers if desired).
+        float x_pixel_center = screen_position.X;
         // 2. Shift the coordinates down so that the minimum coordinates are negative.
         //      By doing this by the half-width of the render target, this means the
         //      new center will correspond with the center of the render target.
@@ -213,7 +273,7 @@ namespace GRAPHICS
         // the y coordinate must be flipped.
         unsigned int render_target_height_in_pixels = render_target.GetHeightInPixels();
         float render_target_half_height_in_pixels = render_target_height_in_pixels / 2.0f;
-        float y_pixel_center = pixel_coordinates.Y + OFFSET_TO_CENTER_OF_PIXEL;
+        float y_pixel_center = screen_position.Y;
         float y_shifted_down = (y_pixel_center - render_target_half_height_in_pixels);
         float y_scaled_to_viewing_plane_range = y_shifted_down * ViewingPlane.Height / render_target_height_in_pixels;
         constexpr float FLIP_Y = -1.0f;
@@ -273,4 +333,76 @@ namespace GRAPHICS
             return orthographic_ray;
         }
     }
+
+    /// Computes where a world position appears on the screen.
+    /// This is the inverse of \ref ViewingRay, so the viewing ray through the returned
+    /// screen position passes through the world position.
+    /// @param[in]  world_position - The world position to project onto the screen.
+    /// @param[in]  render_target - The render target defining the screen dimensions.
+    /// @return The screen position (in pixels, possibly outside of the render target) of the world position;
+    ///     null if the world position is not in front of the camera.
+    std::optional<MATH::Vector2f> Camera::ScreenPosition(
+        const MATH::Vector3f& world_position,
+        const RenderTarget& render_target) const
+    {
+        // EXPRESS THE POSITION IN THE CAMERA'S COORDINATE FRAME.
+        // The right direction is perpendicular to both the up and forward directions, but the up and forward
+        // directions aren't necessarily perpendicular to each other (see \ref LookAtFrom), so the up and forward
+        // components must be solved for together to exactly undo the combination in \ref ViewingRay.
+        MATH::Vector3f camera_to_position = world_position - WorldPosition;
+        float right_distance = MATH::Vector3f::DotProduct(camera_to_position, CoordinateFrame.Right);
+        float projected_up_distance = MATH::Vector3f::DotProduct(camera_to_position, CoordinateFrame.Up);
+        float projected_forward_distance = MATH::Vector3f::DotProduct(camera_to_position, CoordinateFrame.Forward);
+        float up_forward_cosine = MATH::Vector3f::DotProduct(CoordinateFrame.Up, CoordinateFrame.Forward);
+        float up_forward_sine_squared = 1.0f - (up_forward_cosine * up_forward_cosine);
+        float up_distance = (projected_up_distance - up_forward_cosine * projected_forward_distance) / up_forward_sine_squared;
+        float forward_distance = (projected_forward_distance - up_forward_cosine * projected_up_distance) / up_forward_sine_squared;
+        // The camera looks along its negative forward direction.
+        float view_distance = -forward_distance;
+
+        // COMPUTE THE POSITION ON THE VIEWING PLANE ACCORDING TO THE TYPE OF PROJECTION.
+        float x_scaled_to_viewing_plane_range = 0.0f;
+        float y_scaled_to_viewing_plane_range = 0.0f;
+        bool using_perspective_projection = (ProjectionType::PERSPECTIVE == Projection);
+        if (using_perspective_projection)
+        {
+            // CHECK IF THE POSITION IS IN FRONT OF THE CAMERA.
+            bool position_in_front_of_camera = (view_distance > 0.0f);
+            if (!position_in_front_of_camera)
+            {
+                return std::nullopt;
+            }
+
+            // UNDO THE PERSPECTIVE DIVISION AND SCALING.
+            MATH::Angle<float>::Radians camera_field_of_view_in_radians = MATH::Angle<float>::DegreesToRadians(FieldOfView);
+            float half_field_of_view_in_radians = camera_field_of_view_in_radians.Value / 2.0f;
+            float ratio_between_camera_view_dimensions_and_distance_from_viewing_plane = std::tan(half_field_of_view_in_radians);
+            float projection_scale = ViewingPlane.FocalLength / (view_distance * ratio_between_camera_view_dimensions_and_distance_from_viewing_plane);
+            x_scaled_to_viewing_plane_range = right_distance * projection_scale;
+            y_scaled_to_viewing_plane_range = up_distance * projection_scale;
+        }
+        else
+        {
+            // CHECK IF THE POSITION IS IN FRONT OF THE VIEWING PLANE.
+            // Orthographic viewing rays start on the viewing plane.
+            bool position_in_front_of_viewing_plane = (view_distance >= ViewingPlane.FocalLength);
+            if (!position_in_front_of_viewing_plane)
+            {
+                return std::nullopt;
+            }
+
+            x_scaled_to_viewing_plane_range = right_distance;
+            y_scaled_to_viewing_plane_range = up_distance;
+        }
+
+        // CONVERT FROM THE VIEWING PLANE RANGE TO THE PIXEL RANGE OF THE RENDER TARGET.
+        // The y coordinate is flipped since y increases going down the render target.
+        float render_target_width_in_pixels = static_cast<float>(render_target.GetWidthInPixels());
+        float render_target_height_in_pixels = static_cast<float>(render_target.GetHeightInPixels());
+        constexpr float FLIP_Y = -1.0f;
+        MATH::Vector2f screen_position(
+            (x_scaled_to_viewing_plane_range * render_target_width_in_pixels / ViewingPlane.Width) + (render_target_width_in_pixels / 2.0f),
+            (FLIP_Y * y_scaled_to_viewing_plane_range * render_target_height_in_pixels / ViewingPlane.Height) + (render_target_height_in_pixels / 2.0f));
+        return screen_position;
+    }
 }
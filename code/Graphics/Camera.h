@@ -1,5 +1,6 @@
 #pragma once
 
+#include <optional>
 #include "Graphics/ProjectionType.h"
 #include "Graphics/RayTracing/Ray.h"
 #include "Graphics/RenderTarget.h"
@@ -34,6 +35,10 @@ namespace GRAPHICS
         static Camera LookAt(const MATH::Vector3f& look_at_world_position);  
         static Camera LookAtFrom(const MATH::Vector3f& look_at_world_position, const MATH::Vector3f& camera_world_position);
 
+        // OPERATORS.
+        bool operator==(const Camera& rhs) const;
+        bool operator!=(const Camera& rhs) const;
+
         // TRANSFORM METHODS.
         MATH::Matrix4x4f ViewTransform() const;
 
@@ -41,6 +46,12 @@ namespace GRAPHICS
         RAY_TRACING::Ray ViewingRay(
             const MATH::Vector2ui& pixel_coordinates,
             const RenderTarget& render_target) const;
+        RAY_TRACING::Ray ViewingRay(
+            const MATH::Vector2f& screen_position,
+            const RenderTarget& render_target) const;
+        std::optional<MATH::Vector2f> ScreenPosition(
+            const MATH::Vector3f& world_position,
+            const RenderTarget& render_target) const;
 
         // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
         /// The type of projection the camera is currently using.
@@ -0,0 +1,188 @@
+#include "Graphics/ExampleLighting.h"
+
+namespace GRAPHICS
+{
+    /// Creates the example lighting configurations.
+    /// @return Each of the example lighting configurations, with the lights for each configuration.
+    std::vector< std::vector<Light> > ExampleLighting::CreateConfigurations()
+    {
+        std::vector< std::vector<Light> > light_configurations =
+        {
+            // Full white ambient light.
+            std::vector<GRAPHICS::Light>
+            {
+                GRAPHICS::Light
+                {
+                    .Type = GRAPHICS::LightType::AMBIENT,
+                    .Color = GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f),
+                },
+            },
+            // Half strength ambient light.
+            std::vector<GRAPHICS::Light>
+            {
+                GRAPHICS::Light
+                {
+                    .Type = GRAPHICS::LightType::AMBIENT,
+                    .Color = GRAPHICS::Color(0.5f, 0.5f, 0.5f, 1.0f)
+                },
+            },
+            // Pitch-black ambient lighting.
+            std::vector<GRAPHICS::Light>
+            {
+                GRAPHICS::Light
+                {
+                    .Type = GRAPHICS::LightType::AMBIENT,
+                    .Color = GRAPHICS::Color(0.0f, 0.0f, 0.0f, 1.0f)
+                },
+            },
+            // Red ambient light.
+            std::vector<GRAPHICS::Light>
+            {
+                GRAPHICS::Light
+                {
+                    .Type = GRAPHICS::LightType::AMBIENT,
+                    .Color = GRAPHICS::Color(1.0f, 0.0f, 0.0f, 1.0f)
+                },
+            },
+            // Green ambient light.
+            std::vector<GRAPHICS::Light>
+            {
+                GRAPHICS::Light
+                {
+                    .Type = GRAPHICS::LightType::AMBIENT,
+                    .Color = GRAPHICS::Color(0.0f, 1.0f, 0.0f, 1.0f)
+                },
+            },
+            // Blue ambient light.
+            std::vector<GRAPHICS::Light>
+            {
+                GRAPHICS::Light
+                {
+                    .Type = GRAPHICS::LightType::AMBIENT,
+                    .Color = GRAPHICS::Color(0.0f, 0.0f, 1.0f, 1.0f)
+                },
+            },
+            // White directional light going left.
+            std::vector<GRAPHICS::Light>
+            {
+                GRAPHICS::Light
+                {
+                    .Type = GRAPHICS::LightType::DIRECTIONAL,
+                    .Color = GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f),
+                    .DirectionalLightDirection = MATH::Vector3f(-1.0f, 0.0f, 0.0f)
+                },
+            },
+            // White directional light going right.
+            std::vector<GRAPHICS::Light>
+            {
+                GRAPHICS::Light
+                {
+                    .Type = GRAPHICS::LightType::DIRECTIONAL,
+                    .Color = GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f),
+                    .DirectionalLightDirection = MATH::Vector3f(1.0f, 0.0f, 0.0f)
+                },
+            },
+            // White directional light going down.
+            std::vector<GRAPHICS::Light>
+            {
+                GRAPHICS::Light
+                {
+                    .Type = GRAPHICS::LightType::DIRECTIONAL,
+                    .Color = GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f),
+                    .DirectionalLightDirection = MATH::Vector3f(0.0f, -1.0f, 0.0f)
+                },
+            },
+            // White directional light going up.
+            std::vector<GRAPHICS::Light>
+            {
+                GRAPHICS::Light
+                {
+                    .Type = GRAPHICS::LightType::DIRECTIONAL,
+                    .Color = GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f),
+                    .DirectionalLightDirection = MATH::Vector3f(0.0f, 1.0f, 0.0f)
+                },
+            },
+            // Red directional light at an angle.
+            std::vector<GRAPHICS::Light>
+            {
+                GRAPHICS::Light
+                {
+                    .Type = GRAPHICS::LightType::DIRECTIONAL,
+                    .Color = GRAPHICS::Color(1.0f, 0.0f, 0.0f, 1.0f),
+                    .DirectionalLightDirection = MATH::Vector3f::Normalize(MATH::Vector3f(1.0f, 1.0f, 0.0f))
+                },
+            },
+            // Green directional light at an angle.
+            std::vector<GRAPHICS::Light>
+            {
+                GRAPHICS::Light
+                {
+                    .Type = GRAPHICS::LightType::DIRECTIONAL,
+                    .Color = GRAPHICS::Color(0.0f, 1.0f, 0.0f, 1.0f),
+                    .DirectionalLightDirection = MATH::Vector3f::Normalize(MATH::Vector3f(0.0f, 1.0f, 1.0f))
+                },
+            },
+            // Blue directional light at an angle.
+            std::vector<GRAPHICS::Light>
+            {
+                GRAPHICS::Light
+                {
+                    .Type = GRAPHICS::LightType::DIRECTIONAL,
+                    .Color = GRAPHICS::Color(0.0f, 0.0f, 1.0f, 1.0f),
+                    .DirectionalLightDirection = MATH::Vector3f::Normalize(MATH::Vector3f(1.0f, 0.0f, 1.0f))
+                },
+            },
+            // White point light at center.
+            std::vector<GRAPHICS::Light>
+            {
+                GRAPHICS::Light
+                {
+                    .Type = GRAPHICS::LightType::POINT,
+                    .Color = GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f),
+                    .PointLightWorldPosition = MATH::Vector3f(0.0f, 0.0f, 0.0f)
+                },
+            },
+            // Red-green light at left.
+            std::vector<GRAPHICS::Light>
+            {
+                GRAPHICS::Light
+                {
+                    .Type = GRAPHICS::LightType::POINT,
+                    .Color = GRAPHICS::Color(1.0f, 1.0f, 0.0f, 1.0f),
+                    .PointLightWorldPosition = MATH::Vector3f(-50.0f, 0.0f, 0.0f)
+                },
+            },
+            // Green-blue light at right.
+            std::vector<GRAPHICS::Light>
+            {
+                GRAPHICS::Light
+                {
+                    .Type = GRAPHICS::LightType::POINT,
+                    .Color = GRAPHICS::Color(0.0f, 1.0f, 1.0f, 1.0f),
+                    .PointLightWorldPosition = MATH::Vector3f(50.0f, 0.0f, 0.0f)
+                },
+            },
+            // Blue-red light at top.
+            std::vector<GRAPHICS::Light>
+            {
+                GRAPHICS::Light
+                {
+                    .Type = GRAPHICS::LightType::POINT,
+                    .Color = GRAPHICS::Color(1.0f, 0.0f, 1.0f, 1.0f),
+                    .PointLightWorldPosition = MATH::Vector3f(0.0f, 50.0f, 0.0f)
+                },
+            },
+            // Green-blue light at bottom.
+            std::vector<GRAPHICS::Light>
+            {
+                GRAPHICS::Light
+                {
+                    .Type = GRAPHICS::LightType::POINT,
+                    .Color = GRAPHICS::Color(0.0f, 1.0f, 1.0f, 1.0f),
+                    .PointLightWorldPosition = MATH::Vector3f(0.0f, -50.0f, 0.0f)
+                },
+            },
+        };
+        return light_configurations;
+    }
+}
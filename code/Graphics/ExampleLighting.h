@@ -0,0 +1,15 @@
+#pragma once
+
+#include <vector>
+#include "Graphics/Light.h"
+
+namespace GRAPHICS
+{
+    /// The lighting configurations that the demo cycles through when rasterizing.
+    class ExampleLighting
+    {
+    public:
+        // CONSTRUCTION.
+        static std::vector< std::vector<Light> > CreateConfigurations();
+    };
+}
@@ -0,0 +1,83 @@
+#include "Graphics/ExampleMaterials.h"
+
+namespace GRAPHICS
+{
+    /// Creates an example material for each type of shading.
+    /// @param[in]  texture - The texture for the textured material.
+    /// @return An example material for each type of shading, indexed by shading type.
+    std::array<std::shared_ptr<Material>, static_cast<std::size_t>(ShadingType::COUNT)> ExampleMaterials::CreateForEachShadingType(
+        const std::shared_ptr<Texture>& texture)
+    {
+        std::array<std::shared_ptr<Material>, static_cast<std::size_t>(ShadingType::COUNT)> materials_by_shading_type =
+        {
+            std::make_shared<GRAPHICS::Material>(GRAPHICS::Material
+            {
+                .Shading = GRAPHICS::ShadingType::WIREFRAME,
+                .WireframeColor = GRAPHICS::Color::GREEN
+            }),
+            std::make_shared<GRAPHICS::Material>(GRAPHICS::Material
+            {
+                .Shading = GRAPHICS::ShadingType::WIREFRAME_VERTEX_COLOR_INTERPOLATION,
+                .VertexWireframeColors =
+                {
+                    GRAPHICS::Color::RED,
+                    GRAPHICS::Color::GREEN,
+                    GRAPHICS::Color::BLUE,
+                }
+            }),
+            std::make_shared<GRAPHICS::Material>(GRAPHICS::Material
+            {
+                .Shading = GRAPHICS::ShadingType::FLAT,
+                .FaceColor = GRAPHICS::Color::BLUE
+            }),
+            std::make_shared<GRAPHICS::Material>(GRAPHICS::Material
+            {
+                .Shading = GRAPHICS::ShadingType::FACE_VERTEX_COLOR_INTERPOLATION,
+                .VertexFaceColors =
+                {
+                    GRAPHICS::Color(1.0f, 0.0f, 0.0f, 1.0f),
+                    GRAPHICS::Color(0.0f, 1.0f, 0.0f, 1.0f),
+                    GRAPHICS::Color(0.0f, 0.0f, 1.0f, 1.0f),
+                }
+            }),
+            std::make_shared<GRAPHICS::Material>(GRAPHICS::Material
+            {
+                .Shading = GRAPHICS::ShadingType::GOURAUD,
+                .VertexColors =
+                {
+                    // Basic grayscale.
+                    GRAPHICS::Color(0.5f, 0.5f, 0.5f, 1.0f),
+                    GRAPHICS::Color(0.5f, 0.5f, 0.5f, 1.0f),
+                    GRAPHICS::Color(0.5f, 0.5f, 0.5f, 1.0f),
+                },
+                .SpecularPower = 20.0f
+            }),
+            std::make_shared<GRAPHICS::Material>(GRAPHICS::Material
+            {
+                .Shading = GRAPHICS::ShadingType::TEXTURED,
+                .VertexColors =
+                {
+                    GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f),
+                    GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f),
+                    GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f),
+                },
+                .Texture = texture,
+                .VertexTextureCoordinates =
+                {
+                    MATH::Vector2f(0.0f, 0.0f),
+                    MATH::Vector2f(1.0f, 0.0f),
+                    MATH::Vector2f(0.0f, 1.0f)
+                }
+            }),
+            std::make_shared<GRAPHICS::Material>(GRAPHICS::Material
+            {
+                .Shading = GRAPHICS::ShadingType::MATERIAL,
+                .AmbientColor = GRAPHICS::Color(0.2f, 0.2f, 0.2f, 1.0f),
+                .DiffuseColor = GRAPHICS::Color(0.8f, 0.8f, 0.8f, 1.0f),
+                .SpecularColor = GRAPHICS::Color(0.5f, 0.5f, 0.5f, 1.0f),
+                .SpecularPower = 20.0f
+            })
+        };
+        return materials_by_shading_type;
+    }
+}
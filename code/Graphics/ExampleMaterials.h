@@ -0,0 +1,19 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include "Graphics/Material.h"
+#include "Graphics/Texture.h"
+
+namespace GRAPHICS
+{
+    /// A material for each kind of shading, as cycled through in the demo.
+    class ExampleMaterials
+    {
+    public:
+        // CONSTRUCTION.
+        static std::array<std::shared_ptr<Material>, static_cast<std::size_t>(ShadingType::COUNT)> CreateForEachShadingType(
+            const std::shared_ptr<Texture>& texture);
+    };
+}
@@ -73,6 +73,9 @@ namespace GRAPHICS
         float ReflectivityProportion = 0.0f;
         /// The emissive color if the material emits light.
         Color EmissiveColor = Color::BLACK;
+        /// True if surfaces with this material block light (cast shadows); false otherwise.
+        /// Useful for things like glass or decals that shouldn't darken what's behind them.
+        bool CastsShadows = true;
 
         /// Any texture defining the look of the material.
         std::shared_ptr<Texture> Texture = nullptr;
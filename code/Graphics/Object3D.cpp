@@ -13,4 +13,31 @@ namespace GRAPHICS
         MATH::Matrix4x4f world_transform = translation_matrix * rotation_matrix * scale_matrix;
         return world_transform;
     }
+
+    /// Gets the inverse of the world transformation matrix of the object,
+    /// which transforms from world space back into the local coordinate space of the object.
+    /// Computed directly from the individual transformations rather than by inverting a general matrix.
+    /// The scale must be non-zero along all axes for the inverse to exist.
+    /// @return The object's inverse world transform.
+    MATH::Matrix4x4f Object3D::InverseWorldTransform() const
+    {
+        // INVERT EACH INDIVIDUAL TRANSFORMATION.
+        MATH::Matrix4x4f inverse_translation_matrix = MATH::Matrix4x4f::Translation(-WorldPosition);
+        MATH::Matrix4x4f inverse_x_rotation_matrix = MATH::Matrix4x4f::RotateX(MATH::Angle<float>::Radians(-RotationInRadians.X.Value));
+        MATH::Matrix4x4f inverse_y_rotation_matrix = MATH::Matrix4x4f::RotateY(MATH::Angle<float>::Radians(-RotationInRadians.Y.Value));
+        MATH::Matrix4x4f inverse_z_rotation_matrix = MATH::Matrix4x4f::RotateZ(MATH::Angle<float>::Radians(-RotationInRadians.Z.Value));
+        MATH::Vector3f inverse_scale(1.0f / Scale.X, 1.0f / Scale.Y, 1.0f / Scale.Z);
+        MATH::Matrix4x4f inverse_scale_matrix = MATH::Matrix4x4f::Scale(inverse_scale);
+
+        // COMBINE THE INVERSES IN REVERSE ORDER.
+        // Since the world transform is T * Rx * Ry * Rz * S,
+        // its inverse is S^-1 * Rz^-1 * Ry^-1 * Rx^-1 * T^-1.
+        MATH::Matrix4x4f inverse_world_transform = 
+            inverse_scale_matrix * 
+            inverse_z_rotation_matrix * 
+            inverse_y_rotation_matrix * 
+            inverse_x_rotation_matrix * 
+            inverse_translation_matrix;
+        return inverse_world_transform;
+    }
 }
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <memory>
 #include <vector>
+#include "Graphics/Texture.h"
 #include "Graphics/Triangle.h"
 #include "Math/Angle.h"
 #include "Math/Matrix4x4.h"
@@ -14,6 +16,7 @@ namespace GRAPHICS
     public:
         // METHODS.
         MATH::Matrix4x4f WorldTransform() const;
+        MATH::Matrix4x4f InverseWorldTransform() const;
 
         // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
         /// The triangles of the object, in the local coordinate space of the object.
@@ -24,5 +27,11 @@ namespace GRAPHICS
         MATH::Vector3< MATH::Angle<float>::Radians > RotationInRadians = MATH::Vector3< MATH::Angle<float>::Radians >();
         /// The scaling of the object.  Defaults to no scaling (using the size of the triangles exactly).
         MATH::Vector3f Scale = MATH::Vector3f(1.0f, 1.0f, 1.0f);
+        /// Any precomputed lighting for the object, indexed by each triangle's lightmap texture coordinates
+        /// (typically baked with a \ref RAY_TRACING::LightmapBaker).  If present, the lightmap is used instead of
+        /// evaluating diffuse light from directional and point lights when rendering, so that light should be static.
+        /// Ambient light (reduced by any ambient occlusion baked for vertices) and specular highlights are
+        /// still evaluated for each vertex.
+        std::shared_ptr<Texture> Lightmap = nullptr;
     };
 }
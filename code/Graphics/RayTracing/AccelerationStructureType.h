@@ -0,0 +1,20 @@
+#pragma once
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// The different structures that can be used to speed up finding which objects in a scene a ray may hit.
+    enum class AccelerationStructureType
+    {
+        /// The structure is chosen based on how many objects exist and how many move between updates.
+        AUTOMATIC = 0,
+        /// A bounding volume hierarchy, which is the most efficient for tracing rays but more
+        /// expensive to build.  Best for static scenes or scenes where only a few objects move.
+        BOUNDING_VOLUME_HIERARCHY,
+        /// A uniform grid, which is cheap enough to rebuild from scratch every frame.
+        /// Best for scenes with many similarly sized objects that all move (like particles).
+        UNIFORM_GRID
+    };
+}
+}
@@ -0,0 +1,188 @@
+#include <algorithm>
+#include <limits>
+#include "Graphics/RayTracing/AccumulationBuffer.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// Computes the perceived brightness of some radiance.
+    /// @param[in]  radiance - The radiance, as (red, green, blue).
+    /// @return The luminance of the radiance, using Rec. 709 weights.
+    float AccumulationBuffer::Luminance(const MATH::Vector3f& radiance)
+    {
+        float luminance = (0.2126f * radiance.X) + (0.7152f * radiance.Y) + (0.0722f * radiance.Z);
+        return luminance;
+    }
+
+    /// Constructor for an empty buffer.
+    /// @param[in]  width_in_pixels - The width of the buffer.
+    /// @param[in]  height_in_pixels - The height of the buffer.
+    AccumulationBuffer::AccumulationBuffer(const unsigned int width_in_pixels, const unsigned int height_in_pixels) :
+        Pixels(width_in_pixels, height_in_pixels)
+    {}
+
+    /// Gets the width of the buffer.
+    /// @return The width of the buffer in pixels.
+    unsigned int AccumulationBuffer::GetWidthInPixels() const
+    {
+        return Pixels.GetWidth();
+    }
+
+    /// Gets the height of the buffer.
+    /// @return The height of the buffer in pixels.
+    unsigned int AccumulationBuffer::GetHeightInPixels() const
+    {
+        return Pixels.GetHeight();
+    }
+
+    /// Adds a sample to a pixel.
+    /// @param[in]  x - The x coordinate of the pixel.
+    /// @param[in]  y - The y coordinate of the pixel.
+    /// @param[in]  radiance - The radiance of the sample, as (red, green, blue).
+    /// @param[in]  features - The surface features seen by the sample.
+    void AccumulationBuffer::AddSample(
+        const unsigned int x,
+        const unsigned int y,
+        const MATH::Vector3f& radiance,
+        const SurfaceFeatures& features)
+    {
+        Pixel& pixel = Pixels(x, y);
+        pixel.RadianceSum += radiance;
+        float luminance = Luminance(radiance);
+        pixel.LuminanceSum += luminance;
+        pixel.SquaredLuminanceSum += luminance * luminance;
+        pixel.FeatureSum.Albedo += features.Albedo;
+        pixel.FeatureSum.Normal += features.Normal;
+        pixel.FeatureSum.Depth += features.Depth;
+        ++pixel.SampleCount;
+    }
+
+    /// Gets the average radiance of all samples for a pixel.
+    /// @param[in]  x - The x coordinate of the pixel.
+    /// @param[in]  y - The y coordinate of the pixel.
+    /// @return The average radiance, as (red, green, blue); zero if the pixel has no samples.
+    MATH::Vector3f AccumulationBuffer::MeanRadiance(const unsigned int x, const unsigned int y) const
+    {
+        const Pixel& pixel = Pixels(x, y);
+        if (0 == pixel.SampleCount)
+        {
+            return MATH::Vector3f();
+        }
+
+        float inverse_sample_count = 1.0f / static_cast<float>(pixel.SampleCount);
+        MATH::Vector3f mean_radiance = MATH::Vector3f::Scale(inverse_sample_count, pixel.RadianceSum);
+        return mean_radiance;
+    }
+
+    /// Gets the average surface features of all samples for a pixel.
+    /// @param[in]  x - The x coordinate of the pixel.
+    /// @param[in]  y - The y coordinate of the pixel.
+    /// @return The average features; all zero if the pixel has no samples.
+    SurfaceFeatures AccumulationBuffer::MeanFeatures(const unsigned int x, const unsigned int y) const
+    {
+        const Pixel& pixel = Pixels(x, y);
+        if (0 == pixel.SampleCount)
+        {
+            return SurfaceFeatures();
+        }
+
+        float inverse_sample_count = 1.0f / static_cast<float>(pixel.SampleCount);
+        SurfaceFeatures mean_features;
+        mean_features.Albedo = MATH::Vector3f::Scale(inverse_sample_count, pixel.FeatureSum.Albedo);
+        mean_features.Normal = MATH::Vector3f::Scale(inverse_sample_count, pixel.FeatureSum.Normal);
+        mean_features.Depth = inverse_sample_count * pixel.FeatureSum.Depth;
+        return mean_features;
+    }
+
+    /// Estimates how much a pixel's average luminance may still differ from its true luminance.
+    /// This is the sample variance of the pixel's luminance divided by the number of samples,
+    /// so it shrinks as more samples are taken.
+    /// @param[in]  x - The x coordinate of the pixel.
+    /// @param[in]  y - The y coordinate of the pixel.
+    /// @return The estimated variance of the pixel's average luminance;
+    ///     infinite if there are too few samples to estimate it.
+    float AccumulationBuffer::VarianceOfMean(const unsigned int x, const unsigned int y) const
+    {
+        // MAKE SURE THERE ARE ENOUGH SAMPLES TO ESTIMATE VARIANCE.
+        const Pixel& pixel = Pixels(x, y);
+        constexpr unsigned int MIN_SAMPLE_COUNT_FOR_VARIANCE = 2;
+        if (pixel.SampleCount < MIN_SAMPLE_COUNT_FOR_VARIANCE)
+        {
+            return std::numeric_limits<float>::infinity();
+        }
+
+        // COMPUTE THE UNBIASED SAMPLE VARIANCE.
+        // Rounding may make the variance slightly negative when all samples are nearly equal.
+        float sample_count = static_cast<float>(pixel.SampleCount);
+        float mean_luminance = pixel.LuminanceSum / sample_count;
+        float sum_of_squared_differences = pixel.SquaredLuminanceSum - (sample_count * mean_luminance * mean_luminance);
+        float sample_variance = std::max(0.0f, sum_of_squared_differences / (sample_count - 1.0f));
+
+        float variance_of_mean = sample_variance / sample_count;
+        return variance_of_mean;
+    }
+
+    /// Computes the average of \ref VarianceOfMean over all pixels in a tile.
+    /// @param[in]  tile - The tile of pixels.
+    /// @return The average variance of the tile's pixels.
+    float AccumulationBuffer::AverageVarianceOfMean(const ScreenTile& tile) const
+    {
+        float total_variance = 0.0f;
+        unsigned int tile_end_x = tile.LeftX + tile.WidthInPixels;
+        unsigned int tile_end_y = tile.TopY + tile.HeightInPixels;
+        for (unsigned int y = tile.TopY; y < tile_end_y; ++y)
+        {
+            for (unsigned int x = tile.LeftX; x < tile_end_x; ++x)
+            {
+                total_variance += VarianceOfMean(x, y);
+            }
+        }
+
+        float average_variance = total_variance / static_cast<float>(tile.PixelCount());
+        return average_variance;
+    }
+
+    /// Gets the fewest samples any pixel in a tile has.
+    /// @param[in]  tile - The tile of pixels.
+    /// @return The minimum sample count among the tile's pixels.
+    unsigned int AccumulationBuffer::MinSampleCount(const ScreenTile& tile) const
+    {
+        unsigned int min_sample_count = std::numeric_limits<unsigned int>::max();
+        unsigned int tile_end_x = tile.LeftX + tile.WidthInPixels;
+        unsigned int tile_end_y = tile.TopY + tile.HeightInPixels;
+        for (unsigned int y = tile.TopY; y < tile_end_y; ++y)
+        {
+            for (unsigned int x = tile.LeftX; x < tile_end_x; ++x)
+            {
+                min_sample_count = std::min(min_sample_count, Pixels(x, y).SampleCount);
+            }
+        }
+        return min_sample_count;
+    }
+
+    /// Converts the average radiance of each pixel to a color in a render target.
+    /// Radiance is simply clamped to the displayable range.  Pixels without any samples are left unchanged.
+    /// @param[in,out]  render_target - The render target to write to.  Must have the same dimensions as the buffer.
+    void AccumulationBuffer::ResolveTo(GRAPHICS::RenderTarget& render_target) const
+    {
+        unsigned int width_in_pixels = GetWidthInPixels();
+        unsigned int height_in_pixels = GetHeightInPixels();
+        for (unsigned int y = 0; y < height_in_pixels; ++y)
+        {
+            for (unsigned int x = 0; x < width_in_pixels; ++x)
+            {
+                if (0 == Pixels(x, y).SampleCount)
+                {
+                    continue;
+                }
+
+                MATH::Vector3f mean_radiance = MeanRadiance(x, y);
+                Color color(mean_radiance.X, mean_radiance.Y, mean_radiance.Z, Color::MAX_FLOAT_COLOR_COMPONENT);
+                color.Clamp();
+                render_target.WritePixel(x, y, color);
+            }
+        }
+    }
+}
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "Containers/Array2D.h"
+#include "Graphics/RayTracing/ScreenTile.h"
+#include "Graphics/RayTracing/SurfaceFeatures.h"
+#include "Graphics/RenderTarget.h"
+#include "Math/Vector3.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// A high dynamic range buffer that accumulates many samples per pixel, for progressive rendering
+    /// with techniques like path tracing where each sample is just a noisy estimate of a pixel's color.
+    /// Radiance is stored as unclamped floating-point (red, green, blue) sums so that bright samples
+    /// aren't lost before averaging, and the averaged image is only converted to (clamped) colors
+    /// in a render target when requested.
+    ///
+    /// The spread of each pixel's samples is also tracked so that regions of the image that have
+    /// converged can be detected and skipped, and the surface features seen by each sample are
+    /// averaged to guide denoising.
+    ///
+    /// Different pixels may be updated concurrently from different threads, but each pixel must
+    /// only be updated by a single thread at a time.
+    class AccumulationBuffer
+    {
+    public:
+        /// The samples accumulated for a single pixel.
+        class Pixel
+        {
+        public:
+            // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+            /// The sum of all samples' radiance, as (red, green, blue).
+            MATH::Vector3f RadianceSum = MATH::Vector3f();
+            /// The sum of all samples' luminance.
+            float LuminanceSum = 0.0f;
+            /// The sum of all samples' squared luminance, for computing variance.
+            float SquaredLuminanceSum = 0.0f;
+            /// The sum of all samples' surface features.
+            SurfaceFeatures FeatureSum = SurfaceFeatures();
+            /// The number of samples accumulated.
+            unsigned int SampleCount = 0;
+        };
+
+        // STATIC METHODS.
+        static float Luminance(const MATH::Vector3f& radiance);
+
+        // CONSTRUCTION.
+        explicit AccumulationBuffer() = default;
+        explicit AccumulationBuffer(const unsigned int width_in_pixels, const unsigned int height_in_pixels);
+
+        // DIMENSIONS.
+        unsigned int GetWidthInPixels() const;
+        unsigned int GetHeightInPixels() const;
+
+        // SAMPLES.
+        void AddSample(
+            const unsigned int x,
+            const unsigned int y,
+            const MATH::Vector3f& radiance,
+            const SurfaceFeatures& features = SurfaceFeatures());
+        MATH::Vector3f MeanRadiance(const unsigned int x, const unsigned int y) const;
+        SurfaceFeatures MeanFeatures(const unsigned int x, const unsigned int y) const;
+        float VarianceOfMean(const unsigned int x, const unsigned int y) const;
+        float AverageVarianceOfMean(const ScreenTile& tile) const;
+        unsigned int MinSampleCount(const ScreenTile& tile) const;
+
+        // CONVERSION.
+        void ResolveTo(GRAPHICS::RenderTarget& render_target) const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The accumulated samples for each pixel.
+        CONTAINERS::Array2D<Pixel> Pixels = CONTAINERS::Array2D<Pixel>();
+    };
+}
+}
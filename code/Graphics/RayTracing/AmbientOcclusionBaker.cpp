@@ -0,0 +1,317 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <vector>
+#include "Graphics/RayTracing/AmbientOcclusionBaker.h"
+#include "Graphics/RayTracing/PathTracingAlgorithm.h"
+#include "Graphics/RayTracing/Ray.h"
+#include "Math/CounterBasedRandomNumberGenerator.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// Bakes ambient occlusion for all vertices of an object.
+    /// @param[in,out]  object_3D - The object whose triangles' vertex ambient occlusion should be baked.
+    ///     Only the object's own triangles occlude its vertices.
+    /// @param[in]  thread_count - The number of threads to bake with.  At least 1 thread is always used.
+    void AmbientOcclusionBaker::Bake(Object3D& object_3D, const unsigned int thread_count) const
+    {
+        // FIND THE UNIQUE VERTICES SHARED BY TRIANGLES.
+        // Vertices are considered shared if they have exactly the same position, which is the case
+        // for triangles sharing vertices in model files.
+        std::vector<SharedVertex> shared_vertices;
+        std::vector<std::size_t> shared_vertex_indices_by_triangle_vertex;
+        shared_vertex_indices_by_triangle_vertex.reserve(object_3D.Triangles.size() * Triangle::VERTEX_COUNT);
+        std::map<std::array<float, 3>, std::size_t> shared_vertex_indices_by_position;
+        for (const Triangle& triangle : object_3D.Triangles)
+        {
+            // The cross product's length is twice the triangle's area, so it's already weighted by area.
+            MATH::Vector3f first_edge = triangle.Vertices[1] - triangle.Vertices[0];
+            MATH::Vector3f second_edge = triangle.Vertices[2] - triangle.Vertices[0];
+            MATH::Vector3f area_weighted_normal = MATH::Vector3f::CrossProduct(first_edge, second_edge);
+            for (const MATH::Vector3f& vertex : triangle.Vertices)
+            {
+                std::array<float, 3> position = { vertex.X, vertex.Y, vertex.Z };
+                auto [position_and_index, position_is_new] = shared_vertex_indices_by_position.try_emplace(position, shared_vertices.size());
+                if (position_is_new)
+                {
+                    shared_vertices.push_back(SharedVertex { .Position = vertex });
+                }
+
+                std::size_t shared_vertex_index = position_and_index->second;
+                shared_vertices[shared_vertex_index].AreaWeightedNormal += area_weighted_normal;
+                shared_vertex_indices_by_triangle_vertex.push_back(shared_vertex_index);
+            }
+        }
+
+        // CREATE A MESH FOR EFFICIENTLY CASTING RAYS AGAINST THE OBJECT.
+        Mesh mesh(object_3D.Triangles);
+
+        // DEFINE HOW TO BAKE VERTICES UNTIL ALL HAVE BEEN CLAIMED.
+        // Each vertex is only written by a single thread.
+        std::atomic<std::size_t> next_shared_vertex_index = 0;
+        auto bake_vertices = [&]()
+        {
+            while (true)
+            {
+                std::size_t shared_vertex_index = next_shared_vertex_index.fetch_add(1, std::memory_order_relaxed);
+                bool all_vertices_claimed = (shared_vertex_index >= shared_vertices.size());
+                if (all_vertices_claimed)
+                {
+                    return;
+                }
+
+                SharedVertex& shared_vertex = shared_vertices[shared_vertex_index];
+                std::uint32_t random_number_key = MATH::CounterBasedRandomNumberGenerator::Hash(static_cast<std::uint32_t>(shared_vertex_index));
+                shared_vertex.AmbientOcclusion = ComputeAmbientOcclusion(mesh, shared_vertex, random_number_key);
+            }
+        };
+
+        // BAKE ALL VERTICES.
+        std::size_t worker_thread_count = std::max<std::size_t>(1, thread_count);
+        worker_thread_count = std::min(worker_thread_count, std::max<std::size_t>(1, shared_vertices.size()));
+        if (worker_thread_count <= 1)
+        {
+            bake_vertices();
+        }
+        else
+        {
+            std::vector<std::thread> worker_threads;
+            worker_threads.reserve(worker_thread_count);
+            for (std::size_t thread_index = 0; thread_index < worker_thread_count; ++thread_index)
+            {
+                worker_threads.emplace_back(bake_vertices);
+            }
+            for (std::thread& worker_thread : worker_threads)
+            {
+                worker_thread.join();
+            }
+        }
+
+        // COPY THE BAKED AMBIENT OCCLUSION TO THE TRIANGLES.
+        std::size_t triangle_vertex_index = 0;
+        for (Triangle& triangle : object_3D.Triangles)
+        {
+            for (float& vertex_ambient_occlusion : triangle.VertexAmbientOcclusion)
+            {
+                std::size_t shared_vertex_index = shared_vertex_indices_by_triangle_vertex[triangle_vertex_index];
+                vertex_ambient_occlusion = shared_vertices[shared_vertex_index].AmbientOcclusion;
+                ++triangle_vertex_index;
+            }
+        }
+    }
+
+    /// Bakes ambient occlusion for all vertices of an object, reusing any earlier bake cached for the same
+    /// object and settings.  Newly baked results are saved to the cache for later reuse.
+    /// @param[in,out]  object_3D - The object whose triangles' vertex ambient occlusion should be baked.
+    /// @param[in]  cache_folder_path - The folder of cache files.  Created if it doesn't exist.
+    /// @param[in]  thread_count - The number of threads to bake with, if baking is needed.
+    /// @return True if an earlier bake was reused from the cache; false if ambient occlusion was newly baked.
+    bool AmbientOcclusionBaker::BakeCached(
+        Object3D& object_3D,
+        const std::filesystem::path& cache_folder_path,
+        const unsigned int thread_count) const
+    {
+        // TRY REUSING AN EARLIER BAKE.
+        // The hash is only computed once since it requires visiting every vertex.
+        std::uint32_t hash = Hash(object_3D);
+        std::filesystem::path cache_filepath = CacheFilepath(hash, cache_folder_path);
+        bool cached_bake_loaded = Load(cache_filepath, hash, object_3D);
+        if (cached_bake_loaded)
+        {
+            return true;
+        }
+
+        // BAKE AND CACHE THE AMBIENT OCCLUSION.
+        // Failing to cache results only makes later loads slower, so the error is ignored.
+        Bake(object_3D, thread_count);
+        std::error_code error;
+        std::filesystem::create_directories(cache_folder_path, error);
+        Save(object_3D, hash, cache_filepath);
+        return false;
+    }
+
+    /// Computes a hash identifying baked ambient occlusion for an object,
+    /// based on the object's vertices and the baking settings.
+    /// @param[in]  object_3D - The object to hash.
+    /// @return The hash for the object's baked ambient occlusion.
+    std::uint32_t AmbientOcclusionBaker::Hash(const Object3D& object_3D) const
+    {
+        // HASH THE SETTINGS.
+        std::uint32_t hash = MATH::CounterBasedRandomNumberGenerator::Hash(CACHE_FILE_VERSION);
+        hash = MATH::CounterBasedRandomNumberGenerator::HashCombine(hash, SampleCountPerVertex);
+        hash = MATH::CounterBasedRandomNumberGenerator::HashFloat(hash, MaxOcclusionDistance);
+        hash = MATH::CounterBasedRandomNumberGenerator::HashFloat(hash, SurfaceOffsetDistance);
+
+        // HASH THE VERTICES.
+        hash = MATH::CounterBasedRandomNumberGenerator::HashCombine(hash, static_cast<std::uint32_t>(object_3D.Triangles.size()));
+        for (const Triangle& triangle : object_3D.Triangles)
+        {
+            for (const MATH::Vector3f& vertex : triangle.Vertices)
+            {
+                hash = MATH::CounterBasedRandomNumberGenerator::HashFloat(hash, vertex.X);
+                hash = MATH::CounterBasedRandomNumberGenerator::HashFloat(hash, vertex.Y);
+                hash = MATH::CounterBasedRandomNumberGenerator::HashFloat(hash, vertex.Z);
+            }
+        }
+        return hash;
+    }
+
+    /// Gets the path of the file caching baked ambient occlusion for an object.
+    /// @param[in]  object_3D - The object whose cache file to get.
+    /// @param[in]  cache_folder_path - The folder of cache files.
+    /// @return The path of the cache file, named after the hash for the object.
+    std::filesystem::path AmbientOcclusionBaker::CacheFilepath(const Object3D& object_3D, const std::filesystem::path& cache_folder_path) const
+    {
+        std::uint32_t hash = Hash(object_3D);
+        std::filesystem::path cache_filepath = CacheFilepath(hash, cache_folder_path);
+        return cache_filepath;
+    }
+
+    /// Gets the path of the file caching baked ambient occlusion with a known hash.
+    /// @param[in]  hash - The hash identifying the baked ambient occlusion (see \ref Hash).
+    /// @param[in]  cache_folder_path - The folder of cache files.
+    /// @return The path of the cache file, named after the hash.
+    std::filesystem::path AmbientOcclusionBaker::CacheFilepath(const std::uint32_t hash, const std::filesystem::path& cache_folder_path)
+    {
+        std::ostringstream filename;
+        filename << std::hex << std::setw(8) << std::setfill('0') << hash << CACHE_FILE_EXTENSION;
+        std::filesystem::path cache_filepath = cache_folder_path / filename.str();
+        return cache_filepath;
+    }
+
+    /// Saves baked ambient occlusion for an object to a file.  The file contains a small header
+    /// followed by the ambient occlusion for each triangle vertex, quantized to a single byte.
+    /// @param[in]  object_3D - The object whose baked ambient occlusion to save.
+    /// @param[in]  hash - The hash identifying the baked ambient occlusion (see \ref Hash).
+    /// @param[in]  filepath - The path of the file to save to.
+    /// @return True if saving succeeded; false otherwise.
+    bool AmbientOcclusionBaker::Save(const Object3D& object_3D, const std::uint32_t hash, const std::filesystem::path& filepath)
+    {
+        // OPEN THE FILE.
+        std::ofstream cache_file(filepath, std::ios::binary);
+        bool cache_file_opened = cache_file.is_open();
+        if (!cache_file_opened)
+        {
+            return false;
+        }
+
+        // WRITE THE HEADER.
+        std::uint32_t vertex_count = static_cast<std::uint32_t>(object_3D.Triangles.size() * Triangle::VERTEX_COUNT);
+        const std::uint32_t header[] = { CACHE_FILE_MAGIC_NUMBER, CACHE_FILE_VERSION, hash, vertex_count };
+        cache_file.write(reinterpret_cast<const char*>(header), sizeof(header));
+
+        // WRITE THE QUANTIZED AMBIENT OCCLUSION.
+        std::vector<std::uint8_t> quantized_ambient_occlusion;
+        quantized_ambient_occlusion.reserve(vertex_count);
+        for (const Triangle& triangle : object_3D.Triangles)
+        {
+            for (float vertex_ambient_occlusion : triangle.VertexAmbientOcclusion)
+            {
+                float clamped_ambient_occlusion = std::clamp(vertex_ambient_occlusion, 0.0f, 1.0f);
+                quantized_ambient_occlusion.push_back(static_cast<std::uint8_t>(std::lround(clamped_ambient_occlusion * UINT8_MAX)));
+            }
+        }
+        cache_file.write(reinterpret_cast<const char*>(quantized_ambient_occlusion.data()), quantized_ambient_occlusion.size());
+
+        bool cache_file_written = cache_file.good();
+        return cache_file_written;
+    }
+
+    /// Loads baked ambient occlusion for an object from a file.
+    /// @param[in]  filepath - The path of the file to load from.
+    /// @param[in]  hash - The hash identifying the expected baked ambient occlusion (see \ref Hash).
+    /// @param[in,out]  object_3D - The object whose triangles' vertex ambient occlusion should be loaded.
+    ///     Only updated if loading succeeds.
+    /// @return True if loading succeeded; false if the file is missing, invalid, or for a different object or settings.
+    bool AmbientOcclusionBaker::Load(const std::filesystem::path& filepath, const std::uint32_t hash, Object3D& object_3D)
+    {
+        // OPEN THE FILE.
+        std::ifstream cache_file(filepath, std::ios::binary);
+        bool cache_file_opened = cache_file.is_open();
+        if (!cache_file_opened)
+        {
+            return false;
+        }
+
+        // MAKE SURE THE FILE IS FOR THIS OBJECT.
+        std::uint32_t header[4] = {};
+        cache_file.read(reinterpret_cast<char*>(header), sizeof(header));
+        std::uint32_t expected_vertex_count = static_cast<std::uint32_t>(object_3D.Triangles.size() * Triangle::VERTEX_COUNT);
+        bool header_matches = (
+            cache_file.good() &&
+            (CACHE_FILE_MAGIC_NUMBER == header[0]) &&
+            (CACHE_FILE_VERSION == header[1]) &&
+            (hash == header[2]) &&
+            (expected_vertex_count == header[3]));
+        if (!header_matches)
+        {
+            return false;
+        }
+
+        // READ THE QUANTIZED AMBIENT OCCLUSION.
+        std::vector<std::uint8_t> quantized_ambient_occlusion(expected_vertex_count);
+        cache_file.read(reinterpret_cast<char*>(quantized_ambient_occlusion.data()), quantized_ambient_occlusion.size());
+        bool all_ambient_occlusion_read = cache_file.good();
+        if (!all_ambient_occlusion_read)
+        {
+            return false;
+        }
+
+        // COPY THE AMBIENT OCCLUSION TO THE TRIANGLES.
+        std::size_t triangle_vertex_index = 0;
+        for (Triangle& triangle : object_3D.Triangles)
+        {
+            for (float& vertex_ambient_occlusion : triangle.VertexAmbientOcclusion)
+            {
+                vertex_ambient_occlusion = static_cast<float>(quantized_ambient_occlusion[triangle_vertex_index]) / UINT8_MAX;
+                ++triangle_vertex_index;
+            }
+        }
+        return true;
+    }
+
+    /// Computes the ambient occlusion for a single vertex by casting rays over the hemisphere around it.
+    /// @param[in]  mesh - The mesh that may occlude the vertex.
+    /// @param[in]  vertex - The vertex to compute ambient occlusion for.
+    /// @param[in]  random_number_key - The key for randomly choosing ray directions.
+    /// @return The proportion [0, 1] of rays not blocked within the max occlusion distance.
+    float AmbientOcclusionBaker::ComputeAmbientOcclusion(const Mesh& mesh, const SharedVertex& vertex, const std::uint32_t random_number_key) const
+    {
+        // TREAT DEGENERATE VERTICES AS UNOCCLUDED.
+        // Vertices only used by zero-area triangles have no meaningful hemisphere to sample.
+        float normal_length = vertex.AreaWeightedNormal.Length();
+        bool vertex_has_normal = (normal_length > 0.0f);
+        if (!vertex_has_normal || 0 == SampleCountPerVertex)
+        {
+            return 1.0f;
+        }
+
+        // COUNT HOW MANY RAYS OVER THE HEMISPHERE ARE BLOCKED.
+        // Cosine-weighting the directions matches how much ambient light from each direction a diffuse surface reflects.
+        MATH::Vector3f unit_normal = MATH::Vector3f::Scale(1.0f / normal_length, vertex.AreaWeightedNormal);
+        MATH::Vector3f ray_origin = vertex.Position + MATH::Vector3f::Scale(SurfaceOffsetDistance, unit_normal);
+        MATH::CounterBasedRandomNumberGenerator random_number_generator(random_number_key);
+        unsigned int occluded_sample_count = 0;
+        for (unsigned int sample_index = 0; sample_index < SampleCountPerVertex; ++sample_index)
+        {
+            MATH::Vector3f direction = PathTracingAlgorithm::CosineWeightedHemisphereDirection(unit_normal, random_number_generator);
+            Ray ray(ray_origin, direction);
+            bool ray_occluded = mesh.Occludes(ray, 0.0f, MaxOcclusionDistance);
+            if (ray_occluded)
+            {
+                ++occluded_sample_count;
+            }
+        }
+
+        float unoccluded_proportion = 1.0f - (static_cast<float>(occluded_sample_count) / static_cast<float>(SampleCountPerVertex));
+        return unoccluded_proportion;
+    }
+}
+}
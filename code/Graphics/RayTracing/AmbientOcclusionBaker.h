@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <thread>
+#include "Graphics/Object3D.h"
+#include "Graphics/RayTracing/Mesh.h"
+#include "Math/Vector3.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// Bakes ambient occlusion for each vertex of an object offline, so that the rasterizing
+    /// \ref GRAPHICS::Renderer can darken ambient lighting in creases and corners at no runtime cost.
+    ///
+    /// Rays are cast from each vertex over the hemisphere around its normal, and the proportion of
+    /// rays that escape the object within \ref MaxOcclusionDistance becomes the vertex's
+    /// \ref Triangle::VertexAmbientOcclusion.  Vertices shared by several triangles (having the same
+    /// position) are only baked once using the area-weighted average of the triangles' normals, so
+    /// shading stays continuous across triangles.  Samples are chosen with a random number generator
+    /// keyed by the vertex, so results don't depend on the number of threads.
+    ///
+    /// Since baking can take a while for large models, results can be cached in small sidecar files
+    /// (1 byte per vertex) named after a hash of the object's vertices and the baking settings, so
+    /// repeated loads of the same model reuse the earlier bake.
+    class AmbientOcclusionBaker
+    {
+    public:
+        // STATIC CONSTANTS.
+        /// The extension of files caching baked ambient occlusion.
+        static constexpr char CACHE_FILE_EXTENSION[] = ".ao";
+        /// The first bytes of files caching baked ambient occlusion ("SRAO" when read as ASCII on little-endian machines).
+        static constexpr std::uint32_t CACHE_FILE_MAGIC_NUMBER = 0x4F415253;
+        /// The version of the cache file format, to be changed whenever the format or baking algorithm changes.
+        static constexpr std::uint32_t CACHE_FILE_VERSION = 1;
+
+        // BAKING.
+        void Bake(Object3D& object_3D, const unsigned int thread_count = std::thread::hardware_concurrency()) const;
+        bool BakeCached(
+            Object3D& object_3D,
+            const std::filesystem::path& cache_folder_path,
+            const unsigned int thread_count = std::thread::hardware_concurrency()) const;
+
+        // CACHING.
+        std::uint32_t Hash(const Object3D& object_3D) const;
+        std::filesystem::path CacheFilepath(const Object3D& object_3D, const std::filesystem::path& cache_folder_path) const;
+        static std::filesystem::path CacheFilepath(const std::uint32_t hash, const std::filesystem::path& cache_folder_path);
+        static bool Save(const Object3D& object_3D, const std::uint32_t hash, const std::filesystem::path& filepath);
+        static bool Load(const std::filesystem::path& filepath, const std::uint32_t hash, Object3D& object_3D);
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The number of rays cast from each vertex.
+        unsigned int SampleCountPerVertex = 64;
+        /// The distance (in the local coordinates of the object) within which surfaces occlude a vertex.
+        /// Limiting this keeps distant parts of an object from darkening open areas.
+        float MaxOcclusionDistance = 1.0f;
+        /// How far rays are started from vertices (along the vertex normal)
+        /// to avoid immediately intersecting the triangles sharing the vertex.
+        float SurfaceOffsetDistance = 0.001f;
+
+    private:
+        /// A unique vertex position shared by one or more triangles.
+        class SharedVertex
+        {
+        public:
+            // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+            /// The position of the vertex.
+            MATH::Vector3f Position = MATH::Vector3f();
+            /// The sum of the normals of triangles sharing the vertex, weighted by the triangles' areas.
+            MATH::Vector3f AreaWeightedNormal = MATH::Vector3f();
+            /// The baked ambient occlusion for the vertex.
+            float AmbientOcclusion = 1.0f;
+        };
+
+        // PRIVATE HELPER METHODS.
+        float ComputeAmbientOcclusion(const Mesh& mesh, const SharedVertex& vertex, const std::uint32_t random_number_key) const;
+    };
+}
+}
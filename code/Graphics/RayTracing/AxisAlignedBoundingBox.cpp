@@ -0,0 +1,160 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include "Graphics/RayTracing/AxisAlignedBoundingBox.h"
+#include "Math/Vector4.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// Constructor.
+    /// @param[in]  minimum_corner - The corner of the box with the smallest coordinates.
+    /// @param[in]  maximum_corner - The corner of the box with the largest coordinates.
+    AxisAlignedBoundingBox::AxisAlignedBoundingBox(const MATH::Vector3f& minimum_corner, const MATH::Vector3f& maximum_corner) :
+        MinimumCorner(minimum_corner),
+        MaximumCorner(maximum_corner)
+    {}
+
+    /// Expands the box to contain the specified point.
+    /// @param[in]  point - The point to contain.
+    void AxisAlignedBoundingBox::Expand(const MATH::Vector3f& point)
+    {
+        MinimumCorner.X = std::min(MinimumCorner.X, point.X);
+        MinimumCorner.Y = std::min(MinimumCorner.Y, point.Y);
+        MinimumCorner.Z = std::min(MinimumCorner.Z, point.Z);
+
+        MaximumCorner.X = std::max(MaximumCorner.X, point.X);
+        MaximumCorner.Y = std::max(MaximumCorner.Y, point.Y);
+        MaximumCorner.Z = std::max(MaximumCorner.Z, point.Z);
+    }
+
+    /// Expands the box to contain the specified box.
+    /// @param[in]  box - The box to contain.
+    void AxisAlignedBoundingBox::Expand(const AxisAlignedBoundingBox& box)
+    {
+        Expand(box.MinimumCorner);
+        Expand(box.MaximumCorner);
+    }
+
+    /// Determines if the box is empty (contains no points).
+    /// @return True if the box is empty; false otherwise.
+    bool AxisAlignedBoundingBox::IsEmpty() const
+    {
+        bool is_empty = (
+            (MinimumCorner.X > MaximumCorner.X) ||
+            (MinimumCorner.Y > MaximumCorner.Y) ||
+            (MinimumCorner.Z > MaximumCorner.Z));
+        return is_empty;
+    }
+
+    /// Determines if the box is bounded along all axes.  Unbounded objects (like infinite planes)
+    /// have infinite boxes, which can't be subdivided by acceleration structures.
+    /// @return True if all corners are finite; false otherwise.
+    bool AxisAlignedBoundingBox::IsFinite() const
+    {
+        bool is_finite = (
+            std::isfinite(MinimumCorner.X) && std::isfinite(MinimumCorner.Y) && std::isfinite(MinimumCorner.Z) &&
+            std::isfinite(MaximumCorner.X) && std::isfinite(MaximumCorner.Y) && std::isfinite(MaximumCorner.Z));
+        return is_finite;
+    }
+
+    /// Computes the center of the box.
+    /// @return The center point of the box.
+    MATH::Vector3f AxisAlignedBoundingBox::Center() const
+    {
+        MATH::Vector3f center = MATH::Vector3f::Scale(0.5f, MinimumCorner + MaximumCorner);
+        return center;
+    }
+
+    /// Computes the size of the box along each of the primary axes.
+    /// @return The size of the box.
+    MATH::Vector3f AxisAlignedBoundingBox::Size() const
+    {
+        MATH::Vector3f size = MaximumCorner - MinimumCorner;
+        return size;
+    }
+
+    /// Computes the total area of all faces of the box.
+    /// @return The surface area of the box; 0 if the box is empty.
+    float AxisAlignedBoundingBox::SurfaceArea() const
+    {
+        if (IsEmpty())
+        {
+            return 0.0f;
+        }
+
+        MATH::Vector3f size = Size();
+        float surface_area = 2.0f * ((size.X * size.Y) + (size.Y * size.Z) + (size.Z * size.X));
+        return surface_area;
+    }
+
+    /// Computes a box containing this box after it has been transformed.
+    /// The resulting box may be larger than the transformed contents since it must remain axis-aligned.
+    /// @param[in]  transform - The transform to apply to the box.
+    /// @return A box containing the transformed box.
+    AxisAlignedBoundingBox AxisAlignedBoundingBox::Transform(const MATH::Matrix4x4f& transform) const
+    {
+        // AN EMPTY BOX REMAINS EMPTY.
+        if (IsEmpty())
+        {
+            return *this;
+        }
+
+        // TRANSFORM ALL CORNERS OF THE BOX.
+        const std::array<MATH::Vector3f, 8> corners =
+        {
+            MATH::Vector3f(MinimumCorner.X, MinimumCorner.Y, MinimumCorner.Z),
+            MATH::Vector3f(MaximumCorner.X, MinimumCorner.Y, MinimumCorner.Z),
+            MATH::Vector3f(MinimumCorner.X, MaximumCorner.Y, MinimumCorner.Z),
+            MATH::Vector3f(MaximumCorner.X, MaximumCorner.Y, MinimumCorner.Z),
+            MATH::Vector3f(MinimumCorner.X, MinimumCorner.Y, MaximumCorner.Z),
+            MATH::Vector3f(MaximumCorner.X, MinimumCorner.Y, MaximumCorner.Z),
+            MATH::Vector3f(MinimumCorner.X, MaximumCorner.Y, MaximumCorner.Z),
+            MATH::Vector3f(MaximumCorner.X, MaximumCorner.Y, MaximumCorner.Z),
+        };
+        AxisAlignedBoundingBox transformed_box;
+        for (const MATH::Vector3f& corner : corners)
+        {
+            MATH::Vector4f homogeneous_corner = MATH::Vector4f::HomogeneousPositionVector(corner);
+            MATH::Vector4f transformed_corner = transform * homogeneous_corner;
+            transformed_box.Expand(MATH::Vector3f(transformed_corner.X, transformed_corner.Y, transformed_corner.Z));
+        }
+        return transformed_box;
+    }
+
+    /// Checks if a ray intersects the box using the "slab" method.
+    /// @param[in]  ray - The ray to check for intersection.
+    /// @param[in]  inverse_ray_direction - The component-wise reciprocal of the ray's direction.
+    ///     Passed in since it's typically reused across many boxes for a single ray.
+    /// @param[in]  max_distance - The maximum distance (in units of the ray) at which intersections count.
+    /// @return True if the ray intersects the box within [0, max_distance]; false otherwise.
+    bool AxisAlignedBoundingBox::Intersects(const Ray& ray, const MATH::Vector3f& inverse_ray_direction, const float max_distance) const
+    {
+        // COMPUTE THE DISTANCES TO EACH PAIR OF PLANES ALONG THE X AXIS.
+        float x_distance_to_minimum_plane = (MinimumCorner.X - ray.Origin.X) * inverse_ray_direction.X;
+        float x_distance_to_maximum_plane = (MaximumCorner.X - ray.Origin.X) * inverse_ray_direction.X;
+        float entry_distance = std::min(x_distance_to_minimum_plane, x_distance_to_maximum_plane);
+        float exit_distance = std::max(x_distance_to_minimum_plane, x_distance_to_maximum_plane);
+
+        // NARROW THE DISTANCES BASED ON THE Y AXIS.
+        float y_distance_to_minimum_plane = (MinimumCorner.Y - ray.Origin.Y) * inverse_ray_direction.Y;
+        float y_distance_to_maximum_plane = (MaximumCorner.Y - ray.Origin.Y) * inverse_ray_direction.Y;
+        entry_distance = std::max(entry_distance, std::min(y_distance_to_minimum_plane, y_distance_to_maximum_plane));
+        exit_distance = std::min(exit_distance, std::max(y_distance_to_minimum_plane, y_distance_to_maximum_plane));
+
+        // NARROW THE DISTANCES BASED ON THE Z AXIS.
+        float z_distance_to_minimum_plane = (MinimumCorner.Z - ray.Origin.Z) * inverse_ray_direction.Z;
+        float z_distance_to_maximum_plane = (MaximumCorner.Z - ray.Origin.Z) * inverse_ray_direction.Z;
+        entry_distance = std::max(entry_distance, std::min(z_distance_to_minimum_plane, z_distance_to_maximum_plane));
+        exit_distance = std::min(exit_distance, std::max(z_distance_to_minimum_plane, z_distance_to_maximum_plane));
+
+        // CHECK IF THE RAY IS INSIDE ALL SLABS AT ONCE WITHIN THE ALLOWED RANGE.
+        bool intersects = (
+            (entry_distance <= exit_distance) &&
+            (exit_distance >= 0.0f) &&
+            (entry_distance <= max_distance));
+        return intersects;
+    }
+}
+}
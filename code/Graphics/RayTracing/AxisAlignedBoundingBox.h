@@ -0,0 +1,49 @@
+#pragma once
+
+#include <limits>
+#include "Graphics/RayTracing/Ray.h"
+#include "Math/Matrix4x4.h"
+#include "Math/Vector3.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// A box aligned with the primary axes that bounds some region of 3D space.
+    /// Primarily used to quickly reject rays that cannot hit more expensive objects.
+    class AxisAlignedBoundingBox
+    {
+    public:
+        // CONSTRUCTION.
+        explicit AxisAlignedBoundingBox() = default;
+        explicit AxisAlignedBoundingBox(const MATH::Vector3f& minimum_corner, const MATH::Vector3f& maximum_corner);
+
+        // EXPANSION.
+        void Expand(const MATH::Vector3f& point);
+        void Expand(const AxisAlignedBoundingBox& box);
+
+        // OTHER METHODS.
+        bool IsEmpty() const;
+        bool IsFinite() const;
+        MATH::Vector3f Center() const;
+        MATH::Vector3f Size() const;
+        float SurfaceArea() const;
+        AxisAlignedBoundingBox Transform(const MATH::Matrix4x4f& transform) const;
+        bool Intersects(const Ray& ray, const MATH::Vector3f& inverse_ray_direction, const float max_distance) const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The corner of the box with the smallest coordinates.
+        /// Defaults to infinity so that the box starts out empty and can be expanded.
+        MATH::Vector3f MinimumCorner = MATH::Vector3f(
+            std::numeric_limits<float>::infinity(),
+            std::numeric_limits<float>::infinity(),
+            std::numeric_limits<float>::infinity());
+        /// The corner of the box with the largest coordinates.
+        /// Defaults to negative infinity so that the box starts out empty and can be expanded.
+        MATH::Vector3f MaximumCorner = MATH::Vector3f(
+            -std::numeric_limits<float>::infinity(),
+            -std::numeric_limits<float>::infinity(),
+            -std::numeric_limits<float>::infinity());
+    };
+}
+}
@@ -0,0 +1,137 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "Graphics/RayTracing/AxisAlignedBox.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// Computes the surface normal of the box at given point.
+    /// The normal is that of the face closest to the point, which is found as the axis along which
+    /// the point is furthest from the center relative to the box's size along that axis.
+    /// @param[in]  surface_point - The point on the box's surface at which to compute a normal.
+    /// @return The unit surface normal at the specified point.
+    MATH::Vector3f AxisAlignedBox::SurfaceNormal(const MATH::Vector3f& surface_point) const
+    {
+        // COMPUTE THE POINT'S POSITION RELATIVE TO THE BOX.
+        // Each component is in [-1, 1] for points within the box, with faces at -1 and 1.
+        MATH::Vector3f center = MATH::Vector3f::Scale(0.5f, MinimumCorner + MaximumCorner);
+        MATH::Vector3f half_size = MATH::Vector3f::Scale(0.5f, MaximumCorner - MinimumCorner);
+        MATH::Vector3f center_to_point = surface_point - center;
+        MATH::Vector3f relative_position(
+            center_to_point.X / half_size.X,
+            center_to_point.Y / half_size.Y,
+            center_to_point.Z / half_size.Z);
+
+        // USE THE NORMAL OF THE CLOSEST FACE.
+        float x_distance = std::abs(relative_position.X);
+        float y_distance = std::abs(relative_position.Y);
+        float z_distance = std::abs(relative_position.Z);
+        if ((x_distance >= y_distance) && (x_distance >= z_distance))
+        {
+            return MATH::Vector3f(std::copysign(1.0f, relative_position.X), 0.0f, 0.0f);
+        }
+        else if (y_distance >= z_distance)
+        {
+            return MATH::Vector3f(0.0f, std::copysign(1.0f, relative_position.Y), 0.0f);
+        }
+        else
+        {
+            return MATH::Vector3f(0.0f, 0.0f, std::copysign(1.0f, relative_position.Z));
+        }
+    }
+
+    /// Gets the material defining surface properties of the object.
+    /// @return The material for the object.
+    const Material* AxisAlignedBox::GetMaterial() const
+    {
+        return Material.get();
+    }
+
+    /// Checks for an intersection between a ray and the box.
+    /// Rays starting inside the box intersect the face they exit through.
+    /// @param[in]  ray - The ray to check for intersection.
+    /// @return A ray-object intersection, if one occurred; std::nullopt otherwise.
+    std::optional<RayObjectIntersection> AxisAlignedBox::Intersect(const Ray& ray) const
+    {
+        // COMPUTE THE DISTANCES TO EACH PAIR OF PLANES BOUNDING THE BOX.
+        // The ray is inside the box between the furthest entry into and closest exit out of all pairs of planes.
+        MATH::Vector3f inverse_ray_direction(1.0f / ray.Direction.X, 1.0f / ray.Direction.Y, 1.0f / ray.Direction.Z);
+        float x_distance_to_minimum_plane = (MinimumCorner.X - ray.Origin.X) * inverse_ray_direction.X;
+        float x_distance_to_maximum_plane = (MaximumCorner.X - ray.Origin.X) * inverse_ray_direction.X;
+        float y_distance_to_minimum_plane = (MinimumCorner.Y - ray.Origin.Y) * inverse_ray_direction.Y;
+        float y_distance_to_maximum_plane = (MaximumCorner.Y - ray.Origin.Y) * inverse_ray_direction.Y;
+        float z_distance_to_minimum_plane = (MinimumCorner.Z - ray.Origin.Z) * inverse_ray_direction.Z;
+        float z_distance_to_maximum_plane = (MaximumCorner.Z - ray.Origin.Z) * inverse_ray_direction.Z;
+        float entry_distance = std::max({
+            std::min(x_distance_to_minimum_plane, x_distance_to_maximum_plane),
+            std::min(y_distance_to_minimum_plane, y_distance_to_maximum_plane),
+            std::min(z_distance_to_minimum_plane, z_distance_to_maximum_plane) });
+        float exit_distance = std::min({
+            std::max(x_distance_to_minimum_plane, x_distance_to_maximum_plane),
+            std::max(y_distance_to_minimum_plane, y_distance_to_maximum_plane),
+            std::max(z_distance_to_minimum_plane, z_distance_to_maximum_plane) });
+
+        // CHECK IF THE RAY IS INSIDE ALL SLABS AT ONCE IN FRONT OF ITS ORIGIN.
+        bool box_intersected = (exit_distance >= std::max(entry_distance, 0.0f));
+        if (!box_intersected)
+        {
+            return std::nullopt;
+        }
+
+        RayObjectIntersection intersection;
+        intersection.Ray = &ray;
+        intersection.DistanceFromRayToObject = (entry_distance >= 0.0f) ? entry_distance : exit_distance;
+        intersection.Object = this;
+        return intersection;
+    }
+
+    /// Gets the world-space bounds of the box, which is just the box itself.
+    /// @return The box.
+    AxisAlignedBoundingBox AxisAlignedBox::Bounds() const
+    {
+        AxisAlignedBoundingBox bounds(MinimumCorner, MaximumCorner);
+        return bounds;
+    }
+
+    /// Gets the kind of object, for reporting statistics.
+    /// @return \ref ObjectType::AXIS_ALIGNED_BOX.
+    ObjectType AxisAlignedBox::Type() const
+    {
+        return ObjectType::AXIS_ALIGNED_BOX;
+    }
+
+    /// Checks for intersections between all rays in a packet and the box, using the same math as \ref Intersect.
+    /// @param[in]  ray_packet - The rays to check for intersection.
+    /// @param[out]  distances - The distance along each ray to the box; infinity for rays that miss.
+    /// @return True since packet intersections are supported.
+    bool AxisAlignedBox::IntersectPacket(const RayPacket& ray_packet, std::array<float, RayPacket::MAX_RAY_COUNT>& distances) const
+    {
+        constexpr float NO_INTERSECTION = std::numeric_limits<float>::infinity();
+        for (std::size_t ray_index = 0; ray_index < RayPacket::MAX_RAY_COUNT; ++ray_index)
+        {
+            float x_distance_to_minimum_plane = (MinimumCorner.X - ray_packet.OriginX[ray_index]) / ray_packet.DirectionX[ray_index];
+            float x_distance_to_maximum_plane = (MaximumCorner.X - ray_packet.OriginX[ray_index]) / ray_packet.DirectionX[ray_index];
+            float y_distance_to_minimum_plane = (MinimumCorner.Y - ray_packet.OriginY[ray_index]) / ray_packet.DirectionY[ray_index];
+            float y_distance_to_maximum_plane = (MaximumCorner.Y - ray_packet.OriginY[ray_index]) / ray_packet.DirectionY[ray_index];
+            float z_distance_to_minimum_plane = (MinimumCorner.Z - ray_packet.OriginZ[ray_index]) / ray_packet.DirectionZ[ray_index];
+            float z_distance_to_maximum_plane = (MaximumCorner.Z - ray_packet.OriginZ[ray_index]) / ray_packet.DirectionZ[ray_index];
+            float entry_distance = std::max({
+                std::min(x_distance_to_minimum_plane, x_distance_to_maximum_plane),
+                std::min(y_distance_to_minimum_plane, y_distance_to_maximum_plane),
+                std::min(z_distance_to_minimum_plane, z_distance_to_maximum_plane) });
+            float exit_distance = std::min({
+                std::max(x_distance_to_minimum_plane, x_distance_to_maximum_plane),
+                std::max(y_distance_to_minimum_plane, y_distance_to_maximum_plane),
+                std::max(z_distance_to_minimum_plane, z_distance_to_maximum_plane) });
+
+            bool box_intersected = (exit_distance >= std::max(entry_distance, 0.0f));
+            float distance_from_ray_to_box = (entry_distance >= 0.0f) ? entry_distance : exit_distance;
+            distances[ray_index] = box_intersected ? distance_from_ray_to_box : NO_INTERSECTION;
+        }
+
+        return true;
+    }
+}
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include "Graphics/Material.h"
+#include "Graphics/RayTracing/IObject3D.h"
+#include "Graphics/RayTracing/RayPacket.h"
+#include "Math/Vector3.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// A solid box aligned with the primary axes that can be ray traced.
+    /// Much cheaper to intersect than the 12 triangles of an equivalent mesh, and its bounds are exactly itself.
+    class AxisAlignedBox : public IObject3D
+    {
+    public:
+        // PUBLIC METHODS.
+        MATH::Vector3f SurfaceNormal(const MATH::Vector3f& surface_point) const override;
+        const Material* GetMaterial() const override;
+        std::optional<RayObjectIntersection> Intersect(const Ray& ray) const override;
+        AxisAlignedBoundingBox Bounds() const override;
+        ObjectType Type() const override;
+        bool IntersectPacket(const RayPacket& ray_packet, std::array<float, RayPacket::MAX_RAY_COUNT>& distances) const override;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The corner of the box with the smallest coordinates.
+        MATH::Vector3f MinimumCorner = MATH::Vector3f();
+        /// The corner of the box with the largest coordinates.
+        MATH::Vector3f MaximumCorner = MATH::Vector3f();
+        /// The material defining surface properties of the box.
+        std::shared_ptr<Material> Material = nullptr;
+    };
+}
+}
@@ -0,0 +1,172 @@
+#include <algorithm>
+#include "Graphics/RayTracing/BackgroundRenderJob.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// Destructor to stop any worker threads.
+    /// Unlike cancelling, this waits for all worker threads to stop since they use the job's images.
+    BackgroundRenderJob::~BackgroundRenderJob()
+    {
+        Cancel();
+        for (std::unique_ptr<ImageRender>& cancelled_image : CancelledImages)
+        {
+            for (std::thread& worker_thread : cancelled_image->WorkerThreads)
+            {
+                worker_thread.join();
+            }
+        }
+    }
+
+    /// Starts rendering a new image on background threads, cancelling any image currently being rendered.
+    /// @param[in]  ray_tracer - The ray tracer to render with.  Copied so that it may be modified after this call.
+    /// @param[in]  scene - The scene to render.  Must not be modified until the job is completed.
+    /// @param[in]  render_target - The render target that the image will eventually be presented to.
+    ///     Only used to determine the dimensions and format of the back buffer.
+    /// @param[in]  thread_count - The number of worker threads to render with.  At least 1 thread is always used.
+    void BackgroundRenderJob::Start(
+        const RayTracingAlgorithm& ray_tracer,
+        const std::shared_ptr<const Scene>& scene,
+        const GRAPHICS::RenderTarget& render_target,
+        const unsigned int thread_count)
+    {
+        // STOP ANY PREVIOUS RENDERING.
+        Cancel();
+
+        // PREPARE THE NEW IMAGE.
+        CurrentImage = std::make_unique<ImageRender>(ray_tracer, scene, render_target);
+        ++StartedImageCount;
+
+        // START THE WORKER THREADS.
+        // There's no benefit to having more threads than tiles.
+        unsigned int worker_thread_count = std::max(1u, thread_count);
+        worker_thread_count = std::min(worker_thread_count, static_cast<unsigned int>(CurrentImage->Tiles.size()));
+        CurrentImage->RunningWorkerThreadCount = worker_thread_count;
+        for (unsigned int thread_index = 0; thread_index < worker_thread_count; ++thread_index)
+        {
+            CurrentImage->WorkerThreads.emplace_back(&ImageRender::RenderTiles, CurrentImage.get());
+        }
+    }
+
+    /// Cancels rendering of the current image, if any.
+    /// Worker threads stop after finishing their current tile, but this doesn't wait for them.
+    /// Threads from previously cancelled images that have since stopped are joined.
+    void BackgroundRenderJob::Cancel()
+    {
+        if (CurrentImage)
+        {
+            CurrentImage->CancellationRequested = true;
+            CancelledImages.push_back(std::move(CurrentImage));
+        }
+
+        JoinStoppedWorkerThreads();
+    }
+
+    /// Determines if the current image has been completely rendered.
+    /// @return True if the image is complete; false if no image has been started or rendering is unfinished.
+    bool BackgroundRenderJob::IsComplete() const
+    {
+        if (!CurrentImage)
+        {
+            return false;
+        }
+
+        bool all_tiles_completed = (CurrentImage->CompletedTileCount.load(std::memory_order_acquire) == CurrentImage->Tiles.size());
+        return all_tiles_completed;
+    }
+
+    /// Gets how much of the current image has been rendered.
+    /// @return The percentage [0, 100] of the image that has been rendered.  0 if no image has been started.
+    float BackgroundRenderJob::CompletionPercentage() const
+    {
+        if (!CurrentImage || CurrentImage->Tiles.empty())
+        {
+            return 0.0f;
+        }
+
+        constexpr float FULLY_COMPLETE_PERCENTAGE = 100.0f;
+        std::size_t completed_tile_count = CurrentImage->CompletedTileCount.load(std::memory_order_acquire);
+        float completed_proportion = static_cast<float>(completed_tile_count) / static_cast<float>(CurrentImage->Tiles.size());
+        float completion_percentage = FULLY_COMPLETE_PERCENTAGE * completed_proportion;
+        return completion_percentage;
+    }
+
+    /// Gets the finished image, if rendering has completed.
+    /// @return The finished image; null if the image is not yet complete.
+    const GRAPHICS::RenderTarget* BackgroundRenderJob::FinishedFrame() const
+    {
+        if (!IsComplete())
+        {
+            return nullptr;
+        }
+
+        return &CurrentImage->BackBuffer;
+    }
+
+    /// Gets the number identifying the current image, which increases each time a new image is started.
+    /// Callers can compare this to the number of the last finished frame they used to only use new frames.
+    /// @return The number of the current image; 0 if no image has been started.
+    std::size_t BackgroundRenderJob::FrameNumber() const
+    {
+        return StartedImageCount;
+    }
+
+    /// Joins the worker threads of any cancelled images whose threads have all stopped, discarding those images.
+    void BackgroundRenderJob::JoinStoppedWorkerThreads()
+    {
+        auto worker_threads_stopped = [](const std::unique_ptr<ImageRender>& cancelled_image)
+        {
+            bool all_worker_threads_stopped = (0 == cancelled_image->RunningWorkerThreadCount.load(std::memory_order_acquire));
+            if (all_worker_threads_stopped)
+            {
+                // Threads have already returned from rendering, so this doesn't wait on any rendering.
+                for (std::thread& worker_thread : cancelled_image->WorkerThreads)
+                {
+                    worker_thread.join();
+                }
+            }
+            return all_worker_threads_stopped;
+        };
+        std::erase_if(CancelledImages, worker_threads_stopped);
+    }
+
+    /// Prepares to render an image.
+    /// @param[in]  ray_tracer - The ray tracer to render with.  Copied so that it may be modified after this call.
+    /// @param[in]  scene - The scene to render.
+    /// @param[in]  render_target - The render target whose dimensions and format the back buffer should have.
+    BackgroundRenderJob::ImageRender::ImageRender(
+        const RayTracingAlgorithm& ray_tracer,
+        const std::shared_ptr<const Scene>& scene,
+        const GRAPHICS::RenderTarget& render_target) :
+        RayTracer(ray_tracer),
+        SceneBeingRendered(scene),
+        BackBuffer(render_target),
+        Tiles(ScreenTile::Partition(render_target.GetWidthInPixels(), render_target.GetHeightInPixels()))
+    {}
+
+    /// Renders tiles until all tiles have been claimed or cancellation is requested.
+    /// Executed by each worker thread.
+    void BackgroundRenderJob::ImageRender::RenderTiles()
+    {
+        while (!CancellationRequested.load(std::memory_order_relaxed))
+        {
+            // CLAIM THE NEXT TILE.
+            std::size_t tile_index = NextTileIndex.fetch_add(1, std::memory_order_relaxed);
+            bool all_tiles_claimed = (tile_index >= Tiles.size());
+            if (all_tiles_claimed)
+            {
+                break;
+            }
+
+            // RENDER THE TILE.
+            // Tiles don't overlap, so each thread writes to different pixels of the back buffer.
+            RayTracer.RenderTile(*SceneBeingRendered, BackBuffer, Tiles[tile_index]);
+            CompletedTileCount.fetch_add(1, std::memory_order_release);
+        }
+
+        // INDICATE THIS THREAD HAS STOPPED.
+        RunningWorkerThreadCount.fetch_sub(1, std::memory_order_release);
+    }
+}
+}
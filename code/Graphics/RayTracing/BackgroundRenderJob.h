@@ -0,0 +1,97 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+#include "Graphics/RayTracing/RayTracingAlgorithm.h"
+#include "Graphics/RayTracing/Scene.h"
+#include "Graphics/RayTracing/ScreenTile.h"
+#include "Graphics/RenderTarget.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// Ray traces a single image on background threads so that the calling thread stays responsive.
+    /// The image is rendered into a back buffer owned by the job, and is only meant to be presented
+    /// once the entire image is finished.  A job may be cancelled at any time (for example, when the
+    /// camera moves), in which case worker threads stop after finishing their current tile.
+    /// Cancelling never waits for worker threads to stop; their threads are only joined once they've
+    /// stopped on their own (or when the job is destroyed), so a caller like a UI thread is never blocked.
+    ///
+    /// The job copies the ray tracer when started, so the original ray tracer (including its camera)
+    /// may be freely modified while the job runs.  The scene is shared rather than copied,
+    /// so it must not be modified until the job has completed.  Cancelled images may continue
+    /// reading the scene until their worker threads finish their current tiles.
+    class BackgroundRenderJob
+    {
+    public:
+        // CONSTRUCTION/DESTRUCTION.
+        explicit BackgroundRenderJob() = default;
+        ~BackgroundRenderJob();
+        BackgroundRenderJob(const BackgroundRenderJob&) = delete;
+        BackgroundRenderJob& operator=(const BackgroundRenderJob&) = delete;
+
+        // RENDERING.
+        void Start(
+            const RayTracingAlgorithm& ray_tracer,
+            const std::shared_ptr<const Scene>& scene,
+            const GRAPHICS::RenderTarget& render_target,
+            const unsigned int thread_count = std::thread::hardware_concurrency());
+        void Cancel();
+        bool IsComplete() const;
+        float CompletionPercentage() const;
+        const GRAPHICS::RenderTarget* FinishedFrame() const;
+        std::size_t FrameNumber() const;
+
+    private:
+        /// A single image being rendered, along with the threads rendering it.
+        /// Kept alive until its worker threads have stopped, even after being cancelled.
+        class ImageRender
+        {
+        public:
+            // CONSTRUCTION.
+            explicit ImageRender(
+                const RayTracingAlgorithm& ray_tracer,
+                const std::shared_ptr<const Scene>& scene,
+                const GRAPHICS::RenderTarget& render_target);
+
+            // RENDERING.
+            void RenderTiles();
+
+            // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+            /// A copy of the ray tracer used to render the image.
+            RayTracingAlgorithm RayTracer;
+            /// The scene being rendered.  Shared to keep it alive while worker threads are using it.
+            std::shared_ptr<const Scene> SceneBeingRendered;
+            /// The back buffer being rendered into.  Only safe to read once the image is complete.
+            GRAPHICS::RenderTarget BackBuffer;
+            /// The tiles of the back buffer to render.
+            std::vector<ScreenTile> Tiles;
+            /// The index of the next tile for a worker thread to claim.
+            std::atomic<std::size_t> NextTileIndex = 0;
+            /// The number of tiles that have been fully rendered.
+            std::atomic<std::size_t> CompletedTileCount = 0;
+            /// True if worker threads should stop rendering as soon as possible.
+            std::atomic<bool> CancellationRequested = false;
+            /// The number of worker threads that haven't yet stopped rendering.
+            std::atomic<unsigned int> RunningWorkerThreadCount = 0;
+            /// The threads rendering tiles.
+            std::vector<std::thread> WorkerThreads = {};
+        };
+
+        // PRIVATE HELPER METHODS.
+        void JoinStoppedWorkerThreads();
+
+        // MEMBER VARIABLES.
+        /// The image currently being rendered, if any.
+        std::unique_ptr<ImageRender> CurrentImage = nullptr;
+        /// Cancelled images whose worker threads may not have stopped yet.
+        std::vector<std::unique_ptr<ImageRender>> CancelledImages = {};
+        /// The number of images that have been started, identifying the current image.
+        std::size_t StartedImageCount = 0;
+    };
+}
+}
@@ -0,0 +1,229 @@
+#include <algorithm>
+#include "Graphics/RayTracing/BoundingVolumeHierarchy.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// Builds the hierarchy over the specified primitives, replacing any previous contents.
+    /// @param[in]  primitive_bounds - The bounds of each primitive, in the same order as the primitives.
+    void BoundingVolumeHierarchy::Build(const std::vector<AxisAlignedBoundingBox>& primitive_bounds)
+    {
+        // CLEAR ANY PREVIOUS CONTENTS.
+        Nodes.clear();
+        PrimitiveIndices.clear();
+        UnboundedPrimitiveIndices.clear();
+
+        // SEPARATE OUT PRIMITIVES THAT CAN'T BE PLACED IN THE TREE.
+        // Infinite bounds would make every node containing them infinitely large, and empty or non-finite
+        // bounds have no meaningful center for partitioning, so such primitives are visited for every ray instead.
+        PrimitiveIndices.reserve(primitive_bounds.size());
+        for (std::size_t primitive_index = 0; primitive_index < primitive_bounds.size(); ++primitive_index)
+        {
+            const AxisAlignedBoundingBox& bounds = primitive_bounds[primitive_index];
+            bool bounds_can_be_partitioned = (bounds.IsFinite() && !bounds.IsEmpty());
+            if (bounds_can_be_partitioned)
+            {
+                PrimitiveIndices.push_back(primitive_index);
+            }
+            else
+            {
+                UnboundedPrimitiveIndices.push_back(primitive_index);
+            }
+        }
+        if (PrimitiveIndices.empty())
+        {
+            return;
+        }
+
+        // COMPUTE THE CENTERS OF EACH PRIMITIVE FOR PARTITIONING.
+        std::vector<MATH::Vector3f> primitive_centers;
+        primitive_centers.reserve(primitive_bounds.size());
+        for (const AxisAlignedBoundingBox& bounds : primitive_bounds)
+        {
+            primitive_centers.push_back(bounds.Center());
+        }
+
+        // BUILD THE TREE STARTING FROM A ROOT CONTAINING ALL PRIMITIVES.
+        // A binary tree has fewer than twice as many nodes as leaves.
+        Nodes.reserve(2 * PrimitiveIndices.size());
+        Node root_node;
+        root_node.FirstPrimitiveIndex = 0;
+        root_node.PrimitiveCount = PrimitiveIndices.size();
+        Nodes.push_back(root_node);
+        constexpr std::size_t ROOT_NODE_INDEX = 0;
+        constexpr std::size_t ROOT_DEPTH = 0;
+        BuildNode(ROOT_NODE_INDEX, ROOT_DEPTH, primitive_bounds, primitive_centers);
+    }
+
+    /// Updates the bounds of all nodes for primitives that have moved, without changing the structure of the tree.
+    /// Refitting is much cheaper than rebuilding, but the tree may become less efficient as primitives move
+    /// further from where they were when the tree was built (see \ref SurfaceAreaHeuristicCost).
+    /// @param[in]  primitive_bounds - The current bounds of each primitive, in the same order as when the tree was built.
+    void BoundingVolumeHierarchy::Refit(const std::vector<AxisAlignedBoundingBox>& primitive_bounds)
+    {
+        // REFIT NODES FROM THE BOTTOM UP.
+        // Child nodes are always added after their parents, so visiting nodes in reverse
+        // order guarantees that children are refit before their parents.
+        for (auto node = Nodes.rbegin(); node != Nodes.rend(); ++node)
+        {
+            AxisAlignedBoundingBox node_bounds;
+            bool is_leaf_node = (node->PrimitiveCount > 0);
+            if (is_leaf_node)
+            {
+                std::size_t end_primitive_index = node->FirstPrimitiveIndex + node->PrimitiveCount;
+                for (std::size_t index = node->FirstPrimitiveIndex; index < end_primitive_index; ++index)
+                {
+                    node_bounds.Expand(primitive_bounds[PrimitiveIndices[index]]);
+                }
+            }
+            else
+            {
+                node_bounds.Expand(Nodes[node->FirstChildIndex].Bounds);
+                node_bounds.Expand(Nodes[node->FirstChildIndex + 1].Bounds);
+            }
+            node->Bounds = node_bounds;
+        }
+    }
+
+    /// Gets the number of primitives in the hierarchy.
+    /// @return The number of primitives.
+    std::size_t BoundingVolumeHierarchy::PrimitiveCount() const
+    {
+        std::size_t primitive_count = PrimitiveIndices.size() + UnboundedPrimitiveIndices.size();
+        return primitive_count;
+    }
+
+    /// Gets the bounds of all primitives in the tree of the hierarchy.
+    /// @return The bounds of the entire tree; empty if no primitives with finite bounds exist.
+    AxisAlignedBoundingBox BoundingVolumeHierarchy::Bounds() const
+    {
+        if (Nodes.empty())
+        {
+            return AxisAlignedBoundingBox();
+        }
+
+        constexpr std::size_t ROOT_NODE_INDEX = 0;
+        return Nodes[ROOT_NODE_INDEX].Bounds;
+    }
+
+    /// Estimates the expected cost of tracing a ray through the hierarchy using the surface area heuristic.
+    /// The probability of a ray hitting a node is proportional to the node's surface area relative to the root,
+    /// so large or heavily overlapping nodes (as can result from refitting moving primitives) increase the cost.
+    /// @return The estimated cost of tracing a ray; 0 if the hierarchy is empty or has no area.
+    float BoundingVolumeHierarchy::SurfaceAreaHeuristicCost() const
+    {
+        // CHECK IF THE HIERARCHY HAS ANY AREA FOR RAYS TO HIT.
+        float root_surface_area = Bounds().SurfaceArea();
+        if (root_surface_area <= 0.0f)
+        {
+            return 0.0f;
+        }
+
+        // SUM THE COSTS OF ALL NODES WEIGHTED BY THEIR PROBABILITY OF BEING HIT.
+        float cost = 0.0f;
+        for (const Node& node : Nodes)
+        {
+            float hit_probability = node.Bounds.SurfaceArea() / root_surface_area;
+            bool is_leaf_node = (node.PrimitiveCount > 0);
+            float node_cost = is_leaf_node ?
+                (static_cast<float>(node.PrimitiveCount) * PRIMITIVE_INTERSECTION_COST) :
+                NODE_TRAVERSAL_COST;
+            cost += hit_probability * node_cost;
+        }
+        return cost;
+    }
+
+    /// Recursively builds a node and its children by splitting the node's primitives
+    /// at the median of their centers along the longest axis.
+    /// @param[in]  node_index - The index of the node to build.  Its primitive range must already be set.
+    /// @param[in]  depth - The depth of the node in the tree.
+    /// @param[in]  primitive_bounds - The bounds of each primitive.
+    /// @param[in]  primitive_centers - The centers of each primitive.
+    void BoundingVolumeHierarchy::BuildNode(
+        const std::size_t node_index,
+        const std::size_t depth,
+        const std::vector<AxisAlignedBoundingBox>& primitive_bounds,
+        const std::vector<MATH::Vector3f>& primitive_centers)
+    {
+        // COMPUTE THE BOUNDS OF THE NODE'S PRIMITIVES.
+        // A copy of the node's primitive range is used since adding child nodes may reallocate the node list.
+        const std::size_t first_primitive_index = Nodes[node_index].FirstPrimitiveIndex;
+        const std::size_t primitive_count = Nodes[node_index].PrimitiveCount;
+        const std::size_t end_primitive_index = first_primitive_index + primitive_count;
+        AxisAlignedBoundingBox node_bounds;
+        AxisAlignedBoundingBox center_bounds;
+        for (std::size_t index = first_primitive_index; index < end_primitive_index; ++index)
+        {
+            std::size_t primitive_index = PrimitiveIndices[index];
+            node_bounds.Expand(primitive_bounds[primitive_index]);
+            center_bounds.Expand(primitive_centers[primitive_index]);
+        }
+        Nodes[node_index].Bounds = node_bounds;
+
+        // CHECK IF THE NODE SHOULD REMAIN A LEAF.
+        bool few_enough_primitives_for_leaf = (primitive_count <= MAX_PRIMITIVE_COUNT_PER_LEAF);
+        bool maximum_depth_reached = (depth >= MAX_DEPTH);
+        if (few_enough_primitives_for_leaf || maximum_depth_reached)
+        {
+            return;
+        }
+
+        // FIND THE LONGEST AXIS OF THE PRIMITIVE CENTERS.
+        // Splitting along this axis tends to produce the most separated children.
+        MATH::Vector3f center_extent = center_bounds.Size();
+        float MATH::Vector3f::* longest_axis = &MATH::Vector3f::X;
+        if (center_extent.Y > center_extent.*longest_axis)
+        {
+            longest_axis = &MATH::Vector3f::Y;
+        }
+        if (center_extent.Z > center_extent.*longest_axis)
+        {
+            longest_axis = &MATH::Vector3f::Z;
+        }
+
+        // CHECK IF THE PRIMITIVES CAN BE SEPARATED.
+        // If all centers are at the same point, then no split would help.
+        bool primitives_can_be_separated = (center_extent.*longest_axis > 0.0f);
+        if (!primitives_can_be_separated)
+        {
+            return;
+        }
+
+        // PARTITION THE PRIMITIVES AT THE MEDIAN CENTER ALONG THE LONGEST AXIS.
+        auto first_primitive = PrimitiveIndices.begin() + first_primitive_index;
+        auto end_primitive = PrimitiveIndices.begin() + end_primitive_index;
+        const std::size_t first_child_primitive_count = primitive_count / 2;
+        auto median_primitive = first_primitive + first_child_primitive_count;
+        std::nth_element(
+            first_primitive,
+            median_primitive,
+            end_primitive,
+            [&](const std::size_t lhs_primitive_index, const std::size_t rhs_primitive_index)
+            {
+                return primitive_centers[lhs_primitive_index].*longest_axis < primitive_centers[rhs_primitive_index].*longest_axis;
+            });
+
+        // CREATE THE CHILD NODES.
+        Node first_child;
+        first_child.FirstPrimitiveIndex = first_primitive_index;
+        first_child.PrimitiveCount = first_child_primitive_count;
+        Node second_child;
+        second_child.FirstPrimitiveIndex = first_primitive_index + first_child_primitive_count;
+        second_child.PrimitiveCount = primitive_count - first_child_primitive_count;
+
+        const std::size_t first_child_index = Nodes.size();
+        Nodes.push_back(first_child);
+        Nodes.push_back(second_child);
+
+        // CONVERT THE CURRENT NODE TO AN INTERIOR NODE.
+        Nodes[node_index].FirstChildIndex = first_child_index;
+        Nodes[node_index].PrimitiveCount = 0;
+
+        // BUILD THE CHILD NODES.
+        const std::size_t child_depth = depth + 1;
+        BuildNode(first_child_index, child_depth, primitive_bounds, primitive_centers);
+        BuildNode(first_child_index + 1, child_depth, primitive_bounds, primitive_centers);
+    }
+}
+}
@@ -0,0 +1,217 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+#include "Graphics/RayTracing/AxisAlignedBoundingBox.h"
+#include "Graphics/RayTracing/Ray.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// A binary tree of bounding boxes over some primitives (objects, triangles, etc.),
+    /// allowing rays to skip over large groups of primitives they cannot hit.
+    /// The hierarchy only stores indices to primitives, so the primitives themselves
+    /// are managed externally and must keep the same order as when the hierarchy was built.
+    /// Primitives with infinite bounds (like planes), or with empty bounds, are kept outside of the tree and visited for every ray.
+    class BoundingVolumeHierarchy
+    {
+    public:
+        // STATIC CONSTANTS.
+        /// The maximum number of primitives stored in a single leaf node.
+        static constexpr std::size_t MAX_PRIMITIVE_COUNT_PER_LEAF = 4;
+        /// The maximum depth of the tree.  Primitives beyond this depth are kept in
+        /// larger leaves, which allows traversal to use a fixed-size stack.
+        static constexpr std::size_t MAX_DEPTH = 48;
+        /// The relative cost of traversing an interior node, for estimating the quality of the hierarchy.
+        static constexpr float NODE_TRAVERSAL_COST = 1.0f;
+        /// The relative cost of intersecting a single primitive, for estimating the quality of the hierarchy.
+        static constexpr float PRIMITIVE_INTERSECTION_COST = 1.0f;
+
+        /// A single node in the hierarchy.
+        class Node
+        {
+        public:
+            // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+            /// The bounds of all primitives under this node.
+            AxisAlignedBoundingBox Bounds = AxisAlignedBoundingBox();
+            /// The index of the first child node, if this is an interior node.
+            /// The second child immediately follows the first.
+            std::size_t FirstChildIndex = 0;
+            /// The index into the primitive index list of the first primitive, if this is a leaf node.
+            std::size_t FirstPrimitiveIndex = 0;
+            /// The number of primitives in this node.  Only leaf nodes have primitives.
+            std::size_t PrimitiveCount = 0;
+        };
+
+        // CONSTRUCTION.
+        void Build(const std::vector<AxisAlignedBoundingBox>& primitive_bounds);
+        void Refit(const std::vector<AxisAlignedBoundingBox>& primitive_bounds);
+
+        // OTHER METHODS.
+        std::size_t PrimitiveCount() const;
+        AxisAlignedBoundingBox Bounds() const;
+        float SurfaceAreaHeuristicCost() const;
+        template <typename PrimitiveVisitor>
+        void VisitPrimitives(
+            const Ray& ray,
+            const float& max_distance,
+            PrimitiveVisitor&& visit_primitive,
+            std::size_t* const traversal_step_count = nullptr) const;
+        template <typename BoundsPredicate, typename PrimitiveVisitor>
+        void VisitOverlappingPrimitives(BoundsPredicate&& overlaps_bounds, PrimitiveVisitor&& visit_primitive) const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The nodes of the tree, with the root node first.
+        std::vector<Node> Nodes = {};
+        /// Indices of primitives, ordered so that each leaf's primitives are contiguous.
+        std::vector<std::size_t> PrimitiveIndices = {};
+        /// Indices of primitives with infinite or empty bounds, which aren't in any node.
+        std::vector<std::size_t> UnboundedPrimitiveIndices = {};
+
+    private:
+        // PRIVATE HELPER METHODS.
+        void BuildNode(
+            const std::size_t node_index,
+            const std::size_t depth,
+            const std::vector<AxisAlignedBoundingBox>& primitive_bounds,
+            const std::vector<MATH::Vector3f>& primitive_centers);
+    };
+
+    /// Visits all primitives whose bounding boxes are intersected by a ray.
+    /// @tparam PrimitiveVisitor - A callable type taking a primitive index and returning a bool.
+    /// @param[in]  ray - The ray to check for intersection.
+    /// @param[in]  max_distance - The maximum distance (in units of the ray) at which intersections count.
+    ///     Passed by reference so that visitors searching for the closest intersection can shrink it
+    ///     as closer intersections are found, allowing more of the hierarchy to be skipped.
+    /// @param[in]  visit_primitive - The visitor to call for each primitive.
+    ///     Returning true stops traversal early (useful when any intersection is sufficient).
+    /// @param[in,out]  traversal_step_count - If provided, incremented for each node visited (for statistics).
+    template <typename PrimitiveVisitor>
+    void BoundingVolumeHierarchy::VisitPrimitives(
+        const Ray& ray,
+        const float& max_distance,
+        PrimitiveVisitor&& visit_primitive,
+        std::size_t* const traversal_step_count) const
+    {
+        // VISIT ANY PRIMITIVES NOT IN THE TREE.
+        for (std::size_t primitive_index : UnboundedPrimitiveIndices)
+        {
+            bool stop_traversal = visit_primitive(primitive_index);
+            if (stop_traversal)
+            {
+                return;
+            }
+        }
+
+        // CHECK IF THERE IS ANYTHING TO VISIT IN THE TREE.
+        if (Nodes.empty())
+        {
+            return;
+        }
+
+        // COMPUTE THE INVERSE RAY DIRECTION ONCE FOR ALL BOUNDING BOX CHECKS.
+        MATH::Vector3f inverse_ray_direction(
+            1.0f / ray.Direction.X,
+            1.0f / ray.Direction.Y,
+            1.0f / ray.Direction.Z);
+
+        // TRAVERSE THE TREE FROM THE ROOT.
+        // A fixed-size stack avoids allocating memory for every ray.
+        std::array<std::size_t, MAX_DEPTH + 1> node_indices_to_visit;
+        std::size_t node_to_visit_count = 0;
+        constexpr std::size_t ROOT_NODE_INDEX = 0;
+        node_indices_to_visit[node_to_visit_count++] = ROOT_NODE_INDEX;
+        while (node_to_visit_count > 0)
+        {
+            // SKIP THE NODE IF THE RAY DOESN'T HIT IT.
+            const Node& node = Nodes[node_indices_to_visit[--node_to_visit_count]];
+            if (traversal_step_count)
+            {
+                ++(*traversal_step_count);
+            }
+            bool ray_hits_node = node.Bounds.Intersects(ray, inverse_ray_direction, max_distance);
+            if (!ray_hits_node)
+            {
+                continue;
+            }
+
+            // VISIT ANY PRIMITIVES IN A LEAF NODE.
+            bool is_leaf_node = (node.PrimitiveCount > 0);
+            if (is_leaf_node)
+            {
+                std::size_t end_primitive_index = node.FirstPrimitiveIndex + node.PrimitiveCount;
+                for (std::size_t primitive_index = node.FirstPrimitiveIndex; primitive_index < end_primitive_index; ++primitive_index)
+                {
+                    bool stop_traversal = visit_primitive(PrimitiveIndices[primitive_index]);
+                    if (stop_traversal)
+                    {
+                        return;
+                    }
+                }
+                continue;
+            }
+
+            // VISIT THE CHILDREN OF AN INTERIOR NODE.
+            node_indices_to_visit[node_to_visit_count++] = node.FirstChildIndex + 1;
+            node_indices_to_visit[node_to_visit_count++] = node.FirstChildIndex;
+        }
+    }
+
+    /// Visits all primitives whose bounding boxes overlap some volume (such as a frustum),
+    /// skipping any subtrees whose bounds don't overlap it.
+    /// @tparam BoundsPredicate - A callable type taking a const AxisAlignedBoundingBox reference and
+    ///     returning true if the box may overlap the volume.
+    /// @tparam PrimitiveVisitor - A callable type taking a primitive index.
+    /// @param[in]  overlaps_bounds - The check for whether bounds overlap the volume.
+    /// @param[in]  visit_primitive - The visitor to call for each primitive.  Each primitive is visited at most once.
+    ///     Primitives with infinite or empty bounds are always visited.
+    template <typename BoundsPredicate, typename PrimitiveVisitor>
+    void BoundingVolumeHierarchy::VisitOverlappingPrimitives(BoundsPredicate&& overlaps_bounds, PrimitiveVisitor&& visit_primitive) const
+    {
+        // VISIT ANY PRIMITIVES NOT IN THE TREE.
+        for (std::size_t primitive_index : UnboundedPrimitiveIndices)
+        {
+            visit_primitive(primitive_index);
+        }
+
+        // CHECK IF THERE IS ANYTHING TO VISIT IN THE TREE.
+        if (Nodes.empty())
+        {
+            return;
+        }
+
+        // TRAVERSE THE TREE FROM THE ROOT.
+        std::array<std::size_t, MAX_DEPTH + 1> node_indices_to_visit;
+        std::size_t node_to_visit_count = 0;
+        constexpr std::size_t ROOT_NODE_INDEX = 0;
+        node_indices_to_visit[node_to_visit_count++] = ROOT_NODE_INDEX;
+        while (node_to_visit_count > 0)
+        {
+            // SKIP THE NODE IF IT DOESN'T OVERLAP THE VOLUME.
+            const Node& node = Nodes[node_indices_to_visit[--node_to_visit_count]];
+            if (!overlaps_bounds(node.Bounds))
+            {
+                continue;
+            }
+
+            // VISIT ANY PRIMITIVES IN A LEAF NODE.
+            bool is_leaf_node = (node.PrimitiveCount > 0);
+            if (is_leaf_node)
+            {
+                std::size_t end_primitive_index = node.FirstPrimitiveIndex + node.PrimitiveCount;
+                for (std::size_t primitive_index = node.FirstPrimitiveIndex; primitive_index < end_primitive_index; ++primitive_index)
+                {
+                    visit_primitive(PrimitiveIndices[primitive_index]);
+                }
+                continue;
+            }
+
+            // VISIT THE CHILDREN OF AN INTERIOR NODE.
+            node_indices_to_visit[node_to_visit_count++] = node.FirstChildIndex + 1;
+            node_indices_to_visit[node_to_visit_count++] = node.FirstChildIndex;
+        }
+    }
+}
+}
@@ -0,0 +1,384 @@
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <utility>
+#include "Graphics/RayTracing/Denoiser.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// Denoises an image, writing the result to a render target.
+    /// @param[in]  noisy_image - The image to denoise, including the surface features seen by its samples.
+    /// @param[in,out]  render_target - The render target to write the denoised image to.
+    ///     Must have the same dimensions as the noisy image.
+    /// @param[in]  thread_count - The number of threads to denoise with.  At least 1 thread is always used.
+    void Denoiser::Denoise(
+        const AccumulationBuffer& noisy_image,
+        GRAPHICS::RenderTarget& render_target,
+        const unsigned int thread_count) const
+    {
+        // SPLIT THE IMAGE INTO SEPARATE PLANES.
+        unsigned int width_in_pixels = noisy_image.GetWidthInPixels();
+        unsigned int height_in_pixels = noisy_image.GetHeightInPixels();
+        std::size_t pixel_count = static_cast<std::size_t>(width_in_pixels) * height_in_pixels;
+        Planes image;
+        image.Red.resize(pixel_count);
+        image.Green.resize(pixel_count);
+        image.Blue.resize(pixel_count);
+        FeaturePlanes features = AllocateFeaturePlanes(pixel_count);
+        for (unsigned int y = 0; y < height_in_pixels; ++y)
+        {
+            for (unsigned int x = 0; x < width_in_pixels; ++x)
+            {
+                std::size_t pixel_index = (static_cast<std::size_t>(y) * width_in_pixels) + x;
+
+                MATH::Vector3f mean_radiance = noisy_image.MeanRadiance(x, y);
+                image.Red[pixel_index] = mean_radiance.X;
+                image.Green[pixel_index] = mean_radiance.Y;
+                image.Blue[pixel_index] = mean_radiance.Z;
+
+                SurfaceFeatures mean_features = noisy_image.MeanFeatures(x, y);
+                features.AlbedoRed[pixel_index] = mean_features.Albedo.X;
+                features.AlbedoGreen[pixel_index] = mean_features.Albedo.Y;
+                features.AlbedoBlue[pixel_index] = mean_features.Albedo.Z;
+                features.NormalX[pixel_index] = mean_features.Normal.X;
+                features.NormalY[pixel_index] = mean_features.Normal.Y;
+                features.NormalZ[pixel_index] = mean_features.Normal.Z;
+                features.Depth[pixel_index] = mean_features.Depth;
+                bool pixel_has_samples = (noisy_image.Pixels(x, y).SampleCount > 0);
+                features.SampleWeight[pixel_index] = pixel_has_samples ? 1.0f : 0.0f;
+            }
+        }
+
+        // FILTER THE IMAGE.
+        Filter(width_in_pixels, height_in_pixels, features, thread_count, image, render_target);
+    }
+
+    /// Denoises an image rendered by the ray tracer, writing the result to a render target.
+    /// Useful when the ray tracer's lighting is noisy, such as with many-light sampling.
+    /// @param[in]  noisy_image - The image to denoise.
+    /// @param[in]  geometry_buffer - The primary hits for each pixel of the image, providing the surface features.
+    ///     Must have the same dimensions as the noisy image.
+    /// @param[in,out]  render_target - The render target to write the denoised image to.
+    ///     Must have the same dimensions as the noisy image but may be the noisy image itself.
+    /// @param[in]  thread_count - The number of threads to denoise with.  At least 1 thread is always used.
+    void Denoiser::Denoise(
+        const GRAPHICS::RenderTarget& noisy_image,
+        const GeometryBuffer& geometry_buffer,
+        GRAPHICS::RenderTarget& render_target,
+        const unsigned int thread_count) const
+    {
+        // SPLIT THE IMAGE INTO SEPARATE PLANES.
+        unsigned int width_in_pixels = noisy_image.GetWidthInPixels();
+        unsigned int height_in_pixels = noisy_image.GetHeightInPixels();
+        std::size_t pixel_count = static_cast<std::size_t>(width_in_pixels) * height_in_pixels;
+        Planes image;
+        image.Red.resize(pixel_count);
+        image.Green.resize(pixel_count);
+        image.Blue.resize(pixel_count);
+        FeaturePlanes features = AllocateFeaturePlanes(pixel_count);
+        for (unsigned int y = 0; y < height_in_pixels; ++y)
+        {
+            for (unsigned int x = 0; x < width_in_pixels; ++x)
+            {
+                std::size_t pixel_index = (static_cast<std::size_t>(y) * width_in_pixels) + x;
+
+                Color color = noisy_image.GetPixel(x, y);
+                image.Red[pixel_index] = color.Red;
+                image.Green[pixel_index] = color.Green;
+                image.Blue[pixel_index] = color.Blue;
+
+                // GET THE FEATURES OF THE SURFACE SEEN THROUGH THE PIXEL.
+                // Like for path traced images, pixels seeing only the background have its color as their albedo,
+                // and normals are flipped to face the camera.
+                const GeometryBuffer::PrimaryHit& primary_hit = geometry_buffer.PrimaryHits(x, y);
+                features.SampleWeight[pixel_index] = 1.0f;
+                if (!primary_hit.Object)
+                {
+                    features.AlbedoRed[pixel_index] = color.Red;
+                    features.AlbedoGreen[pixel_index] = color.Green;
+                    features.AlbedoBlue[pixel_index] = color.Blue;
+                    continue;
+                }
+
+                const Material* material = primary_hit.Object->IntersectionMaterial(primary_hit.Intersection());
+                features.AlbedoRed[pixel_index] = material->DiffuseColor.Red;
+                features.AlbedoGreen[pixel_index] = material->DiffuseColor.Green;
+                features.AlbedoBlue[pixel_index] = material->DiffuseColor.Blue;
+                MATH::Vector3f unit_surface_normal = primary_hit.UnitSurfaceNormal;
+                if (MATH::Vector3f::DotProduct(unit_surface_normal, primary_hit.ViewingRay.Direction) > 0.0f)
+                {
+                    unit_surface_normal = -unit_surface_normal;
+                }
+                features.NormalX[pixel_index] = unit_surface_normal.X;
+                features.NormalY[pixel_index] = unit_surface_normal.Y;
+                features.NormalZ[pixel_index] = unit_surface_normal.Z;
+                features.Depth[pixel_index] = primary_hit.DistanceFromRayToObject;
+            }
+        }
+
+        // FILTER THE IMAGE.
+        Filter(width_in_pixels, height_in_pixels, features, thread_count, image, render_target);
+    }
+
+    /// Allocates zeroed surface feature planes.
+    /// @param[in]  pixel_count - The number of pixels in each plane.
+    /// @return The allocated feature planes.
+    Denoiser::FeaturePlanes Denoiser::AllocateFeaturePlanes(const std::size_t pixel_count)
+    {
+        FeaturePlanes features;
+        features.AlbedoRed.resize(pixel_count);
+        features.AlbedoGreen.resize(pixel_count);
+        features.AlbedoBlue.resize(pixel_count);
+        features.NormalX.resize(pixel_count);
+        features.NormalY.resize(pixel_count);
+        features.NormalZ.resize(pixel_count);
+        features.Depth.resize(pixel_count);
+        features.SampleWeight.resize(pixel_count);
+        return features;
+    }
+
+    /// Applies all iterations of the filter to an image, writing the result to a render target.
+    /// @param[in]  width_in_pixels - The width of the image.
+    /// @param[in]  height_in_pixels - The height of the image.
+    /// @param[in]  features - The surface features guiding the filter.
+    /// @param[in]  thread_count - The number of threads to filter with.  At least 1 thread is always used.
+    /// @param[in,out]  image - The image to filter.  Used as scratch space while filtering.
+    /// @param[in,out]  render_target - The render target to write the filtered image to.
+    void Denoiser::Filter(
+        const unsigned int width_in_pixels,
+        const unsigned int height_in_pixels,
+        const FeaturePlanes& features,
+        const unsigned int thread_count,
+        Planes& image,
+        GRAPHICS::RenderTarget& render_target) const
+    {
+        // ALLOCATE SCRATCH SPACE FOR EACH THREAD.
+        // This is done once up front so that filtering rows doesn't need any allocations.
+        unsigned int worker_thread_count = std::max(1u, thread_count);
+        worker_thread_count = std::min(worker_thread_count, std::max(1u, height_in_pixels));
+        std::vector<RowSums> row_sums_by_thread(worker_thread_count);
+        for (RowSums& row_sums : row_sums_by_thread)
+        {
+            row_sums.WeightedRed.resize(width_in_pixels);
+            row_sums.WeightedGreen.resize(width_in_pixels);
+            row_sums.WeightedBlue.resize(width_in_pixels);
+            row_sums.Weights.resize(width_in_pixels);
+        }
+
+        // FILTER THE IMAGE WITH PROGRESSIVELY WIDER KERNELS.
+        Planes& input = image;
+        Planes output = image;
+        for (unsigned int iteration_index = 0; iteration_index < IterationCount; ++iteration_index)
+        {
+            // DEFINE HOW TO FILTER ROWS UNTIL ALL HAVE BEEN CLAIMED.
+            // Each row is only written by a single thread and only reads from the previous iteration's output.
+            unsigned int step_in_pixels = 1u << iteration_index;
+            float color_sigma = ColorSigma / static_cast<float>(step_in_pixels);
+            std::atomic<unsigned int> next_row_index = 0;
+            auto filter_rows = [&](RowSums& row_sums)
+            {
+                while (true)
+                {
+                    unsigned int y = next_row_index.fetch_add(1, std::memory_order_relaxed);
+                    bool all_rows_claimed = (y >= height_in_pixels);
+                    if (all_rows_claimed)
+                    {
+                        return;
+                    }
+
+                    FilterRow(y, width_in_pixels, height_in_pixels, step_in_pixels, color_sigma, features, input, row_sums, output);
+                }
+            };
+
+            // FILTER ALL ROWS.
+            if (worker_thread_count <= 1)
+            {
+                filter_rows(row_sums_by_thread.front());
+            }
+            else
+            {
+                std::vector<std::thread> worker_threads;
+                worker_threads.reserve(worker_thread_count);
+                for (RowSums& row_sums : row_sums_by_thread)
+                {
+                    worker_threads.emplace_back(filter_rows, std::ref(row_sums));
+                }
+                for (std::thread& worker_thread : worker_threads)
+                {
+                    worker_thread.join();
+                }
+            }
+
+            // USE THIS ITERATION'S OUTPUT AS THE NEXT ITERATION'S INPUT.
+            std::swap(input, output);
+        }
+
+        // WRITE THE DENOISED IMAGE TO THE RENDER TARGET.
+        for (unsigned int y = 0; y < height_in_pixels; ++y)
+        {
+            for (unsigned int x = 0; x < width_in_pixels; ++x)
+            {
+                std::size_t pixel_index = (static_cast<std::size_t>(y) * width_in_pixels) + x;
+                Color color(input.Red[pixel_index], input.Green[pixel_index], input.Blue[pixel_index], Color::MAX_FLOAT_COLOR_COMPONENT);
+                color.Clamp();
+                render_target.WritePixel(x, y, color);
+            }
+        }
+    }
+
+    /// Applies a single iteration of the filter to a row of pixels.
+    /// @param[in]  y - The y coordinate of the row to filter.
+    /// @param[in]  width_in_pixels - The width of the image.
+    /// @param[in]  height_in_pixels - The height of the image.
+    /// @param[in]  step_in_pixels - The distance between neighboring kernel taps for this iteration.
+    /// @param[in]  color_sigma - The allowed color difference for this iteration.
+    /// @param[in]  features - The surface features guiding the filter.
+    /// @param[in]  input - The image to filter.
+    /// @param[in,out]  row_sums - Scratch space for the row's weighted sums.  Must have an entry for each pixel in the row.
+    /// @param[out]  output - The image to write the filtered row to.
+    void Denoiser::FilterRow(
+        const unsigned int y,
+        const unsigned int width_in_pixels,
+        const unsigned int height_in_pixels,
+        const unsigned int step_in_pixels,
+        const float color_sigma,
+        const FeaturePlanes& features,
+        const Planes& input,
+        RowSums& row_sums,
+        Planes& output) const
+    {
+        // INITIALIZE THE WEIGHTED SUMS FOR THE ROW.
+        std::fill(row_sums.WeightedRed.begin(), row_sums.WeightedRed.end(), 0.0f);
+        std::fill(row_sums.WeightedGreen.begin(), row_sums.WeightedGreen.end(), 0.0f);
+        std::fill(row_sums.WeightedBlue.begin(), row_sums.WeightedBlue.end(), 0.0f);
+        std::fill(row_sums.Weights.begin(), row_sums.Weights.end(), 0.0f);
+
+        // PRECOMPUTE THE SCALES FOR EACH TYPE OF DIFFERENCE.
+        // A tiny minimum avoids dividing by zero if any sigma is zero.
+        constexpr float MIN_SIGMA = 1e-6f;
+        float inverse_squared_color_sigma = 1.0f / std::max(MIN_SIGMA, color_sigma * color_sigma);
+        float inverse_squared_albedo_sigma = 1.0f / std::max(MIN_SIGMA, AlbedoSigma * AlbedoSigma);
+        float inverse_squared_normal_sigma = 1.0f / std::max(MIN_SIGMA, NormalSigma * NormalSigma);
+
+        // ADD CONTRIBUTIONS FROM EACH TAP OF THE KERNEL.
+        constexpr int KERNEL_RADIUS = 2;
+        constexpr float KERNEL_WEIGHTS[] = { 1.0f / 16.0f, 1.0f / 4.0f, 3.0f / 8.0f, 1.0f / 4.0f, 1.0f / 16.0f };
+        const int width = static_cast<int>(width_in_pixels);
+        const int height = static_cast<int>(height_in_pixels);
+        const int step = static_cast<int>(step_in_pixels);
+        const std::size_t row_start_index = static_cast<std::size_t>(y) * width_in_pixels;
+        for (int tap_y_index = -KERNEL_RADIUS; tap_y_index <= KERNEL_RADIUS; ++tap_y_index)
+        {
+            // SKIP TAPS OUTSIDE THE IMAGE.
+            int tap_row_offset = tap_y_index * step;
+            int tap_y = static_cast<int>(y) + tap_row_offset;
+            bool tap_row_in_image = (0 <= tap_y) && (tap_y < height);
+            if (!tap_row_in_image)
+            {
+                continue;
+            }
+            const std::size_t tap_row_start_index = static_cast<std::size_t>(tap_y) * width_in_pixels;
+
+            for (int tap_x_index = -KERNEL_RADIUS; tap_x_index <= KERNEL_RADIUS; ++tap_x_index)
+            {
+                // DETERMINE WHICH PIXELS IN THE ROW HAVE THIS TAP WITHIN THE IMAGE.
+                // Limiting the range up front keeps bounds checks out of the inner loop.
+                int tap_column_offset = tap_x_index * step;
+                int begin_x = std::max(0, -tap_column_offset);
+                int end_x = std::min(width, width - tap_column_offset);
+                if (begin_x >= end_x)
+                {
+                    continue;
+                }
+
+                // COMPUTE THE PARTS OF THE WEIGHT THAT ARE THE SAME FOR THE WHOLE ROW.
+                float kernel_weight = KERNEL_WEIGHTS[tap_x_index + KERNEL_RADIUS] * KERNEL_WEIGHTS[tap_y_index + KERNEL_RADIUS];
+                float tap_distance_in_pixels = std::sqrt(static_cast<float>(
+                    (tap_column_offset * tap_column_offset) + (tap_row_offset * tap_row_offset)));
+                float depth_sigma = DepthSigma * tap_distance_in_pixels;
+
+                // POINT TO THE FIRST CENTER AND TAP PIXELS IN RANGE.
+                const std::size_t center_start_index = row_start_index + static_cast<std::size_t>(begin_x);
+                const float* center_red = input.Red.data() + center_start_index;
+                const float* center_green = input.Green.data() + center_start_index;
+                const float* center_blue = input.Blue.data() + center_start_index;
+                const float* center_albedo_red = features.AlbedoRed.data() + center_start_index;
+                const float* center_albedo_green = features.AlbedoGreen.data() + center_start_index;
+                const float* center_albedo_blue = features.AlbedoBlue.data() + center_start_index;
+                const float* center_normal_x = features.NormalX.data() + center_start_index;
+                const float* center_normal_y = features.NormalY.data() + center_start_index;
+                const float* center_normal_z = features.NormalZ.data() + center_start_index;
+                const float* center_depth = features.Depth.data() + center_start_index;
+
+                const std::size_t tap_start_index = tap_row_start_index + static_cast<std::size_t>(begin_x + tap_column_offset);
+                const float* tap_red = input.Red.data() + tap_start_index;
+                const float* tap_green = input.Green.data() + tap_start_index;
+                const float* tap_blue = input.Blue.data() + tap_start_index;
+                const float* tap_albedo_red = features.AlbedoRed.data() + tap_start_index;
+                const float* tap_albedo_green = features.AlbedoGreen.data() + tap_start_index;
+                const float* tap_albedo_blue = features.AlbedoBlue.data() + tap_start_index;
+                const float* tap_normal_x = features.NormalX.data() + tap_start_index;
+                const float* tap_normal_y = features.NormalY.data() + tap_start_index;
+                const float* tap_normal_z = features.NormalZ.data() + tap_start_index;
+                const float* tap_depth = features.Depth.data() + tap_start_index;
+                const float* tap_sample_weight = features.SampleWeight.data() + tap_start_index;
+
+                float* red_sums = row_sums.WeightedRed.data() + begin_x;
+                float* green_sums = row_sums.WeightedGreen.data() + begin_x;
+                float* blue_sums = row_sums.WeightedBlue.data() + begin_x;
+                float* total_weights = row_sums.Weights.data() + begin_x;
+
+                // ADD THE TAP'S CONTRIBUTION TO EACH PIXEL IN THE ROW.
+                // All differences are combined into a single exponent so that only one exponential is needed per tap.
+                const int pixel_count = end_x - begin_x;
+                for (int x = 0; x < pixel_count; ++x)
+                {
+                    float red_difference = tap_red[x] - center_red[x];
+                    float green_difference = tap_green[x] - center_green[x];
+                    float blue_difference = tap_blue[x] - center_blue[x];
+                    float squared_color_distance = (red_difference * red_difference) + (green_difference * green_difference) + (blue_difference * blue_difference);
+
+                    float albedo_red_difference = tap_albedo_red[x] - center_albedo_red[x];
+                    float albedo_green_difference = tap_albedo_green[x] - center_albedo_green[x];
+                    float albedo_blue_difference = tap_albedo_blue[x] - center_albedo_blue[x];
+                    float squared_albedo_distance = (albedo_red_difference * albedo_red_difference) + (albedo_green_difference * albedo_green_difference) + (albedo_blue_difference * albedo_blue_difference);
+
+                    float normal_x_difference = tap_normal_x[x] - center_normal_x[x];
+                    float normal_y_difference = tap_normal_y[x] - center_normal_y[x];
+                    float normal_z_difference = tap_normal_z[x] - center_normal_z[x];
+                    float squared_normal_distance = (normal_x_difference * normal_x_difference) + (normal_y_difference * normal_y_difference) + (normal_z_difference * normal_z_difference);
+
+                    float depth_difference = std::abs(tap_depth[x] - center_depth[x]);
+                    float allowed_depth_difference = (depth_sigma * std::max(tap_depth[x], center_depth[x])) + MIN_SIGMA;
+
+                    float exponent =
+                        (squared_color_distance * inverse_squared_color_sigma) +
+                        (squared_albedo_distance * inverse_squared_albedo_sigma) +
+                        (squared_normal_distance * inverse_squared_normal_sigma) +
+                        (depth_difference / allowed_depth_difference);
+                    float weight = kernel_weight * tap_sample_weight[x] * std::exp(-exponent);
+
+                    red_sums[x] += weight * tap_red[x];
+                    green_sums[x] += weight * tap_green[x];
+                    blue_sums[x] += weight * tap_blue[x];
+                    total_weights[x] += weight;
+                }
+            }
+        }
+
+        // NORMALIZE THE WEIGHTED SUMS.
+        // Pixels without any contributing taps (only possible if nothing nearby has samples) are left black.
+        for (unsigned int x = 0; x < width_in_pixels; ++x)
+        {
+            std::size_t pixel_index = row_start_index + x;
+            float inverse_weight_sum = (row_sums.Weights[x] > 0.0f) ? (1.0f / row_sums.Weights[x]) : 0.0f;
+            output.Red[pixel_index] = row_sums.WeightedRed[x] * inverse_weight_sum;
+            output.Green[pixel_index] = row_sums.WeightedGreen[x] * inverse_weight_sum;
+            output.Blue[pixel_index] = row_sums.WeightedBlue[x] * inverse_weight_sum;
+        }
+    }
+}
+}
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <thread>
+#include <vector>
+#include "Graphics/RayTracing/AccumulationBuffer.h"
+#include "Graphics/RayTracing/GeometryBuffer.h"
+#include "Graphics/RenderTarget.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// Removes noise from images rendered with only a few samples per pixel, using an
+    /// edge-avoiding à-trous wavelet filter (Dammertz et al., "Edge-Avoiding À-Trous Wavelet
+    /// Transform for fast Global Illumination Filtering").
+    ///
+    /// Each iteration blurs the image with a 5x5 B3-spline kernel whose taps are spread twice as far
+    /// apart as in the previous iteration, so a few cheap iterations cover a large area.  Each tap is
+    /// weighted by how similar its color, albedo, normal, and depth are to the center pixel's, so blurring
+    /// stops at the edges of objects, materials, and shadows.  The surface features used for this are
+    /// captured during tracing and are nearly noise-free even when lighting is very noisy.
+    /// Images may come from the path tracer (with features accumulated alongside samples) or from
+    /// the ray tracer (with features taken from its cached primary hits).
+    ///
+    /// The image is stored as separate planes of floats for each channel, and each kernel tap is applied
+    /// across an entire row at once, so the innermost loops run over contiguous memory without branches
+    /// and can be vectorized by the compiler.  Rows are distributed across threads, and results don't
+    /// depend on the number of threads.
+    class Denoiser
+    {
+    public:
+        // DENOISING.
+        void Denoise(
+            const AccumulationBuffer& noisy_image,
+            GRAPHICS::RenderTarget& render_target,
+            const unsigned int thread_count = std::thread::hardware_concurrency()) const;
+        void Denoise(
+            const GRAPHICS::RenderTarget& noisy_image,
+            const GeometryBuffer& geometry_buffer,
+            GRAPHICS::RenderTarget& render_target,
+            const unsigned int thread_count = std::thread::hardware_concurrency()) const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The number of filtering iterations.  The filter covers a (4 * 2^iterations + 1) pixel wide area.
+        unsigned int IterationCount = 5;
+        /// How different colors may be (as the distance between their red, green, and blue components)
+        /// before they're not blurred together.  Halved with each iteration so that later, wider iterations
+        /// only blur remaining noise rather than real detail.
+        float ColorSigma = 1.0f;
+        /// How different albedos may be before they're not blurred together.
+        float AlbedoSigma = 0.1f;
+        /// How different normals may be (as the distance between them) before they're not blurred together.
+        float NormalSigma = 0.5f;
+        /// How different depths may be, relative to the farther depth and per pixel of distance
+        /// between the pixels, before they're not blurred together.
+        float DepthSigma = 0.05f;
+
+    private:
+        /// The image being filtered, stored with a separate plane of values for each channel.
+        class Planes
+        {
+        public:
+            // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+            /// The red radiance of each pixel, in row-major order.
+            std::vector<float> Red = {};
+            /// The green radiance of each pixel, in row-major order.
+            std::vector<float> Green = {};
+            /// The blue radiance of each pixel, in row-major order.
+            std::vector<float> Blue = {};
+        };
+
+        /// The surface features guiding the filter, stored with a separate plane of values for each channel.
+        class FeaturePlanes
+        {
+        public:
+            // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+            /// The red albedo of each pixel, in row-major order.
+            std::vector<float> AlbedoRed = {};
+            /// The green albedo of each pixel, in row-major order.
+            std::vector<float> AlbedoGreen = {};
+            /// The blue albedo of each pixel, in row-major order.
+            std::vector<float> AlbedoBlue = {};
+            /// The X component of each pixel's normal, in row-major order.
+            std::vector<float> NormalX = {};
+            /// The Y component of each pixel's normal, in row-major order.
+            std::vector<float> NormalY = {};
+            /// The Z component of each pixel's normal, in row-major order.
+            std::vector<float> NormalZ = {};
+            /// The depth of each pixel, in row-major order.
+            std::vector<float> Depth = {};
+            /// 1 for pixels with samples and 0 for pixels without, in row-major order.
+            /// Pixels without samples don't contribute to their neighbors.
+            std::vector<float> SampleWeight = {};
+        };
+
+        /// The weighted sums for filtering a single row, kept by each thread so that they can be reused for every row.
+        class RowSums
+        {
+        public:
+            // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+            /// The weighted sum of red radiance for each pixel in the row.
+            std::vector<float> WeightedRed = {};
+            /// The weighted sum of green radiance for each pixel in the row.
+            std::vector<float> WeightedGreen = {};
+            /// The weighted sum of blue radiance for each pixel in the row.
+            std::vector<float> WeightedBlue = {};
+            /// The sum of weights for each pixel in the row.
+            std::vector<float> Weights = {};
+        };
+
+        // PRIVATE HELPER METHODS.
+        static FeaturePlanes AllocateFeaturePlanes(const std::size_t pixel_count);
+        void Filter(
+            const unsigned int width_in_pixels,
+            const unsigned int height_in_pixels,
+            const FeaturePlanes& features,
+            const unsigned int thread_count,
+            Planes& image,
+            GRAPHICS::RenderTarget& render_target) const;
+        void FilterRow(
+            const unsigned int y,
+            const unsigned int width_in_pixels,
+            const unsigned int height_in_pixels,
+            const unsigned int step_in_pixels,
+            const float color_sigma,
+            const FeaturePlanes& features,
+            const Planes& input,
+            RowSums& row_sums,
+            Planes& output) const;
+    };
+}
+}
@@ -0,0 +1,124 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "Graphics/RayTracing/Disc.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// Gets the surface normal of the disc, which is the same at every point.
+    /// @param[in]  surface_point - The point on the disc's surface at which to compute a normal.
+    /// @return The unit surface normal of the disc.
+    MATH::Vector3f Disc::SurfaceNormal(const MATH::Vector3f& surface_point) const
+    {
+        surface_point;
+        return UnitNormal;
+    }
+
+    /// Gets the material defining surface properties of the object.
+    /// @return The material for the object.
+    const Material* Disc::GetMaterial() const
+    {
+        return Material.get();
+    }
+
+    /// Checks for an intersection between a ray and the disc.
+    /// @param[in]  ray - The ray to check for intersection.
+    /// @return A ray-object intersection, if one occurred; std::nullopt otherwise.
+    std::optional<RayObjectIntersection> Disc::Intersect(const Ray& ray) const
+    {
+        // SOLVE FOR THE DISTANCE ALONG THE RAY TO THE DISC'S PLANE.
+        // See Plane::Intersect for how this is derived.
+        float ray_direction_along_normal = MATH::Vector3f::DotProduct(UnitNormal, ray.Direction);
+        float ray_origin_to_center_along_normal = MATH::Vector3f::DotProduct(UnitNormal, CenterPosition - ray.Origin);
+        float distance_from_ray_to_plane = ray_origin_to_center_along_normal / ray_direction_along_normal;
+
+        // CHECK IF THE INTERSECTION WITH THE PLANE IS IN FRONT OF THE RAY AND WITHIN THE DISC.
+        // Rays parallel to the disc result in infinite or NaN distances, which fail this check.
+        MATH::Vector3f plane_intersection_point = ray.Origin + MATH::Vector3f::Scale(distance_from_ray_to_plane, ray.Direction);
+        MATH::Vector3f center_to_intersection = plane_intersection_point - CenterPosition;
+        float squared_distance_from_center = MATH::Vector3f::DotProduct(center_to_intersection, center_to_intersection);
+        bool disc_intersected = (
+            (distance_from_ray_to_plane >= 0.0f) &&
+            (distance_from_ray_to_plane < std::numeric_limits<float>::infinity()) &&
+            (squared_distance_from_center <= Radius * Radius));
+        if (!disc_intersected)
+        {
+            return std::nullopt;
+        }
+
+        RayObjectIntersection intersection;
+        intersection.Ray = &ray;
+        intersection.DistanceFromRayToObject = distance_from_ray_to_plane;
+        intersection.Object = this;
+        return intersection;
+    }
+
+    /// Computes the world-space bounds of the disc.
+    /// Along each axis, the disc extends by its radius scaled by how perpendicular the axis is to the normal,
+    /// so a disc facing along an axis has no thickness along that axis.
+    /// @return A box tightly containing the entire disc.
+    AxisAlignedBoundingBox Disc::Bounds() const
+    {
+        auto extent_along = [&](const float normal_component)
+        {
+            float extent = Radius * std::sqrt(std::max(0.0f, 1.0f - (normal_component * normal_component)));
+            return extent;
+        };
+        MATH::Vector3f extents(extent_along(UnitNormal.X), extent_along(UnitNormal.Y), extent_along(UnitNormal.Z));
+        AxisAlignedBoundingBox bounds(CenterPosition - extents, CenterPosition + extents);
+        return bounds;
+    }
+
+    /// Gets the kind of object, for reporting statistics.
+    /// @return \ref ObjectType::DISC.
+    ObjectType Disc::Type() const
+    {
+        return ObjectType::DISC;
+    }
+
+    /// Checks for intersections between all rays in a packet and the disc, using the same math as \ref Intersect.
+    /// @param[in]  ray_packet - The rays to check for intersection.
+    /// @param[out]  distances - The distance along each ray to the disc; infinity for rays that miss.
+    /// @return True since packet intersections are supported.
+    bool Disc::IntersectPacket(const RayPacket& ray_packet, std::array<float, RayPacket::MAX_RAY_COUNT>& distances) const
+    {
+        constexpr float NO_INTERSECTION = std::numeric_limits<float>::infinity();
+        float squared_radius = Radius * Radius;
+        for (std::size_t ray_index = 0; ray_index < RayPacket::MAX_RAY_COUNT; ++ray_index)
+        {
+            // COMPUTE THE DISTANCE TO THE DISC'S PLANE.
+            float origin_to_center_x = CenterPosition.X - ray_packet.OriginX[ray_index];
+            float origin_to_center_y = CenterPosition.Y - ray_packet.OriginY[ray_index];
+            float origin_to_center_z = CenterPosition.Z - ray_packet.OriginZ[ray_index];
+            float ray_direction_along_normal =
+                (UnitNormal.X * ray_packet.DirectionX[ray_index]) +
+                (UnitNormal.Y * ray_packet.DirectionY[ray_index]) +
+                (UnitNormal.Z * ray_packet.DirectionZ[ray_index]);
+            float ray_origin_to_center_along_normal =
+                (UnitNormal.X * origin_to_center_x) +
+                (UnitNormal.Y * origin_to_center_y) +
+                (UnitNormal.Z * origin_to_center_z);
+            float distance_from_ray_to_plane = ray_origin_to_center_along_normal / ray_direction_along_normal;
+
+            // CHECK IF THE PLANE INTERSECTION IS WITHIN THE DISC.
+            float center_to_intersection_x = (distance_from_ray_to_plane * ray_packet.DirectionX[ray_index]) - origin_to_center_x;
+            float center_to_intersection_y = (distance_from_ray_to_plane * ray_packet.DirectionY[ray_index]) - origin_to_center_y;
+            float center_to_intersection_z = (distance_from_ray_to_plane * ray_packet.DirectionZ[ray_index]) - origin_to_center_z;
+            float squared_distance_from_center =
+                (center_to_intersection_x * center_to_intersection_x) +
+                (center_to_intersection_y * center_to_intersection_y) +
+                (center_to_intersection_z * center_to_intersection_z);
+
+            bool disc_intersected = (
+                (distance_from_ray_to_plane >= 0.0f) &&
+                (distance_from_ray_to_plane < NO_INTERSECTION) &&
+                (squared_distance_from_center <= squared_radius));
+            distances[ray_index] = disc_intersected ? distance_from_ray_to_plane : NO_INTERSECTION;
+        }
+
+        return true;
+    }
+}
+}
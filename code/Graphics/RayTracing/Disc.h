@@ -0,0 +1,38 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include "Graphics/Material.h"
+#include "Graphics/RayTracing/IObject3D.h"
+#include "Graphics/RayTracing/RayPacket.h"
+#include "Math/Vector3.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// A flat, circular disc that can be ray traced.
+    /// Useful as a bounded alternative to an infinite \ref Plane, with much tighter bounds than a pair of triangles.
+    class Disc : public IObject3D
+    {
+    public:
+        // PUBLIC METHODS.
+        MATH::Vector3f SurfaceNormal(const MATH::Vector3f& surface_point) const override;
+        const Material* GetMaterial() const override;
+        std::optional<RayObjectIntersection> Intersect(const Ray& ray) const override;
+        AxisAlignedBoundingBox Bounds() const override;
+        ObjectType Type() const override;
+        bool IntersectPacket(const RayPacket& ray_packet, std::array<float, RayPacket::MAX_RAY_COUNT>& distances) const override;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The center of the disc in world coordinates.
+        MATH::Vector3f CenterPosition = MATH::Vector3f();
+        /// The unit normal of the disc, which is the same everywhere on the disc.
+        MATH::Vector3f UnitNormal = MATH::Vector3f(0.0f, 1.0f, 0.0f);
+        /// The radius of the disc.
+        float Radius = 0.0f;
+        /// The material defining surface properties of the disc.
+        std::shared_ptr<Material> Material = nullptr;
+    };
+}
+}
@@ -0,0 +1,422 @@
+#include <memory>
+#include "Graphics/Cube.h"
+#include "Graphics/Material.h"
+#include "Graphics/Object3D.h"
+#include "Graphics/RayTracing/AxisAlignedBox.h"
+#include "Graphics/RayTracing/ExampleScenes.h"
+#include "Graphics/RayTracing/Mesh.h"
+#include "Graphics/RayTracing/MeshInstance.h"
+#include "Graphics/RayTracing/Plane.h"
+#include "Graphics/RayTracing/Sphere.h"
+#include "Graphics/Triangle.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// Creates one of the example scenes.
+    /// @param[in]  scene_number - The number of the scene to create, in the range [0, COUNT).
+    /// @return The requested scene, with any acceleration structures built; null if the number is out of range.
+    std::unique_ptr<Scene> ExampleScenes::Create(const unsigned int scene_number)
+    {
+        switch (scene_number)
+        {
+            case 0:
+            {
+                // BASIC TRIANGLE.
+                auto scene = std::make_unique<Scene>();
+                scene->PointLights.push_back(GRAPHICS::Light
+                {
+                    .Color = GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f),
+                    .PointLightWorldPosition = MATH::Vector3f(0.0f, 0.0f, 0.0f),
+                });
+                scene->BackgroundColor = GRAPHICS::Color(0.3f, 0.3f, 0.7f, 0.0f);
+
+                auto material = std::make_shared<GRAPHICS::Material>();
+                material->DiffuseColor = GRAPHICS::Color(0.8f, 0.8f, 0.8f, 1.0f);
+                material->AmbientColor = GRAPHICS::Color(0.0f, 0.0f, 0.0f, 1.0f);
+                material->SpecularColor = GRAPHICS::Color(0.0f, 0.0f, 0.0f, 1.0f);
+                material->SpecularPower = 1.0f;
+                material->ReflectivityProportion = 0.0f;
+
+                auto triangle = std::make_unique<GRAPHICS::Triangle>();
+                triangle->Vertices =
+                {
+                    MATH::Vector3f(-1.0f, -1.0f, -2.0f),
+                    MATH::Vector3f(1.0f, -1.0f, -2.0f),
+                    MATH::Vector3f(0.0f, 1.0f, -2.0f),
+                };
+                triangle->Material = material;
+                scene->Objects.push_back(std::move(triangle));
+                return scene;
+            }
+            case 1:
+            {
+                // MULTIPLE TRIANGLES.
+                auto scene = std::make_unique<Scene>();
+                scene->PointLights.push_back(GRAPHICS::Light
+                {
+                    .Color = GRAPHICS::Color(0.7f, 0.7f, 0.7f, 1.0f),
+                    .PointLightWorldPosition = MATH::Vector3f(4.0f, 4.0f, 8.0f),
+                });
+                scene->BackgroundColor = GRAPHICS::Color(0.2f, 0.2f, 1.0f, 0.0f);
+
+                auto material = std::make_shared<GRAPHICS::Material>();
+                material->DiffuseColor = GRAPHICS::Color(0.8f, 0.8f, 0.8f, 1.0f);
+                material->AmbientColor = GRAPHICS::Color(0.2f, 0.2f, 0.2f, 1.0f);
+                material->SpecularColor = GRAPHICS::Color(0.0f, 0.0f, 0.0f, 1.0f);
+                material->SpecularPower = 1.0f;
+                material->ReflectivityProportion = 0.0f;
+
+                auto triangle = std::make_unique<GRAPHICS::Triangle>();
+                triangle->Vertices =
+                {
+                    MATH::Vector3f(-0.1f, -0.1f, -2.0f),
+                    MATH::Vector3f(0.1f, -0.1f, -2.0f),
+                    MATH::Vector3f(0.0f, 0.1f, -2.0f),
+                };
+                triangle->Material = material;
+                scene->Objects.push_back(std::move(triangle));
+
+                triangle = std::make_unique<GRAPHICS::Triangle>();
+                triangle->Vertices =
+                {
+                    MATH::Vector3f(-0.9f, -0.9f, -2.0f),
+                    MATH::Vector3f(0.7f, -0.7f, -2.0f),
+                    MATH::Vector3f(-0.7f, -0.6f, -2.0f),
+                };
+                triangle->Material = material;
+                scene->Objects.push_back(std::move(triangle));
+
+                triangle = std::make_unique<GRAPHICS::Triangle>();
+                triangle->Vertices =
+                {
+                    MATH::Vector3f(0.5f, -0.5f, -2.0f),
+                    MATH::Vector3f(0.8f, -0.7f, -2.0f),
+                    MATH::Vector3f(0.6f, 0.6f, -2.0f),
+                };
+                triangle->Material = material;
+                scene->Objects.push_back(std::move(triangle));
+
+                return scene;
+            }
+            case 2:
+            {
+                auto scene = std::make_unique<Scene>();
+                scene->PointLights.push_back(GRAPHICS::Light
+                {
+                    .Color = GRAPHICS::Color(0.7f, 0.7f, 0.7f, 1.0f),
+                    .PointLightWorldPosition = MATH::Vector3f(4.0f, 4.0f, 8.0f),
+                });
+                scene->BackgroundColor = GRAPHICS::Color(0.2f, 0.2f, 1.0f, 0.0f);
+
+                // TRIANLGE + SPHERE.
+                auto material = std::make_shared<GRAPHICS::Material>();
+                material->DiffuseColor = GRAPHICS::Color(0.8f, 0.8f, 0.8f, 1.0f);
+                material->AmbientColor = GRAPHICS::Color(0.2f, 0.2f, 0.2f, 1.0f);
+                material->SpecularColor = GRAPHICS::Color(0.0f, 0.0f, 0.0f, 1.0f);
+                material->SpecularPower = 1.0f;
+                material->ReflectivityProportion = 0.0f;
+
+                auto triangle = std::make_unique<GRAPHICS::Triangle>();
+                triangle->Vertices =
+                {
+                    MATH::Vector3f(-1.0f, -1.0f, -3.0f),
+                    MATH::Vector3f(1.0f, -1.0f, -3.0f),
+                    MATH::Vector3f(0.0f, 1.0f, -3.0f),
+                };
+                triangle->Material = material;
+                scene->Objects.push_back(std::move(triangle));
+
+                // SPHERE.
+                auto sphere_material = std::make_shared<GRAPHICS::Material>();
+                sphere_material->DiffuseColor = GRAPHICS::Color(0.8f, 0.2f, 0.7f, 1.0f);
+                sphere_material->AmbientColor = GRAPHICS::Color(0.3f, 0.1f, 0.6f, 1.0f);
+                sphere_material->SpecularColor = GRAPHICS::Color(0.0f, 0.0f, 0.0f, 1.0f);
+                sphere_material->SpecularPower = 1.0f;
+                sphere_material->ReflectivityProportion = 0.0f;
+
+                auto sphere = std::make_unique<Sphere>();
+                sphere->CenterPosition = MATH::Vector3f(0.0f, 0.0f, -3.0f);
+                sphere->Radius = 0.87f;
+                sphere->Material = sphere_material;
+
+                scene->Objects.push_back(std::move(sphere));
+
+                return scene;
+            }
+            case 3:
+            {
+                // MULTIPLE LIGHTS.
+                auto scene = std::make_unique<Scene>();
+                scene->PointLights.push_back(GRAPHICS::Light
+                {
+                    .Color = GRAPHICS::Color(0.9f, 0.0f, 0.0f, 1.0f),
+                    .PointLightWorldPosition = MATH::Vector3f(3.0f, 4.0f, 0.0f),
+                });
+                scene->PointLights.push_back(GRAPHICS::Light
+                {
+                    .Color = GRAPHICS::Color(0.0f, 0.9f, 0.0f, 1.0f),
+                    .PointLightWorldPosition = MATH::Vector3f(-4.0f, 5.0f, 0.0f),
+                });
+                scene->PointLights.push_back(GRAPHICS::Light
+                {
+                    .Color = GRAPHICS::Color(0.0f, 0.0f, 0.9f, 1.0f),
+                    .PointLightWorldPosition = MATH::Vector3f(0.0f, 4.0f, -5.0f),
+                });
+                scene->BackgroundColor = GRAPHICS::Color(0.2f, 0.2f, 1.0f, 0.0f);
+
+                // Ground plane.
+                auto material = std::make_shared<GRAPHICS::Material>();
+                material->DiffuseColor = GRAPHICS::Color(0.8f, 0.8f, 0.8f, 1.0f);
+                material->AmbientColor = GRAPHICS::Color(0.2f, 0.2f, 0.2f, 1.0f);
+                material->SpecularColor = GRAPHICS::Color(0.1f, 0.1f, 0.1f, 1.0f);
+                material->SpecularPower = 1.0f;
+                material->ReflectivityProportion = 0.5f;
+
+                auto ground_plane = std::make_unique<Plane>();
+                ground_plane->PointOnPlane = MATH::Vector3f(0.0f, -1.0f, 0.0f);
+                ground_plane->UnitNormal = MATH::Vector3f(0.0f, 1.0f, 0.0f);
+                ground_plane->Material = material;
+                scene->Objects.push_back(std::move(ground_plane));
+
+                // SPHERE.
+                auto sphere_material = std::make_shared<GRAPHICS::Material>();
+                sphere_material->DiffuseColor = GRAPHICS::Color(0.8f, 0.8f, 0.8f, 1.0f);
+                sphere_material->AmbientColor = GRAPHICS::Color(0.2f, 0.2f, 0.2f, 1.0f);
+                sphere_material->SpecularColor = GRAPHICS::Color(0.1f, 0.1f, 0.1f, 1.0f);
+                sphere_material->SpecularPower = 1.0f;
+                sphere_material->ReflectivityProportion = 0.5f;
+
+                auto sphere = std::make_unique<Sphere>();
+                sphere->CenterPosition = MATH::Vector3f(0.0f, 0.5f, -3.0f);
+                sphere->Radius = 0.7f;
+                sphere->Material = sphere_material;
+
+                scene->Objects.push_back(std::move(sphere));
+
+                return scene;
+            }
+            case 4:
+            {
+                // MULTIPLE REFLECTIVE SPHERES.
+                auto scene = std::make_unique<Scene>();
+                scene->PointLights.push_back(GRAPHICS::Light
+                {
+                    .Color = GRAPHICS::Color(0.7f, 0.7f, 0.7f, 1.0f),
+                    .PointLightWorldPosition = MATH::Vector3f(8.0f, 8.0f, 3.0f),
+                });
+                scene->PointLights.push_back(GRAPHICS::Light
+                {
+                    .Color = GRAPHICS::Color(0.3f, 0.3f, 0.3f, 1.0f),
+                    .PointLightWorldPosition = MATH::Vector3f(-4.0f, 2.0f, 0.0f),
+                });
+                scene->BackgroundColor = GRAPHICS::Color(0.2f, 0.2f, 1.0f, 0.0f);
+
+                // Ground plane.
+                auto material = std::make_shared<GRAPHICS::Material>();
+                material->DiffuseColor = GRAPHICS::Color(0.8f, 0.8f, 0.8f, 1.0f);
+                material->AmbientColor = GRAPHICS::Color(0.2f, 0.2f, 0.2f, 1.0f);
+                material->SpecularColor = GRAPHICS::Color(0.0f, 0.0f, 0.0f, 1.0f);
+                material->SpecularPower = 1.0f;
+                material->ReflectivityProportion = 0.5f;
+
+                auto ground_plane = std::make_unique<Plane>();
+                ground_plane->PointOnPlane = MATH::Vector3f(0.0f, -1.0f, 0.0f);
+                ground_plane->UnitNormal = MATH::Vector3f(0.0f, 1.0f, 0.0f);
+                ground_plane->Material = material;
+                scene->Objects.push_back(std::move(ground_plane));
+
+                // SPHERE.
+                auto sphere_material = std::make_shared<GRAPHICS::Material>();
+                sphere_material->DiffuseColor = GRAPHICS::Color(0.6f, 0.6f, 0.6f, 1.0f);
+                sphere_material->AmbientColor = GRAPHICS::Color(0.2f, 0.2f, 0.2f, 1.0f);
+                sphere_material->SpecularColor = GRAPHICS::Color(0.7f, 0.7f, 0.7f, 1.0f);
+                sphere_material->SpecularPower = 20.0f;
+                sphere_material->ReflectivityProportion = 0.7f;
+
+                auto sphere = std::make_unique<Sphere>();
+                sphere->CenterPosition = MATH::Vector3f(1.2f, 0.0f, -5.0f);
+                sphere->Radius = 1.0f;
+                sphere_material->AmbientColor = GRAPHICS::Color(1.0f, 0.0f, 0.0f, 1.0f);
+                sphere_material->DiffuseColor = sphere_material->AmbientColor;
+                sphere->Material = sphere_material;
+                scene->Objects.push_back(std::move(sphere));
+
+                sphere = std::make_unique<Sphere>();
+                sphere->CenterPosition = MATH::Vector3f(0.0f, 0.3f, -1.5f);
+                sphere->Radius = 0.2f;
+                sphere_material->AmbientColor = GRAPHICS::Color(0.0f, 1.0f, 0.0f, 1.0f);
+                sphere_material->DiffuseColor = sphere_material->AmbientColor;
+                sphere->Material = sphere_material;
+                scene->Objects.push_back(std::move(sphere));
+
+                sphere = std::make_unique<Sphere>();
+                sphere->CenterPosition = MATH::Vector3f(-1.0f, -0.5f, -3.0f);
+                sphere->Radius = 0.5f;
+                sphere_material->AmbientColor = GRAPHICS::Color(0.0f, 0.0f, 1.0f, 1.0f);
+                sphere_material->DiffuseColor = sphere_material->AmbientColor;
+                sphere->Material = sphere_material;
+                scene->Objects.push_back(std::move(sphere));
+
+                return scene;
+            }
+            case 5:
+            {
+                auto scene = std::make_unique<Scene>();
+                scene->PointLights.push_back(GRAPHICS::Light
+                {
+                    .Color = GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f),
+                    .PointLightWorldPosition = MATH::Vector3f(-5.0f, 2.0f, 5.0f),
+                });
+                scene->BackgroundColor = GRAPHICS::Color::BLACK;
+
+                // SPHERE 1.
+                auto sphere_material = std::make_shared<GRAPHICS::Material>();
+                sphere_material->DiffuseColor = GRAPHICS::Color(0.5f, 0.0f, 0.5f, 1.0f);
+                sphere_material->AmbientColor = GRAPHICS::Color(0.2f, 0.0f, 0.2f, 1.0f);
+                sphere_material->SpecularColor = GRAPHICS::Color(0.7f, 0.7f, 0.7f, 1.0f);
+                sphere_material->SpecularPower = 20.0f;
+                sphere_material->ReflectivityProportion = 0.8f;
+
+                auto sphere = std::make_unique<Sphere>();
+                sphere->CenterPosition = MATH::Vector3f(0.0f, 0.0f, -4.0f);
+                sphere->Radius = 1.0f;
+                sphere->Material = sphere_material;
+                scene->Objects.push_back(std::move(sphere));
+
+                // SPHERE 2.
+                sphere_material = std::make_shared<GRAPHICS::Material>();
+                sphere_material->DiffuseColor = GRAPHICS::Color(0.0f, 0.5f, 0.0f, 1.0f);
+                sphere_material->AmbientColor = GRAPHICS::Color(0.0f, 0.2f, 0.0f, 1.0f);
+                sphere_material->SpecularColor = GRAPHICS::Color(0.0f, 0.2f, 0.0f, 1.0f);
+                sphere_material->SpecularPower = 1.0f;
+                sphere_material->ReflectivityProportion = 0.0f;
+
+                sphere = std::make_unique<Sphere>();
+                sphere->CenterPosition = MATH::Vector3f(1.0f, 0.6f, -3.0f);
+                sphere->Radius = 0.3f;
+                sphere->Material = sphere_material;
+                scene->Objects.push_back(std::move(sphere));
+
+                return scene;
+            }
+            case 6:
+            {
+                // FOREST OF INSTANCED CUBES.
+                auto scene = std::make_unique<Scene>();
+                scene->PointLights.push_back(GRAPHICS::Light
+                {
+                    .Color = GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f),
+                    .PointLightWorldPosition = MATH::Vector3f(5.0f, 10.0f, 5.0f),
+                });
+                scene->BackgroundColor = GRAPHICS::Color(0.2f, 0.2f, 1.0f, 0.0f);
+
+                auto cube_material = std::make_shared<GRAPHICS::Material>();
+                cube_material->DiffuseColor = GRAPHICS::Color(0.2f, 0.7f, 0.3f, 1.0f);
+                cube_material->AmbientColor = GRAPHICS::Color(0.05f, 0.2f, 0.1f, 1.0f);
+                cube_material->SpecularColor = GRAPHICS::Color(0.0f, 0.0f, 0.0f, 1.0f);
+                cube_material->SpecularPower = 1.0f;
+                cube_material->ReflectivityProportion = 0.0f;
+
+                // All instances share the same cube geometry.
+                GRAPHICS::Object3D cube = GRAPHICS::Cube::Create(cube_material);
+                auto cube_mesh = std::make_shared<const Mesh>(cube.Triangles);
+
+                constexpr int CUBE_COUNT_PER_SIDE = 20;
+                constexpr float SPACING_BETWEEN_CUBES = 2.0f;
+                for (int x_index = 0; x_index < CUBE_COUNT_PER_SIDE; ++x_index)
+                {
+                    for (int z_index = 0; z_index < CUBE_COUNT_PER_SIDE; ++z_index)
+                    {
+                        // VARY EACH CUBE A BIT SO THAT THE INSTANCES ARE DISTINGUISHABLE.
+                        GRAPHICS::Object3D placement;
+                        placement.WorldPosition = MATH::Vector3f(
+                            static_cast<float>(x_index - (CUBE_COUNT_PER_SIDE / 2)) * SPACING_BETWEEN_CUBES,
+                            -1.0f,
+                            -3.0f - (static_cast<float>(z_index) * SPACING_BETWEEN_CUBES));
+                        float height = 1.0f + static_cast<float>((x_index * 7 + z_index * 3) % 5) * 0.5f;
+                        placement.Scale = MATH::Vector3f(0.5f, height, 0.5f);
+                        placement.RotationInRadians.Y = MATH::Angle<float>::Radians(static_cast<float>(x_index + z_index) * 0.3f);
+
+                        auto cube_instance = std::make_unique<MeshInstance>(
+                            cube_mesh,
+                            placement.WorldTransform(),
+                            placement.InverseWorldTransform());
+                        scene->Objects.push_back(std::move(cube_instance));
+                    }
+                }
+
+                scene->BuildAccelerationStructure();
+                return scene;
+            }
+            case 7:
+            {
+                // CITY AT NIGHT WITH MANY STREET LIGHTS.
+                auto scene = std::make_unique<Scene>();
+                scene->BackgroundColor = GRAPHICS::Color(0.0f, 0.0f, 0.05f, 0.0f);
+
+                auto ground_material = std::make_shared<GRAPHICS::Material>();
+                ground_material->DiffuseColor = GRAPHICS::Color(0.5f, 0.5f, 0.5f, 1.0f);
+                ground_material->AmbientColor = GRAPHICS::Color(0.01f, 0.01f, 0.02f, 1.0f);
+                ground_material->SpecularColor = GRAPHICS::Color(0.0f, 0.0f, 0.0f, 1.0f);
+                ground_material->SpecularPower = 1.0f;
+                ground_material->ReflectivityProportion = 0.0f;
+
+                auto ground_plane = std::make_unique<Plane>();
+                ground_plane->PointOnPlane = MATH::Vector3f(0.0f, -1.0f, 0.0f);
+                ground_plane->UnitNormal = MATH::Vector3f(0.0f, 1.0f, 0.0f);
+                ground_plane->Material = ground_material;
+                scene->Objects.push_back(std::move(ground_plane));
+
+                auto building_material = std::make_shared<GRAPHICS::Material>();
+                building_material->DiffuseColor = GRAPHICS::Color(0.6f, 0.6f, 0.7f, 1.0f);
+                building_material->AmbientColor = GRAPHICS::Color(0.02f, 0.02f, 0.03f, 1.0f);
+                building_material->SpecularColor = GRAPHICS::Color(0.0f, 0.0f, 0.0f, 1.0f);
+                building_material->SpecularPower = 1.0f;
+                building_material->ReflectivityProportion = 0.0f;
+
+                // BUILDINGS ON BLOCKS WITH STREET LIGHTS ALONG THE STREETS BETWEEN THEM.
+                constexpr int BLOCK_COUNT_PER_SIDE = 8;
+                constexpr float BLOCK_SPACING = 3.0f;
+                constexpr float BUILDING_HALF_WIDTH = 1.0f;
+                constexpr int STREET_LIGHT_COUNT_PER_BLOCK = 4;
+                for (int x_index = 0; x_index < BLOCK_COUNT_PER_SIDE; ++x_index)
+                {
+                    for (int z_index = 0; z_index < BLOCK_COUNT_PER_SIDE; ++z_index)
+                    {
+                        float block_center_x = static_cast<float>(x_index - (BLOCK_COUNT_PER_SIDE / 2)) * BLOCK_SPACING;
+                        float block_center_z = -4.0f - (static_cast<float>(z_index) * BLOCK_SPACING);
+                        float building_height = 1.0f + static_cast<float>((x_index * 5 + z_index * 3) % 7) * 0.75f;
+
+                        auto building = std::make_unique<AxisAlignedBox>();
+                        building->MinimumCorner = MATH::Vector3f(block_center_x - BUILDING_HALF_WIDTH, -1.0f, block_center_z - BUILDING_HALF_WIDTH);
+                        building->MaximumCorner = MATH::Vector3f(block_center_x + BUILDING_HALF_WIDTH, -1.0f + building_height, block_center_z + BUILDING_HALF_WIDTH);
+                        building->Material = building_material;
+                        scene->Objects.push_back(std::move(building));
+
+                        // Street lights are dim and slightly varied in warmth, so many of them are needed to light the city.
+                        constexpr float STREET_OFFSET = BLOCK_SPACING / 2.0f;
+                        for (int light_index = 0; light_index < STREET_LIGHT_COUNT_PER_BLOCK; ++light_index)
+                        {
+                            float along_street = (static_cast<float>(light_index) / static_cast<float>(STREET_LIGHT_COUNT_PER_BLOCK) - 0.5f) * BLOCK_SPACING;
+                            float warmth = static_cast<float>((x_index + z_index + light_index) % 3) * 0.001f;
+                            scene->PointLights.push_back(GRAPHICS::Light
+                            {
+                                .Color = GRAPHICS::Color(0.004f, 0.0035f - warmth, 0.003f - warmth, 1.0f),
+                                .PointLightWorldPosition = MATH::Vector3f(block_center_x + STREET_OFFSET, 0.0f, block_center_z + along_street),
+                            });
+                        }
+                    }
+                }
+
+                scene->BuildAccelerationStructure();
+                scene->BuildLightDistribution();
+                return scene;
+            }
+            default:
+                return nullptr;
+        }
+    }
+}
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <memory>
+#include "Graphics/RayTracing/Scene.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// The ray tracing scenes that can be switched between in the demo.
+    class ExampleScenes
+    {
+    public:
+        // STATIC CONSTANTS.
+        /// The number of example scenes.
+        static constexpr unsigned int COUNT = 8;
+
+        // CONSTRUCTION.
+        static std::unique_ptr<Scene> Create(const unsigned int scene_number);
+    };
+}
+}
@@ -0,0 +1,124 @@
+#include <algorithm>
+#include "Graphics/RayTracing/Frustum.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// Creates the frustum covering all viewing rays for a screen tile.
+    /// @param[in]  ray_generator - The generator of viewing rays for the camera and render target.
+    /// @param[in]  tile - The tile whose rays should be covered.
+    /// @return The frustum bounded by the rays through the outer corners of the tile.
+    Frustum Frustum::ForTile(const RayGenerator& ray_generator, const ScreenTile& tile)
+    {
+        // GET THE RAYS THROUGH THE CORNERS OF THE TILE.
+        // Corners are listed in order around the tile so that consecutive corners form the tile's edges.
+        // Rays through the outer corners of the tile's pixels cover the rays through all pixel centers.
+        float left_x = static_cast<float>(tile.LeftX);
+        float right_x = static_cast<float>(tile.LeftX + tile.WidthInPixels);
+        float top_y = static_cast<float>(tile.TopY);
+        float bottom_y = static_cast<float>(tile.TopY + tile.HeightInPixels);
+        constexpr std::size_t CORNER_COUNT = 4;
+        const std::array<Ray, CORNER_COUNT> corner_rays =
+        {
+            ray_generator.ViewingRay(MATH::Vector2f(left_x, top_y)),
+            ray_generator.ViewingRay(MATH::Vector2f(right_x, top_y)),
+            ray_generator.ViewingRay(MATH::Vector2f(right_x, bottom_y)),
+            ray_generator.ViewingRay(MATH::Vector2f(left_x, bottom_y)),
+        };
+
+        // FIND A POINT INSIDE THE FRUSTUM FOR ORIENTING THE SIDE PLANES.
+        float center_x = (left_x + right_x) / 2.0f;
+        float center_y = (top_y + bottom_y) / 2.0f;
+        Ray center_ray = ray_generator.ViewingRay(MATH::Vector2f(center_x, center_y));
+        MATH::Vector3f point_inside_frustum = center_ray.Origin + center_ray.Direction;
+
+        // CREATE A SIDE PLANE ALONG EACH EDGE OF THE TILE.
+        // Each plane passes through the start of one corner ray and one unit along it and the next corner ray.
+        // This covers both perspective rays (sharing an origin) and orthographic rays (sharing a direction).
+        Frustum frustum;
+        for (std::size_t corner_index = 0; corner_index < CORNER_COUNT; ++corner_index)
+        {
+            const Ray& current_corner_ray = corner_rays[corner_index];
+            const Ray& next_corner_ray = corner_rays[(corner_index + 1) % CORNER_COUNT];
+            MATH::Vector3f next_corner_point = next_corner_ray.Origin + next_corner_ray.Direction;
+            MATH::Vector3f normal = MATH::Vector3f::CrossProduct(current_corner_ray.Direction, next_corner_point - current_corner_ray.Origin);
+
+            // POINT THE NORMAL INTO THE FRUSTUM.
+            float offset = MATH::Vector3f::DotProduct(normal, current_corner_ray.Origin);
+            bool normal_points_outward = (MATH::Vector3f::DotProduct(normal, point_inside_frustum) < offset);
+            if (normal_points_outward)
+            {
+                normal = -normal;
+                offset = -offset;
+            }
+
+            frustum.HalfSpaces[corner_index].Normal = normal;
+            frustum.HalfSpaces[corner_index].Offset = offset;
+        }
+
+        // CREATE A NEAR PLANE BEHIND ALL RAY ORIGINS.
+        // Rays only travel forward, so anything behind all origins relative to the direction of all rays can't be hit.
+        // The plane is parallel to the screen, whose axes are given by how rays change between pixels
+        // (only origins change for orthographic rays, and only directions change for perspective rays).
+        MATH::Vector3f screen_x_axis = ray_generator.OriginStepX + ray_generator.DirectionStepX;
+        MATH::Vector3f screen_y_axis = ray_generator.OriginStepY + ray_generator.DirectionStepY;
+        MATH::Vector3f near_normal = MATH::Vector3f::CrossProduct(screen_x_axis, screen_y_axis);
+        if (MATH::Vector3f::DotProduct(near_normal, center_ray.Direction) < 0.0f)
+        {
+            near_normal = -near_normal;
+        }
+
+        // The near plane is left unbounded if any rays don't travel forward from it (which shouldn't happen for valid cameras).
+        bool all_rays_travel_along_near_normal = std::all_of(
+            corner_rays.cbegin(),
+            corner_rays.cend(),
+            [&near_normal](const Ray& corner_ray) { return MATH::Vector3f::DotProduct(near_normal, corner_ray.Direction) > 0.0f; });
+        if (all_rays_travel_along_near_normal)
+        {
+            float near_offset = MATH::Vector3f::DotProduct(near_normal, corner_rays[0].Origin);
+            for (const Ray& corner_ray : corner_rays)
+            {
+                near_offset = std::min(near_offset, MATH::Vector3f::DotProduct(near_normal, corner_ray.Origin));
+            }
+
+            constexpr std::size_t NEAR_HALF_SPACE_INDEX = CORNER_COUNT;
+            frustum.HalfSpaces[NEAR_HALF_SPACE_INDEX].Normal = near_normal;
+            frustum.HalfSpaces[NEAR_HALF_SPACE_INDEX].Offset = near_offset;
+        }
+
+        return frustum;
+    }
+
+    /// Determines if a bounding box may overlap the frustum.
+    /// @param[in]  bounding_box - The bounding box to check.
+    /// @return False if the box is definitely entirely outside the frustum; true otherwise.
+    ///     Unbounded boxes are always considered to overlap the frustum.
+    bool Frustum::Intersects(const AxisAlignedBoundingBox& bounding_box) const
+    {
+        // TREAT UNBOUNDED BOXES AS ALWAYS OVERLAPPING.
+        // Infinite coordinates can't be reliably compared against planes.
+        if (!bounding_box.IsFinite())
+        {
+            return true;
+        }
+
+        // CHECK IF THE BOX IS ENTIRELY OUTSIDE ANY HALF-SPACE.
+        // Only the corner of the box farthest along each half-space's normal needs to be checked.
+        for (const HalfSpace& half_space : HalfSpaces)
+        {
+            MATH::Vector3f farthest_corner(
+                (half_space.Normal.X >= 0.0f) ? bounding_box.MaximumCorner.X : bounding_box.MinimumCorner.X,
+                (half_space.Normal.Y >= 0.0f) ? bounding_box.MaximumCorner.Y : bounding_box.MinimumCorner.Y,
+                (half_space.Normal.Z >= 0.0f) ? bounding_box.MaximumCorner.Z : bounding_box.MinimumCorner.Z);
+            bool box_outside_half_space = (MATH::Vector3f::DotProduct(half_space.Normal, farthest_corner) < half_space.Offset);
+            if (box_outside_half_space)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include "Graphics/RayTracing/AxisAlignedBoundingBox.h"
+#include "Graphics/RayTracing/RayGenerator.h"
+#include "Graphics/RayTracing/ScreenTile.h"
+#include "Math/Vector3.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// The convex volume covered by a bundle of viewing rays, such as all rays for a screen tile.
+    /// Objects whose bounds lie entirely outside the frustum can't be hit by any of the rays,
+    /// so testing bounds against the frustum once lets the rays skip those objects entirely.
+    ///
+    /// The frustum is bounded by a plane along each edge of the tile and a near plane behind all
+    /// ray origins.  It has no far plane.  Tests are conservative: bounds are only reported as
+    /// outside if they're definitely outside.
+    class Frustum
+    {
+    public:
+        /// A half-space bounding the frustum.
+        class HalfSpace
+        {
+        public:
+            // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+            /// The normal of the bounding plane, pointing into the frustum.
+            /// Zero for half-spaces that don't bound anything (such as for degenerate tiles).
+            MATH::Vector3f Normal = MATH::Vector3f();
+            /// Points whose dot product with the normal is at least this are inside the half-space.
+            float Offset = 0.0f;
+        };
+
+        // STATIC CONSTANTS.
+        /// The number of half-spaces bounding a frustum (4 sides and a near plane).
+        static constexpr std::size_t HALF_SPACE_COUNT = 5;
+
+        // CONSTRUCTION.
+        static Frustum ForTile(const RayGenerator& ray_generator, const ScreenTile& tile);
+
+        // INTERSECTION.
+        bool Intersects(const AxisAlignedBoundingBox& bounding_box) const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The half-spaces whose intersection is the frustum.
+        std::array<HalfSpace, HALF_SPACE_COUNT> HalfSpaces = {};
+    };
+}
+}
@@ -0,0 +1,64 @@
+#include "Graphics/RayTracing/GeometryBuffer.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// Converts the primary hit back into a ray-object intersection.
+    /// @return The intersection for the hit.  Refers to this hit's viewing ray,
+    ///     so it is only valid as long as this hit exists.
+    RayObjectIntersection GeometryBuffer::PrimaryHit::Intersection() const
+    {
+        RayObjectIntersection intersection;
+        intersection.Ray = &ViewingRay;
+        intersection.DistanceFromRayToObject = DistanceFromRayToObject;
+        intersection.Object = Object;
+        intersection.PrimitiveIndex = PrimitiveIndex;
+        return intersection;
+    }
+
+    /// Resets the buffer to hold primary hits for new parameters.
+    /// The caller is responsible for filling in the primary hits for all pixels.
+    /// @param[in]  camera - The camera that primary rays will be traced from.
+    /// @param[in]  scene - The scene that primary rays will be traced through.
+    /// @param[in]  render_target - The render target whose pixels will be traced.
+    void GeometryBuffer::Reset(const GRAPHICS::Camera& camera, const Scene& scene, const GRAPHICS::RenderTarget& render_target)
+    {
+        PrimaryHits = CONTAINERS::Array2D<PrimaryHit>(render_target.GetWidthInPixels(), render_target.GetHeightInPixels());
+        Camera = camera;
+        SceneGeometryVersion = scene.GeometryVersion;
+        SceneObjectCount = scene.Objects.size();
+        Valid = true;
+    }
+
+    /// Invalidates the buffer so that it won't be reused until reset.
+    void GeometryBuffer::Invalidate()
+    {
+        Valid = false;
+    }
+
+    /// Determines if the buffer holds primary hits that can be reused for the specified parameters.
+    /// @param[in]  camera - The camera being rendered from.
+    /// @param[in]  scene - The scene being rendered.  Geometry changes are detected via the scene's
+    ///     geometry version, though objects being added or removed are also detected automatically.
+    /// @param[in]  render_target - The render target being rendered to.
+    /// @return True if the cached primary hits are valid for the parameters; false otherwise.
+    bool GeometryBuffer::IsValidFor(const GRAPHICS::Camera& camera, const Scene& scene, const GRAPHICS::RenderTarget& render_target) const
+    {
+        if (!Valid)
+        {
+            return false;
+        }
+
+        bool dimensions_match = (
+            (PrimaryHits.GetWidth() == render_target.GetWidthInPixels()) &&
+            (PrimaryHits.GetHeight() == render_target.GetHeightInPixels()));
+        bool camera_matches = (Camera == camera);
+        bool geometry_matches = (
+            (SceneGeometryVersion == scene.GeometryVersion) &&
+            (SceneObjectCount == scene.Objects.size()));
+        bool valid_for_parameters = (dimensions_match && camera_matches && geometry_matches);
+        return valid_for_parameters;
+    }
+}
+}
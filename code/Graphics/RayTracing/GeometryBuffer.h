@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstddef>
+#include "Containers/Array2D.h"
+#include "Graphics/Camera.h"
+#include "Graphics/RayTracing/IObject3D.h"
+#include "Graphics/RayTracing/Ray.h"
+#include "Graphics/RayTracing/RayObjectIntersection.h"
+#include "Graphics/RayTracing/Scene.h"
+#include "Graphics/RenderTarget.h"
+#include "Math/Vector3.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// Cached results of tracing the primary (viewing) ray through each pixel of an image.
+    /// Since primary visibility only depends on the camera and scene geometry, these results
+    /// can be reused to re-shade an image when only lights or materials change.
+    class GeometryBuffer
+    {
+    public:
+        /// The primary ray hit for a single pixel.
+        class PrimaryHit
+        {
+        public:
+            // INTERSECTION CONVERSION.
+            RayObjectIntersection Intersection() const;
+
+            // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+            /// The viewing ray through the pixel.
+            RAY_TRACING::Ray ViewingRay = RAY_TRACING::Ray(MATH::Vector3f(), MATH::Vector3f());
+            /// The distance along the viewing ray to the hit (in units of the ray).
+            float DistanceFromRayToObject = 0.0f;
+            /// The object hit by the viewing ray; null if nothing was hit.
+            const IObject3D* Object = nullptr;
+            /// The index of the hit primitive within the object, if applicable.
+            std::size_t PrimitiveIndex = 0;
+            /// The world position of the hit.
+            MATH::Vector3f WorldPosition = MATH::Vector3f();
+            /// The unit surface normal at the hit.
+            MATH::Vector3f UnitSurfaceNormal = MATH::Vector3f();
+        };
+
+        // CACHE MANAGEMENT.
+        void Reset(const GRAPHICS::Camera& camera, const Scene& scene, const GRAPHICS::RenderTarget& render_target);
+        void Invalidate();
+        bool IsValidFor(const GRAPHICS::Camera& camera, const Scene& scene, const GRAPHICS::RenderTarget& render_target) const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The primary hit for each pixel.
+        CONTAINERS::Array2D<PrimaryHit> PrimaryHits = CONTAINERS::Array2D<PrimaryHit>();
+
+    private:
+        // MEMBER VARIABLES.
+        /// True if the primary hits correspond to the remaining parameters below.
+        bool Valid = false;
+        /// The camera the primary hits were traced from.
+        GRAPHICS::Camera Camera = GRAPHICS::Camera();
+        /// The scene's geometry version when the primary hits were traced.
+        unsigned int SceneGeometryVersion = 0;
+        /// The number of objects in the scene when the primary hits were traced.
+        std::size_t SceneObjectCount = 0;
+    };
+}
+}
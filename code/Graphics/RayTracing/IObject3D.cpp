@@ -0,0 +1,97 @@
+#include "Graphics/RayTracing/IObject3D.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// Computes the surface normal of the object at an intersection.
+    /// By default, the normal is computed solely from the intersection point.
+    /// @param[in]  intersection - An intersection with this object.
+    /// @return The unit surface normal at the intersection.
+    MATH::Vector3f IObject3D::IntersectionSurfaceNormal(const RayObjectIntersection& intersection) const
+    {
+        MATH::Vector3f intersection_point = intersection.IntersectionPoint();
+        MATH::Vector3f surface_normal = SurfaceNormal(intersection_point);
+        return surface_normal;
+    }
+
+    /// Gets the material of the object at an intersection.
+    /// By default, the object's single material is used.
+    /// @param[in]  intersection - An intersection with this object.
+    /// @return The material at the intersection; null if no material exists.
+    const Material* IObject3D::IntersectionMaterial(const RayObjectIntersection& intersection) const
+    {
+        // This parameter is unneeded for objects with a single material.
+        intersection;
+
+        const Material* material = GetMaterial();
+        return material;
+    }
+
+    /// Checks if the object blocks a ray within some range along the ray.
+    /// Objects with materials that don't cast shadows never block rays.
+    /// @param[in]  ray - The ray to check.
+    /// @param[in]  min_distance - The exclusive minimum distance (in units of the ray) at which the object blocks the ray.
+    /// @param[in]  max_distance - The exclusive maximum distance (in units of the ray) at which the object blocks the ray.
+    /// @return True if the object blocks the ray within the range; false otherwise.
+    bool IObject3D::Occludes(const Ray& ray, const float min_distance, const float max_distance) const
+    {
+        // CHECK IF THE OBJECT CASTS SHADOWS.
+        // This is checked before intersecting since it's much cheaper.
+        const Material* material = GetMaterial();
+        bool object_casts_shadows = (!material || material->CastsShadows);
+        if (!object_casts_shadows)
+        {
+            return false;
+        }
+
+        // CHECK IF THE RAY INTERSECTS THE OBJECT.
+        std::optional<RayObjectIntersection> intersection = Intersect(ray);
+        bool ray_hit_object = (std::nullopt != intersection);
+        if (!ray_hit_object)
+        {
+            return false;
+        }
+
+        // CHECK IF THE INTERSECTION IS WITHIN RANGE.
+        bool intersection_in_range = (
+            (min_distance < intersection->DistanceFromRayToObject) &&
+            (intersection->DistanceFromRayToObject < max_distance));
+        return intersection_in_range;
+    }
+
+    /// Gets the geometry of the object as triangles in world space, allowing it to be rasterized.
+    /// The index of each triangle must match the primitive index of ray intersections with that triangle.
+    /// By default, objects aren't composed of triangles and can only be ray traced.
+    /// @param[out]  world_triangles - The vertices of each triangle of the object, if composed of triangles.
+    /// @return True if the object is composed of triangles; false otherwise.
+    bool IObject3D::WorldTriangles(std::vector< std::array<MATH::Vector3f, 3> >& world_triangles) const
+    {
+        world_triangles.clear();
+        return false;
+    }
+
+    /// Checks for intersections between all rays in a packet and the object at once.
+    /// Only meant for objects that can be fully described by the distance to an intersection
+    /// (without a primitive index).  By default, objects only support intersecting single rays.
+    /// @param[in]  ray_packet - The rays to check for intersection.
+    /// @param[out]  distances - The distance along each ray to the object; infinity for rays that miss.
+    ///     Only filled in if packet intersections are supported.
+    /// @return True if packet intersections are supported; false otherwise.
+    bool IObject3D::IntersectPacket(const RayPacket& ray_packet, std::array<float, RayPacket::MAX_RAY_COUNT>& distances) const
+    {
+        // These parameters are unneeded for objects without packet intersections.
+        ray_packet;
+        distances;
+
+        return false;
+    }
+
+    /// Gets the kind of object, for reporting statistics.
+    /// @return \ref ObjectType::OTHER by default.
+    ObjectType IObject3D::Type() const
+    {
+        return ObjectType::OTHER;
+    }
+}
+}
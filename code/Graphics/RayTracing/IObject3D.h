@@ -1,9 +1,14 @@
 #pragma once
 
+#include <array>
 #include <optional>
+#include <vector>
 #include "Graphics/Material.h"
+#include "Graphics/RayTracing/AxisAlignedBoundingBox.h"
+#include "Graphics/RayTracing/ObjectType.h"
 #include "Graphics/RayTracing/Ray.h"
 #include "Graphics/RayTracing/RayObjectIntersection.h"
+#include "Graphics/RayTracing/RayPacket.h"
 
 namespace GRAPHICS
 {
@@ -31,6 +36,20 @@ namespace RAY_TRACING
         /// @param[in]  ray - The ray to check for intersection.
         /// @return A ray-object intersection, if one occurred; std::nullopt otherwise.
         virtual std::optional<RayObjectIntersection> Intersect(const Ray& ray) const = 0;
+
+        /// Computes the world-space bounds of the object.
+        /// @return A box containing the entire object.
+        virtual AxisAlignedBoundingBox Bounds() const = 0;
+
+        // METHODS WITH DEFAULT IMPLEMENTATIONS.
+        // These may be overridden by objects composed of multiple primitives
+        // that need information beyond just the intersection point.
+        virtual MATH::Vector3f IntersectionSurfaceNormal(const RayObjectIntersection& intersection) const;
+        virtual const Material* IntersectionMaterial(const RayObjectIntersection& intersection) const;
+        virtual bool Occludes(const Ray& ray, const float min_distance, const float max_distance) const;
+        virtual bool WorldTriangles(std::vector< std::array<MATH::Vector3f, 3> >& world_triangles) const;
+        virtual bool IntersectPacket(const RayPacket& ray_packet, std::array<float, RayPacket::MAX_RAY_COUNT>& distances) const;
+        virtual ObjectType Type() const;
     };
 }
 }
\ No newline at end of file
@@ -0,0 +1,247 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "Graphics/RayTracing/IrradianceCache.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// Deletes all of a node's records and children.
+    IrradianceCache::Node::~Node()
+    {
+        RecordListEntry* record_entry = Records.load(std::memory_order_acquire);
+        while (record_entry)
+        {
+            RecordListEntry* next_record_entry = record_entry->Next;
+            delete record_entry;
+            record_entry = next_record_entry;
+        }
+
+        for (std::atomic<Node*>& child : Children)
+        {
+            delete child.load(std::memory_order_acquire);
+        }
+    }
+
+    /// Creates an empty cache.
+    /// @param[in]  bounds - The bounds of the surfaces that will have records, which the octree is subdivided within.
+    ///     Records outside the bounds may still be inserted but are slower to look up.  If the bounds aren't finite,
+    ///     the octree won't be subdivided at all.
+    IrradianceCache::IrradianceCache(const AxisAlignedBoundingBox& bounds)
+    {
+        // MAKE THE ROOT A CUBE COVERING THE BOUNDS.
+        bool bounds_subdividable = (bounds.IsFinite() && !bounds.IsEmpty());
+        if (bounds_subdividable)
+        {
+            MATH::Vector3f size = bounds.Size();
+            RootCenter = bounds.Center();
+            RootHalfSize = std::max({ size.X, size.Y, size.Z }) / 2.0f;
+        }
+        else
+        {
+            RootHalfSize = std::numeric_limits<float>::infinity();
+        }
+    }
+
+    /// Deletes all records.  No other threads may be using the cache.
+    IrradianceCache::~IrradianceCache() = default;
+
+    /// Adds a record to the cache.  Safe to call from any number of threads at once.
+    /// @param[in]  record - The record to add.
+    void IrradianceCache::Insert(const Record& record)
+    {
+        Insert(record, Root, RootCenter, RootHalfSize, 0);
+        InsertedRecordCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /// Interpolates irradiance at a point from all records valid for it, with each record weighted based on how
+    /// close it is relative to its validity radius and how similar its surface normal is.
+    /// Safe to call from any number of threads at once, including while records are being inserted.
+    /// @param[in]  position - The world position of the point on a surface.
+    /// @param[in]  unit_surface_normal - The unit surface normal at the point.
+    /// @return The interpolated irradiance, if any records are valid for the point; null otherwise.
+    std::optional<GRAPHICS::Color> IrradianceCache::Interpolate(const MATH::Vector3f& position, const MATH::Vector3f& unit_surface_normal) const
+    {
+        // DEFINE HOW TO ADD THE CONTRIBUTION OF A RECORD.
+        // Colors are summed manually since color addition clamps.
+        float total_weight = 0.0f;
+        float total_red = 0.0f;
+        float total_green = 0.0f;
+        float total_blue = 0.0f;
+        auto add_record = [&](const Record& record)
+        {
+            // SKIP RECORDS IN FRONT OF THE POINT.
+            // Such records may see surfaces that are behind the point (and so can't light it).
+            MATH::Vector3f offset_from_record = position - record.Position;
+            MATH::Vector3f average_normal = MATH::Vector3f::Scale(0.5f, unit_surface_normal + record.UnitSurfaceNormal);
+            constexpr float MAX_DISTANCE_IN_FRONT_AS_PROPORTION_OF_RADIUS = 0.05f;
+            bool record_in_front_of_point = (MATH::Vector3f::DotProduct(offset_from_record, average_normal) < -MAX_DISTANCE_IN_FRONT_AS_PROPORTION_OF_RADIUS * record.ValidityRadius);
+            if (record_in_front_of_point)
+            {
+                return;
+            }
+
+            // WEIGHT THE RECORD BASED ON ITS ESTIMATED ERROR.
+            // Error grows with distance and with how differently the surfaces face, and the record
+            // isn't used once the error reaches 1, so records fade out smoothly toward their edges.
+            float distance_proportion = offset_from_record.Length() / record.ValidityRadius;
+            float normal_alignment = MATH::Vector3f::DotProduct(unit_surface_normal, record.UnitSurfaceNormal);
+            float normal_difference = std::sqrt(std::max(0.0f, 1.0f - normal_alignment));
+            float error = distance_proportion + normal_difference;
+            float weight = 1.0f - error;
+            if (weight <= 0.0f)
+            {
+                return;
+            }
+
+            total_weight += weight;
+            total_red += weight * record.Irradiance.Red;
+            total_green += weight * record.Irradiance.Green;
+            total_blue += weight * record.Irradiance.Blue;
+        };
+
+        // CHECK RECORDS IN EACH NODE CONTAINING THE POINT.
+        const Node* node = &Root;
+        MATH::Vector3f node_center = RootCenter;
+        float node_half_size = RootHalfSize;
+        while (node)
+        {
+            for (const RecordListEntry* record_entry = node->Records.load(std::memory_order_acquire); record_entry; record_entry = record_entry->Next)
+            {
+                add_record(record_entry->Record);
+            }
+
+            // MOVE TO THE CHILD CONTAINING THE POINT.
+            bool point_in_node = (
+                (std::abs(position.X - node_center.X) <= node_half_size) &&
+                (std::abs(position.Y - node_center.Y) <= node_half_size) &&
+                (std::abs(position.Z - node_center.Z) <= node_half_size));
+            if (!point_in_node || !std::isfinite(node_half_size))
+            {
+                break;
+            }
+            std::size_t child_index = (
+                ((position.X > node_center.X) ? 1 : 0) |
+                ((position.Y > node_center.Y) ? 2 : 0) |
+                ((position.Z > node_center.Z) ? 4 : 0));
+            node_center = ChildCenter(node_center, node_half_size, child_index);
+            node_half_size /= 2.0f;
+            node = node->Children[child_index].load(std::memory_order_acquire);
+        }
+
+        // AVERAGE THE VALID RECORDS.
+        if (total_weight <= 0.0f)
+        {
+            return std::nullopt;
+        }
+        GRAPHICS::Color irradiance(
+            total_red / total_weight,
+            total_green / total_weight,
+            total_blue / total_weight,
+            GRAPHICS::Color::MAX_FLOAT_COLOR_COMPONENT);
+        return irradiance;
+    }
+
+    /// Gets the number of records that have been inserted.
+    /// @return The number of records in the cache.
+    std::size_t IrradianceCache::RecordCount() const
+    {
+        return InsertedRecordCount.load(std::memory_order_relaxed);
+    }
+
+    /// Adds a record to a node or the children it overlaps.
+    /// @param[in]  record - The record to add.
+    /// @param[in,out]  node - The node to add the record to.
+    /// @param[in]  node_center - The center of the node.
+    /// @param[in]  node_half_size - Half the width of the node along each axis.
+    /// @param[in]  depth - The depth of the node within the octree (0 for the root).
+    void IrradianceCache::Insert(
+        const Record& record,
+        Node& node,
+        const MATH::Vector3f& node_center,
+        const float node_half_size,
+        const unsigned int depth)
+    {
+        // STORE THE RECORD IN THIS NODE IF CHILDREN WOULD BE TOO SMALL.
+        // Children must be at least as wide as the record's validity sphere so that the sphere overlaps
+        // at most 2 children along each axis.
+        bool node_subdividable = (std::isfinite(node_half_size) && (depth < MAX_DEPTH));
+        float child_size = node_half_size;
+        bool children_fit_record = (child_size >= 2.0f * record.ValidityRadius);
+
+        // STORE RECORDS EXTENDING OUTSIDE THE ROOT IN THE ROOT.
+        // Children only cover the root, so such records would be lost (or missed by lookups outside the root).
+        float max_offset_within_node = node_half_size - record.ValidityRadius;
+        bool record_within_node = (
+            (std::abs(record.Position.X - node_center.X) <= max_offset_within_node) &&
+            (std::abs(record.Position.Y - node_center.Y) <= max_offset_within_node) &&
+            (std::abs(record.Position.Z - node_center.Z) <= max_offset_within_node));
+        bool record_outside_root = ((0 == depth) && !record_within_node);
+        if (!node_subdividable || !children_fit_record || record_outside_root)
+        {
+            // ATOMICALLY PUSH THE RECORD ONTO THE FRONT OF THE NODE'S LIST.
+            // If another thread pushed a record first, the new entry is relinked and tried again.
+            RecordListEntry* record_entry = new RecordListEntry { .Record = record };
+            record_entry->Next = node.Records.load(std::memory_order_relaxed);
+            while (!node.Records.compare_exchange_weak(record_entry->Next, record_entry, std::memory_order_release, std::memory_order_relaxed))
+            {
+                // The record entry's next pointer has been updated to the current first entry.
+            }
+            return;
+        }
+
+        // ADD THE RECORD TO EACH CHILD ITS VALIDITY SPHERE OVERLAPS.
+        float child_half_size = node_half_size / 2.0f;
+        for (std::size_t child_index = 0; child_index < node.Children.size(); ++child_index)
+        {
+            // SKIP CHILDREN THE RECORD DOESN'T OVERLAP.
+            MATH::Vector3f child_center = ChildCenter(node_center, node_half_size, child_index);
+            float max_offset = child_half_size + record.ValidityRadius;
+            bool record_overlaps_child = (
+                (std::abs(record.Position.X - child_center.X) <= max_offset) &&
+                (std::abs(record.Position.Y - child_center.Y) <= max_offset) &&
+                (std::abs(record.Position.Z - child_center.Z) <= max_offset));
+            if (!record_overlaps_child)
+            {
+                continue;
+            }
+
+            // CREATE THE CHILD IF NEEDED.
+            // If another thread created the child first, its child is used instead.
+            std::atomic<Node*>& child_pointer = node.Children[child_index];
+            Node* child = child_pointer.load(std::memory_order_acquire);
+            if (!child)
+            {
+                Node* new_child = new Node();
+                bool new_child_added = child_pointer.compare_exchange_strong(child, new_child, std::memory_order_acq_rel, std::memory_order_acquire);
+                if (new_child_added)
+                {
+                    child = new_child;
+                }
+                else
+                {
+                    delete new_child;
+                }
+            }
+
+            Insert(record, *child, child_center, child_half_size, depth + 1);
+        }
+    }
+
+    /// Computes the center of a child node.
+    /// @param[in]  node_center - The center of the parent node.
+    /// @param[in]  node_half_size - Half the width of the parent node along each axis.
+    /// @param[in]  child_index - The index of the child (with 1 bit per axis set for the positive half).
+    /// @return The center of the child.
+    MATH::Vector3f IrradianceCache::ChildCenter(const MATH::Vector3f& node_center, const float node_half_size, const std::size_t child_index)
+    {
+        float quarter_size = node_half_size / 2.0f;
+        MATH::Vector3f child_center(
+            node_center.X + ((child_index & 1) ? quarter_size : -quarter_size),
+            node_center.Y + ((child_index & 2) ? quarter_size : -quarter_size),
+            node_center.Z + ((child_index & 4) ? quarter_size : -quarter_size));
+        return child_center;
+    }
+}
+}
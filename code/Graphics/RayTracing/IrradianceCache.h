@@ -0,0 +1,112 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include "Graphics/Color.h"
+#include "Graphics/RayTracing/AxisAlignedBoundingBox.h"
+#include "Math/Vector3.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// A cache of indirect diffuse irradiance at sparse points on surfaces (Ward et al., "A Ray Tracing
+    /// Solution for Diffuse Interreflection").  Indirect diffuse light changes slowly across surfaces, so
+    /// rather than being computed for every pixel, it's computed at a few points and interpolated between them.
+    ///
+    /// Each record is valid within a radius based on how close nearby surfaces are (since nearby surfaces cause
+    /// indirect light to change more quickly) and for surfaces facing a similar direction.  Records are stored
+    /// in an octree, in each node overlapping the record's validity sphere at a depth where nodes are about as
+    /// large as the sphere, so lookups only need to check records in the few nodes containing the point.
+    ///
+    /// Any number of threads may look up and insert records at the same time without locks.  Records and
+    /// octree nodes are added by atomically swapping pointers and are never removed until the cache is destroyed,
+    /// so readers always see consistent data.  Which records exist depends on the order threads insert them,
+    /// so interpolated results may differ slightly between renders using different numbers of threads.
+    /// Records remain valid as long as the scene is static, so a cache can be kept across frames.
+    class IrradianceCache
+    {
+    public:
+        /// Irradiance cached at a single point on a surface.
+        class Record
+        {
+        public:
+            // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+            /// The world position of the point on the surface.
+            MATH::Vector3f Position = MATH::Vector3f();
+            /// The unit surface normal at the point.
+            MATH::Vector3f UnitSurfaceNormal = MATH::Vector3f();
+            /// The irradiance (as the average color of incoming light) at the point.
+            GRAPHICS::Color Irradiance = GRAPHICS::Color::BLACK;
+            /// The distance within which the record may be used.
+            float ValidityRadius = 0.0f;
+        };
+
+        // STATIC CONSTANTS.
+        /// The maximum depth of nodes in the octree, limiting how finely it's subdivided for tiny records.
+        static constexpr unsigned int MAX_DEPTH = 16;
+
+        // CONSTRUCTION/DESTRUCTION.
+        explicit IrradianceCache(const AxisAlignedBoundingBox& bounds);
+        ~IrradianceCache();
+        IrradianceCache(const IrradianceCache&) = delete;
+        IrradianceCache& operator=(const IrradianceCache&) = delete;
+
+        // CACHING.
+        void Insert(const Record& record);
+        std::optional<GRAPHICS::Color> Interpolate(const MATH::Vector3f& position, const MATH::Vector3f& unit_surface_normal) const;
+        std::size_t RecordCount() const;
+
+    private:
+        /// A record in the list of records stored in an octree node.
+        class RecordListEntry
+        {
+        public:
+            // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+            /// The record.
+            IrradianceCache::Record Record = IrradianceCache::Record();
+            /// The next entry in the list.  Null for the last entry.
+            RecordListEntry* Next = nullptr;
+        };
+
+        /// A cubic node of the octree.
+        class Node
+        {
+        public:
+            // CONSTRUCTION/DESTRUCTION.
+            explicit Node() = default;
+            ~Node();
+            Node(const Node&) = delete;
+            Node& operator=(const Node&) = delete;
+
+            // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+            /// The child nodes covering each octant, indexed by 1 bit per axis (X as the lowest bit) set for
+            /// the positive half.  Null until a record is inserted into the octant.
+            std::array<std::atomic<Node*>, 8> Children = {};
+            /// The first record stored in the node.  Null if the node has no records.
+            std::atomic<RecordListEntry*> Records = nullptr;
+        };
+
+        // PRIVATE HELPER METHODS.
+        void Insert(
+            const Record& record,
+            Node& node,
+            const MATH::Vector3f& node_center,
+            const float node_half_size,
+            const unsigned int depth);
+        static MATH::Vector3f ChildCenter(const MATH::Vector3f& node_center, const float node_half_size, const std::size_t child_index);
+
+        // MEMBER VARIABLES.
+        /// The root node of the octree.  Records outside of it are stored in it.
+        Node Root = Node();
+        /// The center of the root node.
+        MATH::Vector3f RootCenter = MATH::Vector3f();
+        /// Half the width of the root node along each axis.  Infinite if the root can't be subdivided.
+        float RootHalfSize = 0.0f;
+        /// The number of records that have been inserted.
+        std::atomic<std::size_t> InsertedRecordCount = 0;
+    };
+}
+}
@@ -0,0 +1,84 @@
+#include <algorithm>
+#include <limits>
+#include "Graphics/RayTracing/LightDistribution.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// Computes the power of a light for weighting how likely it is to be sampled.
+    /// @param[in]  light - The light whose power to compute.
+    /// @return The sum of the light's red, green, and blue components.
+    float LightDistribution::Power(const Light& light)
+    {
+        float power = light.Color.Red + light.Color.Green + light.Color.Blue;
+        return power;
+    }
+
+    /// Builds the distribution over the specified point lights, replacing any previous contents.
+    /// @param[in]  lights - The point lights to build the distribution over.
+    void LightDistribution::Build(const std::vector<Light>& lights)
+    {
+        // CLEAR ANY PREVIOUS CONTENTS.
+        LightPowers.clear();
+        CumulativeLightPowers.clear();
+
+        // COMPUTE THE POWER OF EACH LIGHT AND THE RUNNING TOTAL.
+        // Lights without power (or with invalid negative power) don't add to the total so that they're never chosen.
+        LightPowers.reserve(lights.size());
+        CumulativeLightPowers.reserve(lights.size());
+        float total_power = 0.0f;
+        for (const Light& light : lights)
+        {
+            float light_power = std::max(0.0f, Power(light));
+            total_power += light_power;
+            LightPowers.push_back(light_power);
+            CumulativeLightPowers.push_back(total_power);
+        }
+    }
+
+    /// Gets the number of lights in the distribution.
+    /// @return The number of lights.
+    std::size_t LightDistribution::LightCount() const
+    {
+        return LightPowers.size();
+    }
+
+    /// Randomly chooses a light in proportion to its power.
+    /// @param[in]  random_number - A random number in [0, 1) determining which light is chosen.
+    /// @param[out]  probability - The probability that the returned light was chosen.
+    ///     Contributions from the light should be divided by this to remain unbiased.
+    /// @return The index of the chosen light; null if no lights in the distribution have any power.
+    std::optional<std::size_t> LightDistribution::SampleLight(const float random_number, float& probability) const
+    {
+        // CHECK IF ANY LIGHT CAN BE CHOSEN.
+        probability = 0.0f;
+        if (CumulativeLightPowers.empty())
+        {
+            return std::nullopt;
+        }
+        float total_power = CumulativeLightPowers.back();
+        if (total_power <= 0.0f)
+        {
+            return std::nullopt;
+        }
+
+        // FIND THE LIGHT WHOSE RANGE OF CUMULATIVE POWER CONTAINS THE RANDOM NUMBER.
+        // Each light's range ends at its cumulative power, so the first light whose cumulative power exceeds
+        // the scaled random number is chosen.  Lights without power have empty ranges and are never chosen.
+        constexpr float LARGEST_RANDOM_NUMBER = 1.0f - std::numeric_limits<float>::epsilon() / 2.0f;
+        float power_to_skip = std::clamp(random_number, 0.0f, LARGEST_RANDOM_NUMBER) * total_power;
+        auto chosen_light = std::upper_bound(CumulativeLightPowers.cbegin(), CumulativeLightPowers.cend(), power_to_skip);
+        bool rounded_past_last_light = (CumulativeLightPowers.cend() == chosen_light);
+        if (rounded_past_last_light)
+        {
+            // The last light with any power is the first to reach the total power.
+            chosen_light = std::lower_bound(CumulativeLightPowers.cbegin(), CumulativeLightPowers.cend(), total_power);
+        }
+
+        std::size_t chosen_light_index = static_cast<std::size_t>(chosen_light - CumulativeLightPowers.cbegin());
+        probability = LightPowers[chosen_light_index] / total_power;
+        return chosen_light_index;
+    }
+}
+}
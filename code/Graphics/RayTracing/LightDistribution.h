@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+#include "Graphics/Light.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// A distribution over point lights, allowing a single light to be randomly chosen
+    /// with probability proportional to its power.
+    /// The running total of power over all lights is stored, so choosing a light only requires
+    /// a binary search, and the cost of choosing a light grows only logarithmically with the number of lights.
+    ///
+    /// Point lights in this renderer aren't attenuated with distance, so light positions aren't considered.
+    /// Power is only an estimate of each light's contribution (ignoring shadows and surface orientation),
+    /// so the probability of choosing each light is also returned to allow unbiased weighting.
+    /// Every light with any power has a non-zero probability of being chosen.
+    ///
+    /// The distribution only stores the power of each light, so it must be rebuilt whenever lights change.
+    class LightDistribution
+    {
+    public:
+        // STATIC METHODS.
+        static float Power(const Light& light);
+
+        // CONSTRUCTION.
+        void Build(const std::vector<Light>& lights);
+
+        // SAMPLING.
+        std::size_t LightCount() const;
+        std::optional<std::size_t> SampleLight(const float random_number, float& probability) const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The power of each light, in the same order as the lights the distribution was built for.
+        std::vector<float> LightPowers = {};
+        /// The total power of each light and all lights before it, in the same order as \ref LightPowers.
+        std::vector<float> CumulativeLightPowers = {};
+    };
+}
+}
@@ -0,0 +1,264 @@
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include "Graphics/RayTracing/LightmapBaker.h"
+#include "Math/Matrix4x4.h"
+#include "Math/Vector4.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// Generates simple lightmap texture coordinates for an object by giving each triangle its own square cell
+    /// within a grid covering the lightmap.  Each triangle covers half of its cell (with its first vertex at the
+    /// cell's top-left, second vertex at the bottom-left, and third vertex at the top-right), inset by a pixel
+    /// so that filtering doesn't blend neighboring triangles.  Triangles aren't scaled by their size, so this
+    /// is best suited to objects with similarly sized triangles.
+    /// @param[in,out]  object_3D - The object whose triangles' lightmap texture coordinates to generate.
+    /// @param[in]  lightmap_dimension_in_pixels - The width and height of the lightmap the coordinates are for.
+    ///     Should allow cells at least a few pixels wide for the number of triangles.
+    void LightmapBaker::GenerateLightmapTextureCoordinates(Object3D& object_3D, const unsigned int lightmap_dimension_in_pixels)
+    {
+        // DETERMINE THE SIZE OF EACH TRIANGLE'S CELL.
+        std::size_t triangle_count = object_3D.Triangles.size();
+        std::size_t cell_count_per_row = static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<float>(triangle_count))));
+        cell_count_per_row = std::max<std::size_t>(1, cell_count_per_row);
+        float lightmap_dimension = static_cast<float>(lightmap_dimension_in_pixels);
+        float cell_dimension_in_pixels = lightmap_dimension / static_cast<float>(cell_count_per_row);
+        float inset_in_pixels = std::min(DILATION_DISTANCE_IN_PIXELS, cell_dimension_in_pixels / 4.0f);
+
+        // PLACE EACH TRIANGLE IN ITS OWN CELL.
+        for (std::size_t triangle_index = 0; triangle_index < triangle_count; ++triangle_index)
+        {
+            std::size_t cell_column = triangle_index % cell_count_per_row;
+            std::size_t cell_row = triangle_index / cell_count_per_row;
+            float left = (static_cast<float>(cell_column) * cell_dimension_in_pixels + inset_in_pixels) / lightmap_dimension;
+            float right = (static_cast<float>(cell_column + 1) * cell_dimension_in_pixels - inset_in_pixels) / lightmap_dimension;
+            float top = (static_cast<float>(cell_row) * cell_dimension_in_pixels + inset_in_pixels) / lightmap_dimension;
+            float bottom = (static_cast<float>(cell_row + 1) * cell_dimension_in_pixels - inset_in_pixels) / lightmap_dimension;
+
+            Triangle& triangle = object_3D.Triangles[triangle_index];
+            triangle.LightmapTextureCoordinates[0] = MATH::Vector2f(left, top);
+            triangle.LightmapTextureCoordinates[1] = MATH::Vector2f(left, bottom);
+            triangle.LightmapTextureCoordinates[2] = MATH::Vector2f(right, top);
+        }
+    }
+
+    /// Bakes the direct lighting reaching an object into a new lightmap for the object.
+    /// @param[in]  scene - The scene providing lights and objects that may cast shadows.
+    ///     The object itself should typically be in the scene (in world space) so that it can shadow itself.
+    /// @param[in,out]  object_3D - The object to bake a lightmap for, based on its current lightmap texture
+    ///     coordinates and world transform.  Its lightmap is replaced with the newly baked one.
+    /// @param[in]  thread_count - The number of threads to bake with.  At least 1 thread is always used.
+    void LightmapBaker::Bake(const Scene& scene, Object3D& object_3D, const unsigned int thread_count) const
+    {
+        // TRANSFORM THE TRIANGLES INTO WORLD SPACE.
+        MATH::Matrix4x4f world_transform = object_3D.WorldTransform();
+        std::vector< std::array<MATH::Vector3f, Triangle::VERTEX_COUNT> > world_triangles;
+        std::vector<MATH::Vector3f> world_unit_surface_normals;
+        world_triangles.reserve(object_3D.Triangles.size());
+        world_unit_surface_normals.reserve(object_3D.Triangles.size());
+        for (const Triangle& local_triangle : object_3D.Triangles)
+        {
+            std::array<MATH::Vector3f, Triangle::VERTEX_COUNT> world_vertices = {};
+            for (std::size_t vertex_index = 0; vertex_index < Triangle::VERTEX_COUNT; ++vertex_index)
+            {
+                MATH::Vector4f world_vertex = world_transform * MATH::Vector4f::HomogeneousPositionVector(local_triangle.Vertices[vertex_index]);
+                world_vertices[vertex_index] = MATH::Vector3f(world_vertex.X, world_vertex.Y, world_vertex.Z);
+            }
+            world_triangles.push_back(world_vertices);
+
+            MATH::Vector3f first_edge = world_vertices[1] - world_vertices[0];
+            MATH::Vector3f second_edge = world_vertices[2] - world_vertices[0];
+            world_unit_surface_normals.push_back(MATH::Vector3f::Normalize(MATH::Vector3f::CrossProduct(first_edge, second_edge)));
+        }
+
+        // FIND THE POINT ON THE NEAREST TRIANGLE FOR EACH LIGHTMAP PIXEL.
+        // Each triangle only needs to check pixels near its bounding rectangle in the lightmap.
+        unsigned int dimension_in_pixels = LightmapDimensionInPixels;
+        float dimension = static_cast<float>(dimension_in_pixels);
+        std::vector<PixelSurfacePoint> pixel_surface_points(static_cast<std::size_t>(dimension_in_pixels) * dimension_in_pixels);
+        for (std::size_t triangle_index = 0; triangle_index < object_3D.Triangles.size(); ++triangle_index)
+        {
+            // GET THE TRIANGLE IN PIXEL COORDINATES.
+            const Triangle& triangle = object_3D.Triangles[triangle_index];
+            std::array<MATH::Vector2f, Triangle::VERTEX_COUNT> pixel_vertices = {};
+            for (std::size_t vertex_index = 0; vertex_index < Triangle::VERTEX_COUNT; ++vertex_index)
+            {
+                pixel_vertices[vertex_index] = MATH::Vector2f(
+                    triangle.LightmapTextureCoordinates[vertex_index].X * dimension,
+                    triangle.LightmapTextureCoordinates[vertex_index].Y * dimension);
+            }
+
+            // SKIP TRIANGLES WITHOUT ANY AREA IN THE LIGHTMAP.
+            MATH::Vector2f first_edge = pixel_vertices[1] - pixel_vertices[0];
+            MATH::Vector2f second_edge = pixel_vertices[2] - pixel_vertices[0];
+            float twice_signed_area = (first_edge.X * second_edge.Y) - (first_edge.Y * second_edge.X);
+            bool triangle_has_area = (std::abs(twice_signed_area) > 0.0f);
+            if (!triangle_has_area)
+            {
+                continue;
+            }
+
+            // FIND THE PIXELS THAT MAY BE NEAR THE TRIANGLE.
+            float min_x = std::min({ pixel_vertices[0].X, pixel_vertices[1].X, pixel_vertices[2].X }) - DILATION_DISTANCE_IN_PIXELS;
+            float max_x = std::max({ pixel_vertices[0].X, pixel_vertices[1].X, pixel_vertices[2].X }) + DILATION_DISTANCE_IN_PIXELS;
+            float min_y = std::min({ pixel_vertices[0].Y, pixel_vertices[1].Y, pixel_vertices[2].Y }) - DILATION_DISTANCE_IN_PIXELS;
+            float max_y = std::max({ pixel_vertices[0].Y, pixel_vertices[1].Y, pixel_vertices[2].Y }) + DILATION_DISTANCE_IN_PIXELS;
+            float max_pixel_coordinate = dimension - 1.0f;
+            unsigned int left_x = static_cast<unsigned int>(std::clamp(std::floor(min_x), 0.0f, max_pixel_coordinate));
+            unsigned int right_x = static_cast<unsigned int>(std::clamp(std::ceil(max_x), 0.0f, max_pixel_coordinate));
+            unsigned int top_y = static_cast<unsigned int>(std::clamp(std::floor(min_y), 0.0f, max_pixel_coordinate));
+            unsigned int bottom_y = static_cast<unsigned int>(std::clamp(std::ceil(max_y), 0.0f, max_pixel_coordinate));
+
+            // ASSIGN THE TRIANGLE TO PIXELS IT'S NEAREST TO.
+            for (unsigned int y = top_y; y <= bottom_y; ++y)
+            {
+                for (unsigned int x = left_x; x <= right_x; ++x)
+                {
+                    MATH::Vector2f pixel_center(static_cast<float>(x) + 0.5f, static_cast<float>(y) + 0.5f);
+                    MATH::Vector2f closest_point = ClosestPointOnTriangle(pixel_center, pixel_vertices);
+                    float distance_in_pixels = (pixel_center - closest_point).Length();
+                    PixelSurfacePoint& pixel_surface_point = pixel_surface_points[static_cast<std::size_t>(y) * dimension_in_pixels + x];
+                    bool triangle_nearest_to_pixel = (
+                        (distance_in_pixels <= DILATION_DISTANCE_IN_PIXELS) &&
+                        (distance_in_pixels < pixel_surface_point.DistanceInPixels));
+                    if (triangle_nearest_to_pixel)
+                    {
+                        pixel_surface_point.TriangleIndex = triangle_index;
+                        pixel_surface_point.VertexWeights = BarycentricWeights(closest_point, pixel_vertices);
+                        pixel_surface_point.DistanceInPixels = distance_in_pixels;
+                    }
+                }
+            }
+        }
+
+        // DEFINE HOW TO LIGHT ROWS OF PIXELS UNTIL ALL HAVE BEEN CLAIMED.
+        // Each pixel is only written by a single thread.
+        auto lightmap = std::make_shared<Texture>(dimension_in_pixels, dimension_in_pixels, ColorFormat::RGBA);
+        std::atomic<unsigned int> next_row_index = 0;
+        auto light_rows = [&]()
+        {
+            while (true)
+            {
+                unsigned int y = next_row_index.fetch_add(1, std::memory_order_relaxed);
+                bool all_rows_claimed = (y >= dimension_in_pixels);
+                if (all_rows_claimed)
+                {
+                    return;
+                }
+
+                for (unsigned int x = 0; x < dimension_in_pixels; ++x)
+                {
+                    // LEAVE PIXELS NOT NEAR ANY TRIANGLE UNLIT.
+                    const PixelSurfacePoint& pixel_surface_point = pixel_surface_points[static_cast<std::size_t>(y) * dimension_in_pixels + x];
+                    bool pixel_near_triangle = std::isfinite(pixel_surface_point.DistanceInPixels);
+                    if (!pixel_near_triangle)
+                    {
+                        lightmap->Bitmap.WritePixel(x, y, Color::BLACK);
+                        continue;
+                    }
+
+                    // FIND THE POINT ON THE TRIANGLE IN WORLD SPACE.
+                    const std::array<MATH::Vector3f, Triangle::VERTEX_COUNT>& world_vertices = world_triangles[pixel_surface_point.TriangleIndex];
+                    MATH::Vector3f world_point = MATH::Vector3f::Scale(pixel_surface_point.VertexWeights[0], world_vertices[0]);
+                    world_point += MATH::Vector3f::Scale(pixel_surface_point.VertexWeights[1], world_vertices[1]);
+                    world_point += MATH::Vector3f::Scale(pixel_surface_point.VertexWeights[2], world_vertices[2]);
+
+                    // COMPUTE THE LIGHT REACHING THE POINT.
+                    const MATH::Vector3f& unit_surface_normal = world_unit_surface_normals[pixel_surface_point.TriangleIndex];
+                    MATH::Vector3f offset_world_point = world_point + MATH::Vector3f::Scale(SurfaceOffsetDistance, unit_surface_normal);
+                    Color light_color = RayTracer.ComputeDirectLight(scene, offset_world_point, unit_surface_normal);
+                    light_color.Alpha = 1.0f;
+                    lightmap->Bitmap.WritePixel(x, y, light_color);
+                }
+            }
+        };
+
+        // LIGHT ALL ROWS.
+        unsigned int worker_thread_count = std::max(1u, thread_count);
+        worker_thread_count = std::min(worker_thread_count, std::max(1u, dimension_in_pixels));
+        if (worker_thread_count <= 1)
+        {
+            light_rows();
+        }
+        else
+        {
+            std::vector<std::thread> worker_threads;
+            worker_threads.reserve(worker_thread_count);
+            for (unsigned int thread_index = 0; thread_index < worker_thread_count; ++thread_index)
+            {
+                worker_threads.emplace_back(light_rows);
+            }
+            for (std::thread& worker_thread : worker_threads)
+            {
+                worker_thread.join();
+            }
+        }
+
+        object_3D.Lightmap = lightmap;
+    }
+
+    /// Finds the closest point on a 2D triangle to another point.
+    /// @param[in]  point - The point to find the closest point to.
+    /// @param[in]  triangle_vertices - The vertices of the triangle.
+    /// @return The closest point within or on the edges of the triangle.
+    MATH::Vector2f LightmapBaker::ClosestPointOnTriangle(
+        const MATH::Vector2f& point,
+        const std::array<MATH::Vector2f, Triangle::VERTEX_COUNT>& triangle_vertices)
+    {
+        // CHECK IF THE POINT IS ALREADY WITHIN THE TRIANGLE.
+        std::array<float, Triangle::VERTEX_COUNT> vertex_weights = BarycentricWeights(point, triangle_vertices);
+        bool point_in_triangle = std::all_of(vertex_weights.cbegin(), vertex_weights.cend(), [](const float weight) { return weight >= 0.0f; });
+        if (point_in_triangle)
+        {
+            return point;
+        }
+
+        // FIND THE CLOSEST POINT ON ANY EDGE.
+        MATH::Vector2f closest_point = triangle_vertices[0];
+        float closest_distance = std::numeric_limits<float>::infinity();
+        for (std::size_t vertex_index = 0; vertex_index < Triangle::VERTEX_COUNT; ++vertex_index)
+        {
+            const MATH::Vector2f& edge_start = triangle_vertices[vertex_index];
+            const MATH::Vector2f& edge_end = triangle_vertices[(vertex_index + 1) % Triangle::VERTEX_COUNT];
+            MATH::Vector2f edge = edge_end - edge_start;
+            float edge_length_squared = MATH::Vector2f::DotProduct(edge, edge);
+            float ratio_along_edge = 0.0f;
+            if (edge_length_squared > 0.0f)
+            {
+                ratio_along_edge = std::clamp(MATH::Vector2f::DotProduct(point - edge_start, edge) / edge_length_squared, 0.0f, 1.0f);
+            }
+
+            MATH::Vector2f closest_point_on_edge = edge_start + MATH::Vector2f::Scale(ratio_along_edge, edge);
+            float distance = (point - closest_point_on_edge).Length();
+            if (distance < closest_distance)
+            {
+                closest_point = closest_point_on_edge;
+                closest_distance = distance;
+            }
+        }
+
+        return closest_point;
+    }
+
+    /// Computes the barycentric weights of a 2D triangle's vertices for a point.
+    /// @param[in]  point - The point to compute weights for.
+    /// @param[in]  triangle_vertices - The vertices of the triangle.  Must have a non-zero area.
+    /// @return The weight of each vertex, which sum to 1 and are all non-negative for points within the triangle.
+    std::array<float, Triangle::VERTEX_COUNT> LightmapBaker::BarycentricWeights(
+        const MATH::Vector2f& point,
+        const std::array<MATH::Vector2f, Triangle::VERTEX_COUNT>& triangle_vertices)
+    {
+        // Each vertex's weight is the proportion of the triangle's area in the sub-triangle opposite it.
+        MATH::Vector2f first_edge = triangle_vertices[1] - triangle_vertices[0];
+        MATH::Vector2f second_edge = triangle_vertices[2] - triangle_vertices[0];
+        MATH::Vector2f point_offset = point - triangle_vertices[0];
+        float twice_signed_area = (first_edge.X * second_edge.Y) - (first_edge.Y * second_edge.X);
+        float second_vertex_weight = ((point_offset.X * second_edge.Y) - (point_offset.Y * second_edge.X)) / twice_signed_area;
+        float third_vertex_weight = ((first_edge.X * point_offset.Y) - (first_edge.Y * point_offset.X)) / twice_signed_area;
+        float first_vertex_weight = 1.0f - second_vertex_weight - third_vertex_weight;
+        return { first_vertex_weight, second_vertex_weight, third_vertex_weight };
+    }
+}
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <array>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "Graphics/Color.h"
+#include "Graphics/Object3D.h"
+#include "Graphics/RayTracing/RayTracingAlgorithm.h"
+#include "Graphics/RayTracing/Scene.h"
+#include "Graphics/Texture.h"
+#include "Graphics/Triangle.h"
+#include "Math/Vector2.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// Bakes static lighting for objects into lightmap textures using the ray tracer's shadows and direct lighting,
+    /// so that the rasterizing \ref GRAPHICS::Renderer can sample the lightmaps instead of evaluating diffuse light.
+    /// Fully static environments then render with no per-frame cost for shadows or diffuse lighting.
+    /// Ambient light isn't baked since the renderer applies it separately (along with any ambient occlusion
+    /// baked for vertices and the material's ambient color).
+    ///
+    /// Each texel of an object's lightmap is mapped back to a point on the triangle covering it (based on the
+    /// triangles' \ref Triangle::LightmapTextureCoordinates), and the light reaching that point in the scene is
+    /// stored.  Texels just outside triangles are filled from the nearest point on the nearest triangle so that
+    /// filtering near triangle edges doesn't blend in unlit texels.  Rows of texels are lit in parallel.
+    ///
+    /// Objects without lightmap texture coordinates can have simple ones generated, with each triangle given
+    /// its own cell of the lightmap.
+    class LightmapBaker
+    {
+    public:
+        // TEXTURE COORDINATES.
+        static void GenerateLightmapTextureCoordinates(Object3D& object_3D, const unsigned int lightmap_dimension_in_pixels);
+
+        // BAKING.
+        void Bake(
+            const Scene& scene,
+            Object3D& object_3D,
+            const unsigned int thread_count = std::thread::hardware_concurrency()) const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The width and height of baked lightmaps, in pixels.
+        unsigned int LightmapDimensionInPixels = 64;
+        /// How far points are moved off of surfaces (along the surface normal) before tracing shadow rays,
+        /// to avoid surfaces that are also in the scene shadowing themselves.
+        float SurfaceOffsetDistance = 0.001f;
+        /// The ray tracer computing light, whose shadow and diffuse settings are used.
+        RayTracingAlgorithm RayTracer = RayTracingAlgorithm();
+
+    private:
+        /// The point on a triangle whose light is stored in a single lightmap pixel.
+        class PixelSurfacePoint
+        {
+        public:
+            // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+            /// The index of the triangle within the object.  Only valid if the pixel is covered.
+            std::size_t TriangleIndex = 0;
+            /// The barycentric weights of the triangle's vertices for the point.
+            std::array<float, Triangle::VERTEX_COUNT> VertexWeights = {};
+            /// The distance (in pixels) from the pixel's center to the triangle.
+            /// Zero if the pixel's center is within the triangle, and infinity if no triangle covers the pixel.
+            float DistanceInPixels = std::numeric_limits<float>::infinity();
+        };
+
+        // STATIC CONSTANTS.
+        /// How far (in pixels) outside triangles lightmap pixels are filled.
+        static constexpr float DILATION_DISTANCE_IN_PIXELS = 1.0f;
+
+        // PRIVATE HELPER METHODS.
+        static MATH::Vector2f ClosestPointOnTriangle(
+            const MATH::Vector2f& point,
+            const std::array<MATH::Vector2f, Triangle::VERTEX_COUNT>& triangle_vertices);
+        static std::array<float, Triangle::VERTEX_COUNT> BarycentricWeights(
+            const MATH::Vector2f& point,
+            const std::array<MATH::Vector2f, Triangle::VERTEX_COUNT>& triangle_vertices);
+    };
+}
+}
@@ -0,0 +1,71 @@
+#include <limits>
+#include "Graphics/RayTracing/Mesh.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// Constructs a mesh from the specified triangles, building a hierarchy over them.
+    /// @param[in]  triangles - The triangles of the mesh, in the local coordinate space of the mesh.
+    Mesh::Mesh(const std::vector<Triangle>& triangles) :
+        Triangles(triangles),
+        TriangleHierarchy()
+    {
+        // BUILD THE HIERARCHY OVER ALL TRIANGLES.
+        std::vector<AxisAlignedBoundingBox> triangle_bounds;
+        triangle_bounds.reserve(Triangles.size());
+        for (const Triangle& triangle : Triangles)
+        {
+            triangle_bounds.push_back(triangle.Bounds());
+        }
+        TriangleHierarchy.Build(triangle_bounds);
+    }
+
+    /// Finds the closest intersection between a ray and the mesh.
+    /// @param[in]  ray - The ray to check for intersection, in the local coordinate space of the mesh.
+    /// @return The closest intersection with a triangle in the mesh, if one occurred; std::nullopt otherwise.
+    ///     The primitive index of the intersection identifies the intersected triangle.
+    std::optional<RayObjectIntersection> Mesh::Intersect(const Ray& ray) const
+    {
+        // FIND THE CLOSEST TRIANGLE THE RAY INTERSECTS.
+        std::optional<RayObjectIntersection> closest_intersection = std::nullopt;
+        float closest_distance = std::numeric_limits<float>::infinity();
+        TriangleHierarchy.VisitPrimitives(ray, closest_distance, [&](const std::size_t triangle_index)
+        {
+            // CHECK IF THE RAY INTERSECTS THE CURRENT TRIANGLE.
+            std::optional<RayObjectIntersection> intersection = Triangles[triangle_index].Intersect(ray);
+            bool ray_hit_closer_triangle = (intersection && (intersection->DistanceFromRayToObject < closest_distance));
+            if (ray_hit_closer_triangle)
+            {
+                closest_distance = intersection->DistanceFromRayToObject;
+                closest_intersection = intersection;
+                closest_intersection->PrimitiveIndex = triangle_index;
+            }
+
+            // CONTINUE SEARCHING FOR ANY CLOSER TRIANGLES.
+            return false;
+        });
+
+        return closest_intersection;
+    }
+
+    /// Checks if any triangle in the mesh blocks a ray within some range along the ray.
+    /// Triangles with materials that don't cast shadows never block rays.
+    /// @param[in]  ray - The ray to check, in the local coordinate space of the mesh.
+    /// @param[in]  min_distance - The exclusive minimum distance (in units of the ray) at which triangles block the ray.
+    /// @param[in]  max_distance - The exclusive maximum distance (in units of the ray) at which triangles block the ray.
+    /// @return True if the ray is blocked; false otherwise.
+    bool Mesh::Occludes(const Ray& ray, const float min_distance, const float max_distance) const
+    {
+        // STOP AS SOON AS ANY TRIANGLE BLOCKS THE RAY.
+        bool occluded = false;
+        TriangleHierarchy.VisitPrimitives(ray, max_distance, [&](const std::size_t triangle_index)
+        {
+            occluded = Triangles[triangle_index].Occludes(ray, min_distance, max_distance);
+            return occluded;
+        });
+
+        return occluded;
+    }
+}
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+#include "Graphics/RayTracing/BoundingVolumeHierarchy.h"
+#include "Graphics/RayTracing/Ray.h"
+#include "Graphics/RayTracing/RayObjectIntersection.h"
+#include "Graphics/Triangle.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// Triangle geometry that can be shared by many instances placed throughout a scene.
+    /// The triangles are in the local coordinate space of the mesh and have their own
+    /// bounding volume hierarchy (a "bottom-level" hierarchy), so the mesh is intended
+    /// to be treated as immutable once constructed (typically shared as a pointer to const).
+    class Mesh
+    {
+    public:
+        // CONSTRUCTION.
+        explicit Mesh(const std::vector<Triangle>& triangles);
+
+        // INTERSECTION.
+        std::optional<RayObjectIntersection> Intersect(const Ray& ray) const;
+        bool Occludes(const Ray& ray, const float min_distance, const float max_distance) const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The triangles of the mesh, in the local coordinate space of the mesh.
+        std::vector<Triangle> Triangles = {};
+        /// The hierarchy over the triangles, in the local coordinate space of the mesh.
+        BoundingVolumeHierarchy TriangleHierarchy = BoundingVolumeHierarchy();
+    };
+}
+}
@@ -0,0 +1,201 @@
+#include <cmath>
+#include <limits>
+#include "Graphics/RayTracing/MeshInstance.h"
+#include "Math/Vector4.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// Constructor.
+    /// @param[in]  mesh - The shared geometry of the mesh.
+    /// @param[in]  world_transform - The transform from the local coordinate space of the mesh to world space.
+    /// @param[in]  inverse_world_transform - The inverse of the world transform.
+    MeshInstance::MeshInstance(
+        const std::shared_ptr<const RAY_TRACING::Mesh>& mesh,
+        const MATH::Matrix4x4f& world_transform,
+        const MATH::Matrix4x4f& inverse_world_transform) :
+        Mesh(mesh),
+        WorldTransform(world_transform),
+        InverseWorldTransform(inverse_world_transform)
+    {}
+
+    /// Computes the surface normal of the mesh at given point.
+    /// Since each triangle of the mesh has a different normal, the normal of the triangle
+    /// whose plane is closest to the point is used.  This requires checking every triangle,
+    /// so \ref IntersectionSurfaceNormal should be preferred whenever an intersection is available.
+    /// @param[in]  surface_point - The point on the mesh's surface at which to compute a normal.
+    /// @return The unit surface normal at the specified point.
+    MATH::Vector3f MeshInstance::SurfaceNormal(const MATH::Vector3f& surface_point) const
+    {
+        // TRANSFORM THE POINT INTO THE LOCAL COORDINATE SPACE OF THE MESH.
+        MATH::Vector4f homogeneous_world_point = MATH::Vector4f::HomogeneousPositionVector(surface_point);
+        MATH::Vector4f homogeneous_object_point = InverseWorldTransform * homogeneous_world_point;
+        MATH::Vector3f object_point(homogeneous_object_point.X, homogeneous_object_point.Y, homogeneous_object_point.Z);
+
+        // FIND THE TRIANGLE WHOSE PLANE IS CLOSEST TO THE POINT.
+        MATH::Vector3f closest_object_space_normal;
+        float closest_distance_to_plane = std::numeric_limits<float>::infinity();
+        for (const Triangle& triangle : Mesh->Triangles)
+        {
+            MATH::Vector3f triangle_normal = triangle.SurfaceNormal();
+            float distance_to_plane = std::abs(MATH::Vector3f::DotProduct(triangle_normal, object_point - triangle.Vertices[0]));
+            if (distance_to_plane < closest_distance_to_plane)
+            {
+                closest_distance_to_plane = distance_to_plane;
+                closest_object_space_normal = triangle_normal;
+            }
+        }
+
+        MATH::Vector3f world_surface_normal = WorldSpaceSurfaceNormal(closest_object_space_normal);
+        return world_surface_normal;
+    }
+
+    /// Gets a representative material of the mesh.
+    /// Individual triangles may have different materials, which can be retrieved
+    /// for an intersection via \ref IntersectionMaterial.
+    /// @return The material of the first triangle in the mesh; null if no triangles exist.
+    const Material* MeshInstance::GetMaterial() const
+    {
+        if (!Mesh || Mesh->Triangles.empty())
+        {
+            return nullptr;
+        }
+
+        const Material* material = Mesh->Triangles.front().GetMaterial();
+        return material;
+    }
+
+    /// Checks for an intersection between a ray and the mesh instance.
+    /// @param[in]  ray - The ray to check for intersection.
+    /// @return A ray-object intersection, if one occurred; std::nullopt otherwise.
+    ///     The primitive index of the intersection identifies the intersected triangle.
+    std::optional<RayObjectIntersection> MeshInstance::Intersect(const Ray& ray) const
+    {
+        // INTERSECT THE MESH IN ITS LOCAL COORDINATE SPACE.
+        // Since the object space ray's direction isn't re-normalized, distances along it
+        // are the same as distances along the original world space ray.
+        Ray object_space_ray = ObjectSpaceRay(ray);
+        std::optional<RayObjectIntersection> intersection = Mesh->Intersect(object_space_ray);
+        if (!intersection)
+        {
+            return std::nullopt;
+        }
+
+        // RETURN THE INTERSECTION IN TERMS OF THE ORIGINAL RAY AND THIS INSTANCE.
+        intersection->Ray = &ray;
+        intersection->Object = this;
+        return intersection;
+    }
+
+    /// Computes the world-space bounds of the mesh instance.
+    /// @return A box containing the entire mesh instance.
+    AxisAlignedBoundingBox MeshInstance::Bounds() const
+    {
+        AxisAlignedBoundingBox object_space_bounds = Mesh->TriangleHierarchy.Bounds();
+        AxisAlignedBoundingBox world_space_bounds = object_space_bounds.Transform(WorldTransform);
+        return world_space_bounds;
+    }
+
+    /// Gets the kind of object, for reporting statistics.
+    /// @return \ref ObjectType::MESH_INSTANCE.
+    ObjectType MeshInstance::Type() const
+    {
+        return ObjectType::MESH_INSTANCE;
+    }
+
+    /// Computes the surface normal of the intersected triangle.
+    /// @param[in]  intersection - An intersection with this mesh instance.
+    /// @return The unit surface normal at the intersection.
+    MATH::Vector3f MeshInstance::IntersectionSurfaceNormal(const RayObjectIntersection& intersection) const
+    {
+        const Triangle& intersected_triangle = Mesh->Triangles[intersection.PrimitiveIndex];
+        MATH::Vector3f object_space_surface_normal = intersected_triangle.SurfaceNormal();
+        MATH::Vector3f world_surface_normal = WorldSpaceSurfaceNormal(object_space_surface_normal);
+        return world_surface_normal;
+    }
+
+    /// Gets the material of the intersected triangle.
+    /// @param[in]  intersection - An intersection with this mesh instance.
+    /// @return The material at the intersection; null if no material exists.
+    const Material* MeshInstance::IntersectionMaterial(const RayObjectIntersection& intersection) const
+    {
+        const Triangle& intersected_triangle = Mesh->Triangles[intersection.PrimitiveIndex];
+        const Material* material = intersected_triangle.GetMaterial();
+        return material;
+    }
+
+    /// Checks if the mesh instance blocks a ray within some range along the ray.
+    /// @param[in]  ray - The ray to check.
+    /// @param[in]  min_distance - The exclusive minimum distance (in units of the ray) at which the mesh blocks the ray.
+    /// @param[in]  max_distance - The exclusive maximum distance (in units of the ray) at which the mesh blocks the ray.
+    /// @return True if the mesh instance blocks the ray within the range; false otherwise.
+    bool MeshInstance::Occludes(const Ray& ray, const float min_distance, const float max_distance) const
+    {
+        Ray object_space_ray = ObjectSpaceRay(ray);
+        bool occluded = Mesh->Occludes(object_space_ray, min_distance, max_distance);
+        return occluded;
+    }
+
+    /// Gets the mesh's triangles transformed into world space, allowing the instance to be rasterized.
+    /// @param[out]  world_triangles - The world-space vertices of each triangle, in the same order as the mesh's triangles.
+    /// @return True since meshes are always composed of triangles.
+    bool MeshInstance::WorldTriangles(std::vector< std::array<MATH::Vector3f, 3> >& world_triangles) const
+    {
+        world_triangles.clear();
+        world_triangles.reserve(Mesh->Triangles.size());
+        for (const Triangle& triangle : Mesh->Triangles)
+        {
+            std::array<MATH::Vector3f, 3> world_vertices;
+            for (std::size_t vertex_index = 0; vertex_index < triangle.Vertices.size(); ++vertex_index)
+            {
+                MATH::Vector4f homogeneous_vertex = MATH::Vector4f::HomogeneousPositionVector(triangle.Vertices[vertex_index]);
+                MATH::Vector4f world_vertex = WorldTransform * homogeneous_vertex;
+                world_vertices[vertex_index] = MATH::Vector3f(world_vertex.X, world_vertex.Y, world_vertex.Z);
+            }
+            world_triangles.push_back(world_vertices);
+        }
+        return true;
+    }
+
+    /// Transforms a ray from world space into the local coordinate space of the mesh.
+    /// @param[in]  world_ray - The ray in world space.
+    /// @return The ray in the local coordinate space of the mesh.
+    Ray MeshInstance::ObjectSpaceRay(const Ray& world_ray) const
+    {
+        // TRANSFORM THE ORIGIN AS A POSITION.
+        MATH::Vector4f homogeneous_world_origin = MATH::Vector4f::HomogeneousPositionVector(world_ray.Origin);
+        MATH::Vector4f homogeneous_object_origin = InverseWorldTransform * homogeneous_world_origin;
+
+        // TRANSFORM THE DIRECTION AS A DIRECTION.
+        // A W component of 0 prevents the direction from being translated.
+        constexpr float DIRECTION_W = 0.0f;
+        MATH::Vector4f homogeneous_world_direction(world_ray.Direction.X, world_ray.Direction.Y, world_ray.Direction.Z, DIRECTION_W);
+        MATH::Vector4f homogeneous_object_direction = InverseWorldTransform * homogeneous_world_direction;
+
+        Ray object_space_ray(
+            MATH::Vector3f(homogeneous_object_origin.X, homogeneous_object_origin.Y, homogeneous_object_origin.Z),
+            MATH::Vector3f(homogeneous_object_direction.X, homogeneous_object_direction.Y, homogeneous_object_direction.Z));
+        return object_space_ray;
+    }
+
+    /// Transforms a surface normal from the local coordinate space of the mesh into world space.
+    /// Normals must be transformed by the inverse transpose of the world transform
+    /// to remain perpendicular to surfaces under non-uniform scaling.
+    /// @param[in]  object_space_surface_normal - The surface normal in the local coordinate space of the mesh.
+    /// @return The unit surface normal in world space.
+    MATH::Vector3f MeshInstance::WorldSpaceSurfaceNormal(const MATH::Vector3f& object_space_surface_normal) const
+    {
+        // MULTIPLY BY THE TRANSPOSE OF THE INVERSE WORLD TRANSFORM.
+        // The matrix elements are arranged by (column, row), so each column of the
+        // inverse is used as a row of the transpose.
+        const MATH::Vector3f& normal = object_space_surface_normal;
+        MATH::Vector3f world_surface_normal(
+            (InverseWorldTransform.Elements(0, 0) * normal.X) + (InverseWorldTransform.Elements(0, 1) * normal.Y) + (InverseWorldTransform.Elements(0, 2) * normal.Z),
+            (InverseWorldTransform.Elements(1, 0) * normal.X) + (InverseWorldTransform.Elements(1, 1) * normal.Y) + (InverseWorldTransform.Elements(1, 2) * normal.Z),
+            (InverseWorldTransform.Elements(2, 0) * normal.X) + (InverseWorldTransform.Elements(2, 1) * normal.Y) + (InverseWorldTransform.Elements(2, 2) * normal.Z));
+        MATH::Vector3f unit_world_surface_normal = MATH::Vector3f::Normalize(world_surface_normal);
+        return unit_world_surface_normal;
+    }
+}
+}
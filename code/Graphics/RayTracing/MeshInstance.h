@@ -0,0 +1,55 @@
+#pragma once
+
+#include <memory>
+#include "Graphics/Material.h"
+#include "Graphics/RayTracing/IObject3D.h"
+#include "Graphics/RayTracing/Mesh.h"
+#include "Math/Matrix4x4.h"
+#include "Math/Vector3.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// A placement of shared mesh geometry within a scene.
+    /// Many instances can refer to the same mesh, so memory usage scales with the number
+    /// of unique meshes rather than the number of placements.  Rays are transformed into
+    /// the local coordinate space of the mesh for intersection rather than transforming
+    /// the mesh's triangles into world space.
+    class MeshInstance : public IObject3D
+    {
+    public:
+        // CONSTRUCTION.
+        explicit MeshInstance() = default;
+        explicit MeshInstance(
+            const std::shared_ptr<const RAY_TRACING::Mesh>& mesh,
+            const MATH::Matrix4x4f& world_transform,
+            const MATH::Matrix4x4f& inverse_world_transform);
+
+        // PUBLIC METHODS.
+        MATH::Vector3f SurfaceNormal(const MATH::Vector3f& surface_point) const override;
+        const Material* GetMaterial() const override;
+        std::optional<RayObjectIntersection> Intersect(const Ray& ray) const override;
+        AxisAlignedBoundingBox Bounds() const override;
+        ObjectType Type() const override;
+        MATH::Vector3f IntersectionSurfaceNormal(const RayObjectIntersection& intersection) const override;
+        const Material* IntersectionMaterial(const RayObjectIntersection& intersection) const override;
+        bool Occludes(const Ray& ray, const float min_distance, const float max_distance) const override;
+        bool WorldTriangles(std::vector< std::array<MATH::Vector3f, 3> >& world_triangles) const override;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The shared geometry of the mesh.
+        std::shared_ptr<const RAY_TRACING::Mesh> Mesh = nullptr;
+        /// The transform from the local coordinate space of the mesh to world space.
+        MATH::Matrix4x4f WorldTransform = MATH::Matrix4x4f::Identity();
+        /// The transform from world space to the local coordinate space of the mesh.
+        /// Must be kept as the inverse of the world transform.
+        MATH::Matrix4x4f InverseWorldTransform = MATH::Matrix4x4f::Identity();
+
+    private:
+        // PRIVATE HELPER METHODS.
+        Ray ObjectSpaceRay(const Ray& world_ray) const;
+        MATH::Vector3f WorldSpaceSurfaceNormal(const MATH::Vector3f& object_space_surface_normal) const;
+    };
+}
+}
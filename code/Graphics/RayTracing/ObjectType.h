@@ -0,0 +1,26 @@
+#pragma once
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// The different kinds of objects that can be ray traced, for reporting statistics about them.
+    enum class ObjectType
+    {
+        /// A kind of object not listed here (the default for objects that don't report a type).
+        OTHER = 0,
+        /// A \ref Sphere.
+        SPHERE,
+        /// A \ref Plane.
+        PLANE,
+        /// A \ref Disc.
+        DISC,
+        /// An \ref AxisAlignedBox.
+        AXIS_ALIGNED_BOX,
+        /// A \ref MeshInstance.
+        MESH_INSTANCE,
+        /// An extra enum to indicate the number of different object types.
+        COUNT
+    };
+}
+}
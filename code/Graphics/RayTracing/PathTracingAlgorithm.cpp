@@ -0,0 +1,530 @@
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include "Graphics/RayTracing/PathTracingAlgorithm.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// Starts a new render, discarding any samples from a previous render.
+    /// Must be called again whenever the camera or scene changes.
+    /// @param[in]  render_target - The render target that will eventually display the image.
+    ///     Only used to determine the dimensions of the image.
+    void PathTracingAlgorithm::StartRender(const GRAPHICS::RenderTarget& render_target)
+    {
+        unsigned int width_in_pixels = render_target.GetWidthInPixels();
+        unsigned int height_in_pixels = render_target.GetHeightInPixels();
+        Accumulation = AccumulationBuffer(width_in_pixels, height_in_pixels);
+        CameraRayGenerator.emplace(Camera, render_target);
+        UnconvergedTiles = ScreenTile::Partition(width_in_pixels, height_in_pixels);
+        PendingTiles.clear();
+        PassCount = 0;
+    }
+
+    /// Renders a single pass, adding one sample to every pixel in each tile that hasn't converged yet.
+    /// The accumulated image may be displayed between passes via \ref AccumulationBuffer::ResolveTo.
+    /// @param[in]  scene - The scene to render.  Must not change between passes of a single render.
+    /// @param[in]  thread_count - The number of threads to render with.  At least 1 thread is always used.
+    /// @return True if rendering is complete; false if more passes are needed (or no render has been started).
+    bool PathTracingAlgorithm::RenderPass(const Scene& scene, const unsigned int thread_count)
+    {
+        // CHECK IF ANY TILES NEED MORE SAMPLES.
+        if (!CameraRayGenerator)
+        {
+            return false;
+        }
+        if (UnconvergedTiles.empty())
+        {
+            return true;
+        }
+
+        // DEFINE HOW TO RENDER TILES UNTIL ALL HAVE BEEN CLAIMED.
+        // Tiles don't overlap, so each thread writes to different pixels of the accumulation buffer.
+        std::atomic<std::size_t> next_tile_index = 0;
+        auto render_tiles = [&]()
+        {
+            while (true)
+            {
+                std::size_t tile_index = next_tile_index.fetch_add(1, std::memory_order_relaxed);
+                bool all_tiles_claimed = (tile_index >= UnconvergedTiles.size());
+                if (all_tiles_claimed)
+                {
+                    return;
+                }
+
+                RenderTile(scene, UnconvergedTiles[tile_index]);
+            }
+        };
+
+        // RENDER THE TILES.
+        // There's no benefit to having more threads than tiles.
+        unsigned int worker_thread_count = std::max(1u, thread_count);
+        worker_thread_count = std::min(worker_thread_count, static_cast<unsigned int>(UnconvergedTiles.size()));
+        if (worker_thread_count <= 1)
+        {
+            render_tiles();
+        }
+        else
+        {
+            std::vector<std::thread> worker_threads;
+            worker_threads.reserve(worker_thread_count);
+            for (unsigned int thread_index = 0; thread_index < worker_thread_count; ++thread_index)
+            {
+                worker_threads.emplace_back(render_tiles);
+            }
+            for (std::thread& worker_thread : worker_threads)
+            {
+                worker_thread.join();
+            }
+        }
+        ++PassCount;
+
+        // STOP RENDERING ANY TILES THAT HAVE CONVERGED.
+        RemoveConvergedTiles();
+
+        bool render_complete = UnconvergedTiles.empty();
+        return render_complete;
+    }
+
+    /// Continues rendering passes on the calling thread, one tile at a time, until the specified deadline.
+    /// Tiles within each pass are rendered in order of \ref TileRenderingPriority, and any tiles not reached
+    /// before the deadline are carried over to the next call, so a pass may span several calls.
+    /// At least one tile is always rendered (if rendering isn't complete) to guarantee progress.
+    /// @param[in]  scene - The scene to render.  Must not change between calls for a single render.
+    /// @param[in]  deadline - The time by which rendering should stop.
+    /// @return True if rendering is complete; false if more calls are needed (or no render has been started).
+    bool PathTracingAlgorithm::RenderUntil(const Scene& scene, const std::chrono::steady_clock::time_point deadline)
+    {
+        // MAKE SURE A RENDER HAS BEEN STARTED.
+        if (!CameraRayGenerator)
+        {
+            return false;
+        }
+
+        // RENDER TILES UNTIL THE DEADLINE.
+        while (!UnconvergedTiles.empty())
+        {
+            // START A NEW PASS IF THE PREVIOUS ONE FINISHED.
+            if (PendingTiles.empty())
+            {
+                StartTimedPass();
+            }
+
+            // RENDER THE HIGHEST PRIORITY TILE.
+            ScreenTile tile = PendingTiles.back();
+            PendingTiles.pop_back();
+            RenderTile(scene, tile);
+
+            // FINISH THE PASS ONCE ALL OF ITS TILES HAVE BEEN RENDERED.
+            if (PendingTiles.empty())
+            {
+                ++PassCount;
+                RemoveConvergedTiles();
+            }
+
+            // STOP ONCE THE DEADLINE HAS PASSED.
+            bool deadline_passed = (std::chrono::steady_clock::now() >= deadline);
+            if (deadline_passed)
+            {
+                break;
+            }
+        }
+
+        bool render_complete = UnconvergedTiles.empty();
+        return render_complete;
+    }
+
+    /// Determines if the current render is complete.
+    /// @return True if all tiles have converged; false if no render has been started or more passes are needed.
+    bool PathTracingAlgorithm::IsComplete() const
+    {
+        bool render_complete = (CameraRayGenerator && UnconvergedTiles.empty());
+        return render_complete;
+    }
+
+    /// Gets the number of passes rendered so far.
+    /// @return The number of passes since rendering was started.
+    unsigned int PathTracingAlgorithm::CompletedPassCount() const
+    {
+        return PassCount;
+    }
+
+    /// Traces a single random path through the scene to estimate the light arriving along a camera ray.
+    /// @param[in]  scene - The scene to trace through.
+    /// @param[in]  camera_ray - The ray leaving the camera.  Must have a unit direction.
+    /// @param[in,out]  random_number_generator - The source of random numbers for the path.
+    /// @param[out]  first_hit_features - The features of the surface first hit by the camera ray.
+    /// @return The estimated radiance along the ray, as unclamped (red, green, blue).
+    MATH::Vector3f PathTracingAlgorithm::TracePath(
+        const Scene& scene,
+        const Ray& camera_ray,
+        MATH::CounterBasedRandomNumberGenerator& random_number_generator,
+        SurfaceFeatures& first_hit_features) const
+    {
+        // DEFAULT TO THE FEATURES OF THE BACKGROUND.
+        first_hit_features = SurfaceFeatures();
+        first_hit_features.Albedo = MATH::Vector3f(scene.BackgroundColor.Red, scene.BackgroundColor.Green, scene.BackgroundColor.Blue);
+
+        // FOLLOW THE PATH UNTIL IT LEAVES THE SCENE OR IS TERMINATED.
+        // The throughput is the proportion of light at the current vertex that makes it back to the camera.
+        MATH::Vector3f radiance(0.0f, 0.0f, 0.0f);
+        MATH::Vector3f throughput(1.0f, 1.0f, 1.0f);
+        Ray current_ray = camera_ray;
+        for (unsigned int bounce_count = 0; ; ++bounce_count)
+        {
+            // ADD LIGHT FROM THE BACKGROUND IF THE RAY LEAVES THE SCENE.
+            std::optional<RayObjectIntersection> intersection = ComputeClosestIntersection(scene, current_ray);
+            if (!intersection)
+            {
+                radiance += MultiplyComponents(throughput, scene.BackgroundColor);
+                break;
+            }
+
+            // GET THE PROPERTIES OF THE INTERSECTED SURFACE.
+            // The normal is flipped to face the incoming ray so that back faces are lit like front faces.
+            // New rays start slightly above the surface so that they don't hit it again.
+            MATH::Vector3f intersection_point = intersection->IntersectionPoint();
+            const Material* intersected_material = intersection->Object->IntersectionMaterial(*intersection);
+            MATH::Vector3f unit_surface_normal = intersection->Object->IntersectionSurfaceNormal(*intersection);
+            if (MATH::Vector3f::DotProduct(unit_surface_normal, current_ray.Direction) > 0.0f)
+            {
+                unit_surface_normal = -unit_surface_normal;
+            }
+            MATH::Vector3f offset_intersection_point = intersection_point + MATH::Vector3f::Scale(SURFACE_OFFSET_DISTANCE, unit_surface_normal);
+
+            // RECORD THE FEATURES OF THE FIRST SURFACE HIT.
+            if (0 == bounce_count)
+            {
+                const Color& diffuse_color = intersected_material->DiffuseColor;
+                first_hit_features.Albedo = MATH::Vector3f(diffuse_color.Red, diffuse_color.Green, diffuse_color.Blue);
+                first_hit_features.Normal = unit_surface_normal;
+                first_hit_features.Depth = intersection->DistanceFromRayToObject;
+            }
+
+            // ADD LIGHT EMITTED BY THE SURFACE.
+            radiance += MultiplyComponents(throughput, intersected_material->EmissiveColor);
+
+            // ADD LIGHT DIRECTLY FROM LIGHT SOURCES.
+            MATH::Vector3f direct_irradiance = ComputeDirectLighting(scene, offset_intersection_point, unit_surface_normal);
+            MATH::Vector3f direct_radiance = MultiplyComponents(direct_irradiance, intersected_material->DiffuseColor);
+            radiance += MATH::Vector3f(
+                throughput.X * direct_radiance.X,
+                throughput.Y * direct_radiance.Y,
+                throughput.Z * direct_radiance.Z);
+
+            // STOP IF THE PATH HAS REACHED ITS MAXIMUM LENGTH.
+            if (bounce_count >= MaxBounceCount)
+            {
+                break;
+            }
+
+            // CHOOSE THE NEXT DIRECTION.
+            // Choosing a mirror reflection with probability equal to the reflectivity means mirror paths
+            // don't need any extra weighting, while diffuse paths are weighted by the probability of not reflecting.
+            float reflectivity = std::clamp(intersected_material->ReflectivityProportion, 0.0f, 1.0f);
+            bool mirror_reflection = (random_number_generator.NextUniformFloat() < reflectivity);
+            MATH::Vector3f next_direction;
+            if (mirror_reflection)
+            {
+                float ray_length_along_surface_normal = MATH::Vector3f::DotProduct(current_ray.Direction, unit_surface_normal);
+                MATH::Vector3f twice_ray_along_surface_normal = MATH::Vector3f::Scale(2.0f * ray_length_along_surface_normal, unit_surface_normal);
+                next_direction = MATH::Vector3f::Normalize(current_ray.Direction - twice_ray_along_surface_normal);
+            }
+            else
+            {
+                // With cosine-weighted directions, the cosine and probability of each direction cancel out,
+                // leaving just the diffuse color.
+                MATH::Vector3f diffuse_throughput = MultiplyComponents(throughput, intersected_material->DiffuseColor);
+                throughput = MATH::Vector3f::Scale(1.0f / (1.0f - reflectivity), diffuse_throughput);
+                next_direction = CosineWeightedHemisphereDirection(unit_surface_normal, random_number_generator);
+            }
+
+            // RANDOMLY TERMINATE PATHS CARRYING LITTLE LIGHT.
+            // Surviving paths are weighted up to account for terminated paths, keeping results unbiased.
+            bool russian_roulette_applies = (bounce_count + 1 >= RussianRouletteStartBounceCount);
+            if (russian_roulette_applies)
+            {
+                float max_throughput = std::max({ throughput.X, throughput.Y, throughput.Z });
+                float survival_probability = std::min(max_throughput, MAX_RUSSIAN_ROULETTE_SURVIVAL_PROBABILITY);
+                bool path_survives = (random_number_generator.NextUniformFloat() < survival_probability);
+                if (!path_survives)
+                {
+                    break;
+                }
+                throughput = MATH::Vector3f::Scale(1.0f / survival_probability, throughput);
+            }
+
+            // STOP IF NO MORE LIGHT CAN BE CARRIED ALONG THE PATH.
+            bool path_carries_light = (throughput.X > 0.0f) || (throughput.Y > 0.0f) || (throughput.Z > 0.0f);
+            if (!path_carries_light)
+            {
+                break;
+            }
+
+            current_ray = Ray(offset_intersection_point, next_direction);
+        }
+
+        return radiance;
+    }
+
+    /// Adds one sample to every pixel in a tile.
+    /// @param[in]  scene - The scene to render.
+    /// @param[in]  tile - The tile to render.
+    void PathTracingAlgorithm::RenderTile(const Scene& scene, const ScreenTile& tile)
+    {
+        unsigned int width_in_pixels = Accumulation.GetWidthInPixels();
+        unsigned int tile_end_x = tile.LeftX + tile.WidthInPixels;
+        unsigned int tile_end_y = tile.TopY + tile.HeightInPixels;
+        for (unsigned int y = tile.TopY; y < tile_end_y; ++y)
+        {
+            for (unsigned int x = tile.LeftX; x < tile_end_x; ++x)
+            {
+                // CREATE THE RANDOM NUMBERS FOR THE SAMPLE.
+                // Each pixel and sample gets its own independent sequence.
+                std::uint32_t pixel_index = (y * width_in_pixels) + x;
+                std::uint32_t sample_index = Accumulation.Pixels(x, y).SampleCount;
+                std::uint32_t random_number_key = MATH::CounterBasedRandomNumberGenerator::HashCombine(
+                    MATH::CounterBasedRandomNumberGenerator::Hash(pixel_index),
+                    sample_index);
+                MATH::CounterBasedRandomNumberGenerator random_number_generator(random_number_key);
+
+                // TRACE A PATH THROUGH A RANDOM POSITION WITHIN THE PIXEL.
+                // Jittering the position antialiases edges as samples accumulate.
+                MATH::Vector2f screen_position(
+                    static_cast<float>(x) + random_number_generator.NextUniformFloat(),
+                    static_cast<float>(y) + random_number_generator.NextUniformFloat());
+                Ray camera_ray = CameraRayGenerator->ViewingRay(screen_position);
+                SurfaceFeatures first_hit_features;
+                MATH::Vector3f radiance = TracePath(scene, camera_ray, random_number_generator, first_hit_features);
+                Accumulation.AddSample(x, y, radiance, first_hit_features);
+            }
+        }
+    }
+
+    /// Determines if a tile has enough samples to stop rendering it.
+    /// @param[in]  tile - The tile to check.
+    /// @return True if the tile has converged; false if it needs more samples.
+    bool PathTracingAlgorithm::TileConverged(const ScreenTile& tile) const
+    {
+        // CHECK IF THE MAXIMUM NUMBER OF SAMPLES HAS BEEN REACHED.
+        unsigned int min_sample_count = Accumulation.MinSampleCount(tile);
+        if (min_sample_count >= MaxSampleCountPerPixel)
+        {
+            return true;
+        }
+
+        // CHECK IF THE TILE IS SMOOTH ENOUGH.
+        bool variance_can_be_checked = (VarianceThreshold > 0.0f) && (min_sample_count >= MinSampleCountPerPixel);
+        if (!variance_can_be_checked)
+        {
+            return false;
+        }
+
+        float average_variance = Accumulation.AverageVarianceOfMean(tile);
+        bool tile_converged = (average_variance <= VarianceThreshold);
+        return tile_converged;
+    }
+
+    /// Removes any tiles that have converged from those still being rendered.
+    void PathTracingAlgorithm::RemoveConvergedTiles()
+    {
+        auto converged_tiles = std::remove_if(
+            UnconvergedTiles.begin(),
+            UnconvergedTiles.end(),
+            [&](const ScreenTile& tile) { return TileConverged(tile); });
+        UnconvergedTiles.erase(converged_tiles, UnconvergedTiles.end());
+    }
+
+    /// Queues all unconverged tiles for the next pass of \ref RenderUntil, sorted by \ref TileRenderingPriority.
+    void PathTracingAlgorithm::StartTimedPass()
+    {
+        // COMPUTE THE ERROR FOR EACH TILE ONCE IF NEEDED.
+        // Tiles without enough samples to estimate variance have infinite error, so they're rendered first.
+        // Unconverged tiles stay in partition order, so the last one has the largest index.
+        PendingTiles = UnconvergedTiles;
+        bool error_prioritized = (TilePriority::HIGHEST_ERROR == TileRenderingPriority);
+        std::vector<float> errors_by_tile_index;
+        if (error_prioritized && !PendingTiles.empty())
+        {
+            errors_by_tile_index.resize(PendingTiles.back().Index + 1);
+            for (const ScreenTile& tile : PendingTiles)
+            {
+                errors_by_tile_index[tile.Index] = Accumulation.AverageVarianceOfMean(tile);
+            }
+        }
+
+        // SORT THE TILES SO THAT THE HIGHEST PRIORITY TILE IS LAST.
+        // Distance from the screen center is always used to break ties, as for ray traced timed renders.
+        MATH::Vector2f screen_center(
+            static_cast<float>(Accumulation.GetWidthInPixels()) / 2.0f,
+            static_cast<float>(Accumulation.GetHeightInPixels()) / 2.0f);
+        auto squared_distance_from_screen_center = [&](const ScreenTile& tile)
+        {
+            MATH::Vector2f tile_center = tile.Center();
+            float x_distance = tile_center.X - screen_center.X;
+            float y_distance = tile_center.Y - screen_center.Y;
+            float squared_distance = (x_distance * x_distance) + (y_distance * y_distance);
+            return squared_distance;
+        };
+        std::sort(
+            PendingTiles.begin(),
+            PendingTiles.end(),
+            [&](const ScreenTile& lhs_tile, const ScreenTile& rhs_tile)
+            {
+                // LOWER PRIORITY TILES ARE SORTED EARLIER.
+                if (error_prioritized)
+                {
+                    float lhs_error = errors_by_tile_index[lhs_tile.Index];
+                    float rhs_error = errors_by_tile_index[rhs_tile.Index];
+                    if (lhs_error != rhs_error)
+                    {
+                        return lhs_error < rhs_error;
+                    }
+                }
+
+                return squared_distance_from_screen_center(lhs_tile) > squared_distance_from_screen_center(rhs_tile);
+            });
+    }
+
+    /// Computes the light arriving at a surface point directly from all point lights.
+    /// Like \ref RayTracingAlgorithm, lights aren't attenuated by distance.
+    /// @param[in]  scene - The scene containing the lights.
+    /// @param[in]  surface_point - The point being lit, already offset from its surface.
+    /// @param[in]  unit_surface_normal - The unit surface normal at the point.
+    /// @return The total light reaching the point, scaled by the cosine of each light's angle, as (red, green, blue).
+    MATH::Vector3f PathTracingAlgorithm::ComputeDirectLighting(
+        const Scene& scene,
+        const MATH::Vector3f& surface_point,
+        const MATH::Vector3f& unit_surface_normal) const
+    {
+        MATH::Vector3f irradiance(0.0f, 0.0f, 0.0f);
+        for (const Light& light : scene.PointLights)
+        {
+            // SKIP LIGHTS BEHIND THE SURFACE.
+            MATH::Vector3f direction_from_point_to_light = light.PointLightDirectionFrom(surface_point);
+            MATH::Vector3f unit_direction_from_point_to_light = MATH::Vector3f::Normalize(direction_from_point_to_light);
+            float illumination_proportion = MATH::Vector3f::DotProduct(unit_surface_normal, unit_direction_from_point_to_light);
+            if (illumination_proportion <= 0.0f)
+            {
+                continue;
+            }
+
+            // SKIP LIGHTS BLOCKED BY OTHER OBJECTS.
+            // The shadow ray spans the full distance to the light, so the light is reached at a distance of 1.
+            Ray shadow_ray(surface_point, direction_from_point_to_light);
+            constexpr float DISTANCE_AT_LIGHT = 1.0f;
+            if (Occluded(scene, shadow_ray, DISTANCE_AT_LIGHT))
+            {
+                continue;
+            }
+
+            irradiance += MATH::Vector3f(
+                illumination_proportion * light.Color.Red,
+                illumination_proportion * light.Color.Green,
+                illumination_proportion * light.Color.Blue);
+        }
+        return irradiance;
+    }
+
+    /// Computes the closest intersection of a ray with any object in the scene.
+    /// @param[in]  scene - The scene in which to search for intersections.
+    /// @param[in]  ray - The ray to use for searching for intersections.
+    /// @return The closest intersection, if one was found.
+    std::optional<RayObjectIntersection> PathTracingAlgorithm::ComputeClosestIntersection(const Scene& scene, const Ray& ray) const
+    {
+        // CHECK ALL OBJECTS THE RAY MAY HIT.
+        // The closest distance shrinks as intersections are found, allowing more of the scene's
+        // acceleration structure to be skipped.
+        std::optional<RayObjectIntersection> closest_intersection = std::nullopt;
+        float closest_distance = std::numeric_limits<float>::infinity();
+        scene.VisitObjects(ray, closest_distance, [&](const IObject3D& current_object)
+        {
+            std::optional<RayObjectIntersection> intersection = current_object.Intersect(ray);
+            bool new_intersection_closer = (intersection && (intersection->DistanceFromRayToObject < closest_distance));
+            if (new_intersection_closer)
+            {
+                closest_distance = intersection->DistanceFromRayToObject;
+                closest_intersection = intersection;
+            }
+
+            // CONTINUE SEARCHING FOR ANY CLOSER OBJECTS.
+            return false;
+        });
+        return closest_intersection;
+    }
+
+    /// Determines if any object blocks a ray before a maximum distance.
+    /// @param[in]  scene - The scene to check.
+    /// @param[in]  ray - The ray to check.
+    /// @param[in]  max_distance - The maximum distance (in units of the ray) at which objects block the ray.
+    /// @return True if the ray is blocked; false otherwise.
+    bool PathTracingAlgorithm::Occluded(const Scene& scene, const Ray& ray, const float max_distance) const
+    {
+        // STOP SEARCHING AS SOON AS AN OBJECT BLOCKS THE RAY.
+        constexpr float MIN_DISTANCE = 0.0f;
+        bool occluded = false;
+        scene.VisitObjects(ray, max_distance, [&](const IObject3D& current_object)
+        {
+            occluded = current_object.Occludes(ray, MIN_DISTANCE, max_distance);
+            return occluded;
+        });
+        return occluded;
+    }
+
+    /// Randomly chooses a direction in the hemisphere around a surface normal, with directions closer
+    /// to the normal being more likely (in proportion to the cosine of their angle with the normal).
+    /// @param[in]  unit_surface_normal - The unit normal defining the hemisphere.
+    /// @param[in,out]  random_number_generator - The source of random numbers.
+    /// @return A unit direction within the hemisphere.
+    MATH::Vector3f PathTracingAlgorithm::CosineWeightedHemisphereDirection(
+        const MATH::Vector3f& unit_surface_normal,
+        MATH::CounterBasedRandomNumberGenerator& random_number_generator)
+    {
+        // CHOOSE A RANDOM POINT ON A UNIT DISC AND PROJECT IT UP ONTO THE HEMISPHERE.
+        constexpr float FULL_CIRCLE_IN_RADIANS = 2.0f * 3.14159265f;
+        float radius_squared = random_number_generator.NextUniformFloat();
+        float angle_in_radians = FULL_CIRCLE_IN_RADIANS * random_number_generator.NextUniformFloat();
+        float radius = std::sqrt(radius_squared);
+        float tangent_offset = radius * std::cos(angle_in_radians);
+        float bitangent_offset = radius * std::sin(angle_in_radians);
+        float normal_offset = std::sqrt(std::max(0.0f, 1.0f - radius_squared));
+
+        // BUILD AXES PERPENDICULAR TO THE NORMAL.
+        // This construction (from Duff et al., "Building an Orthonormal Basis, Revisited")
+        // avoids any branches or degenerate cases.
+        float sign = std::copysign(1.0f, unit_surface_normal.Z);
+        float a = -1.0f / (sign + unit_surface_normal.Z);
+        float b = unit_surface_normal.X * unit_surface_normal.Y * a;
+        MATH::Vector3f unit_tangent(
+            1.0f + (sign * unit_surface_normal.X * unit_surface_normal.X * a),
+            sign * b,
+            -sign * unit_surface_normal.X);
+        MATH::Vector3f unit_bitangent(
+            b,
+            sign + (unit_surface_normal.Y * unit_surface_normal.Y * a),
+            -unit_surface_normal.Y);
+
+        // TRANSFORM THE DIRECTION TO BE AROUND THE NORMAL.
+        MATH::Vector3f direction = MATH::Vector3f::Scale(tangent_offset, unit_tangent);
+        direction += MATH::Vector3f::Scale(bitangent_offset, unit_bitangent);
+        direction += MATH::Vector3f::Scale(normal_offset, unit_surface_normal);
+        return MATH::Vector3f::Normalize(direction);
+    }
+
+    /// Multiplies radiance by a color component-wise.
+    /// @param[in]  radiance - The radiance, as (red, green, blue).
+    /// @param[in]  color - The color to multiply by.  Alpha is ignored.
+    /// @return The multiplied radiance, as unclamped (red, green, blue).
+    MATH::Vector3f PathTracingAlgorithm::MultiplyComponents(const MATH::Vector3f& radiance, const GRAPHICS::Color& color)
+    {
+        MATH::Vector3f multiplied_radiance(
+            radiance.X * color.Red,
+            radiance.Y * color.Green,
+            radiance.Z * color.Blue);
+        return multiplied_radiance;
+    }
+}
+}
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <chrono>
+#include <optional>
+#include <thread>
+#include <vector>
+#include "Graphics/Camera.h"
+#include "Graphics/Color.h"
+#include "Graphics/RayTracing/AccumulationBuffer.h"
+#include "Graphics/RayTracing/IObject3D.h"
+#include "Graphics/RayTracing/Ray.h"
+#include "Graphics/RayTracing/RayGenerator.h"
+#include "Graphics/RayTracing/RayObjectIntersection.h"
+#include "Graphics/RayTracing/Scene.h"
+#include "Graphics/RayTracing/ScreenTile.h"
+#include "Graphics/RayTracing/SurfaceFeatures.h"
+#include "Graphics/RayTracing/TilePriority.h"
+#include "Graphics/RenderTarget.h"
+#include "Math/CounterBasedRandomNumberGenerator.h"
+#include "Math/Vector3.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// A progressive Monte Carlo path tracer.  Unlike \ref RayTracingAlgorithm, which only follows
+    /// mirror reflections, light bouncing diffusely between surfaces is also simulated, producing
+    /// soft indirect lighting and color bleeding.
+    ///
+    /// Each pass adds one randomly jittered path per pixel to an accumulation buffer, so an image can be
+    /// displayed after any number of passes and keeps improving as more are rendered.  Rendering stops
+    /// for a tile once its pixels reach the maximum sample count or (if enabled) once the estimated
+    /// noise in the tile falls below a threshold, so later passes only spend time on noisy regions.
+    ///
+    /// At each surface hit:
+    ///     - Emitted light is added.
+    ///     - Point lights are sampled directly with shadow rays (next-event estimation), using
+    ///       the same unattenuated diffuse lighting as \ref RayTracingAlgorithm.
+    ///     - The path continues with either a mirror reflection (with probability equal to the
+    ///       material's reflectivity) or a cosine-weighted diffuse bounce.
+    /// Ambient and specular material colors are ignored since indirect lighting replaces ambient light.
+    /// Long paths are terminated early with Russian roulette.
+    ///
+    /// Random numbers for each sample are keyed by pixel and sample index, so images are identical
+    /// regardless of how many threads render them.
+    ///
+    /// Passes may also be spread across multiple calls with a deadline via \ref RenderUntil, in which case
+    /// tiles within each pass are rendered in order of \ref TileRenderingPriority.
+    ///
+    /// The surface first hit by each sample is also recorded in the accumulation buffer
+    /// so that the image can be denoised with a \ref Denoiser.
+    class PathTracingAlgorithm
+    {
+    public:
+        // STATIC CONSTANTS.
+        /// How far new rays are started from surfaces (along the surface normal)
+        /// to avoid immediately re-intersecting the surface they leave.
+        static constexpr float SURFACE_OFFSET_DISTANCE = 0.0001f;
+        /// The maximum probability of a path surviving Russian roulette, ensuring that
+        /// even paths through perfectly white surfaces eventually terminate.
+        static constexpr float MAX_RUSSIAN_ROULETTE_SURVIVAL_PROBABILITY = 0.95f;
+
+        // RENDERING.
+        void StartRender(const GRAPHICS::RenderTarget& render_target);
+        bool RenderPass(
+            const Scene& scene,
+            const unsigned int thread_count = std::thread::hardware_concurrency());
+        bool RenderUntil(const Scene& scene, const std::chrono::steady_clock::time_point deadline);
+        bool IsComplete() const;
+        unsigned int CompletedPassCount() const;
+        MATH::Vector3f TracePath(
+            const Scene& scene,
+            const Ray& camera_ray,
+            MATH::CounterBasedRandomNumberGenerator& random_number_generator,
+            SurfaceFeatures& first_hit_features) const;
+
+        // SAMPLING.
+        static MATH::Vector3f CosineWeightedHemisphereDirection(
+            const MATH::Vector3f& unit_surface_normal,
+            MATH::CounterBasedRandomNumberGenerator& random_number_generator);
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The camera used for rendering.  Changing it requires restarting rendering.
+        GRAPHICS::Camera Camera = GRAPHICS::Camera();
+        /// The maximum number of bounces for any path, regardless of Russian roulette.
+        unsigned int MaxBounceCount = 16;
+        /// The number of bounces after which paths may be randomly terminated with Russian roulette.
+        /// Paths carrying less light are more likely to be terminated.
+        unsigned int RussianRouletteStartBounceCount = 3;
+        /// The minimum number of samples per pixel before a tile may be considered converged.
+        /// Variance estimates from just a few samples are too unreliable to stop on.
+        unsigned int MinSampleCountPerPixel = 16;
+        /// The maximum number of samples per pixel, after which a tile is always considered converged.
+        unsigned int MaxSampleCountPerPixel = 1024;
+        /// The average variance of pixel luminance estimates (see \ref AccumulationBuffer::VarianceOfMean)
+        /// below which a tile is considered converged.  Zero to only stop at \ref MaxSampleCountPerPixel.
+        float VarianceThreshold = 0.0f;
+        /// The order in which tiles are rendered within each pass by \ref RenderUntil.
+        /// Tile changes aren't tracked, so \ref TilePriority::MOST_CHANGED falls back to the screen center.
+        TilePriority TileRenderingPriority = TilePriority::HIGHEST_ERROR;
+        /// The accumulated samples for the current render.
+        AccumulationBuffer Accumulation = AccumulationBuffer();
+
+    private:
+        // PRIVATE HELPER METHODS.
+        void RenderTile(const Scene& scene, const ScreenTile& tile);
+        bool TileConverged(const ScreenTile& tile) const;
+        void RemoveConvergedTiles();
+        void StartTimedPass();
+        MATH::Vector3f ComputeDirectLighting(
+            const Scene& scene,
+            const MATH::Vector3f& surface_point,
+            const MATH::Vector3f& unit_surface_normal) const;
+        std::optional<RayObjectIntersection> ComputeClosestIntersection(const Scene& scene, const Ray& ray) const;
+        bool Occluded(const Scene& scene, const Ray& ray, const float max_distance) const;
+        static MATH::Vector3f MultiplyComponents(const MATH::Vector3f& radiance, const GRAPHICS::Color& color);
+
+        // MEMBER VARIABLES.
+        /// The generator of camera rays for the current render.  Null if no render has been started.
+        std::optional<RayGenerator> CameraRayGenerator = std::nullopt;
+        /// The tiles that still need more samples.
+        std::vector<ScreenTile> UnconvergedTiles = {};
+        /// The tiles still waiting for a sample in the current pass of \ref RenderUntil.
+        /// Sorted with the highest priority tile last so that it can be cheaply removed.
+        std::vector<ScreenTile> PendingTiles = {};
+        /// The number of passes rendered since rendering was started.
+        unsigned int PassCount = 0;
+    };
+}
+}
@@ -0,0 +1,99 @@
+#include <limits>
+#include "Graphics/RayTracing/Plane.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// Gets the surface normal of the plane, which is the same at every point.
+    /// @param[in]  surface_point - The point on the plane's surface at which to compute a normal.
+    /// @return The unit surface normal of the plane.
+    MATH::Vector3f Plane::SurfaceNormal(const MATH::Vector3f& surface_point) const
+    {
+        surface_point;
+        return UnitNormal;
+    }
+
+    /// Gets the material defining surface properties of the object.
+    /// @return The material for the object.
+    const Material* Plane::GetMaterial() const
+    {
+        return Material.get();
+    }
+
+    /// Checks for an intersection between a ray and the plane.
+    /// @param[in]  ray - The ray to check for intersection.
+    /// @return A ray-object intersection, if one occurred; std::nullopt otherwise.
+    std::optional<RayObjectIntersection> Plane::Intersect(const Ray& ray) const
+    {
+        // SOLVE FOR THE DISTANCE ALONG THE RAY TO THE PLANE.
+        // Any point on the plane satisfies UnitNormal * (Point - PointOnPlane) = 0 (where * is the dot product).
+        // Plugging in Point = Ray.Origin + Distance*Ray.Direction gives:
+        //      Distance = UnitNormal * (PointOnPlane - Ray.Origin) / (UnitNormal * Ray.Direction)
+        float ray_direction_along_normal = MATH::Vector3f::DotProduct(UnitNormal, ray.Direction);
+        float ray_origin_to_plane_along_normal = MATH::Vector3f::DotProduct(UnitNormal, PointOnPlane - ray.Origin);
+        float distance_from_ray_to_plane = ray_origin_to_plane_along_normal / ray_direction_along_normal;
+
+        // CHECK IF THE PLANE IS IN FRONT OF THE RAY.
+        // Rays parallel to the plane result in infinite or NaN distances, which fail this check.
+        bool plane_in_front_of_ray = (
+            (distance_from_ray_to_plane >= 0.0f) &&
+            (distance_from_ray_to_plane < std::numeric_limits<float>::infinity()));
+        if (!plane_in_front_of_ray)
+        {
+            return std::nullopt;
+        }
+
+        RayObjectIntersection intersection;
+        intersection.Ray = &ray;
+        intersection.DistanceFromRayToObject = distance_from_ray_to_plane;
+        intersection.Object = this;
+        return intersection;
+    }
+
+    /// Gets the bounds of the plane, which are infinite.
+    /// @return A box covering all of space.
+    AxisAlignedBoundingBox Plane::Bounds() const
+    {
+        constexpr float INFINITY_VALUE = std::numeric_limits<float>::infinity();
+        AxisAlignedBoundingBox bounds(
+            MATH::Vector3f(-INFINITY_VALUE, -INFINITY_VALUE, -INFINITY_VALUE),
+            MATH::Vector3f(INFINITY_VALUE, INFINITY_VALUE, INFINITY_VALUE));
+        return bounds;
+    }
+
+    /// Gets the kind of object, for reporting statistics.
+    /// @return \ref ObjectType::PLANE.
+    ObjectType Plane::Type() const
+    {
+        return ObjectType::PLANE;
+    }
+
+    /// Checks for intersections between all rays in a packet and the plane, using the same math as \ref Intersect.
+    /// @param[in]  ray_packet - The rays to check for intersection.
+    /// @param[out]  distances - The distance along each ray to the plane; infinity for rays that miss.
+    /// @return True since packet intersections are supported.
+    bool Plane::IntersectPacket(const RayPacket& ray_packet, std::array<float, RayPacket::MAX_RAY_COUNT>& distances) const
+    {
+        constexpr float NO_INTERSECTION = std::numeric_limits<float>::infinity();
+        float plane_offset_along_normal = MATH::Vector3f::DotProduct(UnitNormal, PointOnPlane);
+        for (std::size_t ray_index = 0; ray_index < RayPacket::MAX_RAY_COUNT; ++ray_index)
+        {
+            float ray_direction_along_normal =
+                (UnitNormal.X * ray_packet.DirectionX[ray_index]) +
+                (UnitNormal.Y * ray_packet.DirectionY[ray_index]) +
+                (UnitNormal.Z * ray_packet.DirectionZ[ray_index]);
+            float ray_origin_along_normal =
+                (UnitNormal.X * ray_packet.OriginX[ray_index]) +
+                (UnitNormal.Y * ray_packet.OriginY[ray_index]) +
+                (UnitNormal.Z * ray_packet.OriginZ[ray_index]);
+            float distance_from_ray_to_plane = (plane_offset_along_normal - ray_origin_along_normal) / ray_direction_along_normal;
+
+            bool plane_in_front_of_ray = (distance_from_ray_to_plane >= 0.0f) && (distance_from_ray_to_plane < NO_INTERSECTION);
+            distances[ray_index] = plane_in_front_of_ray ? distance_from_ray_to_plane : NO_INTERSECTION;
+        }
+
+        return true;
+    }
+}
+}
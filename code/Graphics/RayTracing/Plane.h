@@ -0,0 +1,37 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include "Graphics/Material.h"
+#include "Graphics/RayTracing/IObject3D.h"
+#include "Graphics/RayTracing/RayPacket.h"
+#include "Math/Vector3.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// An infinite plane that can be ray traced, like a ground plane.
+    /// Much cheaper to intersect than a pair of large triangles, and since its bounds are infinite,
+    /// acceleration structures keep it separate rather than letting it enlarge all of their bounds.
+    class Plane : public IObject3D
+    {
+    public:
+        // PUBLIC METHODS.
+        MATH::Vector3f SurfaceNormal(const MATH::Vector3f& surface_point) const override;
+        const Material* GetMaterial() const override;
+        std::optional<RayObjectIntersection> Intersect(const Ray& ray) const override;
+        AxisAlignedBoundingBox Bounds() const override;
+        ObjectType Type() const override;
+        bool IntersectPacket(const RayPacket& ray_packet, std::array<float, RayPacket::MAX_RAY_COUNT>& distances) const override;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// Any point on the plane in world coordinates.
+        MATH::Vector3f PointOnPlane = MATH::Vector3f();
+        /// The unit normal of the plane, which is the same everywhere on the plane.
+        MATH::Vector3f UnitNormal = MATH::Vector3f(0.0f, 1.0f, 0.0f);
+        /// The material defining surface properties of the plane.
+        std::shared_ptr<Material> Material = nullptr;
+    };
+}
+}
@@ -0,0 +1,158 @@
+#include <algorithm>
+#include <cmath>
+#include "Graphics/RayTracing/RayGenerator.h"
+#include "Math/Angle.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// Constructor.  Precomputes everything needed to generate viewing rays.
+    /// @param[in]  camera - The camera to generate viewing rays for.
+    /// @param[in]  render_target - The render target whose pixels rays are generated through.
+    RayGenerator::RayGenerator(const GRAPHICS::Camera& camera, const GRAPHICS::RenderTarget& render_target) :
+        WidthInPixels(render_target.GetWidthInPixels()),
+        HeightInPixels(render_target.GetHeightInPixels())
+    {
+        // COMPUTE THE SIZE OF A PIXEL ON THE VIEWING PLANE.
+        // This mirrors the conversion from screen positions in \ref GRAPHICS::Camera::ViewingRay,
+        // with the y coordinate flipped since pixel coordinates increase going down.
+        float width_in_pixels = static_cast<float>(WidthInPixels);
+        float height_in_pixels = static_cast<float>(HeightInPixels);
+        float pixel_width_on_viewing_plane = camera.ViewingPlane.Width / width_in_pixels;
+        float pixel_height_on_viewing_plane = -camera.ViewingPlane.Height / height_in_pixels;
+
+        // COMPUTE THE POSITION OF THE TOP-LEFT PIXEL CENTER RELATIVE TO THE CENTER OF THE VIEWING PLANE.
+        float top_left_pixel_center_x = (OFFSET_TO_CENTER_OF_PIXEL - (width_in_pixels / 2.0f)) * pixel_width_on_viewing_plane;
+        float top_left_pixel_center_y = (OFFSET_TO_CENTER_OF_PIXEL - (height_in_pixels / 2.0f)) * pixel_height_on_viewing_plane;
+
+        // COMPUTE THE STEPS ACCORDING TO THE TYPE OF PROJECTION.
+        MATH::Vector3f camera_view_direction = MATH::Vector3f::Scale(-1.0f, camera.CoordinateFrame.Forward);
+        bool using_perspective_projection = (ProjectionType::PERSPECTIVE == camera.Projection);
+        if (using_perspective_projection)
+        {
+            // ALL RAYS START AT THE CAMERA AND FAN OUT BASED ON THE FIELD OF VIEW.
+            MATH::Angle<float>::Radians camera_field_of_view_in_radians = MATH::Angle<float>::DegreesToRadians(camera.FieldOfView);
+            float half_field_of_view_in_radians = camera_field_of_view_in_radians.Value / 2.0f;
+            float ratio_between_camera_view_dimensions_and_distance_from_viewing_plane = std::tan(half_field_of_view_in_radians);
+
+            TopLeftPixelOrigin = camera.WorldPosition;
+
+            DirectionStepX = MATH::Vector3f::Scale(
+                pixel_width_on_viewing_plane * ratio_between_camera_view_dimensions_and_distance_from_viewing_plane,
+                camera.CoordinateFrame.Right);
+            DirectionStepY = MATH::Vector3f::Scale(
+                pixel_height_on_viewing_plane * ratio_between_camera_view_dimensions_and_distance_from_viewing_plane,
+                camera.CoordinateFrame.Up);
+            TopLeftPixelDirection = MATH::Vector3f::Scale(camera.ViewingPlane.FocalLength, camera_view_direction);
+            TopLeftPixelDirection += MATH::Vector3f::Scale(
+                top_left_pixel_center_x * ratio_between_camera_view_dimensions_and_distance_from_viewing_plane,
+                camera.CoordinateFrame.Right);
+            TopLeftPixelDirection += MATH::Vector3f::Scale(
+                top_left_pixel_center_y * ratio_between_camera_view_dimensions_and_distance_from_viewing_plane,
+                camera.CoordinateFrame.Up);
+        }
+        else
+        {
+            // ALL RAYS SHARE A DIRECTION AND START FROM THEIR PIXEL ON THE VIEWING PLANE.
+            TopLeftPixelDirection = camera_view_direction;
+
+            OriginStepX = MATH::Vector3f::Scale(pixel_width_on_viewing_plane, camera.CoordinateFrame.Right);
+            OriginStepY = MATH::Vector3f::Scale(pixel_height_on_viewing_plane, camera.CoordinateFrame.Up);
+            TopLeftPixelOrigin = camera.WorldPosition;
+            TopLeftPixelOrigin += MATH::Vector3f::Scale(camera.ViewingPlane.FocalLength, camera_view_direction);
+            TopLeftPixelOrigin += MATH::Vector3f::Scale(top_left_pixel_center_x, camera.CoordinateFrame.Right);
+            TopLeftPixelOrigin += MATH::Vector3f::Scale(top_left_pixel_center_y, camera.CoordinateFrame.Up);
+        }
+    }
+
+    /// Generates the viewing ray through the center of a pixel.
+    /// @param[in]  pixel_coordinates - The coordinates of the pixel.
+    /// @return The viewing ray through the center of the pixel.
+    Ray RayGenerator::ViewingRay(const MATH::Vector2ui& pixel_coordinates) const
+    {
+        float x = static_cast<float>(pixel_coordinates.X);
+        float y = static_cast<float>(pixel_coordinates.Y);
+
+        MATH::Vector3f origin = TopLeftPixelOrigin;
+        origin += MATH::Vector3f::Scale(x, OriginStepX);
+        origin += MATH::Vector3f::Scale(y, OriginStepY);
+
+        MATH::Vector3f direction = TopLeftPixelDirection;
+        direction += MATH::Vector3f::Scale(x, DirectionStepX);
+        direction += MATH::Vector3f::Scale(y, DirectionStepY);
+
+        Ray ray(origin, MATH::Vector3f::Normalize(direction));
+        return ray;
+    }
+
+    /// Generates the viewing ray through an arbitrary position on the screen.
+    /// @param[in]  screen_position - The continuous position on the render target.  Pixel (x, y) covers
+    ///     positions from (x, y) up to (x + 1, y + 1), so its center is at (x + 0.5, y + 0.5).
+    /// @return The viewing ray through the specified position.
+    Ray RayGenerator::ViewingRay(const MATH::Vector2f& screen_position) const
+    {
+        float x_pixels_from_top_left_center = screen_position.X - OFFSET_TO_CENTER_OF_PIXEL;
+        float y_pixels_from_top_left_center = screen_position.Y - OFFSET_TO_CENTER_OF_PIXEL;
+
+        MATH::Vector3f origin = TopLeftPixelOrigin;
+        origin += MATH::Vector3f::Scale(x_pixels_from_top_left_center, OriginStepX);
+        origin += MATH::Vector3f::Scale(y_pixels_from_top_left_center, OriginStepY);
+
+        MATH::Vector3f direction = TopLeftPixelDirection;
+        direction += MATH::Vector3f::Scale(x_pixels_from_top_left_center, DirectionStepX);
+        direction += MATH::Vector3f::Scale(y_pixels_from_top_left_center, DirectionStepY);
+
+        Ray ray(origin, MATH::Vector3f::Normalize(direction));
+        return ray;
+    }
+
+    /// Generates viewing rays for a run of consecutive pixels within a row, replacing any rays in the packet.
+    /// Components are computed with fixed-length loops over the packet's arrays so that compilers can vectorize them.
+    /// @param[in]  start_x - The X coordinate of the first pixel.
+    /// @param[in]  y - The Y coordinate of the row.
+    /// @param[out]  ray_packet - The packet to fill with rays for pixels starting at the specified pixel.
+    ///     Holds fewer than the maximum number of rays if the end of the row is reached.
+    void RayGenerator::RowPacket(const unsigned int start_x, const unsigned int y, RayPacket& ray_packet) const
+    {
+        // DETERMINE HOW MANY PIXELS REMAIN IN THE ROW.
+        unsigned int remaining_pixel_count = (start_x < WidthInPixels) ? (WidthInPixels - start_x) : 0;
+        ray_packet.RayCount = std::min<std::size_t>(RayPacket::MAX_RAY_COUNT, remaining_pixel_count);
+
+        // COMPUTE THE UNNORMALIZED RAY FOR THE FIRST PIXEL.
+        float x = static_cast<float>(start_x);
+        float row_y = static_cast<float>(y);
+        MATH::Vector3f first_origin = TopLeftPixelOrigin;
+        first_origin += MATH::Vector3f::Scale(x, OriginStepX);
+        first_origin += MATH::Vector3f::Scale(row_y, OriginStepY);
+        MATH::Vector3f first_direction = TopLeftPixelDirection;
+        first_direction += MATH::Vector3f::Scale(x, DirectionStepX);
+        first_direction += MATH::Vector3f::Scale(row_y, DirectionStepY);
+
+        // STEP ACROSS THE ROW FOR ALL SLOTS IN THE PACKET.
+        for (std::size_t ray_index = 0; ray_index < RayPacket::MAX_RAY_COUNT; ++ray_index)
+        {
+            float step_count = static_cast<float>(ray_index);
+            ray_packet.OriginX[ray_index] = first_origin.X + step_count * OriginStepX.X;
+            ray_packet.OriginY[ray_index] = first_origin.Y + step_count * OriginStepX.Y;
+            ray_packet.OriginZ[ray_index] = first_origin.Z + step_count * OriginStepX.Z;
+            ray_packet.DirectionX[ray_index] = first_direction.X + step_count * DirectionStepX.X;
+            ray_packet.DirectionY[ray_index] = first_direction.Y + step_count * DirectionStepX.Y;
+            ray_packet.DirectionZ[ray_index] = first_direction.Z + step_count * DirectionStepX.Z;
+        }
+
+        // NORMALIZE ALL DIRECTIONS.
+        for (std::size_t ray_index = 0; ray_index < RayPacket::MAX_RAY_COUNT; ++ray_index)
+        {
+            float direction_length = std::sqrt(
+                (ray_packet.DirectionX[ray_index] * ray_packet.DirectionX[ray_index]) +
+                (ray_packet.DirectionY[ray_index] * ray_packet.DirectionY[ray_index]) +
+                (ray_packet.DirectionZ[ray_index] * ray_packet.DirectionZ[ray_index]));
+            float inverse_direction_length = 1.0f / direction_length;
+            ray_packet.DirectionX[ray_index] *= inverse_direction_length;
+            ray_packet.DirectionY[ray_index] *= inverse_direction_length;
+            ray_packet.DirectionZ[ray_index] *= inverse_direction_length;
+        }
+    }
+}
+}
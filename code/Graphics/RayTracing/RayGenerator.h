@@ -0,0 +1,102 @@
+#pragma once
+
+#include "Graphics/Camera.h"
+#include "Graphics/RayTracing/Ray.h"
+#include "Graphics/RayTracing/RayPacket.h"
+#include "Graphics/RayTracing/ScreenTile.h"
+#include "Graphics/RenderTarget.h"
+#include "Math/Vector2.h"
+#include "Math/Vector3.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// Generates viewing rays for a camera and render target much more cheaply than
+    /// \ref GRAPHICS::Camera::ViewingRay.  Everything that is the same for all pixels (the field of view
+    /// tangent, render target dimensions, and scaled camera axes) is computed once on construction,
+    /// leaving only a few multiply-adds and a normalization for each ray.
+    ///
+    /// Both the origin and (unnormalized) direction of viewing rays vary linearly across the screen
+    /// (perspective rays only vary in direction and orthographic rays only vary in origin), so rays
+    /// for neighboring pixels can be generated incrementally by adding per-pixel steps.
+    ///
+    /// A generator should be recreated whenever the camera or render target dimensions change.
+    class RayGenerator
+    {
+    public:
+        // STATIC CONSTANTS.
+        /// The offset from the top-left corner of a pixel to its center.
+        static constexpr float OFFSET_TO_CENTER_OF_PIXEL = 0.5f;
+
+        // CONSTRUCTION.
+        explicit RayGenerator(const GRAPHICS::Camera& camera, const GRAPHICS::RenderTarget& render_target);
+
+        // RAY GENERATION.
+        Ray ViewingRay(const MATH::Vector2ui& pixel_coordinates) const;
+        Ray ViewingRay(const MATH::Vector2f& screen_position) const;
+        void RowPacket(const unsigned int start_x, const unsigned int y, RayPacket& ray_packet) const;
+        template <typename RayVisitor>
+        void VisitTileRays(const ScreenTile& tile, RayVisitor visitor) const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The width of the render target rays are generated for.
+        unsigned int WidthInPixels = 0;
+        /// The height of the render target rays are generated for.
+        unsigned int HeightInPixels = 0;
+        /// The origin of the ray through the center of the top-left pixel.
+        MATH::Vector3f TopLeftPixelOrigin = MATH::Vector3f();
+        /// The unnormalized direction of the ray through the center of the top-left pixel.
+        MATH::Vector3f TopLeftPixelDirection = MATH::Vector3f();
+        /// The change in ray origin for moving one pixel to the right.
+        MATH::Vector3f OriginStepX = MATH::Vector3f();
+        /// The change in ray origin for moving one pixel down.
+        MATH::Vector3f OriginStepY = MATH::Vector3f();
+        /// The change in unnormalized ray direction for moving one pixel to the right.
+        MATH::Vector3f DirectionStepX = MATH::Vector3f();
+        /// The change in unnormalized ray direction for moving one pixel down.
+        MATH::Vector3f DirectionStepY = MATH::Vector3f();
+    };
+
+    /// Visits the viewing ray through the center of each pixel in a tile, in row-major order.
+    /// Rays are generated incrementally from the start of each row, so each ray only costs
+    /// a few additions and a normalization.
+    /// @tparam RayVisitor - A callable taking the pixel coordinates and viewing ray:
+    ///     void(const MATH::Vector2ui& pixel_coordinates, const Ray& ray).
+    /// @param[in]  tile - The tile of pixels to visit rays for.
+    /// @param[in]  visitor - The visitor to call with each pixel's viewing ray.
+    template <typename RayVisitor>
+    void RayGenerator::VisitTileRays(const ScreenTile& tile, RayVisitor visitor) const
+    {
+        // COMPUTE THE RAY FOR THE TOP-LEFT PIXEL OF THE TILE.
+        MATH::Vector3f row_origin = TopLeftPixelOrigin;
+        row_origin += MATH::Vector3f::Scale(static_cast<float>(tile.LeftX), OriginStepX);
+        row_origin += MATH::Vector3f::Scale(static_cast<float>(tile.TopY), OriginStepY);
+        MATH::Vector3f row_direction = TopLeftPixelDirection;
+        row_direction += MATH::Vector3f::Scale(static_cast<float>(tile.LeftX), DirectionStepX);
+        row_direction += MATH::Vector3f::Scale(static_cast<float>(tile.TopY), DirectionStepY);
+
+        // VISIT EACH ROW OF THE TILE.
+        unsigned int tile_end_x = tile.LeftX + tile.WidthInPixels;
+        unsigned int tile_end_y = tile.TopY + tile.HeightInPixels;
+        for (unsigned int y = tile.TopY; y < tile_end_y; ++y)
+        {
+            // VISIT EACH PIXEL IN THE ROW.
+            MATH::Vector3f origin = row_origin;
+            MATH::Vector3f direction = row_direction;
+            for (unsigned int x = tile.LeftX; x < tile_end_x; ++x)
+            {
+                Ray ray(origin, MATH::Vector3f::Normalize(direction));
+                visitor(MATH::Vector2ui(x, y), ray);
+
+                origin += OriginStepX;
+                direction += DirectionStepX;
+            }
+
+            // MOVE TO THE NEXT ROW.
+            row_origin += OriginStepY;
+            row_direction += DirectionStepY;
+        }
+    }
+}
+}
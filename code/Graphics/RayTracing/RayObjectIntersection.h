@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <limits>
 #include "Graphics/RayTracing/Ray.h"
 #include "Math/Vector3.h"
@@ -27,6 +28,9 @@ namespace RAY_TRACING
         float DistanceFromRayToObject = std::numeric_limits<float>::infinity();
         /// The intersected object.  Memory is managed externally (outside of this class).
         const IObject3D* Object = nullptr;
+        /// The index of the intersected primitive within the object, for objects composed
+        /// of multiple primitives (like the triangles of a mesh).  Unused for other objects.
+        std::size_t PrimitiveIndex = 0;
     };
 }
 }
@@ -0,0 +1,41 @@
+#include "Graphics/RayTracing/RayPacket.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// Adds a ray to the packet if there's room.
+    /// @param[in]  ray - The ray to add.
+    /// @return True if the ray was added; false if the packet was already full.
+    bool RayPacket::Add(const Ray& ray)
+    {
+        // MAKE SURE THERE'S ROOM FOR THE RAY.
+        bool packet_full = (RayCount >= MAX_RAY_COUNT);
+        if (packet_full)
+        {
+            return false;
+        }
+
+        // STORE THE RAY'S COMPONENTS IN THE NEXT SLOT.
+        OriginX[RayCount] = ray.Origin.X;
+        OriginY[RayCount] = ray.Origin.Y;
+        OriginZ[RayCount] = ray.Origin.Z;
+        DirectionX[RayCount] = ray.Direction.X;
+        DirectionY[RayCount] = ray.Direction.Y;
+        DirectionZ[RayCount] = ray.Direction.Z;
+        ++RayCount;
+        return true;
+    }
+
+    /// Gets a single ray from the packet.
+    /// @param[in]  ray_index - The index of the ray to get.  Must be less than the packet's maximum ray count.
+    /// @return The ray at the specified index.
+    Ray RayPacket::GetRay(const std::size_t ray_index) const
+    {
+        Ray ray(
+            MATH::Vector3f(OriginX[ray_index], OriginY[ray_index], OriginZ[ray_index]),
+            MATH::Vector3f(DirectionX[ray_index], DirectionY[ray_index], DirectionZ[ray_index]));
+        return ray;
+    }
+}
+}
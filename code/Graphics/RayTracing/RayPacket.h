@@ -0,0 +1,43 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include "Graphics/RayTracing/Ray.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// A small batch of rays stored with each component in a separate array (a "structure of arrays").
+    /// This layout lets the same operation be applied to all rays with simple loops over contiguous
+    /// floats, which compilers can turn into SIMD instructions.  Batch intersection methods always process
+    /// every slot in the packet so that loop counts are fixed; only the first \ref RayCount slots are meaningful.
+    class RayPacket
+    {
+    public:
+        // STATIC CONSTANTS.
+        /// The maximum number of rays in a packet.  Matches the width of 256-bit SIMD registers for floats.
+        static constexpr std::size_t MAX_RAY_COUNT = 8;
+
+        // RAYS.
+        bool Add(const Ray& ray);
+        Ray GetRay(const std::size_t ray_index) const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The number of rays in the packet.
+        std::size_t RayCount = 0;
+        /// The X components of each ray's origin.
+        std::array<float, MAX_RAY_COUNT> OriginX = {};
+        /// The Y components of each ray's origin.
+        std::array<float, MAX_RAY_COUNT> OriginY = {};
+        /// The Z components of each ray's origin.
+        std::array<float, MAX_RAY_COUNT> OriginZ = {};
+        /// The X components of each ray's direction.
+        std::array<float, MAX_RAY_COUNT> DirectionX = {};
+        /// The Y components of each ray's direction.
+        std::array<float, MAX_RAY_COUNT> DirectionY = {};
+        /// The Z components of each ray's direction.
+        std::array<float, MAX_RAY_COUNT> DirectionZ = {};
+    };
+}
+}
@@ -1,7 +1,13 @@
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include "Graphics/RayTracing/AxisAlignedBoundingBox.h"
+#include "Graphics/RayTracing/PathTracingAlgorithm.h"
 #include "Graphics/RayTracing/RayTracingAlgorithm.h"
 #include "Math/Angle.h"
+#include "Math/CounterBasedRandomNumberGenerator.h"
 
 namespace GRAPHICS
 {
@@ -12,33 +18,1057 @@ namespace RAY_TRACING
     /// @param[in,out]  render_target - The target to render to.
     void RayTracingAlgorithm::Render(const Scene& scene, GRAPHICS::RenderTarget& render_target)
     {
-        // RENDER EACH ROW OF PIXELS.
+        // TRACK WHICH OBJECTS ARE VISIBLE IN EACH PIXEL IF NEEDED FOR ANTIALIASING.
+        unsigned int render_target_width_in_pixels = render_target.GetWidthInPixels();
         unsigned int render_target_height_in_pixels = render_target.GetHeightInPixels();
+        CONTAINERS::Array2D<const IObject3D*> intersected_objects_by_pixel;
+        if (AdaptiveAntialiasing)
+        {
+            intersected_objects_by_pixel = CONTAINERS::Array2D<const IObject3D*>(render_target_width_in_pixels, render_target_height_in_pixels);
+        }
+
+        // DETERMINE IF PRIMARY HITS FROM THE PREVIOUS RENDER CAN BE REUSED.
+        // Primary hits only depend on the camera and geometry, so only shading needs
+        // to be redone if just lights or materials have changed.
+        bool cached_primary_hits_reusable = false;
+        if (CachePrimaryHits)
+        {
+            cached_primary_hits_reusable = PrimaryHitCache.IsValidFor(Camera, scene, render_target);
+            if (!cached_primary_hits_reusable)
+            {
+                PrimaryHitCache.Reset(Camera, scene, render_target);
+            }
+        }
+        else
+        {
+            // The cache is invalidated since the scene may change without it being tracked.
+            PrimaryHitCache.Invalidate();
+        }
+
+        // PREPARE TO COLLECT STATISTICS IF ENABLED.
+        bool collect_pixel_statistics = (CollectStatistics && CollectPixelStatistics);
+        if (CollectStatistics)
+        {
+            Statistics.Reset(collect_pixel_statistics, render_target_width_in_pixels, render_target_height_in_pixels);
+            CurrentStatisticsCounts = &Statistics.Frame;
+        }
+        std::chrono::steady_clock::time_point frame_start_time = std::chrono::steady_clock::now();
+
+        // RENDER EACH ROW OF PIXELS.
+        RayGenerator ray_generator(Camera, render_target);
         for (unsigned int y = 0; y < render_target_height_in_pixels; ++y)
         {
             // RENDER EACH COLUMN IN THE CURRENT ROW.
-            unsigned int render_target_width_in_pixels = render_target.GetWidthInPixels();
             for (unsigned int x = 0; x < render_target_width_in_pixels; ++x)
             {
-                // COMPUTE THE VIEWING RAY.
-                MATH::Vector2ui pixel_coordinates(x, y);
-                Ray ray = Camera.ViewingRay(pixel_coordinates, render_target);
-
-                // FIND THE CLOSEST OBJECT IN THE SCENE THAT THE RAY INTERSECTS.
-                std::optional<RayObjectIntersection> closest_intersection = ComputeClosestIntersection(scene, ray);
+                // COUNT WORK FOR THE CURRENT PIXEL SEPARATELY IF ENABLED.
+                std::chrono::steady_clock::time_point pixel_start_time;
+                if (collect_pixel_statistics)
+                {
+                    CurrentStatisticsCounts = &Statistics.Pixels(x, y);
+                    pixel_start_time = std::chrono::steady_clock::now();
+                }
 
                 // COLOR THE CURRENT PIXEL.
-                if (closest_intersection)
+                MATH::Vector2ui pixel_coordinates(x, y);
+                const IObject3D* intersected_object = nullptr;
+                Color color = scene.BackgroundColor;
+                if (CachePrimaryHits)
                 {
-                    // COMPUTE THE CURRENT PIXEL'S COLOR.
-                    Color color = ComputeColor(scene, *closest_intersection, ReflectionCount);
-                    render_target.WritePixel(x, y, color);
+                    GeometryBuffer::PrimaryHit& primary_hit = PrimaryHitCache.PrimaryHits(x, y);
+                    if (!cached_primary_hits_reusable)
+                    {
+                        Ray ray = ray_generator.ViewingRay(pixel_coordinates);
+                        primary_hit = TracePrimaryHit(scene, ray);
+                    }
+                    color = ShadePrimaryHit(scene, primary_hit);
+                    intersected_object = primary_hit.Object;
                 }
                 else
                 {
-                    // FILL THE PIXEL WITH THE BACKGROUND COLOR.
-                    render_target.WritePixel(x, y, scene.BackgroundColor);
+                    Ray ray = ray_generator.ViewingRay(pixel_coordinates);
+                    color = TraceViewingRay(scene, ray, intersected_object);
+                }
+                render_target.WritePixel(x, y, color);
+
+                if (AdaptiveAntialiasing)
+                {
+                    intersected_objects_by_pixel(x, y) = intersected_object;
+                }
+
+                // ADD THE PIXEL'S COUNTS TO THE FRAME'S COUNTS IF COUNTED SEPARATELY.
+                if (collect_pixel_statistics)
+                {
+                    Statistics.Pixels(x, y).Time = std::chrono::steady_clock::now() - pixel_start_time;
+                    Statistics.Frame += Statistics.Pixels(x, y);
+                }
+            }
+        }
+
+        // SMOOTH OUT ANY EDGES IF ENABLED.
+        if (CollectStatistics)
+        {
+            CurrentStatisticsCounts = &Statistics.Frame;
+        }
+        if (AdaptiveAntialiasing)
+        {
+            AntialiasEdges(scene, render_target, intersected_objects_by_pixel);
+        }
+
+        // FINISH COLLECTING STATISTICS.
+        // The frame time is measured as a whole rather than summed from pixels to include all overhead.
+        if (CollectStatistics)
+        {
+            Statistics.Frame.Time = std::chrono::steady_clock::now() - frame_start_time;
+        }
+        CurrentStatisticsCounts = nullptr;
+    }
+
+    /// Renders a scene using rasterization for primary visibility and ray tracing for everything else.
+    /// Objects composed of triangles are rasterized with the same camera to find the closest surface
+    /// in each pixel, and only shadows and reflections are ray traced from there.  Any objects that
+    /// can't be rasterized are still intersected with primary rays, so the final image matches \ref Render
+    /// (apart from tiny differences along triangle edges).
+    /// @param[in]  scene - The scene to render.
+    /// @param[in,out]  render_target - The target to render to.
+    void RayTracingAlgorithm::RenderHybrid(const Scene& scene, GRAPHICS::RenderTarget& render_target) const
+    {
+        // RASTERIZE PRIMARY VISIBILITY.
+        VisibilityBuffer visibility_buffer;
+        visibility_buffer.Rasterize(Camera, scene, render_target);
+
+        // SHADE EACH PIXEL.
+        unsigned int render_target_width_in_pixels = render_target.GetWidthInPixels();
+        unsigned int render_target_height_in_pixels = render_target.GetHeightInPixels();
+        RayGenerator ray_generator(Camera, render_target);
+        for (unsigned int y = 0; y < render_target_height_in_pixels; ++y)
+        {
+            for (unsigned int x = 0; x < render_target_width_in_pixels; ++x)
+            {
+                // START FROM THE RASTERIZED PRIMARY HIT.
+                Ray ray = ray_generator.ViewingRay(MATH::Vector2ui(x, y));
+                const VisibilityBuffer::Sample& sample = visibility_buffer.Samples(x, y);
+                RayObjectIntersection closest_intersection;
+                closest_intersection.Ray = &ray;
+                closest_intersection.DistanceFromRayToObject = sample.DistanceFromRayToObject;
+                closest_intersection.Object = sample.Object;
+                closest_intersection.PrimitiveIndex = sample.PrimitiveIndex;
+
+                // CHECK IF ANY UNRASTERIZED OBJECTS ARE CLOSER.
+                for (const IObject3D* unrasterized_object : visibility_buffer.UnrasterizedObjects)
+                {
+                    std::optional<RayObjectIntersection> intersection = unrasterized_object->Intersect(ray);
+                    if (!intersection)
+                    {
+                        continue;
+                    }
+
+                    bool intersection_closer = (intersection->DistanceFromRayToObject < closest_intersection.DistanceFromRayToObject);
+                    if (intersection_closer)
+                    {
+                        closest_intersection = *intersection;
+                    }
+                }
+
+                // COLOR THE PIXEL.
+                Color color = scene.BackgroundColor;
+                if (closest_intersection.Object)
+                {
+                    color = ComputeColor(scene, closest_intersection);
+                }
+                render_target.WritePixel(x, y, color);
+            }
+        }
+    }
+
+    /// Starts (or restarts) a progressive render, which renders an image over multiple calls to
+    /// \ref RenderStep.  Should be called whenever a new image needs to be rendered progressively
+    /// (for example, when the scene, camera, or render target changes).
+    void RayTracingAlgorithm::StartProgressiveRender()
+    {
+        ProgressiveBlockSizeInPixels = COARSEST_PROGRESSIVE_BLOCK_SIZE_IN_PIXELS;
+        NextProgressiveBlockIndex = 0;
+    }
+
+    /// Continues rendering a scene progressively, tracing up to the specified number of rays.
+    /// The first pass traces a single ray per coarse block of pixels and fills the entire block with
+    /// its color, providing a rough preview very quickly.  Each later pass halves the block size and
+    /// only traces pixels that weren't traced by earlier passes, so the final image requires exactly
+    /// one ray per pixel (the same as \ref Render).
+    /// @param[in]  scene - The scene to render.  Must be the same across all steps of a progressive render.
+    /// @param[in,out]  render_target - The target to render to.  Must be the same across all steps of a progressive render.
+    /// @param[in]  ray_budget - The maximum number of rays to trace in this step.
+    /// @return True if the progressive render has completed; false if more steps are needed.
+    bool RayTracingAlgorithm::RenderStep(const Scene& scene, GRAPHICS::RenderTarget& render_target, const unsigned int ray_budget)
+    {
+        // RENDER PASSES UNTIL THE BUDGET IS EXHAUSTED.
+        unsigned int render_target_width_in_pixels = render_target.GetWidthInPixels();
+        unsigned int render_target_height_in_pixels = render_target.GetHeightInPixels();
+        unsigned int remaining_ray_budget = ray_budget;
+        RayGenerator ray_generator(Camera, render_target);
+        while (!ProgressiveRenderComplete())
+        {
+            // DETERMINE THE LAYOUT OF BLOCKS FOR THE CURRENT PASS.
+            unsigned int block_size_in_pixels = ProgressiveBlockSizeInPixels;
+            unsigned int block_count_per_row = (render_target_width_in_pixels + block_size_in_pixels - 1) / block_size_in_pixels;
+            unsigned int block_count_per_column = (render_target_height_in_pixels + block_size_in_pixels - 1) / block_size_in_pixels;
+            unsigned int block_count = block_count_per_row * block_count_per_column;
+
+            // RENDER BLOCKS IN THE CURRENT PASS.
+            bool first_pass = (COARSEST_PROGRESSIVE_BLOCK_SIZE_IN_PIXELS == block_size_in_pixels);
+            unsigned int previous_pass_block_size_in_pixels = 2 * block_size_in_pixels;
+            for (; NextProgressiveBlockIndex < block_count; ++NextProgressiveBlockIndex)
+            {
+                // SKIP BLOCKS WHOSE TOP-LEFT PIXEL WAS ALREADY TRACED IN AN EARLIER PASS.
+                // The colors from those pixels have already been filled in and don't need re-tracing.
+                unsigned int block_x = (NextProgressiveBlockIndex % block_count_per_row) * block_size_in_pixels;
+                unsigned int block_y = (NextProgressiveBlockIndex / block_count_per_row) * block_size_in_pixels;
+                bool block_traced_in_earlier_pass = (
+                    !first_pass &&
+                    (0 == (block_x % previous_pass_block_size_in_pixels)) &&
+                    (0 == (block_y % previous_pass_block_size_in_pixels)));
+                if (block_traced_in_earlier_pass)
+                {
+                    continue;
+                }
+
+                // STOP ONCE THE BUDGET IS EXHAUSTED.
+                // The block index isn't advanced so that this block is the first one rendered in the next step.
+                if (0 == remaining_ray_budget)
+                {
+                    return false;
+                }
+
+                // TRACE THE TOP-LEFT PIXEL OF THE BLOCK.
+                MATH::Vector2ui pixel_coordinates(block_x, block_y);
+                Color color = TracePixel(scene, ray_generator, pixel_coordinates);
+                --remaining_ray_budget;
+
+                // FILL THE ENTIRE BLOCK WITH THE TRACED COLOR.
+                // Blocks along the right and bottom edges may be clipped by the render target.
+                unsigned int block_end_x = std::min(block_x + block_size_in_pixels, render_target_width_in_pixels);
+                unsigned int block_end_y = std::min(block_y + block_size_in_pixels, render_target_height_in_pixels);
+                for (unsigned int y = block_y; y < block_end_y; ++y)
+                {
+                    for (unsigned int x = block_x; x < block_end_x; ++x)
+                    {
+                        render_target.WritePixel(x, y, color);
+                    }
+                }
+            }
+
+            // MOVE TO THE NEXT FINER PASS.
+            // Halving the block size eventually reaches 0 after the 1 pixel pass, indicating completion.
+            ProgressiveBlockSizeInPixels /= 2;
+            NextProgressiveBlockIndex = 0;
+        }
+
+        return true;
+    }
+
+    /// Determines if the current progressive render has completed.
+    /// @return True if the progressive render has completed (or was never started); false otherwise.
+    bool RayTracingAlgorithm::ProgressiveRenderComplete() const
+    {
+        bool progressive_render_complete = (0 == ProgressiveBlockSizeInPixels);
+        return progressive_render_complete;
+    }
+
+    /// Starts (or restarts) a timed render, which renders an image in tiles over multiple calls to
+    /// \ref RenderUntil.  Tiles are ordered based on \ref TileRenderingPriority.
+    /// Should be called whenever a new image needs to be rendered.
+    /// @param[in]  render_target - The target that will be rendered to.
+    void RayTracingAlgorithm::StartTimedRender(const GRAPHICS::RenderTarget& render_target)
+    {
+        // PARTITION THE RENDER TARGET INTO TILES.
+        unsigned int render_target_width_in_pixels = render_target.GetWidthInPixels();
+        unsigned int render_target_height_in_pixels = render_target.GetHeightInPixels();
+        PendingTiles = ScreenTile::Partition(render_target_width_in_pixels, render_target_height_in_pixels);
+        TimedRenderTileCount = PendingTiles.size();
+
+        // FORGET PREVIOUS CHANGES IF THE TILES ARE DIFFERENT.
+        bool tiles_changed = (ChangeAmountsByTileIndex.size() != PendingTiles.size());
+        if (tiles_changed)
+        {
+            constexpr float NO_CHANGE = 0.0f;
+            ChangeAmountsByTileIndex.assign(PendingTiles.size(), NO_CHANGE);
+        }
+
+        // SORT THE TILES SO THAT THE HIGHEST PRIORITY TILE IS LAST.
+        // Distance from the screen center is always used to break ties so that tiles
+        // without other distinguishing information are still rendered from the center outward.
+        MATH::Vector2f screen_center(
+            static_cast<float>(render_target_width_in_pixels) / 2.0f,
+            static_cast<float>(render_target_height_in_pixels) / 2.0f);
+        auto squared_distance_from_screen_center = [&](const ScreenTile& tile)
+        {
+            MATH::Vector2f tile_center = tile.Center();
+            float x_distance = tile_center.X - screen_center.X;
+            float y_distance = tile_center.Y - screen_center.Y;
+            float squared_distance = (x_distance * x_distance) + (y_distance * y_distance);
+            return squared_distance;
+        };
+        std::sort(
+            PendingTiles.begin(),
+            PendingTiles.end(),
+            [&](const ScreenTile& lhs_tile, const ScreenTile& rhs_tile)
+            {
+                // LOWER PRIORITY TILES ARE SORTED EARLIER.
+                if (TilePriority::MOST_CHANGED == TileRenderingPriority)
+                {
+                    float lhs_change_amount = ChangeAmountsByTileIndex[lhs_tile.Index];
+                    float rhs_change_amount = ChangeAmountsByTileIndex[rhs_tile.Index];
+                    if (lhs_change_amount != rhs_change_amount)
+                    {
+                        return lhs_change_amount < rhs_change_amount;
+                    }
                 }
+
+                return squared_distance_from_screen_center(lhs_tile) > squared_distance_from_screen_center(rhs_tile);
+            });
+    }
+
+    /// Continues a timed render, rendering as many tiles as possible before the specified deadline.
+    /// At least one tile is always rendered (if any remain) to guarantee progress, so the deadline
+    /// may be exceeded by up to the time to render a single tile.  Any unfinished tiles are carried
+    /// over to the next call.
+    /// @param[in]  scene - The scene to render.  Should be the same across all calls for a timed render.
+    /// @param[in,out]  render_target - The target to render to.  Must be the same across all calls for a timed render.
+    /// @param[in]  deadline - The time by which rendering should stop.
+    /// @return The percentage [0, 100] of the timed render that has been completed.
+    float RayTracingAlgorithm::RenderUntil(
+        const Scene& scene,
+        GRAPHICS::RenderTarget& render_target,
+        const std::chrono::steady_clock::time_point deadline)
+    {
+        // RENDER TILES UNTIL THE DEADLINE.
+        while (!PendingTiles.empty())
+        {
+            // RENDER THE HIGHEST PRIORITY TILE.
+            ScreenTile tile = PendingTiles.back();
+            PendingTiles.pop_back();
+            ChangeAmountsByTileIndex[tile.Index] = RenderTile(scene, render_target, tile);
+
+            // STOP ONCE THE DEADLINE HAS PASSED.
+            bool deadline_passed = (std::chrono::steady_clock::now() >= deadline);
+            if (deadline_passed)
+            {
+                break;
+            }
+        }
+
+        float completion_percentage = TimedRenderCompletionPercentage();
+        return completion_percentage;
+    }
+
+    /// Gets how much of the current timed render has been completed.
+    /// @return The percentage [0, 100] of the timed render that has been completed.
+    ///     100 if no timed render has been started.
+    float RayTracingAlgorithm::TimedRenderCompletionPercentage() const
+    {
+        constexpr float FULLY_COMPLETE_PERCENTAGE = 100.0f;
+        if (0 == TimedRenderTileCount)
+        {
+            return FULLY_COMPLETE_PERCENTAGE;
+        }
+
+        std::size_t completed_tile_count = TimedRenderTileCount - PendingTiles.size();
+        float completed_proportion = static_cast<float>(completed_tile_count) / static_cast<float>(TimedRenderTileCount);
+        float completion_percentage = FULLY_COMPLETE_PERCENTAGE * completed_proportion;
+        return completion_percentage;
+    }
+
+    /// Gets the primary hits cached by the last render, such as for guiding denoising of the rendered image.
+    /// @return The cached primary hits.  Only filled in if \ref CachePrimaryHits was enabled for the last \ref Render.
+    const GeometryBuffer& RayTracingAlgorithm::CachedPrimaryHits() const
+    {
+        return PrimaryHitCache;
+    }
+
+    /// Renders a single tile of pixels.
+    /// Only pixels within the tile are written, so different tiles may be rendered concurrently.
+    /// @param[in]  scene - The scene to render.
+    /// @param[in,out]  render_target - The target to render to.
+    /// @param[in]  tile - The tile of pixels to render.
+    /// @return The average amount each pixel's color changed from what was previously in the render target,
+    ///     as the sum of the absolute red, green, and blue differences.
+    float RayTracingAlgorithm::RenderTile(const Scene& scene, GRAPHICS::RenderTarget& render_target, const ScreenTile& tile) const
+    {
+        // DEFINE HOW TO WRITE EACH PIXEL WHILE TRACKING HOW MUCH IT CHANGED.
+        float total_change_amount = 0.0f;
+        auto write_pixel = [&](const unsigned int x, const unsigned int y, const Color& color)
+        {
+            Color previous_color = render_target.GetPixel(x, y);
+            total_change_amount += std::abs(color.Red - previous_color.Red);
+            total_change_amount += std::abs(color.Green - previous_color.Green);
+            total_change_amount += std::abs(color.Blue - previous_color.Blue);
+
+            render_target.WritePixel(x, y, color);
+        };
+
+        // FIND THE OBJECTS THE TILE'S VIEWING RAYS MAY HIT IF ENABLED.
+        // Packets of rays can't traverse the scene's acceleration structure, so they always need these objects.
+        RayGenerator ray_generator(Camera, render_target);
+        std::vector<const IObject3D*> tile_objects;
+        const std::vector<const IObject3D*>* primary_ray_candidate_objects = nullptr;
+        bool trace_ray_packets = (PacketPrimaryRays && !WavefrontReflections);
+        if (TileFrustumCulling || trace_ray_packets)
+        {
+            Frustum tile_frustum = Frustum::ForTile(ray_generator, tile);
+            scene.VisitObjectsInFrustum(tile_frustum, [&](const IObject3D& object)
+            {
+                tile_objects.push_back(&object);
+            });
+            primary_ray_candidate_objects = &tile_objects;
+        }
+
+        // RENDER EACH PIXEL IN THE TILE.
+        // Viewing rays are generated incrementally across the tile rather than separately for each pixel.
+        if (WavefrontReflections)
+        {
+            std::vector<Color> pixel_colors = TraceTileWavefront(scene, ray_generator, tile, primary_ray_candidate_objects);
+            for (unsigned int y = 0; y < tile.HeightInPixels; ++y)
+            {
+                for (unsigned int x = 0; x < tile.WidthInPixels; ++x)
+                {
+                    std::size_t pixel_index = static_cast<std::size_t>(y) * tile.WidthInPixels + x;
+                    write_pixel(tile.LeftX + x, tile.TopY + y, pixel_colors[pixel_index]);
+                }
+            }
+        }
+        else if (trace_ray_packets)
+        {
+            // Packets are filled from consecutive pixels in each row, with fewer rays at the end of the tile's row.
+            unsigned int tile_end_x = tile.LeftX + tile.WidthInPixels;
+            unsigned int tile_end_y = tile.TopY + tile.HeightInPixels;
+            for (unsigned int y = tile.TopY; y < tile_end_y; ++y)
+            {
+                for (unsigned int start_x = tile.LeftX; start_x < tile_end_x; start_x += RayPacket::MAX_RAY_COUNT)
+                {
+                    RayPacket ray_packet;
+                    ray_generator.RowPacket(start_x, y, ray_packet);
+                    ray_packet.RayCount = std::min<std::size_t>(ray_packet.RayCount, tile_end_x - start_x);
+
+                    std::vector<Color> colors = TraceViewingRayPacket(scene, ray_packet, tile_objects);
+                    for (std::size_t ray_index = 0; ray_index < ray_packet.RayCount; ++ray_index)
+                    {
+                        write_pixel(start_x + static_cast<unsigned int>(ray_index), y, colors[ray_index]);
+                    }
+                }
+            }
+        }
+        else
+        {
+            ray_generator.VisitTileRays(tile, [&](const MATH::Vector2ui& pixel_coordinates, const Ray& ray)
+            {
+                const IObject3D* intersected_object = nullptr;
+                Color color = TraceViewingRay(scene, ray, intersected_object, primary_ray_candidate_objects);
+                write_pixel(pixel_coordinates.X, pixel_coordinates.Y, color);
+            });
+        }
+
+        // AVERAGE THE CHANGE ACROSS ALL PIXELS.
+        // Averaging keeps smaller tiles along screen edges comparable to other tiles.
+        float pixel_count = static_cast<float>(tile.PixelCount());
+        float average_change_amount = total_change_amount / pixel_count;
+        return average_change_amount;
+    }
+
+    /// Determines if anything in the scene blocks the specified ray within a range of distances.
+    /// Unlike finding the closest intersection, this can stop as soon as any blocking object
+    /// is found, which makes it cheaper for things like shadow rays that only need a yes/no answer.
+    /// @param[in]  scene - The scene in which to search for blocking objects.
+    /// @param[in]  ray - The ray to check for being blocked.
+    /// @param[in]  min_distance - The minimum distance (exclusive, in units of the ray) along the ray
+    ///     at which an object may block it.
+    /// @param[in]  max_distance - The maximum distance (exclusive, in units of the ray) along the ray
+    ///     at which an object may block it.
+    /// @param[in]  ignored_object - An optional object to be ignored.  If provided,
+    ///     this object will never be considered to block the ray.
+    /// @return True if an object that casts shadows blocks the ray within the range; false otherwise.
+    bool RayTracingAlgorithm::Occluded(
+        const Scene& scene,
+        const Ray& ray,
+        const float min_distance,
+        const float max_distance,
+        const IObject3D* const ignored_object) const
+    {
+        // CHECK IF ANY OBJECT IN THE SCENE BLOCKS THE RAY.
+        auto object_occludes_ray = [&](const IObject3D& current_object)
+        {
+            // SKIP OVER THE CURRENT OBJECT IF IT SHOULD BE IGNORED.
+            bool ignore_current_object = (ignored_object == &current_object);
+            if (ignore_current_object)
+            {
+                return false;
+            }
+
+            if (CurrentStatisticsCounts)
+            {
+                CurrentStatisticsCounts->CountIntersectionTest(current_object.Type());
+            }
+            bool object_occludes = current_object.Occludes(ray, min_distance, max_distance);
+            return object_occludes;
+        };
+
+        // STOP SEARCHING AS SOON AS AN OBJECT BLOCKS THE RAY.
+        // The scene's acceleration structure allows skipping objects the ray cannot possibly hit.
+        bool occluded = false;
+        scene.VisitObjects(ray, max_distance, [&](const IObject3D& current_object)
+        {
+            occluded = object_occludes_ray(current_object);
+            return occluded;
+        }, TraversalStepCounter());
+        return occluded;
+    }
+
+    /// Computes the diffuse light directly reaching a point on a surface from all lights in the scene, before being
+    /// reflected by the surface's material.  This follows the same shadow and diffuse settings as rendering, so it can
+    /// be used to precompute lighting for static surfaces (such as for lightmaps).  All lights are always evaluated.
+    /// @param[in]  scene - The scene containing the surface and lights.
+    /// @param[in]  surface_point - The point on the surface.  Should be offset slightly from the surface
+    ///     if the surface is in the scene but not provided as the surface object.
+    /// @param[in]  unit_surface_normal - The unit surface normal at the point.
+    /// @param[in]  surface_object - Any object in the scene that the point is on, which won't block light to the point.
+    /// @return The color of the total light reaching the point.
+    GRAPHICS::Color RayTracingAlgorithm::ComputeDirectLight(
+        const Scene& scene,
+        const MATH::Vector3f& surface_point,
+        const MATH::Vector3f& unit_surface_normal,
+        const IObject3D* const surface_object) const
+    {
+        // CHECK IF ANY LIGHT NEEDS TO BE CONSIDERED.
+        if (!Diffuse)
+        {
+            return Color::BLACK;
+        }
+
+        // ADD UP THE LIGHT FROM EACH LIGHT SOURCE.
+        // Light totals are summed manually since color addition clamps.
+        Color light_total_color = Color::BLACK;
+        for (const Light& light : scene.PointLights)
+        {
+            // SKIP THE LIGHT IF IT'S BLOCKED.
+            MATH::Vector3f direction_from_point_to_light = light.PointLightDirectionFrom(surface_point);
+            if (Shadows)
+            {
+                Ray shadow_ray(surface_point, direction_from_point_to_light);
+                constexpr float NO_DISTANCE_IN_FRONT_OF_SHADOW_RAY = 0.0f;
+                constexpr float DISTANCE_AT_LIGHT = 1.0f;
+                bool light_blocked = Occluded(scene, shadow_ray, NO_DISTANCE_IN_FRONT_OF_SHADOW_RAY, DISTANCE_AT_LIGHT, surface_object);
+                if (light_blocked)
+                {
+                    continue;
+                }
+            }
+
+            // ADD THE LIGHT BASED ON THE LAMBERTIAN SHADING MODEL.
+            MATH::Vector3f unit_direction_from_point_to_light = MATH::Vector3f::Normalize(direction_from_point_to_light);
+            constexpr float NO_ILLUMINATION = 0.0f;
+            float illumination_proportion = MATH::Vector3f::DotProduct(unit_surface_normal, unit_direction_from_point_to_light);
+            illumination_proportion = std::max(NO_ILLUMINATION, illumination_proportion);
+            light_total_color.Red += illumination_proportion * light.Color.Red;
+            light_total_color.Green += illumination_proportion * light.Color.Green;
+            light_total_color.Blue += illumination_proportion * light.Color.Blue;
+        }
+
+        light_total_color.Clamp();
+        return light_total_color;
+    }
+
+    /// Traces all rays for a tile breadth-first, as a wavefront.  Primary rays for all pixels are traced first,
+    /// and the reflected rays they spawn are sorted and traced together, followed by each later bounce.
+    /// Each pixel's color is accumulated in the same order as when following its reflections depth-first,
+    /// so the results are identical.
+    /// @param[in]  scene - The scene to render.
+    /// @param[in]  ray_generator - The generator of viewing rays for the camera and render target.
+    /// @param[in]  tile - The tile of pixels to trace.
+    /// @param[in]  primary_ray_candidate_objects - The only objects primary rays need to be tested against,
+    ///     if known.  Null to search the whole scene.
+    /// @return The colors of the pixels in the tile, in row-major order within the tile.
+    std::vector<GRAPHICS::Color> RayTracingAlgorithm::TraceTileWavefront(
+        const Scene& scene,
+        const RayGenerator& ray_generator,
+        const ScreenTile& tile,
+        const std::vector<const IObject3D*>* const primary_ray_candidate_objects) const
+    {
+        // TRACE ALL PRIMARY RAYS, QUEUEING ANY REFLECTIONS.
+        std::vector<Color> pixel_colors(tile.PixelCount(), scene.BackgroundColor);
+        std::vector<ReflectionRay> reflection_rays;
+        ray_generator.VisitTileRays(tile, [&](const MATH::Vector2ui& pixel_coordinates, const Ray& ray)
+        {
+            // FIND THE CLOSEST OBJECT THE RAY INTERSECTS.
+            if (CurrentStatisticsCounts)
+            {
+                ++CurrentStatisticsCounts->PrimaryRayCount;
+            }
+            std::optional<RayObjectIntersection> closest_intersection = ComputeClosestIntersection(
+                scene,
+                ray,
+                nullptr,
+                primary_ray_candidate_objects);
+            if (!closest_intersection)
+            {
+                return;
+            }
+
+            // SHADE THE INTERSECTED SURFACE.
+            std::size_t pixel_index = static_cast<std::size_t>(pixel_coordinates.Y - tile.TopY) * tile.WidthInPixels + (pixel_coordinates.X - tile.LeftX);
+            Color& pixel_color = pixel_colors[pixel_index];
+            pixel_color = Color::BLACK;
+            constexpr float FULL_CONTRIBUTION = 1.0f;
+            float contribution = FULL_CONTRIBUTION;
+            MATH::Vector3f intersection_point = closest_intersection->IntersectionPoint();
+            MATH::Vector3f unit_surface_normal = closest_intersection->Object->IntersectionSurfaceNormal(*closest_intersection);
+            std::optional<Ray> reflected_ray = ShadeIntersection(
+                scene,
+                *closest_intersection,
+                intersection_point,
+                unit_surface_normal,
+                ReflectionCount,
+                contribution,
+                pixel_color);
+            if (reflected_ray)
+            {
+                ReflectionRay& reflection_ray = reflection_rays.emplace_back();
+                reflection_ray.Ray = *reflected_ray;
+                reflection_ray.ReflectingObject = closest_intersection->Object;
+                reflection_ray.Contribution = contribution;
+                reflection_ray.RemainingReflectionCount = ReflectionCount - 1;
+                reflection_ray.PixelIndex = pixel_index;
+            }
+        });
+
+        // TRACE EACH BOUNCE OF REFLECTIONS TOGETHER.
+        std::vector<ReflectionRay> next_reflection_rays;
+        while (!reflection_rays.empty())
+        {
+            SortReflectionRays(reflection_rays);
+
+            for (const ReflectionRay& reflection_ray : reflection_rays)
+            {
+                // FIND THE CLOSEST OBJECT THE REFLECTED RAY INTERSECTS.
+                if (CurrentStatisticsCounts)
+                {
+                    ++CurrentStatisticsCounts->ReflectionRayCount;
+                }
+                Color& pixel_color = pixel_colors[reflection_ray.PixelIndex];
+                std::optional<RayObjectIntersection> reflected_intersection = ComputeClosestIntersection(
+                    scene,
+                    reflection_ray.Ray,
+                    reflection_ray.ReflectingObject);
+                if (!reflected_intersection)
+                {
+                    // ADD REFLECTED LIGHT CONTRIBUTED FROM THE BACKGROUND.
+                    pixel_color += Color::ScaleRedGreenBlue(reflection_ray.Contribution, scene.BackgroundColor);
+                    continue;
+                }
+
+                // SHADE THE REFLECTED SURFACE, QUEUEING ANY FURTHER REFLECTION.
+                float contribution = reflection_ray.Contribution;
+                MATH::Vector3f intersection_point = reflected_intersection->IntersectionPoint();
+                MATH::Vector3f unit_surface_normal = reflected_intersection->Object->IntersectionSurfaceNormal(*reflected_intersection);
+                std::optional<Ray> reflected_ray = ShadeIntersection(
+                    scene,
+                    *reflected_intersection,
+                    intersection_point,
+                    unit_surface_normal,
+                    reflection_ray.RemainingReflectionCount,
+                    contribution,
+                    pixel_color);
+                if (reflected_ray)
+                {
+                    ReflectionRay& next_reflection_ray = next_reflection_rays.emplace_back();
+                    next_reflection_ray.Ray = *reflected_ray;
+                    next_reflection_ray.ReflectingObject = reflected_intersection->Object;
+                    next_reflection_ray.Contribution = contribution;
+                    next_reflection_ray.RemainingReflectionCount = reflection_ray.RemainingReflectionCount - 1;
+                    next_reflection_ray.PixelIndex = reflection_ray.PixelIndex;
+                }
+            }
+
+            // MOVE ON TO THE NEXT BOUNCE.
+            reflection_rays.swap(next_reflection_rays);
+            next_reflection_rays.clear();
+        }
+
+        // CLAMP THE FINAL PIXEL COLORS ONCE ALL PATHS HAVE BEEN ADDED.
+        for (Color& pixel_color : pixel_colors)
+        {
+            pixel_color.Clamp();
+        }
+        return pixel_colors;
+    }
+
+    /// Sorts reflected rays so that rays starting near each other and heading in similar directions are adjacent.
+    /// Rays are grouped first by the octant of their direction (the signs of its components), which determines
+    /// the order acceleration structures are traversed in, and then by the cell containing their origin within
+    /// a grid over all rays' origins.  Cells are ordered along a Morton (Z-order) curve so that nearby cells
+    /// are close together.
+    /// @param[in,out]  reflection_rays - The rays to sort.
+    void RayTracingAlgorithm::SortReflectionRays(std::vector<ReflectionRay>& reflection_rays)
+    {
+        // BOUND ALL RAY ORIGINS.
+        AxisAlignedBoundingBox origin_bounds;
+        for (const ReflectionRay& reflection_ray : reflection_rays)
+        {
+            origin_bounds.Expand(reflection_ray.Ray.Origin);
+        }
+        MATH::Vector3f origin_bounds_size = origin_bounds.Size();
+
+        // COMPUTE THE SORT KEY FOR EACH RAY.
+        constexpr std::uint32_t CELL_COORDINATE_BIT_COUNT = 4;
+        constexpr std::uint32_t CELL_COUNT_PER_AXIS = 1 << CELL_COORDINATE_BIT_COUNT;
+        auto cell_coordinate = [](const float position, const float minimum, const float size) -> std::uint32_t
+        {
+            // Zero-size bounds (such as all origins lying in a plane) put everything in the first cell along that axis.
+            if (size <= 0.0f)
+            {
+                return 0;
+            }
+
+            float proportion = (position - minimum) / size;
+            std::uint32_t coordinate = static_cast<std::uint32_t>(proportion * static_cast<float>(CELL_COUNT_PER_AXIS));
+            return std::min(coordinate, CELL_COUNT_PER_AXIS - 1);
+        };
+        for (ReflectionRay& reflection_ray : reflection_rays)
+        {
+            // INTERLEAVE THE BITS OF THE CELL COORDINATES.
+            std::uint32_t cell_x = cell_coordinate(reflection_ray.Ray.Origin.X, origin_bounds.MinimumCorner.X, origin_bounds_size.X);
+            std::uint32_t cell_y = cell_coordinate(reflection_ray.Ray.Origin.Y, origin_bounds.MinimumCorner.Y, origin_bounds_size.Y);
+            std::uint32_t cell_z = cell_coordinate(reflection_ray.Ray.Origin.Z, origin_bounds.MinimumCorner.Z, origin_bounds_size.Z);
+            std::uint32_t morton_code = 0;
+            for (std::uint32_t bit_index = 0; bit_index < CELL_COORDINATE_BIT_COUNT; ++bit_index)
+            {
+                morton_code |= ((cell_x >> bit_index) & 1u) << (3 * bit_index);
+                morton_code |= ((cell_y >> bit_index) & 1u) << (3 * bit_index + 1);
+                morton_code |= ((cell_z >> bit_index) & 1u) << (3 * bit_index + 2);
+            }
+
+            // PUT THE DIRECTION OCTANT IN THE HIGHEST BITS.
+            std::uint32_t octant =
+                (reflection_ray.Ray.Direction.X < 0.0f ? 1u : 0u) |
+                (reflection_ray.Ray.Direction.Y < 0.0f ? 2u : 0u) |
+                (reflection_ray.Ray.Direction.Z < 0.0f ? 4u : 0u);
+            reflection_ray.SortKey = (octant << (3 * CELL_COORDINATE_BIT_COUNT)) | morton_code;
+        }
+
+        // SORT THE RAYS.
+        // Pixel indices break ties so that rays within a cell stay in screen order.
+        std::sort(
+            reflection_rays.begin(),
+            reflection_rays.end(),
+            [](const ReflectionRay& first_ray, const ReflectionRay& second_ray)
+            {
+                if (first_ray.SortKey != second_ray.SortKey)
+                {
+                    return first_ray.SortKey < second_ray.SortKey;
+                }
+                return first_ray.PixelIndex < second_ray.PixelIndex;
+            });
+    }
+
+    /// Traces a single viewing ray through the scene to compute the color for a pixel.
+    /// @param[in]  scene - The scene to render.
+    /// @param[in]  ray_generator - The generator of viewing rays for the camera and render target.
+    /// @param[in]  pixel_coordinates - The coordinates of the pixel to trace.
+    /// @return The color for the pixel.
+    GRAPHICS::Color RayTracingAlgorithm::TracePixel(
+        const Scene& scene,
+        const RayGenerator& ray_generator,
+        const MATH::Vector2ui& pixel_coordinates) const
+    {
+        Ray ray = ray_generator.ViewingRay(pixel_coordinates);
+        const IObject3D* intersected_object = nullptr;
+        Color color = TraceViewingRay(scene, ray, intersected_object);
+        return color;
+    }
+
+    /// Traces a packet of viewing rays through the scene to compute their colors.
+    /// @param[in]  scene - The scene to render.
+    /// @param[in]  ray_packet - The viewing rays to trace.
+    /// @param[in]  candidate_objects - The only objects the rays need to be tested against.
+    /// @return The color seen along each ray in the packet, in the same order as the rays.
+    std::vector<GRAPHICS::Color> RayTracingAlgorithm::TraceViewingRayPacket(
+        const Scene& scene,
+        const RayPacket& ray_packet,
+        const std::vector<const IObject3D*>& candidate_objects) const
+    {
+        if (CurrentStatisticsCounts)
+        {
+            CurrentStatisticsCounts->PrimaryRayCount += ray_packet.RayCount;
+        }
+
+        // FIND THE CLOSEST OBJECT INTERSECTED BY EACH RAY.
+        std::array<float, RayPacket::MAX_RAY_COUNT> closest_distances;
+        closest_distances.fill(std::numeric_limits<float>::infinity());
+        std::array<const IObject3D*, RayPacket::MAX_RAY_COUNT> closest_objects = {};
+        std::array<std::size_t, RayPacket::MAX_RAY_COUNT> closest_primitive_indices = {};
+        std::array<float, RayPacket::MAX_RAY_COUNT> distances;
+        for (const IObject3D* candidate_object : candidate_objects)
+        {
+            if (CurrentStatisticsCounts)
+            {
+                for (std::size_t ray_index = 0; ray_index < ray_packet.RayCount; ++ray_index)
+                {
+                    CurrentStatisticsCounts->CountIntersectionTest(candidate_object->Type());
+                }
+            }
+
+            // CHECK FOR CLOSER INTERSECTIONS WITH ALL RAYS AT ONCE IF POSSIBLE.
+            bool packet_intersected = candidate_object->IntersectPacket(ray_packet, distances);
+            if (packet_intersected)
+            {
+                for (std::size_t ray_index = 0; ray_index < ray_packet.RayCount; ++ray_index)
+                {
+                    bool new_intersection_closer = (distances[ray_index] < closest_distances[ray_index]);
+                    if (new_intersection_closer)
+                    {
+                        closest_distances[ray_index] = distances[ray_index];
+                        closest_objects[ray_index] = candidate_object;
+                        closest_primitive_indices[ray_index] = 0;
+                    }
+                }
+                continue;
+            }
+
+            // CHECK FOR CLOSER INTERSECTIONS WITH EACH RAY SEPARATELY OTHERWISE.
+            for (std::size_t ray_index = 0; ray_index < ray_packet.RayCount; ++ray_index)
+            {
+                Ray ray = ray_packet.GetRay(ray_index);
+                std::optional<RayObjectIntersection> intersection = candidate_object->Intersect(ray);
+                bool new_intersection_closer = (intersection && (intersection->DistanceFromRayToObject < closest_distances[ray_index]));
+                if (new_intersection_closer)
+                {
+                    closest_distances[ray_index] = intersection->DistanceFromRayToObject;
+                    closest_objects[ray_index] = candidate_object;
+                    closest_primitive_indices[ray_index] = intersection->PrimitiveIndex;
+                }
+            }
+        }
+
+        // COMPUTE THE COLOR SEEN ALONG EACH RAY.
+        std::vector<Color> colors(ray_packet.RayCount, scene.BackgroundColor);
+        for (std::size_t ray_index = 0; ray_index < ray_packet.RayCount; ++ray_index)
+        {
+            if (!closest_objects[ray_index])
+            {
+                continue;
+            }
+
+            Ray ray = ray_packet.GetRay(ray_index);
+            RayObjectIntersection intersection;
+            intersection.Ray = &ray;
+            intersection.DistanceFromRayToObject = closest_distances[ray_index];
+            intersection.Object = closest_objects[ray_index];
+            intersection.PrimitiveIndex = closest_primitive_indices[ray_index];
+            colors[ray_index] = ComputeColor(scene, intersection);
+        }
+        return colors;
+    }
+
+    /// Traces a viewing ray through the scene to compute its color.
+    /// @param[in]  scene - The scene to render.
+    /// @param[in]  ray - The viewing ray to trace.
+    /// @param[out]  intersected_object - The object first intersected by the ray; null if nothing was intersected.
+    /// @param[in]  candidate_objects - The only objects the ray needs to be tested against, if known.
+    ///     Null to search the whole scene.
+    /// @return The color seen along the ray.
+    GRAPHICS::Color RayTracingAlgorithm::TraceViewingRay(
+        const Scene& scene,
+        const Ray& ray,
+        const IObject3D*& intersected_object,
+        const std::vector<const IObject3D*>* const candidate_objects) const
+    {
+        if (CurrentStatisticsCounts)
+        {
+            ++CurrentStatisticsCounts->PrimaryRayCount;
+        }
+
+        // FIND THE CLOSEST OBJECT IN THE SCENE THAT THE RAY INTERSECTS.
+        std::optional<RayObjectIntersection> closest_intersection = ComputeClosestIntersection(scene, ray, nullptr, candidate_objects);
+        if (!closest_intersection)
+        {
+            // USE THE BACKGROUND COLOR IF NOTHING WAS HIT.
+            intersected_object = nullptr;
+            return scene.BackgroundColor;
+        }
+
+        // COMPUTE THE COLOR FROM THE INTERSECTED OBJECT.
+        intersected_object = closest_intersection->Object;
+        Color color = ComputeColor(scene, *closest_intersection);
+        return color;
+    }
+
+    /// Traces a viewing ray through the scene to find its primary hit, without computing any color.
+    /// @param[in]  scene - The scene to trace through.
+    /// @param[in]  ray - The viewing ray to trace.
+    /// @return The primary hit for the ray.  Has no object if nothing was hit.
+    GeometryBuffer::PrimaryHit RayTracingAlgorithm::TracePrimaryHit(const Scene& scene, const Ray& ray) const
+    {
+        if (CurrentStatisticsCounts)
+        {
+            ++CurrentStatisticsCounts->PrimaryRayCount;
+        }
+
+        GeometryBuffer::PrimaryHit primary_hit;
+        primary_hit.ViewingRay = ray;
+
+        // FIND THE CLOSEST OBJECT IN THE SCENE THAT THE RAY INTERSECTS.
+        std::optional<RayObjectIntersection> closest_intersection = ComputeClosestIntersection(scene, ray);
+        if (!closest_intersection)
+        {
+            return primary_hit;
+        }
+
+        // STORE THE SURFACE INFORMATION NEEDED FOR SHADING.
+        primary_hit.DistanceFromRayToObject = closest_intersection->DistanceFromRayToObject;
+        primary_hit.Object = closest_intersection->Object;
+        primary_hit.PrimitiveIndex = closest_intersection->PrimitiveIndex;
+        primary_hit.WorldPosition = closest_intersection->IntersectionPoint();
+        primary_hit.UnitSurfaceNormal = closest_intersection->Object->IntersectionSurfaceNormal(*closest_intersection);
+        return primary_hit;
+    }
+
+    /// Computes the color for a primary hit, including any secondary rays (shadows and reflections).
+    /// @param[in]  scene - The scene being rendered.
+    /// @param[in]  primary_hit - The primary hit to shade.
+    /// @return The color seen along the primary hit's viewing ray.
+    GRAPHICS::Color RayTracingAlgorithm::ShadePrimaryHit(const Scene& scene, const GeometryBuffer::PrimaryHit& primary_hit) const
+    {
+        // USE THE BACKGROUND COLOR IF NOTHING WAS HIT.
+        if (!primary_hit.Object)
+        {
+            return scene.BackgroundColor;
+        }
+
+        // COMPUTE THE COLOR FROM THE HIT OBJECT.
+        RayObjectIntersection intersection = primary_hit.Intersection();
+        Color color = ComputeColor(scene, intersection, primary_hit.WorldPosition, primary_hit.UnitSurfaceNormal);
+        return color;
+    }
+
+    /// Antialiases edges in a rendered image by replacing the single sample in each edge pixel
+    /// with the average of multiple stratified samples across the pixel.  Edge pixels are those
+    /// whose color differs from a neighboring pixel by more than \ref AntialiasingContrastThreshold
+    /// or that show a different object than a neighboring pixel.
+    /// @param[in]  scene - The scene being rendered.
+    /// @param[in,out]  render_target - The render target containing 1 sample per pixel of the scene.
+    /// @param[in]  intersected_objects_by_pixel - The object visible through the center of each pixel.
+    void RayTracingAlgorithm::AntialiasEdges(
+        const Scene& scene,
+        GRAPHICS::RenderTarget& render_target,
+        const CONTAINERS::Array2D<const IObject3D*>& intersected_objects_by_pixel) const
+    {
+        // DETERMINE HOW MANY SAMPLES TO TAKE PER EDGE PIXEL.
+        // A square grid of samples is used, so the sample count is rounded down to a square number.
+        unsigned int samples_per_pixel_dimension = static_cast<unsigned int>(std::sqrt(static_cast<float>(MaxAntialiasingSamplesPerPixel)));
+        bool extra_samples_possible = (samples_per_pixel_dimension > 1);
+        if (!extra_samples_possible)
+        {
+            return;
+        }
+
+        // FIND ALL EDGE PIXELS.
+        // All edges are found before any pixels are modified so that antialiased pixels don't affect edge detection.
+        // Each pixel is only compared with its right and bottom neighbors, but both pixels are marked as edges
+        // so that edges get smoothed on both sides.
+        unsigned int render_target_width_in_pixels = render_target.GetWidthInPixels();
+        unsigned int render_target_height_in_pixels = render_target.GetHeightInPixels();
+        // A plain vector is used since Array2D can't return references to the packed bits of a std::vector<bool>.
+        std::vector<bool> edge_pixel_flags(static_cast<std::size_t>(render_target_width_in_pixels) * render_target_height_in_pixels);
+        auto pixel_index = [render_target_width_in_pixels](const unsigned int x, const unsigned int y)
+        {
+            return static_cast<std::size_t>(y) * render_target_width_in_pixels + x;
+        };
+        auto pixels_form_edge = [&](const unsigned int x_1, const unsigned int y_1, const unsigned int x_2, const unsigned int y_2)
+        {
+            // CHECK IF THE PIXELS SHOW DIFFERENT OBJECTS.
+            bool different_objects = (intersected_objects_by_pixel(x_1, y_1) != intersected_objects_by_pixel(x_2, y_2));
+            if (different_objects)
+            {
+                return true;
+            }
+
+            // CHECK IF THE PIXELS HAVE SIGNIFICANTLY DIFFERENT COLORS.
+            Color color_1 = render_target.GetPixel(x_1, y_1);
+            Color color_2 = render_target.GetPixel(x_2, y_2);
+            bool high_contrast = (
+                (std::abs(color_1.Red - color_2.Red) > AntialiasingContrastThreshold) ||
+                (std::abs(color_1.Green - color_2.Green) > AntialiasingContrastThreshold) ||
+                (std::abs(color_1.Blue - color_2.Blue) > AntialiasingContrastThreshold));
+            return high_contrast;
+        };
+        for (unsigned int y = 0; y < render_target_height_in_pixels; ++y)
+        {
+            for (unsigned int x = 0; x < render_target_width_in_pixels; ++x)
+            {
+                // COMPARE WITH THE RIGHT NEIGHBOR.
+                unsigned int right_x = x + 1;
+                bool right_neighbor_exists = (right_x < render_target_width_in_pixels);
+                if (right_neighbor_exists && pixels_form_edge(x, y, right_x, y))
+                {
+                    edge_pixel_flags[pixel_index(x, y)] = true;
+                    edge_pixel_flags[pixel_index(right_x, y)] = true;
+                }
+
+                // COMPARE WITH THE BOTTOM NEIGHBOR.
+                unsigned int bottom_y = y + 1;
+                bool bottom_neighbor_exists = (bottom_y < render_target_height_in_pixels);
+                if (bottom_neighbor_exists && pixels_form_edge(x, y, x, bottom_y))
+                {
+                    edge_pixel_flags[pixel_index(x, y)] = true;
+                    edge_pixel_flags[pixel_index(x, bottom_y)] = true;
+                }
+            }
+        }
+
+        // TAKE EXTRA SAMPLES FOR EACH EDGE PIXEL.
+        // The random number generator is seeded with a constant so that images are deterministic.
+        std::minstd_rand random_number_generator;
+        std::uniform_real_distribution<float> offset_within_stratum(0.0f, 1.0f);
+        float stratum_size = 1.0f / static_cast<float>(samples_per_pixel_dimension);
+        unsigned int sample_count = samples_per_pixel_dimension * samples_per_pixel_dimension;
+        RayGenerator ray_generator(Camera, render_target);
+        for (unsigned int y = 0; y < render_target_height_in_pixels; ++y)
+        {
+            for (unsigned int x = 0; x < render_target_width_in_pixels; ++x)
+            {
+                // SKIP PIXELS NOT ALONG EDGES.
+                if (!edge_pixel_flags[pixel_index(x, y)])
+                {
+                    continue;
+                }
+
+                // TAKE A SAMPLE AT A RANDOM POSITION WITHIN EACH STRATUM OF THE PIXEL.
+                // Colors are summed manually since color addition clamps.
+                float total_red = 0.0f;
+                float total_green = 0.0f;
+                float total_blue = 0.0f;
+                for (unsigned int stratum_y = 0; stratum_y < samples_per_pixel_dimension; ++stratum_y)
+                {
+                    for (unsigned int stratum_x = 0; stratum_x < samples_per_pixel_dimension; ++stratum_x)
+                    {
+                        MATH::Vector2f sample_position(
+                            static_cast<float>(x) + (static_cast<float>(stratum_x) + offset_within_stratum(random_number_generator)) * stratum_size,
+                            static_cast<float>(y) + (static_cast<float>(stratum_y) + offset_within_stratum(random_number_generator)) * stratum_size);
+                        Ray ray = ray_generator.ViewingRay(sample_position);
+                        const IObject3D* intersected_object = nullptr;
+                        Color sample_color = TraceViewingRay(scene, ray, intersected_object);
+                        total_red += sample_color.Red;
+                        total_green += sample_color.Green;
+                        total_blue += sample_color.Blue;
+                    }
+                }
+
+                // REPLACE THE PIXEL WITH THE AVERAGE OF THE SAMPLES.
+                float sample_count_as_float = static_cast<float>(sample_count);
+                Color average_color(
+                    total_red / sample_count_as_float,
+                    total_green / sample_count_as_float,
+                    total_blue / sample_count_as_float,
+                    Color::MAX_FLOAT_COLOR_COMPONENT);
+                render_target.WritePixel(x, y, average_color);
             }
         }
     }
@@ -46,189 +1076,491 @@ namespace RAY_TRACING
     /// Computes color based on the specified intersection in the scene.
     /// @param[in]  scene - The scene in which the color is being computed.
     /// @param[in]  intersection - The intersection for which to compute the color.
-    /// @param[in]  remaining_reflection_count - The remaining reflection depth for color computation.
-    ///     To compute more accurate light, rays need to be reflected, but we don't want this to go on forever.
-    ///     Furthermore, more rays can be computationally expensive for little more gain, which is why 
-    ///     the amount of reflection is capped.
     /// @return The computed color.
     GRAPHICS::Color RayTracingAlgorithm::ComputeColor(
         const Scene& scene, 
+        const RayObjectIntersection& intersection) const
+    {
+        MATH::Vector3f intersection_point = intersection.IntersectionPoint();
+        MATH::Vector3f unit_surface_normal = intersection.Object->IntersectionSurfaceNormal(intersection);
+        Color color = ComputeColor(scene, intersection, intersection_point, unit_surface_normal);
+        return color;
+    }
+
+    /// Computes color based on the specified intersection in the scene, for which the intersection
+    /// point and surface normal have already been computed (for example, cached from a previous render).
+    /// Reflections are followed iteratively rather than recursively.  Each reflected surface's
+    /// color is weighted by the product of the reflectivities of all surfaces before it along
+    /// the path (its throughput), so the path can stop early once further reflections would
+    /// contribute less than \ref MinReflectionContribution.
+    /// @param[in]  scene - The scene in which the color is being computed.
+    /// @param[in]  intersection - The intersection for which to compute the color.
+    /// @param[in]  first_intersection_point - The world position of the intersection.
+    /// @param[in]  first_unit_surface_normal - The unit surface normal at the intersection.
+    /// @return The computed color.
+    GRAPHICS::Color RayTracingAlgorithm::ComputeColor(
+        const Scene& scene,
+        const RayObjectIntersection& intersection,
+        const MATH::Vector3f& first_intersection_point,
+        const MATH::Vector3f& first_unit_surface_normal) const
+    {
+        // INITIALIZE THE COLOR TO HAVE NO CONTRIBUTION FROM ANY SOURCES.
+        Color final_color = Color::BLACK;
+
+        // START FOLLOWING THE PATH FROM THE PROVIDED INTERSECTION.
+        // The current ray is stored locally so that intersections along the path can safely refer to it.
+        Ray current_ray = *intersection.Ray;
+        RayObjectIntersection current_intersection = intersection;
+        current_intersection.Ray = &current_ray;
+        constexpr float FULL_CONTRIBUTION = 1.0f;
+        float current_contribution = FULL_CONTRIBUTION;
+        unsigned int remaining_reflection_count = ReflectionCount;
+        MATH::Vector3f intersection_point = first_intersection_point;
+        MATH::Vector3f unit_surface_normal = first_unit_surface_normal;
+        while (true)
+        {
+            // SHADE THE CURRENT SURFACE AND CHECK IF ITS REFLECTION SHOULD BE FOLLOWED.
+            std::optional<Ray> reflected_ray = ShadeIntersection(
+                scene,
+                current_intersection,
+                intersection_point,
+                unit_surface_normal,
+                remaining_reflection_count,
+                current_contribution,
+                final_color);
+            if (!reflected_ray)
+            {
+                break;
+            }
+
+            // CHECK FOR ANY INTERSECTIONS FROM THE REFLECTED RAY.
+            const IObject3D* reflecting_object = current_intersection.Object;
+            current_ray = *reflected_ray;
+            if (CurrentStatisticsCounts)
+            {
+                ++CurrentStatisticsCounts->ReflectionRayCount;
+            }
+            std::optional<RayObjectIntersection> reflected_intersection = ComputeClosestIntersection(scene, current_ray, reflecting_object);
+            if (!reflected_intersection)
+            {
+                // ADD REFLECTED LIGHT CONTRIBUTED FROM THE BACKGROUND.
+                Color reflected_color = Color::ScaleRedGreenBlue(current_contribution, scene.BackgroundColor);
+                final_color += reflected_color;
+                break;
+            }
+
+            // CONTINUE FOLLOWING THE PATH FROM THE REFLECTED INTERSECTION.
+            current_intersection = *reflected_intersection;
+            intersection_point = current_intersection.IntersectionPoint();
+            unit_surface_normal = current_intersection.Object->IntersectionSurfaceNormal(current_intersection);
+            --remaining_reflection_count;
+        }
+
+        // CLAMP THE FINAL COLOR ONCE THE WHOLE PATH HAS BEEN ADDED.
+        final_color.Clamp();
+        return final_color;
+    }
+
+    /// Adds the color directly from lights at a surface along a path, and computes the reflected
+    /// ray to continue the path with if the reflection would contribute enough.
+    /// @param[in]  scene - The scene in which the color is being computed.
+    /// @param[in]  intersection - The intersection with the surface.
+    /// @param[in]  intersection_point - The point of the intersection.
+    /// @param[in]  unit_surface_normal - The unit surface normal of the object at the intersection point.
+    /// @param[in]  remaining_reflection_count - The number of reflections that may still be followed along the path.
+    /// @param[in,out]  contribution - The proportion the surface contributes to the path's color.
+    ///     Updated to the proportion the reflected surface would contribute.
+    /// @param[in,out]  color - The path's color, to which the surface's color is added.
+    ///     Not clamped, so it must be clamped once the path is complete.
+    /// @return The reflected ray, if the reflection should be followed; null if the path ends here.
+    std::optional<Ray> RayTracingAlgorithm::ShadeIntersection(
+        const Scene& scene,
         const RayObjectIntersection& intersection,
-        const unsigned int remaining_reflection_count) const
+        const MATH::Vector3f& intersection_point,
+        const MATH::Vector3f& unit_surface_normal,
+        const unsigned int remaining_reflection_count,
+        float& contribution,
+        GRAPHICS::Color& color) const
+    {
+        // ADD IN THE COLOR DIRECTLY FROM THE CURRENT SURFACE.
+        const Material* intersected_material = intersection.Object->IntersectionMaterial(intersection);
+        // Colors are summed manually since color addition clamps, which would bias weighted light samples.
+        Color surface_color = ComputeSurfaceColor(scene, intersection, intersection_point, unit_surface_normal);
+        if (IndirectDiffuse)
+        {
+            Color indirect_diffuse_color = ComputeIndirectDiffuseColor(scene, intersection, intersection_point, unit_surface_normal);
+            surface_color.Red += indirect_diffuse_color.Red;
+            surface_color.Green += indirect_diffuse_color.Green;
+            surface_color.Blue += indirect_diffuse_color.Blue;
+        }
+        color.Red += contribution * surface_color.Red;
+        color.Green += contribution * surface_color.Green;
+        color.Blue += contribution * surface_color.Blue;
+
+        // CHECK IF THE RAY CAN BE REFLECTED.
+        // In addition to the remaining reflections, there's no need to compute
+        // color from reflected light in the material isn't reflective.
+        bool ray_can_be_reflected = (
+            Reflections &&
+            (remaining_reflection_count > 0) && 
+            (intersected_material->ReflectivityProportion > 0.0f));
+        if (!ray_can_be_reflected)
+        {
+            return std::nullopt;
+        }
+
+        // STOP IF ANY REFLECTED LIGHT WOULD BE NEGLIGIBLE.
+        contribution *= intersected_material->ReflectivityProportion;
+        bool reflection_contributes_enough = (contribution >= MinReflectionContribution);
+        if (!reflection_contributes_enough)
+        {
+            return std::nullopt;
+        }
+
+        // COMPUTE THE REFLECTED RAY.
+        MATH::Vector3f direction_from_ray_origin_to_intersection = intersection_point - intersection.Ray->Origin;
+        MATH::Vector3f normalized_direction_from_ray_origin_to_intersection = MATH::Vector3f::Normalize(direction_from_ray_origin_to_intersection);
+        float length_of_ray_along_surface_normal = MATH::Vector3f::DotProduct(normalized_direction_from_ray_origin_to_intersection, unit_surface_normal);
+        float twice_length_of_ray_along_surface_normal = 2.0f * length_of_ray_along_surface_normal;
+        MATH::Vector3f twice_reflected_ray_along_surface_normal = MATH::Vector3f::Scale(twice_length_of_ray_along_surface_normal, unit_surface_normal);
+        MATH::Vector3f reflected_ray_direction = normalized_direction_from_ray_origin_to_intersection - twice_reflected_ray_along_surface_normal;
+        MATH::Vector3f normalized_reflected_ray_direction = MATH::Vector3f::Normalize(reflected_ray_direction);
+        Ray reflected_ray(intersection_point, normalized_reflected_ray_direction);
+        return reflected_ray;
+    }
+
+    /// Computes the color directly from lights at a single surface intersection (without reflections).
+    /// Diffuse and specular contributions are accumulated together in a single pass over the lights
+    /// so that the shadow ray and light direction only need to be computed once per light, and
+    /// nothing needs to be stored per light.
+    /// @param[in]  scene - The scene in which the color is being computed.
+    /// @param[in]  intersection - The intersection for which to compute the color.
+    /// @param[in]  intersection_point - The point of the intersection.
+    /// @param[in]  unit_surface_normal - The unit surface normal of the object at the intersection point.
+    /// @return The computed color.  Not clamped, so components may exceed the valid range.
+    GRAPHICS::Color RayTracingAlgorithm::ComputeSurfaceColor(
+        const Scene& scene,
+        const RayObjectIntersection& intersection,
+        const MATH::Vector3f& intersection_point,
+        const MATH::Vector3f& unit_surface_normal) const
     {
         // INITIALIZE THE COLOR TO HAVE NO CONTRIBUTION FROM ANY SOURCES.
         Color final_color = Color::BLACK;
 
         // ADD IN THE AMBIENT COLOR IF ENABLED.
-        const Material* intersected_material = intersection.Object->GetMaterial();
+        const Material* intersected_material = intersection.Object->IntersectionMaterial(intersection);
         if (Ambient)
         {
             final_color += intersected_material->AmbientColor;
         }
 
-        // COMPUTE SHADOWS.
-        std::vector<float> shadow_factors_by_light_index;
-        MATH::Vector3f intersection_point = intersection.IntersectionPoint();
-        for (const Light& light : scene.PointLights)
+        // CHECK IF ANY LIGHTS NEED TO BE CONSIDERED.
+        bool lights_contribute = (Diffuse || Specular);
+        if (!lights_contribute)
         {
-            // CAST A RAY OUT TO COMPUTE SHADOWS IF ENABLED.
-            // To simplify later parts of the algorithm, a shadow factor of 1 (no shadowing)
-            // should always be computed.
-            constexpr float NO_SHADOWING = 1.0f;
-            float shadow_factor = NO_SHADOWING;
-            if (Shadows)
+            return final_color;
+        }
+
+        // DEFINE HOW TO ADD DIFFUSE AND SPECULAR CONTRIBUTIONS FROM A LIGHT SOURCE.
+        // Light totals are summed manually since color addition clamps, which would bias weighted light samples.
+        Color diffuse_light_total_color = Color::BLACK;
+        Color specular_light_total_color = Color::BLACK;
+        MATH::Vector3f ray_from_intersection_to_eye = intersection.Ray->Origin - intersection_point;
+        MATH::Vector3f normalized_ray_from_intersection_to_eye = MATH::Vector3f::Normalize(ray_from_intersection_to_eye);
+        auto add_light = [&](const Light& light, const float weight)
+        {
+            float diffuse_proportion = 0.0f;
+            float specular_proportion = 0.0f;
+            bool light_reaches_surface = ComputeLightProportions(
+                scene,
+                intersection,
+                intersection_point,
+                unit_surface_normal,
+                normalized_ray_from_intersection_to_eye,
+                light,
+                diffuse_proportion,
+                specular_proportion);
+            if (!light_reaches_surface)
+            {
+                return;
+            }
+
+            float weighted_diffuse_proportion = weight * diffuse_proportion;
+            diffuse_light_total_color.Red += weighted_diffuse_proportion * light.Color.Red;
+            diffuse_light_total_color.Green += weighted_diffuse_proportion * light.Color.Green;
+            diffuse_light_total_color.Blue += weighted_diffuse_proportion * light.Color.Blue;
+
+            float weighted_specular_proportion = weight * specular_proportion;
+            specular_light_total_color.Red += weighted_specular_proportion * light.Color.Red;
+            specular_light_total_color.Green += weighted_specular_proportion * light.Color.Green;
+            specular_light_total_color.Blue += weighted_specular_proportion * light.Color.Blue;
+        };
+
+        // ADD CONTRIBUTIONS FROM LIGHT SOURCES.
+        // Sampling only helps if there are more lights than samples.
+        bool sample_lights = (
+            ManyLightSampling &&
+            scene.LightDistributionIsCurrent() &&
+            (scene.PointLights.size() > LightSampleCountPerHit));
+        if (sample_lights)
+        {
+            // SAMPLE LIGHTS IN PROPORTION TO THEIR ESTIMATED CONTRIBUTIONS.
+            // The random numbers are keyed by the exact intersection point so that results are deterministic
+            // regardless of how rendering is split across threads.  Dividing each sampled light's contribution by
+            // its probability and averaging over all samples gives the same color as evaluating all lights on average.
+            std::uint32_t random_number_key = MATH::CounterBasedRandomNumberGenerator::Hash(0);
+            random_number_key = MATH::CounterBasedRandomNumberGenerator::HashFloat(random_number_key, intersection_point.X);
+            random_number_key = MATH::CounterBasedRandomNumberGenerator::HashFloat(random_number_key, intersection_point.Y);
+            random_number_key = MATH::CounterBasedRandomNumberGenerator::HashFloat(random_number_key, intersection_point.Z);
+            MATH::CounterBasedRandomNumberGenerator random_number_generator(random_number_key);
+            float sample_count = static_cast<float>(LightSampleCountPerHit);
+            for (unsigned int sample_index = 0; sample_index < LightSampleCountPerHit; ++sample_index)
             {
-                // SHOOT A SHADOW RAY OUT FROM THE INTERSECTION POINT TO THE LIGHT.
-                MATH::Vector3f direction_from_point_to_light = light.PointLightDirectionFrom(intersection_point);
-                Ray shadow_ray(intersection_point, direction_from_point_to_light);
-                std::optional<RayObjectIntersection> shadow_intersection = ComputeClosestIntersection(scene, shadow_ray, intersection.Object);
-                if (shadow_intersection)
+                float light_probability = 0.0f;
+                std::optional<std::size_t> light_index = scene.PointLightDistribution.SampleLight(
+                    random_number_generator.NextUniformFloat(),
+                    light_probability);
+                if (!light_index)
                 {
-                    // DETERMINE THE SHADOW FACTOR BASED ON THE INTERSECTION.
-                    // For a shadow to occur, the intersection with another object must occur in front of the shadow ray.
-                    // Similarly, the intersection must occur before the ray hits the light (hence why the shadow ray
-                    // is computed with a direction that is not unit length but the full length from the intersection
-                    // point to the light - it makes checking for the distance to the light easier).
-                    constexpr float NO_DISTANCE_IN_FRONT_OF_SHADOW_RAY = 0.0f;
-                    constexpr float DISTANCE_AT_LIGHT = 1.0f;
-                    bool shadow_intersection_in_range = (
-                        (NO_DISTANCE_IN_FRONT_OF_SHADOW_RAY < shadow_intersection->DistanceFromRayToObject) &&
-                        (shadow_intersection->DistanceFromRayToObject < DISTANCE_AT_LIGHT));
-                    if (shadow_intersection_in_range)
-                    {
-                        constexpr float FULL_SHADOWING = 0.0f;
-                        shadow_factor = FULL_SHADOWING;
-                    }
-                    else
-                    {
-                        shadow_factor = NO_SHADOWING;
-                    }
+                    break;
                 }
-            }
 
-            // STORE THE SHADOW FACTOR FOR THE LIGHT.
-            shadow_factors_by_light_index.push_back(shadow_factor);
+                float weight = 1.0f / (sample_count * light_probability);
+                add_light(scene.PointLights[*light_index], weight);
+            }
+        }
+        else
+        {
+            // ADD CONTRIBUTIONS FROM ALL LIGHT SOURCES.
+            constexpr float FULL_WEIGHT = 1.0f;
+            for (const Light& light : scene.PointLights)
+            {
+                add_light(light, FULL_WEIGHT);
+            }
         }
 
         // ADD IN DIFFUSE COLOR FROM LIGHTS IF ENABLED.
-        MATH::Vector3f unit_surface_normal = intersection.Object->SurfaceNormal(intersection_point);
+        // Colors from lights are also added manually since only the final pixel color should be clamped.
         if (Diffuse)
         {
-            // ADD DIFFUSE CONTRIBUTIONS FROM ALL LIGHT SOURCES.
-            Color light_total_color = Color::BLACK;
-            for (std::size_t light_index = 0; light_index < scene.PointLights.size(); ++light_index)
-            {
-                // ADD COLOR FROM THE CURRENT LIGHT.
-                // This is based on the Lambertian shading model.
-                // An object is maximally illuminated when facing toward the light.
-                // An object tangent to the light direction or facing away receives no illumination.
-                // In-between, the amount of illumination is proportional to the cosine of the angle between
-                // the light and surface normal (where the cosine can be computed via the dot product).
-                const Light& light = scene.PointLights.at(light_index);
-                MATH::Vector3f direction_from_point_to_light = light.PointLightDirectionFrom(intersection_point);
-                MATH::Vector3f unit_direction_from_point_to_light = MATH::Vector3f::Normalize(direction_from_point_to_light);
-                constexpr float NO_ILLUMINATION = 0.0f;
-                float illumination_proportion = MATH::Vector3f::DotProduct(unit_surface_normal, unit_direction_from_point_to_light);
-                illumination_proportion = std::max(NO_ILLUMINATION, illumination_proportion);
-
-                // ADD THE CURRENT LIGHT'S COLOR.
-                float shadow_factor = shadow_factors_by_light_index.at(light_index);
-                Color current_light_color = Color::ScaleRedGreenBlue(illumination_proportion, light.Color);
-                current_light_color = Color::ScaleRedGreenBlue(shadow_factor, current_light_color);
-                light_total_color += current_light_color;
-            }
-
             // The diffuse color is multiplied component-wise by the amount of light.
-            Color diffuse_color = Color::ComponentMultiplyRedGreenBlue(
-                intersected_material->DiffuseColor,
-                light_total_color);
-            final_color += diffuse_color;
+            final_color.Red += intersected_material->DiffuseColor.Red * diffuse_light_total_color.Red;
+            final_color.Green += intersected_material->DiffuseColor.Green * diffuse_light_total_color.Green;
+            final_color.Blue += intersected_material->DiffuseColor.Blue * diffuse_light_total_color.Blue;
         }
 
-        // ADD IN SPECULAR COLOR IF ENABLED.
-        // This is based on the Blinn-Phong model.
+        // ADD IN SPECULAR COLOR FROM LIGHTS IF ENABLED.
         if (Specular)
         {
-            // ADD SPECULAR CONTRIBUTIONS FROM ALL LIGHT SOURCES.
-            Color specular_light_total_color = Color::BLACK;
-            MATH::Vector3f ray_from_intersection_to_eye = intersection.Ray->Origin - intersection_point;
-            MATH::Vector3f normalized_ray_from_intersection_to_eye = MATH::Vector3f::Normalize(ray_from_intersection_to_eye);
-            for (std::size_t light_index = 0; light_index < scene.PointLights.size(); ++light_index)
-            {
-                // COMPUTE THE AMOUNT OF ILLUMINATION FROM THE CURRENT LIGHT.
-                const Light& light = scene.PointLights.at(light_index);
-                MATH::Vector3f direction_from_point_to_light = light.PointLightDirectionFrom(intersection_point);
-                MATH::Vector3f unit_direction_from_point_to_light = MATH::Vector3f::Normalize(direction_from_point_to_light);
-                constexpr float NO_ILLUMINATION = 0.0f;
-                float illumination_proportion = MATH::Vector3f::DotProduct(unit_surface_normal, unit_direction_from_point_to_light);
-                illumination_proportion = std::max(NO_ILLUMINATION, illumination_proportion);
-
-                // COMPUTE THE REFLECTED LIGHT DIRECTION.
-                MATH::Vector3f reflected_light_along_surface_normal = MATH::Vector3f::Scale(2.0f * illumination_proportion, unit_surface_normal);
-                MATH::Vector3f reflected_light_direction = reflected_light_along_surface_normal - unit_direction_from_point_to_light;
-                MATH::Vector3f unit_reflected_light_direction = MATH::Vector3f::Normalize(reflected_light_direction);
-
-                // COMPUTE THE SPECULAR AMOUNT.
-                float specular_proportion = MATH::Vector3f::DotProduct(normalized_ray_from_intersection_to_eye, unit_reflected_light_direction);
-                specular_proportion = std::max(NO_ILLUMINATION, specular_proportion);
-                specular_proportion = std::pow(specular_proportion, intersected_material->SpecularPower);
-
-                // ADD THE CURRENT LIGHT'S SPECULAR COLOR.
-                float shadow_factor = shadow_factors_by_light_index.at(light_index);
-                float light_proportion = shadow_factor * specular_proportion;
-                Color current_light_specular_color = Color::ScaleRedGreenBlue(light_proportion, light.Color);
-                specular_light_total_color += current_light_specular_color;
-            }
-
             // The specular color is multiplied component-wise by the amount of light.
-            Color specular_color = Color::ComponentMultiplyRedGreenBlue(
-                intersected_material->SpecularColor,
-                specular_light_total_color);
-            final_color += specular_color;
+            final_color.Red += intersected_material->SpecularColor.Red * specular_light_total_color.Red;
+            final_color.Green += intersected_material->SpecularColor.Green * specular_light_total_color.Green;
+            final_color.Blue += intersected_material->SpecularColor.Blue * specular_light_total_color.Blue;
         }
 
-        // COMPUTE REFLECTED LIGHT IF POSSIBLE.
-        if (Reflections)
+        return final_color;
+    }
+
+    /// Computes the color from diffuse light reflected to a surface off of other surfaces.
+    /// The irradiance cache is used if available, with new records only computed where no existing ones are valid.
+    /// @param[in]  scene - The scene in which the color is being computed.
+    /// @param[in]  intersection - The intersection with the surface.
+    /// @param[in]  intersection_point - The point on the surface.
+    /// @param[in]  unit_surface_normal - The unit surface normal at the point.
+    /// @return The indirect diffuse color of the surface.
+    GRAPHICS::Color RayTracingAlgorithm::ComputeIndirectDiffuseColor(
+        const Scene& scene,
+        const RayObjectIntersection& intersection,
+        const MATH::Vector3f& intersection_point,
+        const MATH::Vector3f& unit_surface_normal) const
+    {
+        // SKIP SURFACES THAT DON'T REFLECT DIFFUSE LIGHT.
+        const Material* intersected_material = intersection.Object->IntersectionMaterial(intersection);
+        const Color& diffuse_color = intersected_material->DiffuseColor;
+        bool surface_reflects_diffuse_light = ((diffuse_color.Red > 0.0f) || (diffuse_color.Green > 0.0f) || (diffuse_color.Blue > 0.0f));
+        if (!surface_reflects_diffuse_light)
         {
-            // CHECK IF THE RAY CAN BE REFLECTED.
-            // In addition to the remaining reflections, there's no need to compute
-            // color from reflected light in the material isn't reflective.
-            bool ray_can_be_reflected = (remaining_reflection_count > 0) && (intersected_material->ReflectivityProportion > 0.0f);
-            if (!ray_can_be_reflected)
+            return Color::BLACK;
+        }
+
+        // TRY INTERPOLATING CACHED IRRADIANCE.
+        std::optional<Color> irradiance = std::nullopt;
+        if (IndirectDiffuseCache)
+        {
+            irradiance = IndirectDiffuseCache->Interpolate(intersection_point, unit_surface_normal);
+        }
+
+        // COMPUTE IRRADIANCE IF NO CACHED IRRADIANCE WAS VALID.
+        if (!irradiance)
+        {
+            float validity_radius = 0.0f;
+            irradiance = ComputeIrradiance(scene, intersection, intersection_point, unit_surface_normal, validity_radius);
+            if (IndirectDiffuseCache)
             {
-                // RETURN THE COLOR AS-IS.
-                return final_color;
+                IndirectDiffuseCache->Insert(IrradianceCache::Record
+                {
+                    .Position = intersection_point,
+                    .UnitSurfaceNormal = unit_surface_normal,
+                    .Irradiance = *irradiance,
+                    .ValidityRadius = validity_radius,
+                });
             }
+        }
 
-            // COMPUTE THE REFLECTED RAY.
-            MATH::Vector3f direction_from_ray_origin_to_intersection = intersection_point - intersection.Ray->Origin;
-            MATH::Vector3f normalized_direction_from_ray_origin_to_intersection = MATH::Vector3f::Normalize(direction_from_ray_origin_to_intersection);
-            float length_of_ray_along_surface_normal = MATH::Vector3f::DotProduct(normalized_direction_from_ray_origin_to_intersection, unit_surface_normal);
-            float twice_length_of_ray_along_surface_normal = 2.0f * length_of_ray_along_surface_normal;
-            MATH::Vector3f twice_reflected_ray_along_surface_normal = MATH::Vector3f::Scale(twice_length_of_ray_along_surface_normal, unit_surface_normal);
-            MATH::Vector3f reflected_ray_direction = normalized_direction_from_ray_origin_to_intersection - twice_reflected_ray_along_surface_normal;
-            MATH::Vector3f normalized_reflected_ray_direction = MATH::Vector3f::Normalize(reflected_ray_direction);
-            Ray reflected_ray(intersection_point, normalized_reflected_ray_direction);
+        // The diffuse color is multiplied component-wise by the amount of light.
+        Color indirect_diffuse_color = Color::ComponentMultiplyRedGreenBlue(diffuse_color, *irradiance);
+        return indirect_diffuse_color;
+    }
 
-            // CHECK FOR ANY INTERSECTIONS FROM THE REFLECTED RAY.
-            std::optional<RayObjectIntersection> reflected_intersection = ComputeClosestIntersection(scene, reflected_ray, intersection.Object);
-            if (reflected_intersection)
+    /// Computes the indirect diffuse irradiance at a point by casting rays over the hemisphere above it and averaging
+    /// the light directly leaving the surfaces they hit.  Ray directions are cosine-weighted (matching how diffuse
+    /// surfaces reflect light) and chosen with random numbers keyed by the point, so results are deterministic.
+    /// @param[in]  scene - The scene in which irradiance is being computed.
+    /// @param[in]  intersection - The intersection with the surface containing the point.
+    /// @param[in]  intersection_point - The point on the surface.
+    /// @param[in]  unit_surface_normal - The unit surface normal at the point.
+    /// @param[out]  validity_radius - The distance over which the irradiance may be reused, based on the harmonic
+    ///     mean distance to the surfaces hit (since nearby surfaces make indirect light change more quickly).
+    /// @return The irradiance (as the average color of incoming light).
+    GRAPHICS::Color RayTracingAlgorithm::ComputeIrradiance(
+        const Scene& scene,
+        const RayObjectIntersection& intersection,
+        const MATH::Vector3f& intersection_point,
+        const MATH::Vector3f& unit_surface_normal,
+        float& validity_radius) const
+    {
+        // CAST RAYS OVER THE HEMISPHERE ABOVE THE POINT.
+        // Colors are summed manually since color addition clamps.
+        std::uint32_t random_number_key = MATH::CounterBasedRandomNumberGenerator::Hash(1);
+        random_number_key = MATH::CounterBasedRandomNumberGenerator::HashFloat(random_number_key, intersection_point.X);
+        random_number_key = MATH::CounterBasedRandomNumberGenerator::HashFloat(random_number_key, intersection_point.Y);
+        random_number_key = MATH::CounterBasedRandomNumberGenerator::HashFloat(random_number_key, intersection_point.Z);
+        MATH::CounterBasedRandomNumberGenerator random_number_generator(random_number_key);
+        float total_red = 0.0f;
+        float total_green = 0.0f;
+        float total_blue = 0.0f;
+        float total_inverse_hit_distance = 0.0f;
+        for (unsigned int sample_index = 0; sample_index < IndirectDiffuseSampleCount; ++sample_index)
+        {
+            // FIND THE SURFACE HIT BY THE RAY.
+            MATH::Vector3f direction = PathTracingAlgorithm::CosineWeightedHemisphereDirection(unit_surface_normal, random_number_generator);
+            Ray gather_ray(intersection_point, direction);
+            std::optional<RayObjectIntersection> hit = ComputeClosestIntersection(scene, gather_ray, intersection.Object);
+            if (!hit)
             {
-                // COMPUTE THE REFLECTED COLOR.
-                const unsigned int child_reflection_count = remaining_reflection_count - 1;
-                Color raw_reflected_color = ComputeColor(scene, *reflected_intersection, child_reflection_count);
-                Color reflected_color = Color::ScaleRedGreenBlue(intersected_material->ReflectivityProportion, raw_reflected_color);
-                final_color += reflected_color;
+                continue;
             }
-            else
+
+            // ADD THE LIGHT DIRECTLY LEAVING THE HIT SURFACE.
+            MATH::Vector3f hit_point = hit->IntersectionPoint();
+            MATH::Vector3f hit_unit_surface_normal = hit->Object->IntersectionSurfaceNormal(*hit);
+            Color hit_color = ComputeSurfaceColor(scene, *hit, hit_point, hit_unit_surface_normal);
+            total_red += hit_color.Red;
+            total_green += hit_color.Green;
+            total_blue += hit_color.Blue;
+            total_inverse_hit_distance += 1.0f / std::max(hit->DistanceFromRayToObject, std::numeric_limits<float>::min());
+        }
+
+        // COMPUTE HOW FAR THE IRRADIANCE MAY BE REUSED.
+        float sample_count = static_cast<float>(std::max(1u, IndirectDiffuseSampleCount));
+        validity_radius = MaxIrradianceCacheValidityRadius;
+        if (total_inverse_hit_distance > 0.0f)
+        {
+            float harmonic_mean_hit_distance = sample_count / total_inverse_hit_distance;
+            validity_radius = std::clamp(harmonic_mean_hit_distance, MinIrradianceCacheValidityRadius, MaxIrradianceCacheValidityRadius);
+        }
+
+        // AVERAGE THE LIGHT FROM ALL RAYS.
+        // Rays not hitting anything receive no light.
+        Color irradiance(
+            total_red / sample_count,
+            total_green / sample_count,
+            total_blue / sample_count,
+            Color::MAX_FLOAT_COLOR_COMPONENT);
+        irradiance.Clamp();
+        return irradiance;
+    }
+
+    /// Computes how much a single light illuminates a point on a surface.
+    /// @param[in]  scene - The scene containing the surface.
+    /// @param[in]  intersection - The intersection with the surface.
+    /// @param[in]  intersection_point - The point on the surface to illuminate.
+    /// @param[in]  unit_surface_normal - The unit surface normal at the point.
+    /// @param[in]  normalized_ray_from_intersection_to_eye - The unit direction from the point back toward the viewer.
+    /// @param[in]  light - The light illuminating the point.
+    /// @param[out]  diffuse_proportion - The proportion of the light's color contributing to diffuse shading.
+    ///     Only set if diffuse shading is enabled and the light reaches the surface.
+    /// @param[out]  specular_proportion - The proportion of the light's color contributing to specular shading.
+    ///     Only set if specular shading is enabled and the light reaches the surface.
+    /// @return True if the light reaches the surface; false if it's blocked by a shadow.
+    bool RayTracingAlgorithm::ComputeLightProportions(
+        const Scene& scene,
+        const RayObjectIntersection& intersection,
+        const MATH::Vector3f& intersection_point,
+        const MATH::Vector3f& unit_surface_normal,
+        const MATH::Vector3f& normalized_ray_from_intersection_to_eye,
+        const Light& light,
+        float& diffuse_proportion,
+        float& specular_proportion) const
+    {
+        // CAST A RAY OUT TO COMPUTE SHADOWS IF ENABLED.
+        MATH::Vector3f direction_from_point_to_light = light.PointLightDirectionFrom(intersection_point);
+        if (Shadows)
+        {
+            // SHOOT A SHADOW RAY OUT FROM THE INTERSECTION POINT TO THE LIGHT.
+            // For a shadow to occur, the intersection with another object must occur in front of the shadow ray.
+            // Similarly, the intersection must occur before the ray hits the light (hence why the shadow ray
+            // is computed with a direction that is not unit length but the full length from the intersection
+            // point to the light - it makes checking for the distance to the light easier).
+            // A fully shadowed light contributes nothing, so the rest of the light's computations can be skipped.
+            Ray shadow_ray(intersection_point, direction_from_point_to_light);
+            constexpr float NO_DISTANCE_IN_FRONT_OF_SHADOW_RAY = 0.0f;
+            constexpr float DISTANCE_AT_LIGHT = 1.0f;
+            if (CurrentStatisticsCounts)
             {
-                // ADD REFLECTED LIGHT CONTRIBUTED FROM THE BACKGROUND.
-                Color reflected_color = Color::ScaleRedGreenBlue(intersected_material->ReflectivityProportion, scene.BackgroundColor);
-                final_color += reflected_color;
+                ++CurrentStatisticsCounts->ShadowRayCount;
+            }
+            bool light_blocked = Occluded(scene, shadow_ray, NO_DISTANCE_IN_FRONT_OF_SHADOW_RAY, DISTANCE_AT_LIGHT, intersection.Object);
+            if (light_blocked)
+            {
+                return false;
             }
         }
 
-        return final_color;
+        // COMPUTE THE AMOUNT OF ILLUMINATION FROM THE LIGHT.
+        // This is based on the Lambertian shading model.
+        // An object is maximally illuminated when facing toward the light.
+        // An object tangent to the light direction or facing away receives no illumination.
+        // In-between, the amount of illumination is proportional to the cosine of the angle between
+        // the light and surface normal (where the cosine can be computed via the dot product).
+        MATH::Vector3f unit_direction_from_point_to_light = MATH::Vector3f::Normalize(direction_from_point_to_light);
+        constexpr float NO_ILLUMINATION = 0.0f;
+        float illumination_proportion = MATH::Vector3f::DotProduct(unit_surface_normal, unit_direction_from_point_to_light);
+        illumination_proportion = std::max(NO_ILLUMINATION, illumination_proportion);
+
+        // COMPUTE THE LIGHT'S DIFFUSE PROPORTION IF ENABLED.
+        if (Diffuse)
+        {
+            diffuse_proportion = illumination_proportion;
+        }
+
+        // COMPUTE THE LIGHT'S SPECULAR PROPORTION IF ENABLED.
+        // This is based on the Blinn-Phong model.
+        if (Specular)
+        {
+            // COMPUTE THE REFLECTED LIGHT DIRECTION.
+            MATH::Vector3f reflected_light_along_surface_normal = MATH::Vector3f::Scale(2.0f * illumination_proportion, unit_surface_normal);
+            MATH::Vector3f reflected_light_direction = reflected_light_along_surface_normal - unit_direction_from_point_to_light;
+            MATH::Vector3f unit_reflected_light_direction = MATH::Vector3f::Normalize(reflected_light_direction);
+
+            // COMPUTE THE SPECULAR AMOUNT.
+            const Material* intersected_material = intersection.Object->IntersectionMaterial(intersection);
+            float current_specular_proportion = MATH::Vector3f::DotProduct(normalized_ray_from_intersection_to_eye, unit_reflected_light_direction);
+            current_specular_proportion = std::max(NO_ILLUMINATION, current_specular_proportion);
+            specular_proportion = std::pow(current_specular_proportion, intersected_material->SpecularPower);
+        }
+
+        return true;
     }
 
     /// Computes the closest intersection in the scene of a specific ray.
@@ -238,51 +1570,82 @@ namespace RAY_TRACING
     ///     this object will be ignored for intersections.  This provides an easy way
     ///     to calculate intersections from reflected rays without having the object
     ///     being reflected off of infinitely intersected with.
+    /// @param[in]  candidate_objects - The only objects the ray needs to be tested against, if known
+    ///     (such as from culling against a tile's frustum).  Null to search the whole scene.
     /// @return The closest intersection, if one was found; unpopulated if no intersection
     ///     was found between the ray and an object in the scene.
     std::optional<RayObjectIntersection> RayTracingAlgorithm::ComputeClosestIntersection(
         const Scene& scene,
         const Ray& ray,
-        const IObject3D* const ignored_object) const
+        const IObject3D* const ignored_object,
+        const std::vector<const IObject3D*>* const candidate_objects) const
     {
-        // FIND THE CLOSEST OBJECT IN THE SCENE THAT THE RAY INTERSECTS.
+        // DEFINE HOW TO CHECK EACH OBJECT FOR A CLOSER INTERSECTION.
         std::optional<RayObjectIntersection> closest_intersection = std::nullopt;
-        for (const auto& current_object : scene.Objects)
+        float closest_distance = std::numeric_limits<float>::infinity();
+        auto update_closest_intersection = [&](const IObject3D& current_object)
         {
             // SKIP OVER THE CURRENT OBJECT IF IT SHOULD BE IGNORED.
-            bool ignore_current_object = (ignored_object == current_object.get());
+            bool ignore_current_object = (ignored_object == &current_object);
             if (ignore_current_object)
             {
-                continue;
+                return;
             }
 
             // CHECK IF THE RAY INTERSECTS THE CURRENT OBJECT.
-            std::optional<RayObjectIntersection> intersection = current_object->Intersect(ray);
+            if (CurrentStatisticsCounts)
+            {
+                CurrentStatisticsCounts->CountIntersectionTest(current_object.Type());
+            }
+            std::optional<RayObjectIntersection> intersection = current_object.Intersect(ray);
             bool ray_hit_object = (std::nullopt != intersection);
             if (!ray_hit_object)
             {
-                // CONTINUE SEEING IF OTHER OBJECTS ARE HIT.
-                continue;
+                return;
             }
 
-            // UPDATE THE CLOSEST INTERSECTION APPROPRIATELY.
-            if (closest_intersection)
+            // ONLY OVERWRITE THE CLOSEST INTERSECTION IF THE NEWEST ONE IS CLOSER.
+            bool new_intersection_closer = (intersection->DistanceFromRayToObject < closest_distance);
+            if (new_intersection_closer)
             {
-                // ONLY OVERWRITE THE CLOSEST INTERSECTION IF THE NEWEST ONE IS CLOSER.
-                bool new_intersection_closer = (intersection->DistanceFromRayToObject < closest_intersection->DistanceFromRayToObject);
-                if (new_intersection_closer)
-                {
-                    closest_intersection = intersection;
-                }
+                closest_distance = intersection->DistanceFromRayToObject;
+                closest_intersection = intersection;
             }
-            else
+        };
+
+        // CHECK ONLY THE CANDIDATE OBJECTS IF PROVIDED.
+        if (candidate_objects)
+        {
+            for (const IObject3D* candidate_object : *candidate_objects)
             {
-                // SET THIS FIRST INTERSECTION AS THE CLOSEST.
-                closest_intersection = intersection;
+                update_closest_intersection(*candidate_object);
             }
+            return closest_intersection;
         }
 
+        // CHECK ALL OBJECTS THE RAY MAY HIT.
+        // The closest distance shrinks as intersections are found, allowing more of the scene's
+        // acceleration structure to be skipped.
+        scene.VisitObjects(ray, closest_distance, [&](const IObject3D& current_object)
+        {
+            update_closest_intersection(current_object);
+
+            // CONTINUE SEARCHING FOR ANY CLOSER OBJECTS.
+            return false;
+        }, TraversalStepCounter());
         return closest_intersection;
     }
+
+    /// Gets the counter for steps through the scene's acceleration structure, if collecting statistics.
+    /// @return The counter to increment for each traversal step; null if statistics aren't being collected.
+    std::size_t* RayTracingAlgorithm::TraversalStepCounter() const
+    {
+        if (!CurrentStatisticsCounts)
+        {
+            return nullptr;
+        }
+
+        return &CurrentStatisticsCounts->TraversalStepCount;
+    }
 }
 }
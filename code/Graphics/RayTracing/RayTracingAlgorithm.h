@@ -1,12 +1,27 @@
 #pragma once
 
+#include <chrono>
+#include <cstdint>
+#include <memory>
 #include <optional>
+#include <vector>
+#include "Containers/Array2D.h"
 #include "Graphics/Camera.h"
 #include "Graphics/Color.h"
+#include "Graphics/Light.h"
+#include "Graphics/RayTracing/GeometryBuffer.h"
+#include "Graphics/RayTracing/Frustum.h"
 #include "Graphics/RayTracing/IObject3D.h"
+#include "Graphics/RayTracing/IrradianceCache.h"
 #include "Graphics/RayTracing/Ray.h"
+#include "Graphics/RayTracing/RayGenerator.h"
 #include "Graphics/RayTracing/RayObjectIntersection.h"
+#include "Graphics/RayTracing/RayPacket.h"
+#include "Graphics/RayTracing/RayTracingStatistics.h"
 #include "Graphics/RayTracing/Scene.h"
+#include "Graphics/RayTracing/ScreenTile.h"
+#include "Graphics/RayTracing/TilePriority.h"
+#include "Graphics/RayTracing/VisibilityBuffer.h"
 #include "Graphics/RenderTarget.h"
 
 namespace GRAPHICS
@@ -18,8 +33,38 @@ namespace RAY_TRACING
     class RayTracingAlgorithm
     {
     public:
+        // STATIC CONSTANTS.
+        /// The width and height of the blocks of pixels filled in by the first pass of
+        /// progressive rendering.  Each later pass halves the block size until reaching 1 pixel.
+        static constexpr unsigned int COARSEST_PROGRESSIVE_BLOCK_SIZE_IN_PIXELS = 8;
+
         // PUBLIC METHODS.
         void Render(const Scene& scene, GRAPHICS::RenderTarget& render_target);
+        void RenderHybrid(const Scene& scene, GRAPHICS::RenderTarget& render_target) const;
+        void StartProgressiveRender();
+        bool RenderStep(const Scene& scene, GRAPHICS::RenderTarget& render_target, const unsigned int ray_budget);
+        bool ProgressiveRenderComplete() const;
+        void StartTimedRender(const GRAPHICS::RenderTarget& render_target);
+        float RenderUntil(
+            const Scene& scene,
+            GRAPHICS::RenderTarget& render_target,
+            const std::chrono::steady_clock::time_point deadline);
+        float TimedRenderCompletionPercentage() const;
+        const GeometryBuffer& CachedPrimaryHits() const;
+        float RenderTile(const Scene& scene, GRAPHICS::RenderTarget& render_target, const ScreenTile& tile) const;
+        GeometryBuffer::PrimaryHit TracePrimaryHit(const Scene& scene, const Ray& ray) const;
+        GRAPHICS::Color ShadePrimaryHit(const Scene& scene, const GeometryBuffer::PrimaryHit& primary_hit) const;
+        bool Occluded(
+            const Scene& scene,
+            const Ray& ray,
+            const float min_distance,
+            const float max_distance,
+            const IObject3D* const ignored_object = nullptr) const;
+        GRAPHICS::Color ComputeDirectLight(
+            const Scene& scene,
+            const MATH::Vector3f& surface_point,
+            const MATH::Vector3f& unit_surface_normal,
+            const IObject3D* const surface_object = nullptr) const;
 
         // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
         /// The camera used for rendering.
@@ -37,17 +82,186 @@ namespace RAY_TRACING
         /// The maximum number of reflections to computer (if reflections are enabled).
         /// More reflections will take longer to render an image.
         unsigned int ReflectionCount = 5;
+        /// The minimum proportion a reflected surface must contribute to the final color
+        /// of a pixel for reflections to continue being followed.  Paths through several
+        /// weakly reflective surfaces can stop before \ref ReflectionCount is reached.
+        float MinReflectionContribution = 0.01f;
+        /// True if edges should be antialiased by taking extra samples for only those pixels that
+        /// differ significantly from their neighbors; false to only take a single sample per pixel.
+        bool AdaptiveAntialiasing = false;
+        /// The maximum number of samples for any pixel with adaptive antialiasing.
+        /// Samples are stratified in a square grid within each pixel, so this is rounded down to a square number.
+        unsigned int MaxAntialiasingSamplesPerPixel = 16;
+        /// The minimum difference in any color component [0, 1] between neighboring pixels
+        /// for them to be considered an edge needing antialiasing.
+        float AntialiasingContrastThreshold = 0.1f;
+        /// True if the primary hit for each pixel should be cached by \ref Render so that later renders
+        /// with the same camera and scene geometry only need to redo shading.  Any change to the scene
+        /// that affects visibility must be indicated via the scene's geometry version.
+        bool CachePrimaryHits = false;
+        /// True if lights should be randomly sampled using the scene's light distribution rather than all being
+        /// evaluated for every surface hit, keeping the cost per hit roughly constant for scenes with many lights.
+        /// Sampled lights are weighted so that colors are correct on average, at the cost of some noise.
+        /// All lights are evaluated if the scene's light distribution isn't current.
+        bool ManyLightSampling = false;
+        /// The number of lights sampled for each surface hit with many-light sampling.
+        /// Scenes with no more lights than this always evaluate all lights since that's exact and no more expensive.
+        unsigned int LightSampleCountPerHit = 4;
+        /// The order in which tiles are rendered for timed rendering.
+        TilePriority TileRenderingPriority = TilePriority::SCREEN_CENTER;
+        /// True if \ref RenderTile should trace reflections breadth-first as a wavefront rather than following each
+        /// pixel's reflections one after another.  All primary rays for the tile are traced first, and the reflected
+        /// rays they spawn are queued and sorted by origin and direction so that similar rays are traced together,
+        /// improving cache hit rates when traversing the scene.  Each later bounce is queued and sorted the same way.
+        /// Produces the same image, so this is mainly useful for scenes with many reflective surfaces.
+        bool WavefrontReflections = false;
+        /// True if \ref RenderTile should first find the objects within the frustum covering all of a tile's
+        /// viewing rays (using the scene's hierarchy if available), so that primary rays only need to be tested
+        /// against those few objects rather than each searching the whole scene.  Most helpful for scenes spread
+        /// widely across the screen, where most objects are outside any single tile.
+        bool TileFrustumCulling = false;
+        /// True if \ref RenderTile should trace primary rays in packets of consecutive pixels within each row.
+        /// The objects within the tile's frustum are found first (as with \ref TileFrustumCulling), and objects
+        /// supporting packet intersections (like planes, discs, and boxes) are tested against all rays in a packet
+        /// at once; other objects are tested against each ray separately.  Produces the same image (up to tiny
+        /// rounding differences), so this is mainly useful for scenes with many simple primitives.
+        /// Ignored if \ref WavefrontReflections is enabled.
+        bool PacketPrimaryRays = false;
+        /// True if diffuse light reflected off of other surfaces (indirect diffuse lighting) should be calculated.
+        /// Rays are cast over the hemisphere above each surface, and the light directly leaving the surfaces they hit
+        /// (a single bounce) is averaged.  This is expensive, so using an \ref IndirectDiffuseCache is recommended.
+        bool IndirectDiffuse = false;
+        /// The number of rays cast to compute indirect diffuse lighting at a single point.
+        unsigned int IndirectDiffuseSampleCount = 64;
+        /// Any cache of indirect diffuse lighting, so that it only needs to be computed at a few points and can be
+        /// interpolated elsewhere.  Shared so that it persists across frames (and copies of the ray tracer, such as
+        /// for background rendering) while the scene is static.  Should be replaced with a new cache if the scene changes.
+        std::shared_ptr<IrradianceCache> IndirectDiffuseCache = nullptr;
+        /// The minimum distance over which cached indirect diffuse lighting may be used,
+        /// limiting how many records are created in corners and creases.
+        float MinIrradianceCacheValidityRadius = 0.05f;
+        /// The maximum distance over which cached indirect diffuse lighting may be used,
+        /// limiting how far records are used in open areas.
+        float MaxIrradianceCacheValidityRadius = 5.0f;
+        /// True if \ref Render should count the work done for the frame in \ref Statistics.
+        /// Other rendering methods don't collect statistics.
+        bool CollectStatistics = false;
+        /// True if \ref Render should also count the work done for each pixel (if collecting statistics),
+        /// at some extra cost for timing each pixel.  Extra antialiasing samples are only counted for the frame.
+        bool CollectPixelStatistics = false;
+        /// The statistics from the last render that collected them.
+        RayTracingStatistics Statistics = RayTracingStatistics();
 
     private:
+        /// A reflected ray waiting to be traced as part of a wavefront.
+        class ReflectionRay
+        {
+        public:
+            // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+            /// The reflected ray.
+            RAY_TRACING::Ray Ray = RAY_TRACING::Ray(MATH::Vector3f(), MATH::Vector3f());
+            /// The object the ray reflected off of, which is ignored when tracing the ray.
+            const IObject3D* ReflectingObject = nullptr;
+            /// The proportion whatever the ray hits contributes to its pixel's color.
+            float Contribution = 0.0f;
+            /// The number of reflections that may still be followed after this one.
+            unsigned int RemainingReflectionCount = 0;
+            /// The index (in row-major order within the tile) of the pixel the ray contributes to.
+            std::size_t PixelIndex = 0;
+            /// The key by which rays are sorted so that similar rays are traced together.
+            std::uint32_t SortKey = 0;
+        };
+
         // PRIVATE HELPER METHODS.
+        std::vector<GRAPHICS::Color> TraceTileWavefront(
+            const Scene& scene,
+            const RayGenerator& ray_generator,
+            const ScreenTile& tile,
+            const std::vector<const IObject3D*>* const primary_ray_candidate_objects) const;
+        static void SortReflectionRays(std::vector<ReflectionRay>& reflection_rays);
+        std::vector<GRAPHICS::Color> TraceViewingRayPacket(
+            const Scene& scene,
+            const RayPacket& ray_packet,
+            const std::vector<const IObject3D*>& candidate_objects) const;
+        GRAPHICS::Color TracePixel(
+            const Scene& scene,
+            const RayGenerator& ray_generator,
+            const MATH::Vector2ui& pixel_coordinates) const;
+        GRAPHICS::Color TraceViewingRay(
+            const Scene& scene,
+            const Ray& ray,
+            const IObject3D*& intersected_object,
+            const std::vector<const IObject3D*>* const candidate_objects = nullptr) const;
+        void AntialiasEdges(
+            const Scene& scene,
+            GRAPHICS::RenderTarget& render_target,
+            const CONTAINERS::Array2D<const IObject3D*>& intersected_objects_by_pixel) const;
         GRAPHICS::Color ComputeColor(
+            const Scene& scene,
+            const RayObjectIntersection& intersection) const;
+        GRAPHICS::Color ComputeColor(
+            const Scene& scene,
+            const RayObjectIntersection& intersection,
+            const MATH::Vector3f& first_intersection_point,
+            const MATH::Vector3f& first_unit_surface_normal) const;
+        std::optional<Ray> ShadeIntersection(
+            const Scene& scene,
+            const RayObjectIntersection& intersection,
+            const MATH::Vector3f& intersection_point,
+            const MATH::Vector3f& unit_surface_normal,
+            const unsigned int remaining_reflection_count,
+            float& contribution,
+            GRAPHICS::Color& color) const;
+        GRAPHICS::Color ComputeSurfaceColor(
+            const Scene& scene,
+            const RayObjectIntersection& intersection,
+            const MATH::Vector3f& intersection_point,
+            const MATH::Vector3f& unit_surface_normal) const;
+        GRAPHICS::Color ComputeIndirectDiffuseColor(
             const Scene& scene,
             const RayObjectIntersection& intersection,
-            const unsigned int remaining_reflection_count) const;
+            const MATH::Vector3f& intersection_point,
+            const MATH::Vector3f& unit_surface_normal) const;
+        GRAPHICS::Color ComputeIrradiance(
+            const Scene& scene,
+            const RayObjectIntersection& intersection,
+            const MATH::Vector3f& intersection_point,
+            const MATH::Vector3f& unit_surface_normal,
+            float& validity_radius) const;
+        bool ComputeLightProportions(
+            const Scene& scene,
+            const RayObjectIntersection& intersection,
+            const MATH::Vector3f& intersection_point,
+            const MATH::Vector3f& unit_surface_normal,
+            const MATH::Vector3f& normalized_ray_from_intersection_to_eye,
+            const Light& light,
+            float& diffuse_proportion,
+            float& specular_proportion) const;
         std::optional<RayObjectIntersection> ComputeClosestIntersection(
             const Scene& scene,
             const Ray& ray,
-            const IObject3D* const ignored_object = nullptr) const;
+            const IObject3D* const ignored_object = nullptr,
+            const std::vector<const IObject3D*>* const candidate_objects = nullptr) const;
+        std::size_t* TraversalStepCounter() const;
+
+        // MEMBER VARIABLES.
+        /// The width and height of the blocks of pixels being filled by the current progressive rendering pass.
+        /// Zero once progressive rendering has completed.
+        unsigned int ProgressiveBlockSizeInPixels = 0;
+        /// The index (in row-major order) of the next block to render within the current progressive rendering pass.
+        unsigned int NextProgressiveBlockIndex = 0;
+        /// The tiles still waiting to be rendered for the current timed render.
+        /// Sorted with the highest priority tile last so that it can be cheaply removed.
+        std::vector<ScreenTile> PendingTiles = {};
+        /// The total number of tiles in the current timed render.
+        std::size_t TimedRenderTileCount = 0;
+        /// How much the pixels in each tile changed the last time the tile was rendered (indexed by tile).
+        /// Persists across timed renders to prioritize regions that are changing.
+        std::vector<float> ChangeAmountsByTileIndex = {};
+        /// The primary hits from the last render, if \ref CachePrimaryHits is enabled.
+        GeometryBuffer PrimaryHitCache = GeometryBuffer();
+        /// The counts to update for the work currently being done.  Null if statistics aren't being collected.
+        RayTracingStatistics::Counts* CurrentStatisticsCounts = nullptr;
     };
 }
 }
@@ -0,0 +1,204 @@
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include "Graphics/RayTracing/RayTracingStatistics.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// Adds other counts to these counts.
+    /// @param[in]  rhs - The counts to add.
+    /// @return These counts, after being updated.
+    RayTracingStatistics::Counts& RayTracingStatistics::Counts::operator+=(const Counts& rhs)
+    {
+        PrimaryRayCount += rhs.PrimaryRayCount;
+        ShadowRayCount += rhs.ShadowRayCount;
+        ReflectionRayCount += rhs.ReflectionRayCount;
+        for (std::size_t type_index = 0; type_index < IntersectionTestCountsByObjectType.size(); ++type_index)
+        {
+            IntersectionTestCountsByObjectType[type_index] += rhs.IntersectionTestCountsByObjectType[type_index];
+        }
+        TraversalStepCount += rhs.TraversalStepCount;
+        Time += rhs.Time;
+        return *this;
+    }
+
+    /// Counts a single ray-object intersection test.
+    /// @param[in]  object_type - The type of object tested.
+    void RayTracingStatistics::Counts::CountIntersectionTest(const ObjectType object_type)
+    {
+        ++IntersectionTestCountsByObjectType[static_cast<std::size_t>(object_type)];
+    }
+
+    /// Gets the total number of rays of any kind.
+    /// @return The total number of rays traced.
+    std::size_t RayTracingStatistics::Counts::RayCount() const
+    {
+        std::size_t ray_count = PrimaryRayCount + ShadowRayCount + ReflectionRayCount;
+        return ray_count;
+    }
+
+    /// Gets the total number of intersection tests for all types of objects.
+    /// @return The total number of intersection tests.
+    std::size_t RayTracingStatistics::Counts::IntersectionTestCount() const
+    {
+        std::size_t intersection_test_count = std::accumulate(
+            IntersectionTestCountsByObjectType.cbegin(),
+            IntersectionTestCountsByObjectType.cend(),
+            static_cast<std::size_t>(0));
+        return intersection_test_count;
+    }
+
+    /// Gets the value of a single metric.
+    /// @param[in]  metric - The metric to get.
+    /// @return The value of the metric (in nanoseconds for time).
+    float RayTracingStatistics::Counts::Value(const Metric metric) const
+    {
+        switch (metric)
+        {
+            case Metric::RAYS:
+                return static_cast<float>(RayCount());
+            case Metric::INTERSECTION_TESTS:
+                return static_cast<float>(IntersectionTestCount());
+            case Metric::TRAVERSAL_STEPS:
+                return static_cast<float>(TraversalStepCount);
+            case Metric::TIME:
+                return static_cast<float>(Time.count());
+            default:
+                return 0.0f;
+        }
+    }
+
+    /// Gets the name of a type of object, as used in JSON output.
+    /// @param[in]  object_type - The type of object.
+    /// @return The name of the object type.
+    const char* RayTracingStatistics::ObjectTypeName(const ObjectType object_type)
+    {
+        switch (object_type)
+        {
+            case ObjectType::SPHERE:
+                return "sphere";
+            case ObjectType::PLANE:
+                return "plane";
+            case ObjectType::DISC:
+                return "disc";
+            case ObjectType::AXIS_ALIGNED_BOX:
+                return "axis_aligned_box";
+            case ObjectType::MESH_INSTANCE:
+                return "mesh_instance";
+            case ObjectType::OTHER:
+            default:
+                return "other";
+        }
+    }
+
+    /// Clears all counts in preparation for a new frame.
+    /// @param[in]  per_pixel - True if counts should be collected for each pixel; false for only the entire frame.
+    /// @param[in]  width_in_pixels - The width of the frame.
+    /// @param[in]  height_in_pixels - The height of the frame.
+    void RayTracingStatistics::Reset(const bool per_pixel, const unsigned int width_in_pixels, const unsigned int height_in_pixels)
+    {
+        Frame = Counts();
+        if (per_pixel)
+        {
+            Pixels = CONTAINERS::Array2D<Counts>(width_in_pixels, height_in_pixels);
+        }
+        else
+        {
+            Pixels = CONTAINERS::Array2D<Counts>();
+        }
+    }
+
+    /// Converts the frame's counts to JSON.  Per-pixel counts aren't included since they're better viewed as a heatmap.
+    /// @return A JSON object containing the frame's counts.
+    std::string RayTracingStatistics::ToJson() const
+    {
+        std::string json = "{\"frame\":" + CountsToJson(Frame);
+        bool per_pixel_counts_collected = (Pixels.GetWidth() > 0);
+        json += ",\"per_pixel\":" + std::string(per_pixel_counts_collected ? "true" : "false");
+        json += "}";
+        return json;
+    }
+
+    /// Writes a false-color heatmap of a metric for each pixel, with colors ranging from blue for the
+    /// lowest cost through cyan, green, and yellow to red for the highest cost pixel.  The render target
+    /// is left unchanged if per-pixel statistics weren't collected.
+    /// @param[in]  metric - The metric to visualize.
+    /// @param[out]  render_target - The render target to write the heatmap to.  Only pixels within
+    ///     both the render target and the collected statistics are written.
+    void RayTracingStatistics::WriteHeatmap(const Metric metric, GRAPHICS::RenderTarget& render_target) const
+    {
+        // FIND THE HIGHEST VALUE TO NORMALIZE AGAINST.
+        unsigned int width_in_pixels = std::min(Pixels.GetWidth(), render_target.GetWidthInPixels());
+        unsigned int height_in_pixels = std::min(Pixels.GetHeight(), render_target.GetHeightInPixels());
+        float max_value = 0.0f;
+        for (unsigned int y = 0; y < height_in_pixels; ++y)
+        {
+            for (unsigned int x = 0; x < width_in_pixels; ++x)
+            {
+                max_value = std::max(max_value, Pixels(x, y).Value(metric));
+            }
+        }
+
+        // COLOR EACH PIXEL BASED ON ITS PROPORTION OF THE HIGHEST VALUE.
+        for (unsigned int y = 0; y < height_in_pixels; ++y)
+        {
+            for (unsigned int x = 0; x < width_in_pixels; ++x)
+            {
+                float proportion = (max_value > 0.0f) ? (Pixels(x, y).Value(metric) / max_value) : 0.0f;
+                Color color = HeatmapColor(proportion);
+                render_target.WritePixel(x, y, color);
+            }
+        }
+    }
+
+    /// Converts counts to JSON.
+    /// @param[in]  counts - The counts to convert.
+    /// @return A JSON object containing the counts.
+    std::string RayTracingStatistics::CountsToJson(const Counts& counts)
+    {
+        std::string json = "{";
+        json += "\"primary_ray_count\":" + std::to_string(counts.PrimaryRayCount);
+        json += ",\"shadow_ray_count\":" + std::to_string(counts.ShadowRayCount);
+        json += ",\"reflection_ray_count\":" + std::to_string(counts.ReflectionRayCount);
+        json += ",\"intersection_test_counts\":{";
+        for (std::size_t type_index = 0; type_index < counts.IntersectionTestCountsByObjectType.size(); ++type_index)
+        {
+            if (type_index > 0)
+            {
+                json += ",";
+            }
+            ObjectType object_type = static_cast<ObjectType>(type_index);
+            json += "\"" + std::string(ObjectTypeName(object_type)) + "\":" + std::to_string(counts.IntersectionTestCountsByObjectType[type_index]);
+        }
+        json += "}";
+        json += ",\"traversal_step_count\":" + std::to_string(counts.TraversalStepCount);
+        json += ",\"time_in_nanoseconds\":" + std::to_string(counts.Time.count());
+        json += "}";
+        return json;
+    }
+
+    /// Computes the false color for a value in a heatmap.
+    /// @param[in]  proportion - The value as a proportion [0, 1] of the highest value.
+    /// @return The color for the value, ranging through blue, cyan, green, yellow, and red.
+    GRAPHICS::Color RayTracingStatistics::HeatmapColor(const float proportion)
+    {
+        // INTERPOLATE BETWEEN THE TWO NEAREST COLORS IN THE RAMP.
+        const Color RAMP_COLORS[] =
+        {
+            Color(0.0f, 0.0f, 1.0f, 1.0f),
+            Color(0.0f, 1.0f, 1.0f, 1.0f),
+            Color(0.0f, 1.0f, 0.0f, 1.0f),
+            Color(1.0f, 1.0f, 0.0f, 1.0f),
+            Color(1.0f, 0.0f, 0.0f, 1.0f),
+        };
+        constexpr std::size_t LAST_RAMP_COLOR_INDEX = std::size(RAMP_COLORS) - 1;
+        float ramp_position = std::clamp(proportion, 0.0f, 1.0f) * static_cast<float>(LAST_RAMP_COLOR_INDEX);
+        std::size_t start_color_index = std::min(static_cast<std::size_t>(ramp_position), LAST_RAMP_COLOR_INDEX - 1);
+        float ratio_toward_end = ramp_position - static_cast<float>(start_color_index);
+        Color color = Color::InterpolateRedGreenBlue(RAMP_COLORS[start_color_index], RAMP_COLORS[start_color_index + 1], ratio_toward_end);
+        return color;
+    }
+}
+}
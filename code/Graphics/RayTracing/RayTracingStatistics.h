@@ -0,0 +1,85 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include "Containers/Array2D.h"
+#include "Graphics/RayTracing/ObjectType.h"
+#include "Graphics/RenderTarget.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// Counts of the work done while ray tracing a frame (and optionally each pixel), for finding out
+    /// why a scene renders slowly - such as which kinds of objects are tested most often or how well
+    /// an acceleration structure avoids unnecessary intersection tests.
+    class RayTracingStatistics
+    {
+    public:
+        /// The different measurements that can be visualized in a heatmap.
+        enum class Metric
+        {
+            /// The total number of rays traced (primary, shadow, and reflection).
+            RAYS = 0,
+            /// The total number of ray-object intersection tests.
+            INTERSECTION_TESTS,
+            /// The number of steps through the scene's acceleration structure.
+            TRAVERSAL_STEPS,
+            /// The time spent.
+            TIME
+        };
+
+        /// Counts of the work done for a single pixel or an entire frame.
+        class Counts
+        {
+        public:
+            // OPERATORS.
+            Counts& operator+=(const Counts& rhs);
+
+            // COUNTING.
+            void CountIntersectionTest(const ObjectType object_type);
+            std::size_t RayCount() const;
+            std::size_t IntersectionTestCount() const;
+            float Value(const Metric metric) const;
+
+            // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+            /// The number of rays traced from the camera (including extra antialiasing samples).
+            std::size_t PrimaryRayCount = 0;
+            /// The number of rays traced towards lights to check for shadows.
+            std::size_t ShadowRayCount = 0;
+            /// The number of rays traced for reflections.
+            std::size_t ReflectionRayCount = 0;
+            /// The number of ray-object intersection tests (for both closest hits and shadows), indexed by object type.
+            std::array<std::size_t, static_cast<std::size_t>(ObjectType::COUNT)> IntersectionTestCountsByObjectType = {};
+            /// The number of nodes or cells visited in the scene's acceleration structure.
+            /// Always zero for scenes without an acceleration structure.
+            std::size_t TraversalStepCount = 0;
+            /// The time spent.
+            std::chrono::nanoseconds Time = std::chrono::nanoseconds::zero();
+        };
+
+        // STATIC METHODS.
+        static const char* ObjectTypeName(const ObjectType object_type);
+
+        // RESETTING.
+        void Reset(const bool per_pixel, const unsigned int width_in_pixels, const unsigned int height_in_pixels);
+
+        // OUTPUT.
+        std::string ToJson() const;
+        void WriteHeatmap(const Metric metric, GRAPHICS::RenderTarget& render_target) const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The counts for the entire frame.
+        Counts Frame = Counts();
+        /// The counts for each pixel, if collected.  Empty otherwise.
+        CONTAINERS::Array2D<Counts> Pixels = CONTAINERS::Array2D<Counts>();
+
+    private:
+        // PRIVATE HELPER METHODS.
+        static std::string CountsToJson(const Counts& counts);
+        static GRAPHICS::Color HeatmapColor(const float proportion);
+    };
+}
+}
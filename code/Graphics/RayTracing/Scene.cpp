@@ -0,0 +1,255 @@
+#include <chrono>
+#include "Graphics/RayTracing/Scene.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// Builds the acceleration structure over all objects currently in the scene.
+    /// Should be called after all objects have been added to the scene
+    /// (and again after any objects are added or removed) to speed up ray tracing.
+    /// Any background rebuild in progress is waited on and discarded since it would be stale.
+    void Scene::BuildAccelerationStructure()
+    {
+        // DISCARD ANY PENDING REBUILD.
+        RebuiltObjectHierarchy = {};
+        MovedObjectIndices.clear();
+
+        // GET THE BOUNDS OF ALL OBJECTS.
+        ObjectBounds.clear();
+        ObjectBounds.reserve(Objects.size());
+        for (const auto& object : Objects)
+        {
+            ObjectBounds.push_back(object->Bounds());
+        }
+
+        // BUILD THE APPROPRIATE STRUCTURE.
+        // Without any motion yet, a hierarchy is preferred unless a grid was explicitly requested.
+        BuiltAccelerationStructure = (AccelerationStructureType::UNIFORM_GRID == AccelerationStructure) ?
+            AccelerationStructureType::UNIFORM_GRID :
+            AccelerationStructureType::BOUNDING_VOLUME_HIERARCHY;
+        BuildCurrentAccelerationStructure();
+    }
+
+    /// Records that an object has moved (or otherwise changed shape) so that the acceleration structure
+    /// can be updated for it by the next call to \ref UpdateAccelerationStructure.
+    /// The geometry version of the scene is also incremented.
+    /// @param[in]  object_index - The index of the moved object in the scene's objects.
+    void Scene::MarkObjectMoved(const std::size_t object_index)
+    {
+        bool object_exists = (object_index < Objects.size());
+        if (!object_exists)
+        {
+            return;
+        }
+
+        MovedObjectIndices.push_back(object_index);
+        ++GeometryVersion;
+    }
+
+    /// Updates the acceleration structure for any objects moved since the last update.
+    ///
+    /// A hierarchy is refit for the new object bounds, and if that degrades its estimated cost past
+    /// \ref RebuildCostRatioThreshold, a full rebuild is started on a background thread.  The rebuilt
+    /// hierarchy is swapped in by whichever update first finds it finished, so this should be called
+    /// regularly (like once per frame) for animated scenes.  Objects remain traceable throughout since
+    /// the refit hierarchy is always kept up-to-date with the current object bounds.
+    ///
+    /// A grid is simply rebuilt.  If the acceleration structure is chosen automatically, this may also
+    /// switch between a hierarchy and a grid based on how many objects moved.
+    void Scene::UpdateAccelerationStructure()
+    {
+        // REBUILD IMMEDIATELY IF OBJECTS HAVE BEEN ADDED OR REMOVED.
+        // Updating can only handle objects that were already in the acceleration structure.
+        bool object_count_changed = (ObjectBounds.size() != Objects.size());
+        if (!AccelerationStructureIsCurrent() || object_count_changed)
+        {
+            BuildAccelerationStructure();
+            return;
+        }
+
+        // REBUILD FROM SCRATCH IF A DIFFERENT TYPE OF STRUCTURE IS NOW PREFERRED.
+        AccelerationStructureType preferred_acceleration_structure = PreferredAccelerationStructure();
+        if (preferred_acceleration_structure != BuiltAccelerationStructure)
+        {
+            RebuiltObjectHierarchy = {};
+            UpdateMovedObjectBounds();
+            BuiltAccelerationStructure = preferred_acceleration_structure;
+            BuildCurrentAccelerationStructure();
+            return;
+        }
+
+        // REBUILD A GRID FROM SCRATCH SINCE THAT'S CHEAP.
+        bool objects_moved = !MovedObjectIndices.empty();
+        if (AccelerationStructureType::UNIFORM_GRID == BuiltAccelerationStructure)
+        {
+            if (objects_moved)
+            {
+                UpdateMovedObjectBounds();
+                ObjectGrid.Build(ObjectBounds);
+            }
+            return;
+        }
+
+        // USE ANY FINISHED BACKGROUND REBUILD.
+        bool hierarchy_rebuilt = SwapInRebuiltHierarchy();
+        if (!objects_moved && !hierarchy_rebuilt)
+        {
+            return;
+        }
+
+        // REFIT THE HIERARCHY FOR THE NEW BOUNDS.
+        // A rebuilt hierarchy is also refit since objects may have moved while it was being built.
+        UpdateMovedObjectBounds();
+        ObjectHierarchy.Refit(ObjectBounds);
+        if (hierarchy_rebuilt)
+        {
+            BuiltObjectHierarchyCost = ObjectHierarchy.SurfaceAreaHeuristicCost();
+            return;
+        }
+
+        // START A BACKGROUND REBUILD IF REFITTING HAS DEGRADED THE HIERARCHY TOO MUCH.
+        // Only one rebuild runs at a time, and the rebuild works on its own copy of the object bounds.
+        float refit_cost = ObjectHierarchy.SurfaceAreaHeuristicCost();
+        bool hierarchy_degraded = (refit_cost > BuiltObjectHierarchyCost * RebuildCostRatioThreshold);
+        if (hierarchy_degraded && !AccelerationStructureRebuildPending())
+        {
+            RebuiltObjectHierarchy = std::async(std::launch::async, [object_bounds = ObjectBounds]()
+            {
+                BoundingVolumeHierarchy rebuilt_hierarchy;
+                rebuilt_hierarchy.Build(object_bounds);
+                return rebuilt_hierarchy;
+            });
+        }
+    }
+
+    /// Determines if the acceleration structure covers all objects currently in the scene.
+    /// This can only detect objects being added or removed, not objects being moved.
+    /// @return True if the acceleration structure can be used for ray tracing; false otherwise.
+    bool Scene::AccelerationStructureIsCurrent() const
+    {
+        // CHECK IF THE STRUCTURE WAS BUILT FOR THE CURRENT OBJECTS.
+        bool built_for_current_objects = (BuiltAccelerationStructureObjectCount == Objects.size());
+        if (!built_for_current_objects)
+        {
+            return false;
+        }
+
+        // CHECK IF THE STRUCTURE ITSELF COVERS ALL OBJECTS.
+        if (AccelerationStructureType::UNIFORM_GRID == BuiltAccelerationStructure)
+        {
+            bool grid_covers_all_objects = (ObjectGrid.PrimitiveCount() == Objects.size());
+            return grid_covers_all_objects;
+        }
+
+        bool hierarchy_covers_all_objects = (ObjectHierarchy.PrimitiveCount() == Objects.size());
+        return hierarchy_covers_all_objects;
+    }
+
+    /// Determines if a full rebuild of the hierarchy is in progress (or finished but not yet swapped in).
+    /// @return True if a rebuild is pending; false otherwise.
+    bool Scene::AccelerationStructureRebuildPending() const
+    {
+        bool rebuild_pending = RebuiltObjectHierarchy.valid();
+        return rebuild_pending;
+    }
+
+    /// Gets the type of acceleration structure currently built over objects in the scene.
+    /// @return The type of the current acceleration structure.  Never automatic.
+    AccelerationStructureType Scene::CurrentAccelerationStructure() const
+    {
+        return BuiltAccelerationStructure;
+    }
+
+    /// Builds the distribution over point lights, replacing any previous distribution.
+    /// Must be called again whenever point lights are added, removed, or change color.
+    void Scene::BuildLightDistribution()
+    {
+        PointLightDistribution.Build(PointLights);
+    }
+
+    /// Determines if the light distribution covers all point lights currently in the scene.
+    /// This can only detect lights being added or removed, not lights being changed.
+    /// @return True if the light distribution can be used for sampling lights; false otherwise.
+    bool Scene::LightDistributionIsCurrent() const
+    {
+        bool distribution_covers_all_lights = (PointLightDistribution.LightCount() == PointLights.size());
+        return distribution_covers_all_lights;
+    }
+
+    /// Determines which type of acceleration structure is best for the pending updates to the scene.
+    /// @return The preferred type of acceleration structure.  Never automatic.
+    AccelerationStructureType Scene::PreferredAccelerationStructure() const
+    {
+        // USE ANY EXPLICITLY REQUESTED STRUCTURE.
+        if (AccelerationStructureType::AUTOMATIC != AccelerationStructure)
+        {
+            return AccelerationStructure;
+        }
+
+        // KEEP THE CURRENT STRUCTURE IF NOTHING HAS MOVED.
+        if (MovedObjectIndices.empty())
+        {
+            return BuiltAccelerationStructure;
+        }
+
+        // PREFER A GRID IF MOST OF MANY OBJECTS ARE MOVING.
+        bool many_objects = (Objects.size() >= MIN_OBJECT_COUNT_FOR_AUTOMATIC_GRID);
+        float moved_object_proportion = static_cast<float>(MovedObjectIndices.size()) / static_cast<float>(Objects.size());
+        bool most_objects_moved = (moved_object_proportion >= MIN_MOVED_OBJECT_PROPORTION_FOR_AUTOMATIC_GRID);
+        AccelerationStructureType preferred_acceleration_structure = (many_objects && most_objects_moved) ?
+            AccelerationStructureType::UNIFORM_GRID :
+            AccelerationStructureType::BOUNDING_VOLUME_HIERARCHY;
+        return preferred_acceleration_structure;
+    }
+
+    /// Builds the current type of acceleration structure from the current object bounds,
+    /// clearing the other type of structure so that it doesn't waste memory.
+    void Scene::BuildCurrentAccelerationStructure()
+    {
+        if (AccelerationStructureType::UNIFORM_GRID == BuiltAccelerationStructure)
+        {
+            ObjectGrid.Build(ObjectBounds);
+            ObjectHierarchy = BoundingVolumeHierarchy();
+        }
+        else
+        {
+            ObjectHierarchy.Build(ObjectBounds);
+            BuiltObjectHierarchyCost = ObjectHierarchy.SurfaceAreaHeuristicCost();
+            ObjectGrid = UniformGrid();
+        }
+        BuiltAccelerationStructureObjectCount = ObjectBounds.size();
+    }
+
+    /// Updates the bounds of all objects that have moved since the last update.
+    void Scene::UpdateMovedObjectBounds()
+    {
+        for (std::size_t object_index : MovedObjectIndices)
+        {
+            ObjectBounds[object_index] = Objects[object_index]->Bounds();
+        }
+        MovedObjectIndices.clear();
+    }
+
+    /// Replaces the current hierarchy with one rebuilt in the background, if the rebuild has finished.
+    /// @return True if the hierarchy was replaced; false otherwise.
+    bool Scene::SwapInRebuiltHierarchy()
+    {
+        // CHECK IF A REBUILD HAS FINISHED.
+        if (!AccelerationStructureRebuildPending())
+        {
+            return false;
+        }
+        constexpr std::chrono::seconds NO_WAITING(0);
+        bool rebuild_finished = (std::future_status::ready == RebuiltObjectHierarchy.wait_for(NO_WAITING));
+        if (!rebuild_finished)
+        {
+            return false;
+        }
+
+        // SWAP IN THE REBUILT HIERARCHY.
+        ObjectHierarchy = RebuiltObjectHierarchy.get();
+        return true;
+    }
+}
+}
@@ -1,9 +1,19 @@
 #pragma once
 
+#include <cstddef>
+#include <future>
 #include <memory>
+#include <optional>
 #include <vector>
 #include "Graphics/Color.h"
+#include "Graphics/RayTracing/AccelerationStructureType.h"
+#include "Graphics/RayTracing/AxisAlignedBoundingBox.h"
+#include "Graphics/RayTracing/BoundingVolumeHierarchy.h"
+#include "Graphics/RayTracing/Frustum.h"
 #include "Graphics/RayTracing/IObject3D.h"
+#include "Graphics/RayTracing/LightDistribution.h"
+#include "Graphics/RayTracing/Ray.h"
+#include "Graphics/RayTracing/UniformGrid.h"
 #include "Graphics/Light.h"
 
 namespace GRAPHICS
@@ -11,9 +21,42 @@ namespace GRAPHICS
 namespace RAY_TRACING
 {
     /// A scene consisting of objects within a 3D space.
+    ///
+    /// For animated scenes, moved objects should be reported via \ref MarkObjectMoved, followed by
+    /// a call to \ref UpdateAccelerationStructure before the next render.  With a hierarchy, small motions
+    /// are handled by cheaply refitting it, and once refitting has degraded the hierarchy too much,
+    /// a full rebuild is performed on a background thread and swapped in by a later update.
+    /// With a grid, the grid is simply rebuilt since that's cheap enough to do every update.
+    /// The scene must not be modified or updated while it is being rendered.
     class Scene
     {
     public:
+        // STATIC CONSTANTS.
+        /// The minimum number of objects for a grid to be automatically chosen.
+        /// Hierarchies are cheap enough to update for fewer objects.
+        static constexpr std::size_t MIN_OBJECT_COUNT_FOR_AUTOMATIC_GRID = 256;
+        /// The minimum proportion of objects that must move in a single update for a grid to be automatically chosen.
+        static constexpr float MIN_MOVED_OBJECT_PROPORTION_FOR_AUTOMATIC_GRID = 0.5f;
+
+        // ACCELERATION.
+        void BuildAccelerationStructure();
+        void MarkObjectMoved(const std::size_t object_index);
+        void UpdateAccelerationStructure();
+        bool AccelerationStructureIsCurrent() const;
+        bool AccelerationStructureRebuildPending() const;
+        AccelerationStructureType CurrentAccelerationStructure() const;
+        template <typename ObjectVisitor>
+        void VisitObjects(
+            const Ray& ray,
+            const float& max_distance,
+            ObjectVisitor&& visit_object,
+            std::size_t* const traversal_step_count = nullptr) const;
+        template <typename ObjectVisitor>
+        void VisitObjectsInFrustum(const Frustum& frustum, ObjectVisitor&& visit_object) const;
+
+        // LIGHTING.
+        void BuildLightDistribution();
+        bool LightDistributionIsCurrent() const;
 
         // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
         /// The background color of the scene.
@@ -22,6 +65,123 @@ namespace RAY_TRACING
         std::vector< std::unique_ptr<IObject3D> > Objects = {};
         /// All point lights in the scene.
         std::vector<Light> PointLights = {};
+        /// A version number for the geometry of the scene.  Should be incremented whenever
+        /// objects are moved or changed in a way that affects their visibility (lights and
+        /// material colors don't count) so that any cached visibility can be invalidated.
+        unsigned int GeometryVersion = 0;
+        /// A hierarchy over all objects in the scene (a "top-level" hierarchy).
+        /// Only built on request via \ref BuildAccelerationStructure and only updated for
+        /// moved objects via \ref UpdateAccelerationStructure.
+        BoundingVolumeHierarchy ObjectHierarchy = BoundingVolumeHierarchy();
+        /// A grid over all objects in the scene, used instead of the hierarchy when chosen by \ref AccelerationStructure.
+        UniformGrid ObjectGrid = UniformGrid();
+        /// A distribution over all point lights in the scene, for sampling lights in scenes with many lights.
+        /// Only built on request via \ref BuildLightDistribution, so it must be rebuilt whenever point lights change.
+        LightDistribution PointLightDistribution = LightDistribution();
+        /// The type of structure to build over objects in the scene.
+        AccelerationStructureType AccelerationStructure = AccelerationStructureType::AUTOMATIC;
+        /// How much the surface area heuristic cost of the refit hierarchy may grow (relative
+        /// to its cost when last built) before a full rebuild is scheduled in the background.
+        float RebuildCostRatioThreshold = 1.5f;
+
+    private:
+        // PRIVATE HELPER METHODS.
+        AccelerationStructureType PreferredAccelerationStructure() const;
+        void BuildCurrentAccelerationStructure();
+        void UpdateMovedObjectBounds();
+        bool SwapInRebuiltHierarchy();
+
+        // MEMBER VARIABLES.
+        /// The type of structure currently built over objects in the scene.  Never automatic.
+        AccelerationStructureType BuiltAccelerationStructure = AccelerationStructureType::BOUNDING_VOLUME_HIERARCHY;
+        /// The number of objects the acceleration structure was last built for; empty if never built.
+        /// Tracked separately since a structure over only unbounded objects (like planes) has no nodes or cells.
+        std::optional<std::size_t> BuiltAccelerationStructureObjectCount = std::nullopt;
+        /// The bounds of each object as of the last hierarchy update.
+        std::vector<AxisAlignedBoundingBox> ObjectBounds = {};
+        /// Indices of objects that have moved since the last hierarchy update.
+        std::vector<std::size_t> MovedObjectIndices = {};
+        /// The surface area heuristic cost of the hierarchy when it was last built.
+        float BuiltObjectHierarchyCost = 0.0f;
+        /// A hierarchy being rebuilt on a background thread; only valid while a rebuild is pending.
+        std::future<BoundingVolumeHierarchy> RebuiltObjectHierarchy = {};
     };
+
+    /// Visits all objects that a ray may hit, using the current acceleration structure if available.
+    /// @tparam ObjectVisitor - A callable type taking a const IObject3D reference and returning a bool.
+    /// @param[in]  ray - The ray to check for intersection.
+    /// @param[in]  max_distance - The maximum distance (in units of the ray) at which intersections count.
+    ///     Passed by reference so that visitors searching for the closest intersection can shrink it
+    ///     as closer intersections are found, allowing more objects to be skipped.
+    /// @param[in]  visit_object - The visitor to call for each object.  Objects may be visited more than once.
+    ///     Returning true stops visiting objects early (useful when any intersection is sufficient).
+    /// @param[in,out]  traversal_step_count - If provided, incremented for each step through the acceleration
+    ///     structure (hierarchy nodes or grid cells) for statistics.  Not incremented without an acceleration structure.
+    template <typename ObjectVisitor>
+    void Scene::VisitObjects(
+        const Ray& ray,
+        const float& max_distance,
+        ObjectVisitor&& visit_object,
+        std::size_t* const traversal_step_count) const
+    {
+        // USE THE ACCELERATION STRUCTURE IF AVAILABLE.
+        // This allows skipping objects the ray cannot possibly hit.
+        if (AccelerationStructureIsCurrent())
+        {
+            auto visit_object_index = [&](const std::size_t object_index)
+            {
+                return visit_object(*Objects[object_index]);
+            };
+            if (AccelerationStructureType::UNIFORM_GRID == BuiltAccelerationStructure)
+            {
+                ObjectGrid.VisitPrimitives(ray, max_distance, visit_object_index, traversal_step_count);
+            }
+            else
+            {
+                ObjectHierarchy.VisitPrimitives(ray, max_distance, visit_object_index, traversal_step_count);
+            }
+            return;
+        }
+
+        // VISIT ALL OBJECTS IF NO ACCELERATION STRUCTURE IS AVAILABLE.
+        for (const auto& object : Objects)
+        {
+            bool stop_visiting = visit_object(*object);
+            if (stop_visiting)
+            {
+                return;
+            }
+        }
+    }
+
+    /// Visits all objects whose bounds may overlap a frustum, such as to find the objects any viewing ray
+    /// for a screen tile may hit.  The hierarchy is used to skip groups of objects if available;
+    /// otherwise each object's bounds are checked.
+    /// @tparam ObjectVisitor - A callable type taking a const IObject3D reference.
+    /// @param[in]  frustum - The frustum to find objects within.
+    /// @param[in]  visit_object - The visitor to call for each object.  Each object is visited at most once.
+    template <typename ObjectVisitor>
+    void Scene::VisitObjectsInFrustum(const Frustum& frustum, ObjectVisitor&& visit_object) const
+    {
+        // USE THE HIERARCHY IF AVAILABLE.
+        bool hierarchy_available = (AccelerationStructureIsCurrent() && (AccelerationStructureType::BOUNDING_VOLUME_HIERARCHY == BuiltAccelerationStructure));
+        if (hierarchy_available)
+        {
+            ObjectHierarchy.VisitOverlappingPrimitives(
+                [&frustum](const AxisAlignedBoundingBox& bounds) { return frustum.Intersects(bounds); },
+                [&](const std::size_t object_index) { visit_object(*Objects[object_index]); });
+            return;
+        }
+
+        // CHECK EACH OBJECT'S BOUNDS OTHERWISE.
+        // Grid cells aren't used since they're only a coarse subdivision of the same bounds.
+        for (const auto& object : Objects)
+        {
+            if (frustum.Intersects(object->Bounds()))
+            {
+                visit_object(*object);
+            }
+        }
+    }
 }
 }
@@ -0,0 +1,55 @@
+#include <algorithm>
+#include "Graphics/RayTracing/ScreenTile.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// Partitions a screen into tiles covering all pixels.
+    /// Tiles along the right and bottom edges may be smaller if the screen
+    /// dimensions aren't multiples of the tile dimension.
+    /// @param[in]  screen_width_in_pixels - The width of the screen.
+    /// @param[in]  screen_height_in_pixels - The height of the screen.
+    /// @param[in]  tile_dimension_in_pixels - The width and height of the tiles.
+    /// @return The tiles covering the screen, in row-major order.
+    std::vector<ScreenTile> ScreenTile::Partition(
+        const unsigned int screen_width_in_pixels,
+        const unsigned int screen_height_in_pixels,
+        const unsigned int tile_dimension_in_pixels)
+    {
+        std::vector<ScreenTile> tiles;
+        for (unsigned int top_y = 0; top_y < screen_height_in_pixels; top_y += tile_dimension_in_pixels)
+        {
+            for (unsigned int left_x = 0; left_x < screen_width_in_pixels; left_x += tile_dimension_in_pixels)
+            {
+                ScreenTile tile;
+                tile.Index = tiles.size();
+                tile.LeftX = left_x;
+                tile.TopY = top_y;
+                tile.WidthInPixels = std::min(tile_dimension_in_pixels, screen_width_in_pixels - left_x);
+                tile.HeightInPixels = std::min(tile_dimension_in_pixels, screen_height_in_pixels - top_y);
+                tiles.push_back(tile);
+            }
+        }
+        return tiles;
+    }
+
+    /// Gets the number of pixels in the tile.
+    /// @return The number of pixels in the tile.
+    unsigned int ScreenTile::PixelCount() const
+    {
+        unsigned int pixel_count = WidthInPixels * HeightInPixels;
+        return pixel_count;
+    }
+
+    /// Computes the center of the tile in screen coordinates.
+    /// @return The center of the tile.
+    MATH::Vector2f ScreenTile::Center() const
+    {
+        MATH::Vector2f center(
+            static_cast<float>(LeftX) + (static_cast<float>(WidthInPixels) / 2.0f),
+            static_cast<float>(TopY) + (static_cast<float>(HeightInPixels) / 2.0f));
+        return center;
+    }
+}
+}
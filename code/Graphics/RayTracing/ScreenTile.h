@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "Math/Vector2.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// A rectangular region of pixels on the screen, allowing the screen to be rendered in smaller pieces.
+    class ScreenTile
+    {
+    public:
+        // STATIC CONSTANTS.
+        /// The default width and height of tiles.  Small enough to allow fine-grained scheduling
+        /// but large enough that per-tile overhead is negligible.
+        static constexpr unsigned int DEFAULT_DIMENSION_IN_PIXELS = 16;
+
+        // CONSTRUCTION.
+        static std::vector<ScreenTile> Partition(
+            const unsigned int screen_width_in_pixels,
+            const unsigned int screen_height_in_pixels,
+            const unsigned int tile_dimension_in_pixels = DEFAULT_DIMENSION_IN_PIXELS);
+
+        // OTHER METHODS.
+        unsigned int PixelCount() const;
+        MATH::Vector2f Center() const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The index of the tile within the partitioning of the screen (in row-major order).
+        std::size_t Index = 0;
+        /// The x coordinate of the left column of pixels in the tile.
+        unsigned int LeftX = 0;
+        /// The y coordinate of the top row of pixels in the tile.
+        unsigned int TopY = 0;
+        /// The width of the tile in pixels.
+        unsigned int WidthInPixels = 0;
+        /// The height of the tile in pixels.
+        unsigned int HeightInPixels = 0;
+    };
+}
+}
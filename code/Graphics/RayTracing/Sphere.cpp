@@ -153,5 +153,23 @@ namespace RAY_TRACING
         // INDICATE THAT NO INTERSECTION OCCURRED.
         return std::nullopt;
     }
+
+    /// Computes the world-space bounds of the sphere.
+    /// @return A box containing the entire sphere.
+    AxisAlignedBoundingBox Sphere::Bounds() const
+    {
+        MATH::Vector3f radius_along_each_axis(Radius, Radius, Radius);
+        AxisAlignedBoundingBox bounds(
+            CenterPosition - radius_along_each_axis,
+            CenterPosition + radius_along_each_axis);
+        return bounds;
+    }
+
+    /// Gets the kind of object, for reporting statistics.
+    /// @return \ref ObjectType::SPHERE.
+    ObjectType Sphere::Type() const
+    {
+        return ObjectType::SPHERE;
+    }
 }
 }
@@ -17,6 +17,8 @@ namespace RAY_TRACING
         MATH::Vector3f SurfaceNormal(const MATH::Vector3f& surface_point) const override;
         const Material* GetMaterial() const override;
         std::optional<RayObjectIntersection> Intersect(const Ray& ray) const override;
+        AxisAlignedBoundingBox Bounds() const override;
+        ObjectType Type() const override;
 
         // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
         /// The center of the sphere in world coordinates.
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "Math/Vector3.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// Properties of the surface first seen through a pixel, captured while tracing to guide
+    /// post-processing like denoising.  Unlike lighting, these are (nearly) noise-free, so they reveal
+    /// where the edges of objects and materials are even when only a few samples have been taken.
+    ///
+    /// Pixels that only see the background have the background color as their albedo,
+    /// a zero normal, and zero depth.
+    class SurfaceFeatures
+    {
+    public:
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The diffuse color of the surface, as (red, green, blue).
+        MATH::Vector3f Albedo = MATH::Vector3f();
+        /// The surface normal, facing toward the camera.  Unit length for single samples,
+        /// but may be shorter when averaged over samples hitting differently oriented surfaces.
+        MATH::Vector3f Normal = MATH::Vector3f();
+        /// The distance from the camera to the surface.
+        float Depth = 0.0f;
+    };
+}
+}
@@ -0,0 +1,191 @@
+#include <limits>
+#include <optional>
+#include "Graphics/RayTracing/TemporalReprojection.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// Renders a new frame, reusing the previous frame where possible.
+    /// @param[in]  ray_tracer - The ray tracer (including the camera for the new frame) to render with.
+    /// @param[in]  scene - The scene to render.
+    /// @param[in,out]  render_target - The target to render the new frame to.
+    /// @return The number of pixels that were re-traced rather than reprojected.
+    std::size_t TemporalReprojection::RenderFrame(const RayTracingAlgorithm& ray_tracer, const Scene& scene, GRAPHICS::RenderTarget& render_target)
+    {
+        // REPROJECT THE PREVIOUS FRAME IF POSSIBLE.
+        const GRAPHICS::Camera& camera = ray_tracer.Camera;
+        unsigned int render_target_width_in_pixels = render_target.GetWidthInPixels();
+        unsigned int render_target_height_in_pixels = render_target.GetHeightInPixels();
+        CONTAINERS::Array2D<GeometryBuffer::PrimaryHit> current_primary_hits(render_target_width_in_pixels, render_target_height_in_pixels);
+        std::vector<bool> reprojected_pixel_flags(static_cast<std::size_t>(render_target_width_in_pixels) * render_target_height_in_pixels);
+        if (HistoryIsValidFor(scene, render_target))
+        {
+            Reproject(camera, render_target, current_primary_hits, render_target, reprojected_pixel_flags);
+        }
+        else
+        {
+            FrameIndex = 0;
+        }
+
+        // RE-TRACE ANY PIXELS THAT COULDN'T BE REPROJECTED OR THAT ARE DUE FOR A REFRESH.
+        // Pixels are refreshed in an interleaved pattern so that refreshed pixels are spread across the screen.
+        std::size_t retraced_pixel_count = 0;
+        RayGenerator ray_generator(camera, render_target);
+        for (unsigned int y = 0; y < render_target_height_in_pixels; ++y)
+        {
+            for (unsigned int x = 0; x < render_target_width_in_pixels; ++x)
+            {
+                // CHECK IF THE PIXEL NEEDS TO BE RE-TRACED.
+                std::size_t pixel_index = static_cast<std::size_t>(y) * render_target_width_in_pixels + x;
+                bool pixel_due_for_refresh = (
+                    (RefreshIntervalInFrames > 0) &&
+                    ((pixel_index % RefreshIntervalInFrames) == (FrameIndex % RefreshIntervalInFrames)));
+                bool pixel_needs_retracing = (!reprojected_pixel_flags[pixel_index] || pixel_due_for_refresh);
+                if (!pixel_needs_retracing)
+                {
+                    continue;
+                }
+
+                // RE-TRACE THE PIXEL.
+                Ray ray = ray_generator.ViewingRay(MATH::Vector2ui(x, y));
+                GeometryBuffer::PrimaryHit& primary_hit = current_primary_hits(x, y);
+                primary_hit = ray_tracer.TracePrimaryHit(scene, ray);
+                Color color = ray_tracer.ShadePrimaryHit(scene, primary_hit);
+                render_target.WritePixel(x, y, color);
+                ++retraced_pixel_count;
+            }
+        }
+
+        // REMEMBER THE FRAME FOR REPROJECTION INTO THE NEXT FRAME.
+        HasHistory = true;
+        ++FrameIndex;
+        PreviousPrimaryHits = std::move(current_primary_hits);
+        PreviousFrame = render_target;
+        PreviousSceneGeometryVersion = scene.GeometryVersion;
+        PreviousSceneObjectCount = scene.Objects.size();
+
+        return retraced_pixel_count;
+    }
+
+    /// Forgets the previous frame so that the next frame is fully re-traced.
+    void TemporalReprojection::Reset()
+    {
+        HasHistory = false;
+        FrameIndex = 0;
+    }
+
+    /// Determines if the previous frame can be reprojected for the specified parameters.
+    /// @param[in]  scene - The scene being rendered.
+    /// @param[in]  render_target - The render target for the new frame.
+    /// @return True if the previous frame can be reprojected; false otherwise.
+    bool TemporalReprojection::HistoryIsValidFor(const Scene& scene, const GRAPHICS::RenderTarget& render_target) const
+    {
+        if (!HasHistory)
+        {
+            return false;
+        }
+
+        bool dimensions_match = (
+            (PreviousFrame.GetWidthInPixels() == render_target.GetWidthInPixels()) &&
+            (PreviousFrame.GetHeightInPixels() == render_target.GetHeightInPixels()));
+        bool geometry_matches = (
+            (PreviousSceneGeometryVersion == scene.GeometryVersion) &&
+            (PreviousSceneObjectCount == scene.Objects.size()));
+        bool history_is_valid = (dimensions_match && geometry_matches);
+        return history_is_valid;
+    }
+
+    /// Reprojects the primary hits of the previous frame into the view of a new camera.
+    /// Each previous hit is projected to the pixel it now covers, keeping the closest hit for each pixel.
+    /// Hits on surfaces now facing away from the camera are rejected since they are likely to be hidden.
+    /// @param[in]  camera - The camera for the new frame.
+    /// @param[in]  render_target - The render target for the new frame.  Only used for its dimensions.
+    /// @param[in,out]  current_primary_hits - The primary hits for the new frame, updated with reprojected hits.
+    /// @param[in,out]  current_frame - The new frame, updated with colors of reprojected hits.
+    /// @param[in,out]  reprojected_pixel_flags - Flags (in row-major order) for which pixels of the new frame
+    ///     received a reprojected hit.  Should initially all be false.
+    void TemporalReprojection::Reproject(
+        const GRAPHICS::Camera& camera,
+        const GRAPHICS::RenderTarget& render_target,
+        CONTAINERS::Array2D<GeometryBuffer::PrimaryHit>& current_primary_hits,
+        GRAPHICS::RenderTarget& current_frame,
+        std::vector<bool>& reprojected_pixel_flags) const
+    {
+        // TRACK THE DEPTH OF REPROJECTED HITS TO KEEP THE CLOSEST HIT IN EACH PIXEL.
+        unsigned int render_target_width_in_pixels = render_target.GetWidthInPixels();
+        unsigned int render_target_height_in_pixels = render_target.GetHeightInPixels();
+        std::vector<float> depths(reprojected_pixel_flags.size(), std::numeric_limits<float>::infinity());
+
+        // REPROJECT EACH PIXEL OF THE PREVIOUS FRAME.
+        bool using_perspective_projection = (ProjectionType::PERSPECTIVE == camera.Projection);
+        MATH::Vector3f camera_view_direction = MATH::Vector3f::Scale(-1.0f, camera.CoordinateFrame.Forward);
+        for (unsigned int previous_y = 0; previous_y < render_target_height_in_pixels; ++previous_y)
+        {
+            for (unsigned int previous_x = 0; previous_x < render_target_width_in_pixels; ++previous_x)
+            {
+                // PROJECT THE PREVIOUS HIT ONTO THE NEW SCREEN.
+                const GeometryBuffer::PrimaryHit& previous_hit = PreviousPrimaryHits(previous_x, previous_y);
+                std::optional<MATH::Vector2f> screen_position;
+                float depth = std::numeric_limits<float>::infinity();
+                if (previous_hit.Object)
+                {
+                    // REJECT SURFACES FACING AWAY FROM THE NEW CAMERA.
+                    MATH::Vector3f direction_to_camera = using_perspective_projection ?
+                        (camera.WorldPosition - previous_hit.WorldPosition) :
+                        camera.CoordinateFrame.Forward;
+                    bool surface_faces_camera = (MATH::Vector3f::DotProduct(previous_hit.UnitSurfaceNormal, direction_to_camera) > 0.0f);
+                    if (!surface_faces_camera)
+                    {
+                        continue;
+                    }
+
+                    screen_position = camera.ScreenPosition(previous_hit.WorldPosition, render_target);
+                    MATH::Vector3f camera_to_hit = previous_hit.WorldPosition - camera.WorldPosition;
+                    depth = using_perspective_projection ?
+                        camera_to_hit.Length() :
+                        MATH::Vector3f::DotProduct(camera_to_hit, camera_view_direction);
+                }
+                else if (using_perspective_projection)
+                {
+                    // REPROJECT THE BACKGROUND BASED ON DIRECTION.
+                    // The background is infinitely far away, so only the direction of the previous ray matters.
+                    // Orthographic background pixels can't be reprojected this way since all rays share a direction.
+                    MATH::Vector3f background_position = camera.WorldPosition + previous_hit.ViewingRay.Direction;
+                    screen_position = camera.ScreenPosition(background_position, render_target);
+                }
+
+                // SKIP HITS THAT LANDED OFF SCREEN.
+                if (!screen_position)
+                {
+                    continue;
+                }
+                bool on_screen = (
+                    (screen_position->X >= 0.0f) &&
+                    (screen_position->Y >= 0.0f) &&
+                    (screen_position->X < static_cast<float>(render_target_width_in_pixels)) &&
+                    (screen_position->Y < static_cast<float>(render_target_height_in_pixels)));
+                if (!on_screen)
+                {
+                    continue;
+                }
+
+                // KEEP THE HIT IF IT'S THE CLOSEST FOR ITS NEW PIXEL.
+                // The background never replaces any other hit since it is infinitely far away.
+                unsigned int current_x = static_cast<unsigned int>(screen_position->X);
+                unsigned int current_y = static_cast<unsigned int>(screen_position->Y);
+                std::size_t current_pixel_index = static_cast<std::size_t>(current_y) * render_target_width_in_pixels + current_x;
+                bool closest_hit = (!reprojected_pixel_flags[current_pixel_index] || (depth < depths[current_pixel_index]));
+                if (!closest_hit)
+                {
+                    continue;
+                }
+                reprojected_pixel_flags[current_pixel_index] = true;
+                depths[current_pixel_index] = depth;
+                current_primary_hits(current_x, current_y) = previous_hit;
+                current_frame.WritePixel(current_x, current_y, PreviousFrame.GetPixel(previous_x, previous_y));
+            }
+        }
+    }
+}
+}
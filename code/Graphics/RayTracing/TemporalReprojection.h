@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "Containers/Array2D.h"
+#include "Graphics/Camera.h"
+#include "Graphics/RayTracing/GeometryBuffer.h"
+#include "Graphics/RayTracing/RayTracingAlgorithm.h"
+#include "Graphics/RayTracing/Scene.h"
+#include "Graphics/RenderTarget.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// Renders consecutive frames of a moving camera by reusing as much of the previous frame as possible.
+    /// The primary hit of each pixel in the previous frame is reprojected into the new view, and pixels
+    /// that receive a valid reprojected hit keep their previous color.  Only pixels that were disoccluded
+    /// (received no hit), along with a rotating subset of all pixels, are re-traced.  The rotating subset
+    /// refreshes view-dependent shading (like specular highlights and reflections) that reprojection can't update.
+    ///
+    /// Reprojection assumes a static scene; any geometry change (as indicated by the scene's geometry version)
+    /// causes the next frame to be fully re-traced.
+    class TemporalReprojection
+    {
+    public:
+        // RENDERING.
+        std::size_t RenderFrame(const RayTracingAlgorithm& ray_tracer, const Scene& scene, GRAPHICS::RenderTarget& render_target);
+        void Reset();
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The number of frames over which every pixel is re-traced at least once, even if it could be reprojected.
+        /// Smaller values reduce stale shading but require more rays per frame.  0 disables refreshing.
+        unsigned int RefreshIntervalInFrames = 16;
+
+    private:
+        // PRIVATE HELPER METHODS.
+        bool HistoryIsValidFor(const Scene& scene, const GRAPHICS::RenderTarget& render_target) const;
+        void Reproject(
+            const GRAPHICS::Camera& camera,
+            const GRAPHICS::RenderTarget& render_target,
+            CONTAINERS::Array2D<GeometryBuffer::PrimaryHit>& current_primary_hits,
+            GRAPHICS::RenderTarget& current_frame,
+            std::vector<bool>& reprojected_pixel_flags) const;
+
+        // MEMBER VARIABLES.
+        /// True if a previous frame is available for reprojection.
+        bool HasHistory = false;
+        /// The number of frames rendered since the history was last reset.
+        unsigned int FrameIndex = 0;
+        /// The primary hit for each pixel of the previous frame.
+        CONTAINERS::Array2D<GeometryBuffer::PrimaryHit> PreviousPrimaryHits = CONTAINERS::Array2D<GeometryBuffer::PrimaryHit>();
+        /// The colors of the previous frame.
+        GRAPHICS::RenderTarget PreviousFrame = GRAPHICS::RenderTarget(0, 0, GRAPHICS::ColorFormat::RGBA);
+        /// The scene's geometry version when the previous frame was rendered.
+        unsigned int PreviousSceneGeometryVersion = 0;
+        /// The number of objects in the scene when the previous frame was rendered.
+        std::size_t PreviousSceneObjectCount = 0;
+    };
+}
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// The different orders in which tiles of the screen can be prioritized for rendering
+    /// when there may not be enough time to render all of them.
+    enum class TilePriority
+    {
+        /// Tiles closest to the center of the screen are rendered first,
+        /// since that's typically where viewers are looking.
+        SCREEN_CENTER = 0,
+        /// Tiles whose pixels changed the most the last time they were rendered are rendered first,
+        /// since those are the regions most likely to be out-of-date.
+        MOST_CHANGED,
+        /// Tiles whose pixels have the noisiest estimates (see \ref AccumulationBuffer::AverageVarianceOfMean)
+        /// are rendered first, since more samples there reduce the visible error the most.  Only renderers
+        /// taking many samples per pixel (like \ref PathTracingAlgorithm) can estimate this, so others
+        /// fall back to \ref SCREEN_CENTER.
+        HIGHEST_ERROR
+    };
+}
+}
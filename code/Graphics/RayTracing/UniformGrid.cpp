@@ -0,0 +1,227 @@
+#include <cmath>
+#include "Graphics/RayTracing/UniformGrid.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// Builds the grid over the specified primitives, replacing any previous contents.
+    /// Construction takes linear time in the number of primitives (assuming primitives
+    /// are similarly sized) and is split across multiple threads for large numbers of primitives.
+    /// @param[in]  primitive_bounds - The bounds of each primitive, in the same order as the primitives.
+    /// @param[in]  thread_count - The maximum number of threads to build with.  At least 1 thread is always used.
+    void UniformGrid::Build(const std::vector<AxisAlignedBoundingBox>& primitive_bounds, const unsigned int thread_count)
+    {
+        // CLEAR ANY PREVIOUS CONTENTS.
+        GridBounds = AxisAlignedBoundingBox();
+        CellCounts = MATH::Vector3ui(0, 0, 0);
+        CellSize = MATH::Vector3f();
+        CellPrimitiveStartIndices.clear();
+        CellPrimitiveIndices.clear();
+        UnboundedPrimitiveIndices.clear();
+        TotalPrimitiveCount = primitive_bounds.size();
+
+        // SEPARATE OUT PRIMITIVES THAT CAN'T BE PLACED IN CELLS.
+        // Primitives with empty bounds can never be hit, so they aren't placed anywhere.
+        std::vector<std::size_t> bounded_primitive_indices;
+        bounded_primitive_indices.reserve(primitive_bounds.size());
+        for (std::size_t primitive_index = 0; primitive_index < primitive_bounds.size(); ++primitive_index)
+        {
+            const AxisAlignedBoundingBox& bounds = primitive_bounds[primitive_index];
+            if (bounds.IsEmpty())
+            {
+                continue;
+            }
+
+            if (!bounds.IsFinite())
+            {
+                UnboundedPrimitiveIndices.push_back(primitive_index);
+                continue;
+            }
+
+            bounded_primitive_indices.push_back(primitive_index);
+            GridBounds.Expand(bounds);
+        }
+        if (bounded_primitive_indices.empty())
+        {
+            GridBounds = AxisAlignedBoundingBox();
+            return;
+        }
+
+        // ENSURE THE GRID HAS SOME THICKNESS ALONG EVERY AXIS.
+        // Primitives may all lie in a plane, but cells still need a non-zero size.
+        MATH::Vector3f grid_size = GridBounds.Size();
+        float largest_grid_extent = std::max({ grid_size.X, grid_size.Y, grid_size.Z });
+        constexpr float MIN_PROPORTION_OF_LARGEST_EXTENT = 0.001f;
+        float min_grid_extent = (largest_grid_extent > 0.0f) ? (MIN_PROPORTION_OF_LARGEST_EXTENT * largest_grid_extent) : 1.0f;
+        for (float MATH::Vector3f::* axis : { &MATH::Vector3f::X, &MATH::Vector3f::Y, &MATH::Vector3f::Z })
+        {
+            if (grid_size.*axis < min_grid_extent)
+            {
+                float padding = 0.5f * (min_grid_extent - grid_size.*axis);
+                GridBounds.MinimumCorner.*axis -= padding;
+                GridBounds.MaximumCorner.*axis += padding;
+                grid_size.*axis = min_grid_extent;
+            }
+        }
+
+        // CHOOSE ROUGHLY CUBICAL CELLS WITH THE DESIRED TOTAL CELL COUNT.
+        float grid_volume = grid_size.X * grid_size.Y * grid_size.Z;
+        float desired_cell_count = CELL_COUNT_PER_PRIMITIVE * static_cast<float>(bounded_primitive_indices.size());
+        float cell_count_per_unit_length = std::cbrt(desired_cell_count / grid_volume);
+        auto cell_count_along = [&](const float extent)
+        {
+            float cell_count = std::ceil(extent * cell_count_per_unit_length);
+            return static_cast<unsigned int>(std::clamp(cell_count, 1.0f, static_cast<float>(MAX_CELL_COUNT_PER_AXIS)));
+        };
+        CellCounts = MATH::Vector3ui(cell_count_along(grid_size.X), cell_count_along(grid_size.Y), cell_count_along(grid_size.Z));
+        CellSize = MATH::Vector3f(
+            grid_size.X / static_cast<float>(CellCounts.X),
+            grid_size.Y / static_cast<float>(CellCounts.Y),
+            grid_size.Z / static_cast<float>(CellCounts.Z));
+
+        // COMPUTE THE RANGE OF CELLS OVERLAPPED BY EACH PRIMITIVE.
+        // Bounds are slightly expanded so that primitives touching a cell boundary are placed in both cells.
+        unsigned int build_thread_count = std::max(1u, thread_count);
+        std::size_t max_useful_thread_count = std::max<std::size_t>(1, bounded_primitive_indices.size() / MIN_PRIMITIVE_COUNT_PER_BUILD_THREAD);
+        build_thread_count = static_cast<unsigned int>(std::min<std::size_t>(build_thread_count, max_useful_thread_count));
+        std::vector<MATH::Vector3ui> first_cells(bounded_primitive_indices.size());
+        std::vector<MATH::Vector3ui> last_cells(bounded_primitive_indices.size());
+        RunInParallel(build_thread_count, bounded_primitive_indices.size(), [&](const std::size_t begin_index, const std::size_t end_index)
+        {
+            auto cell_along = [](const float position, const float minimum_corner, const float cell_size, const unsigned int cell_count)
+            {
+                float cell = std::floor((position - minimum_corner) / cell_size);
+                return static_cast<unsigned int>(std::clamp(cell, 0.0f, static_cast<float>(cell_count - 1)));
+            };
+            MATH::Vector3f boundary_tolerance = MATH::Vector3f::Scale(0.0001f, CellSize);
+            for (std::size_t index = begin_index; index < end_index; ++index)
+            {
+                const AxisAlignedBoundingBox& bounds = primitive_bounds[bounded_primitive_indices[index]];
+                MATH::Vector3f minimum_corner = bounds.MinimumCorner - boundary_tolerance;
+                MATH::Vector3f maximum_corner = bounds.MaximumCorner + boundary_tolerance;
+                first_cells[index] = MATH::Vector3ui(
+                    cell_along(minimum_corner.X, GridBounds.MinimumCorner.X, CellSize.X, CellCounts.X),
+                    cell_along(minimum_corner.Y, GridBounds.MinimumCorner.Y, CellSize.Y, CellCounts.Y),
+                    cell_along(minimum_corner.Z, GridBounds.MinimumCorner.Z, CellSize.Z, CellCounts.Z));
+                last_cells[index] = MATH::Vector3ui(
+                    cell_along(maximum_corner.X, GridBounds.MinimumCorner.X, CellSize.X, CellCounts.X),
+                    cell_along(maximum_corner.Y, GridBounds.MinimumCorner.Y, CellSize.Y, CellCounts.Y),
+                    cell_along(maximum_corner.Z, GridBounds.MinimumCorner.Z, CellSize.Z, CellCounts.Z));
+            }
+        });
+
+        // DEFINE HOW TO VISIT THE CELLS OF EACH PRIMITIVE WITHIN A RANGE OF Z LAYERS.
+        // Each thread handles different layers of cells, so threads never write to the same cells.
+        auto for_each_primitive_cell_in_layers = [&](
+            const std::size_t begin_z,
+            const std::size_t end_z,
+            const std::function<void(const std::size_t cell_index, const std::size_t primitive_index)>& visit_cell)
+        {
+            for (std::size_t index = 0; index < bounded_primitive_indices.size(); ++index)
+            {
+                const MATH::Vector3ui& first_cell = first_cells[index];
+                const MATH::Vector3ui& last_cell = last_cells[index];
+                std::size_t first_z = std::max<std::size_t>(first_cell.Z, begin_z);
+                std::size_t end_primitive_z = std::min<std::size_t>(static_cast<std::size_t>(last_cell.Z) + 1, end_z);
+                for (std::size_t z = first_z; z < end_primitive_z; ++z)
+                {
+                    for (std::size_t y = first_cell.Y; y <= last_cell.Y; ++y)
+                    {
+                        for (std::size_t x = first_cell.X; x <= last_cell.X; ++x)
+                        {
+                            visit_cell(CellIndex(x, y, z), bounded_primitive_indices[index]);
+                        }
+                    }
+                }
+            }
+        };
+
+        // COUNT THE PRIMITIVES IN EACH CELL.
+        // Counts are stored one past each cell's index so that they can be converted in-place into start indices.
+        std::size_t cell_count = static_cast<std::size_t>(CellCounts.X) * CellCounts.Y * CellCounts.Z;
+        CellPrimitiveStartIndices.assign(cell_count + 1, 0);
+        unsigned int layer_thread_count = std::min(build_thread_count, CellCounts.Z);
+        RunInParallel(layer_thread_count, CellCounts.Z, [&](const std::size_t begin_z, const std::size_t end_z)
+        {
+            for_each_primitive_cell_in_layers(begin_z, end_z, [&](const std::size_t cell_index, const std::size_t)
+            {
+                ++CellPrimitiveStartIndices[cell_index + 1];
+            });
+        });
+
+        // CONVERT THE COUNTS INTO START INDICES.
+        for (std::size_t cell_index = 0; cell_index < cell_count; ++cell_index)
+        {
+            CellPrimitiveStartIndices[cell_index + 1] += CellPrimitiveStartIndices[cell_index];
+        }
+
+        // FILL IN THE PRIMITIVES FOR EACH CELL.
+        CellPrimitiveIndices.resize(CellPrimitiveStartIndices.back());
+        std::vector<std::size_t> next_indices_by_cell(CellPrimitiveStartIndices.begin(), CellPrimitiveStartIndices.end() - 1);
+        RunInParallel(layer_thread_count, CellCounts.Z, [&](const std::size_t begin_z, const std::size_t end_z)
+        {
+            for_each_primitive_cell_in_layers(begin_z, end_z, [&](const std::size_t cell_index, const std::size_t primitive_index)
+            {
+                CellPrimitiveIndices[next_indices_by_cell[cell_index]++] = primitive_index;
+            });
+        });
+    }
+
+    /// Gets the number of primitives the grid was built over.
+    /// @return The number of primitives.
+    std::size_t UniformGrid::PrimitiveCount() const
+    {
+        return TotalPrimitiveCount;
+    }
+
+    /// Gets the bounds of all primitives in cells of the grid.
+    /// @return The bounds of the grid; empty if no primitives with finite bounds exist.
+    AxisAlignedBoundingBox UniformGrid::Bounds() const
+    {
+        return GridBounds;
+    }
+
+    /// Processes a range of items split evenly across multiple threads, waiting for all of them to finish.
+    /// @param[in]  thread_count - The number of threads to use.  The calling thread is used if only 1 thread is requested.
+    /// @param[in]  item_count - The total number of items to process.
+    /// @param[in]  process_items - The function to process a contiguous range of items on a single thread.
+    void UniformGrid::RunInParallel(
+        const unsigned int thread_count,
+        const std::size_t item_count,
+        const std::function<void(const std::size_t begin_index, const std::size_t end_index)>& process_items)
+    {
+        // PROCESS ALL ITEMS ON THE CURRENT THREAD IF ADDITIONAL THREADS WON'T HELP.
+        if (thread_count <= 1)
+        {
+            process_items(0, item_count);
+            return;
+        }
+
+        // PROCESS EQUAL SHARES OF ITEMS ON SEPARATE THREADS.
+        std::vector<std::thread> threads;
+        threads.reserve(thread_count);
+        for (unsigned int thread_index = 0; thread_index < thread_count; ++thread_index)
+        {
+            std::size_t begin_index = (item_count * thread_index) / thread_count;
+            std::size_t end_index = (item_count * (thread_index + 1)) / thread_count;
+            threads.emplace_back(process_items, begin_index, end_index);
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    /// Computes the index of a cell within the cell lists.
+    /// @param[in]  x - The cell's index along the X axis.
+    /// @param[in]  y - The cell's index along the Y axis.
+    /// @param[in]  z - The cell's index along the Z axis.
+    /// @return The index of the cell.
+    std::size_t UniformGrid::CellIndex(const std::size_t x, const std::size_t y, const std::size_t z) const
+    {
+        std::size_t cell_index = (((z * CellCounts.Y) + y) * CellCounts.X) + x;
+        return cell_index;
+    }
+}
+}
@@ -0,0 +1,233 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <thread>
+#include <vector>
+#include "Graphics/RayTracing/AxisAlignedBoundingBox.h"
+#include "Graphics/RayTracing/Ray.h"
+#include "Math/Vector3.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// A grid of equally sized cells over some primitives (objects, triangles, etc.), with each cell
+    /// listing the primitives overlapping it.  Rays step through only the cells they pass through.
+    ///
+    /// Tracing rays through a grid is typically slower than through a \ref BoundingVolumeHierarchy,
+    /// but a grid can be built in linear time (on multiple threads), making it better suited for
+    /// scenes where most primitives move every frame.  Like the hierarchy, the grid only stores indices
+    /// to primitives, so the primitives themselves must keep the same order as when the grid was built.
+    class UniformGrid
+    {
+    public:
+        // STATIC CONSTANTS.
+        /// The number of cells to create per primitive.  More cells allow rays to skip more primitives,
+        /// at the cost of more memory and more cells to step through.
+        static constexpr float CELL_COUNT_PER_PRIMITIVE = 2.0f;
+        /// The maximum number of cells along any single axis, to bound memory for sparse scenes.
+        static constexpr unsigned int MAX_CELL_COUNT_PER_AXIS = 128;
+        /// The minimum number of primitives per thread when building the grid.  Smaller grids
+        /// are faster to build on a single thread than to start additional threads for.
+        static constexpr std::size_t MIN_PRIMITIVE_COUNT_PER_BUILD_THREAD = 1024;
+
+        // CONSTRUCTION.
+        void Build(
+            const std::vector<AxisAlignedBoundingBox>& primitive_bounds,
+            const unsigned int thread_count = std::thread::hardware_concurrency());
+
+        // OTHER METHODS.
+        std::size_t PrimitiveCount() const;
+        AxisAlignedBoundingBox Bounds() const;
+        template <typename PrimitiveVisitor>
+        void VisitPrimitives(
+            const Ray& ray,
+            const float& max_distance,
+            PrimitiveVisitor&& visit_primitive,
+            std::size_t* const traversal_step_count = nullptr) const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The bounds of the entire grid.  Empty if no primitives with finite bounds exist.
+        AxisAlignedBoundingBox GridBounds = AxisAlignedBoundingBox();
+        /// The number of cells along each axis.
+        MATH::Vector3ui CellCounts = MATH::Vector3ui(0, 0, 0);
+        /// The size of each cell along each axis.
+        MATH::Vector3f CellSize = MATH::Vector3f();
+        /// The index into the cell primitive index list of the first primitive of each cell (in X, then Y,
+        /// then Z order), with an extra final entry so that each cell's primitives end where the next cell's start.
+        std::vector<std::size_t> CellPrimitiveStartIndices = {};
+        /// Indices of primitives in each cell, ordered so that each cell's primitives are contiguous.
+        /// Primitives overlapping multiple cells are listed in each of them.
+        std::vector<std::size_t> CellPrimitiveIndices = {};
+        /// Indices of primitives with infinite bounds, which can't be placed in cells and are visited for every ray.
+        std::vector<std::size_t> UnboundedPrimitiveIndices = {};
+
+    private:
+        // PRIVATE HELPER METHODS.
+        static void RunInParallel(
+            const unsigned int thread_count,
+            const std::size_t item_count,
+            const std::function<void(const std::size_t begin_index, const std::size_t end_index)>& process_items);
+        std::size_t CellIndex(const std::size_t x, const std::size_t y, const std::size_t z) const;
+
+        // MEMBER VARIABLES.
+        /// The total number of primitives the grid was built over, including any not placed in cells.
+        std::size_t TotalPrimitiveCount = 0;
+    };
+
+    /// Visits all primitives in cells that a ray passes through, in order along the ray.
+    /// Since primitives may overlap multiple cells, the same primitive may be visited more than once.
+    /// @tparam PrimitiveVisitor - A callable type taking a primitive index and returning a bool.
+    /// @param[in]  ray - The ray to check for intersection.
+    /// @param[in]  max_distance - The maximum distance (in units of the ray) at which intersections count.
+    ///     Passed by reference so that visitors searching for the closest intersection can shrink it
+    ///     as closer intersections are found, allowing traversal to stop once past that distance.
+    /// @param[in]  visit_primitive - The visitor to call for each primitive.
+    ///     Returning true stops traversal early (useful when any intersection is sufficient).
+    /// @param[in,out]  traversal_step_count - If provided, incremented for each cell visited (for statistics).
+    template <typename PrimitiveVisitor>
+    void UniformGrid::VisitPrimitives(
+        const Ray& ray,
+        const float& max_distance,
+        PrimitiveVisitor&& visit_primitive,
+        std::size_t* const traversal_step_count) const
+    {
+        // VISIT ANY PRIMITIVES NOT IN CELLS.
+        for (std::size_t primitive_index : UnboundedPrimitiveIndices)
+        {
+            bool stop_traversal = visit_primitive(primitive_index);
+            if (stop_traversal)
+            {
+                return;
+            }
+        }
+
+        // CHECK IF THERE ARE ANY CELLS TO VISIT.
+        if (CellPrimitiveIndices.empty())
+        {
+            return;
+        }
+
+        // FIND WHERE THE RAY IS WITHIN THE GRID.
+        // Working with arrays allows each axis to be handled identically.
+        const std::array<float, 3> ray_origin = { ray.Origin.X, ray.Origin.Y, ray.Origin.Z };
+        const std::array<float, 3> ray_direction = { ray.Direction.X, ray.Direction.Y, ray.Direction.Z };
+        const std::array<float, 3> grid_minimum_corner = { GridBounds.MinimumCorner.X, GridBounds.MinimumCorner.Y, GridBounds.MinimumCorner.Z };
+        const std::array<float, 3> grid_maximum_corner = { GridBounds.MaximumCorner.X, GridBounds.MaximumCorner.Y, GridBounds.MaximumCorner.Z };
+        const std::array<float, 3> cell_size = { CellSize.X, CellSize.Y, CellSize.Z };
+        const std::array<int, 3> cell_counts = { static_cast<int>(CellCounts.X), static_cast<int>(CellCounts.Y), static_cast<int>(CellCounts.Z) };
+        float grid_entry_distance = 0.0f;
+        float grid_exit_distance = max_distance;
+        for (std::size_t axis = 0; axis < ray_direction.size(); ++axis)
+        {
+            if (0.0f == ray_direction[axis])
+            {
+                bool origin_within_slab = (
+                    (ray_origin[axis] >= grid_minimum_corner[axis]) &&
+                    (ray_origin[axis] <= grid_maximum_corner[axis]));
+                if (!origin_within_slab)
+                {
+                    return;
+                }
+                continue;
+            }
+
+            float distance_to_minimum_plane = (grid_minimum_corner[axis] - ray_origin[axis]) / ray_direction[axis];
+            float distance_to_maximum_plane = (grid_maximum_corner[axis] - ray_origin[axis]) / ray_direction[axis];
+            grid_entry_distance = std::max(grid_entry_distance, std::min(distance_to_minimum_plane, distance_to_maximum_plane));
+            grid_exit_distance = std::min(grid_exit_distance, std::max(distance_to_minimum_plane, distance_to_maximum_plane));
+        }
+        if (grid_entry_distance > grid_exit_distance)
+        {
+            return;
+        }
+
+        // PREPARE TO STEP THROUGH CELLS ALONG THE RAY (3D-DDA).
+        // For each axis, this tracks the ray's current cell, the distance along the ray at which it
+        // next crosses into a neighboring cell along that axis, and the distance between such crossings.
+        std::array<int, 3> cell = {};
+        std::array<int, 3> cell_step = {};
+        std::array<float, 3> next_cell_crossing_distance = {};
+        std::array<float, 3> cell_crossing_interval = {};
+        for (std::size_t axis = 0; axis < ray_direction.size(); ++axis)
+        {
+            float entry_position = ray_origin[axis] + (grid_entry_distance * ray_direction[axis]);
+            int entry_cell = static_cast<int>((entry_position - grid_minimum_corner[axis]) / cell_size[axis]);
+            cell[axis] = std::clamp(entry_cell, 0, cell_counts[axis] - 1);
+
+            if (ray_direction[axis] > 0.0f)
+            {
+                cell_step[axis] = 1;
+                float next_cell_boundary = grid_minimum_corner[axis] + (static_cast<float>(cell[axis] + 1) * cell_size[axis]);
+                next_cell_crossing_distance[axis] = (next_cell_boundary - ray_origin[axis]) / ray_direction[axis];
+                cell_crossing_interval[axis] = cell_size[axis] / ray_direction[axis];
+            }
+            else if (ray_direction[axis] < 0.0f)
+            {
+                cell_step[axis] = -1;
+                float next_cell_boundary = grid_minimum_corner[axis] + (static_cast<float>(cell[axis]) * cell_size[axis]);
+                next_cell_crossing_distance[axis] = (next_cell_boundary - ray_origin[axis]) / ray_direction[axis];
+                cell_crossing_interval[axis] = -cell_size[axis] / ray_direction[axis];
+            }
+            else
+            {
+                cell_step[axis] = 0;
+                next_cell_crossing_distance[axis] = std::numeric_limits<float>::infinity();
+                cell_crossing_interval[axis] = std::numeric_limits<float>::infinity();
+            }
+        }
+
+        // VISIT EACH CELL ALONG THE RAY.
+        while (true)
+        {
+            // VISIT THE PRIMITIVES IN THE CURRENT CELL.
+            std::size_t cell_index = CellIndex(static_cast<std::size_t>(cell[0]), static_cast<std::size_t>(cell[1]), static_cast<std::size_t>(cell[2]));
+            if (traversal_step_count)
+            {
+                ++(*traversal_step_count);
+            }
+            std::size_t end_index = CellPrimitiveStartIndices[cell_index + 1];
+            for (std::size_t index = CellPrimitiveStartIndices[cell_index]; index < end_index; ++index)
+            {
+                bool stop_traversal = visit_primitive(CellPrimitiveIndices[index]);
+                if (stop_traversal)
+                {
+                    return;
+                }
+            }
+
+            // STOP ONCE THE RAY IS BEYOND THE MAXIMUM DISTANCE.
+            // The maximum distance may have shrunk while visiting primitives.
+            std::size_t next_axis = 0;
+            if (next_cell_crossing_distance[1] < next_cell_crossing_distance[next_axis])
+            {
+                next_axis = 1;
+            }
+            if (next_cell_crossing_distance[2] < next_cell_crossing_distance[next_axis])
+            {
+                next_axis = 2;
+            }
+            // A ray with no direction never crosses into another cell.
+            bool ray_crosses_cells = (0 != cell_step[next_axis]);
+            bool next_cell_beyond_max_distance = (next_cell_crossing_distance[next_axis] > max_distance);
+            if (!ray_crosses_cells || next_cell_beyond_max_distance)
+            {
+                return;
+            }
+
+            // STEP INTO THE NEXT CELL, STOPPING ONCE THE RAY LEAVES THE GRID.
+            cell[next_axis] += cell_step[next_axis];
+            bool cell_within_grid = (cell[next_axis] >= 0) && (cell[next_axis] < cell_counts[next_axis]);
+            if (!cell_within_grid)
+            {
+                return;
+            }
+            next_cell_crossing_distance[next_axis] += cell_crossing_interval[next_axis];
+        }
+    }
+}
+}
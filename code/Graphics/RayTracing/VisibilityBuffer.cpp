@@ -0,0 +1,162 @@
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include "Graphics/RayTracing/VisibilityBuffer.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// Rasterizes all objects in the scene that are composed of triangles, replacing any previous contents.
+    /// @param[in]  camera - The camera to rasterize from.  Should be the same camera used for ray tracing.
+    /// @param[in]  scene - The scene to rasterize.
+    /// @param[in]  render_target - The render target defining the pixels to rasterize to.
+    void VisibilityBuffer::Rasterize(const GRAPHICS::Camera& camera, const Scene& scene, const GRAPHICS::RenderTarget& render_target)
+    {
+        // CLEAR ANY PREVIOUS CONTENTS.
+        Samples = CONTAINERS::Array2D<Sample>(render_target.GetWidthInPixels(), render_target.GetHeightInPixels());
+        UnrasterizedObjects.clear();
+
+        // RASTERIZE EACH OBJECT.
+        // The triangle lists are reused across objects to avoid repeated allocations.
+        std::vector< std::array<MATH::Vector3f, 3> > world_triangles;
+        std::vector< std::array<MATH::Vector2f, 3> > screen_triangles;
+        RayGenerator ray_generator(camera, render_target);
+        for (const auto& object : scene.Objects)
+        {
+            // GET THE OBJECT'S TRIANGLES.
+            bool object_composed_of_triangles = object->WorldTriangles(world_triangles);
+            if (!object_composed_of_triangles)
+            {
+                UnrasterizedObjects.push_back(object.get());
+                continue;
+            }
+
+            // PROJECT ALL TRIANGLES ONTO THE SCREEN.
+            // Triangles aren't clipped, so any object with vertices behind the camera is ray traced instead.
+            screen_triangles.clear();
+            bool all_vertices_projected = true;
+            for (const std::array<MATH::Vector3f, 3>& world_vertices : world_triangles)
+            {
+                std::array<MATH::Vector2f, 3> screen_vertices;
+                for (std::size_t vertex_index = 0; vertex_index < world_vertices.size(); ++vertex_index)
+                {
+                    std::optional<MATH::Vector2f> screen_vertex = camera.ScreenPosition(world_vertices[vertex_index], render_target);
+                    if (!screen_vertex)
+                    {
+                        all_vertices_projected = false;
+                        break;
+                    }
+                    screen_vertices[vertex_index] = *screen_vertex;
+                }
+
+                if (!all_vertices_projected)
+                {
+                    break;
+                }
+                screen_triangles.push_back(screen_vertices);
+            }
+            if (!all_vertices_projected)
+            {
+                UnrasterizedObjects.push_back(object.get());
+                continue;
+            }
+
+            // RASTERIZE EACH TRIANGLE.
+            for (std::size_t triangle_index = 0; triangle_index < world_triangles.size(); ++triangle_index)
+            {
+                RasterizeTriangle(ray_generator, render_target, *object, triangle_index, world_triangles[triangle_index], screen_triangles[triangle_index]);
+            }
+        }
+    }
+
+    /// Rasterizes a single triangle, keeping it in any covered pixels where it is the closest object.
+    /// Triangles are two-sided to match ray tracing.
+    /// @param[in]  ray_generator - The generator of viewing rays for the camera being rasterized from.
+    /// @param[in]  render_target - The render target defining the pixels to rasterize to.
+    /// @param[in]  object - The object containing the triangle.
+    /// @param[in]  primitive_index - The index of the triangle within the object.
+    /// @param[in]  world_vertices - The vertices of the triangle in world space.
+    /// @param[in]  screen_vertices - The vertices of the triangle projected onto the screen.
+    void VisibilityBuffer::RasterizeTriangle(
+        const RayGenerator& ray_generator,
+        const GRAPHICS::RenderTarget& render_target,
+        const IObject3D& object,
+        const std::size_t primitive_index,
+        const std::array<MATH::Vector3f, 3>& world_vertices,
+        const std::array<MATH::Vector2f, 3>& screen_vertices)
+    {
+        // SKIP TRIANGLES SEEN EDGE-ON.
+        // The signed area also determines the winding of the triangle on screen.
+        auto edge_function = [](const MATH::Vector2f& edge_start, const MATH::Vector2f& edge_end, const MATH::Vector2f& point)
+        {
+            return ((edge_end.X - edge_start.X) * (point.Y - edge_start.Y)) - ((edge_end.Y - edge_start.Y) * (point.X - edge_start.X));
+        };
+        float twice_signed_area = edge_function(screen_vertices[0], screen_vertices[1], screen_vertices[2]);
+        if (0.0f == twice_signed_area)
+        {
+            return;
+        }
+        float winding_sign = (twice_signed_area > 0.0f) ? 1.0f : -1.0f;
+
+        // COMPUTE THE RANGE OF PIXELS THAT MAY BE COVERED.
+        float render_target_width_in_pixels = static_cast<float>(render_target.GetWidthInPixels());
+        float render_target_height_in_pixels = static_cast<float>(render_target.GetHeightInPixels());
+        float min_x = std::min({ screen_vertices[0].X, screen_vertices[1].X, screen_vertices[2].X });
+        float max_x = std::max({ screen_vertices[0].X, screen_vertices[1].X, screen_vertices[2].X });
+        float min_y = std::min({ screen_vertices[0].Y, screen_vertices[1].Y, screen_vertices[2].Y });
+        float max_y = std::max({ screen_vertices[0].Y, screen_vertices[1].Y, screen_vertices[2].Y });
+        unsigned int start_x = static_cast<unsigned int>(std::clamp(std::floor(min_x), 0.0f, render_target_width_in_pixels));
+        unsigned int end_x = static_cast<unsigned int>(std::clamp(std::ceil(max_x), 0.0f, render_target_width_in_pixels));
+        unsigned int start_y = static_cast<unsigned int>(std::clamp(std::floor(min_y), 0.0f, render_target_height_in_pixels));
+        unsigned int end_y = static_cast<unsigned int>(std::clamp(std::ceil(max_y), 0.0f, render_target_height_in_pixels));
+
+        // COMPUTE THE TRIANGLE'S PLANE FOR DEPTHS.
+        // The normal doesn't need to be normalized for computing distances along rays.
+        MATH::Vector3f plane_normal = MATH::Vector3f::CrossProduct(
+            world_vertices[1] - world_vertices[0],
+            world_vertices[2] - world_vertices[0]);
+
+        // RASTERIZE EACH PIXEL WHOSE CENTER IS COVERED BY THE TRIANGLE.
+        for (unsigned int y = start_y; y < end_y; ++y)
+        {
+            for (unsigned int x = start_x; x < end_x; ++x)
+            {
+                // CHECK IF THE PIXEL CENTER IS INSIDE ALL EDGES.
+                MATH::Vector2f pixel_center(static_cast<float>(x) + 0.5f, static_cast<float>(y) + 0.5f);
+                bool pixel_covered = (
+                    (winding_sign * edge_function(screen_vertices[0], screen_vertices[1], pixel_center) >= 0.0f) &&
+                    (winding_sign * edge_function(screen_vertices[1], screen_vertices[2], pixel_center) >= 0.0f) &&
+                    (winding_sign * edge_function(screen_vertices[2], screen_vertices[0], pixel_center) >= 0.0f));
+                if (!pixel_covered)
+                {
+                    continue;
+                }
+
+                // COMPUTE THE DISTANCE ALONG THE PIXEL'S VIEWING RAY TO THE TRIANGLE.
+                Ray viewing_ray = ray_generator.ViewingRay(MATH::Vector2ui(x, y));
+                float ray_direction_along_normal = MATH::Vector3f::DotProduct(plane_normal, viewing_ray.Direction);
+                if (0.0f == ray_direction_along_normal)
+                {
+                    continue;
+                }
+                float distance_from_ray_to_triangle = MATH::Vector3f::DotProduct(plane_normal, world_vertices[0] - viewing_ray.Origin) / ray_direction_along_normal;
+                if (distance_from_ray_to_triangle < 0.0f)
+                {
+                    continue;
+                }
+
+                // KEEP THE TRIANGLE IF IT'S THE CLOSEST SO FAR.
+                Sample& sample = Samples(x, y);
+                bool triangle_closest = (distance_from_ray_to_triangle < sample.DistanceFromRayToObject);
+                if (triangle_closest)
+                {
+                    sample.Object = &object;
+                    sample.PrimitiveIndex = primitive_index;
+                    sample.DistanceFromRayToObject = distance_from_ray_to_triangle;
+                }
+            }
+        }
+    }
+}
+}
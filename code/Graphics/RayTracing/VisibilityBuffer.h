@@ -0,0 +1,63 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <vector>
+#include "Containers/Array2D.h"
+#include "Graphics/Camera.h"
+#include "Graphics/RayTracing/IObject3D.h"
+#include "Graphics/RayTracing/RayGenerator.h"
+#include "Graphics/RayTracing/Scene.h"
+#include "Graphics/RenderTarget.h"
+#include "Math/Vector3.h"
+
+namespace GRAPHICS
+{
+namespace RAY_TRACING
+{
+    /// The closest object visible through each pixel, as determined by rasterizing triangles rather than
+    /// ray tracing.  Rasterization only visits pixels covered by each triangle, which is much cheaper than
+    /// tracing a primary ray through the scene for every pixel.
+    ///
+    /// Triangles are projected with the same camera used for ray tracing, and depths are computed as
+    /// distances along each pixel's viewing ray, so the results can be used directly as primary ray hits.
+    /// Objects that can't be rasterized (ones not composed of triangles or with triangles behind the camera)
+    /// are tracked separately so that they can be ray traced instead.
+    class VisibilityBuffer
+    {
+    public:
+        /// The closest rasterized object for a single pixel.
+        class Sample
+        {
+        public:
+            // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+            /// The closest object covering the pixel; null if no rasterized object covers the pixel.
+            const IObject3D* Object = nullptr;
+            /// The index of the covering triangle within the object.
+            std::size_t PrimitiveIndex = 0;
+            /// The distance along the pixel's viewing ray to the object (in units of the ray).
+            float DistanceFromRayToObject = std::numeric_limits<float>::infinity();
+        };
+
+        // RENDERING.
+        void Rasterize(const GRAPHICS::Camera& camera, const Scene& scene, const GRAPHICS::RenderTarget& render_target);
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The closest rasterized object for each pixel.
+        CONTAINERS::Array2D<Sample> Samples = CONTAINERS::Array2D<Sample>();
+        /// Objects in the scene that couldn't be rasterized and must be ray traced instead.
+        std::vector<const IObject3D*> UnrasterizedObjects = {};
+
+    private:
+        // PRIVATE HELPER METHODS.
+        void RasterizeTriangle(
+            const RayGenerator& ray_generator,
+            const GRAPHICS::RenderTarget& render_target,
+            const IObject3D& object,
+            const std::size_t primitive_index,
+            const std::array<MATH::Vector3f, 3>& world_vertices,
+            const std::array<MATH::Vector2f, 3>& screen_vertices);
+    };
+}
+}
@@ -120,6 +120,12 @@ namespace GRAPHICS
                 Color::BLACK,
                 Color::BLACK,
             };
+            std::array<Color, Triangle::VERTEX_COUNT> triangle_lightmap_vertex_colors =
+            {
+                Color::BLACK,
+                Color::BLACK,
+                Color::BLACK,
+            };
             for (std::size_t vertex_index = 0; vertex_index < screen_space_triangle.Vertices.size(); ++vertex_index)
             {
                 MATH::Vector3f& vertex = screen_space_triangle.Vertices[vertex_index];
@@ -182,19 +188,24 @@ namespace GRAPHICS
                         break;
                 }
 
+                // Any lightmap only replaces diffuse light from directional and point lights.  Ambient light
+                // (with any baked ambient occlusion) and specular highlights are still computed for each vertex.
                 Color light_total_color = Color::BLACK;
                 for (const Light& light : lights)
                 {
                     // COMPUTE SHADING BASED ON TYPE OF LIGHT.
                     if (LightType::AMBIENT == light.Type)
                     {
+                        // Ambient light is reduced by any occlusion baked for the vertex.
+                        float ambient_occlusion = world_space_triangle.VertexAmbientOcclusion[vertex_index];
+                        Color occluded_light_color = Color::ScaleRedGreenBlue(ambient_occlusion, light.Color);
                         if (ShadingType::MATERIAL == world_space_triangle.Material->Shading)
                         {
-                            light_total_color += Color::ComponentMultiplyRedGreenBlue(light.Color, world_space_triangle.Material->AmbientColor);
+                            light_total_color += Color::ComponentMultiplyRedGreenBlue(occluded_light_color, world_space_triangle.Material->AmbientColor);
                         }
                         else
                         {
-                            light_total_color += light.Color;
+                            light_total_color += occluded_light_color;
                         }
                     }
                     else
@@ -202,7 +213,7 @@ namespace GRAPHICS
                         // COMPUTE THE SURFACE NORMAL.
                         /// @todo   Vertex normals?
                         MATH::Vector3f unit_surface_normal = world_space_triangle.SurfaceNormal();
-                        
+                    
                         // GET THE DIRECTION OF THE LIGHT.
                         MATH::Vector3f current_world_vertex = MATH::Vector3f(world_vertex.X, world_vertex.Y, world_vertex.Z);
                         MATH::Vector3f direction_from_vertex_to_light;
@@ -226,14 +237,18 @@ namespace GRAPHICS
                         constexpr float NO_ILLUMINATION = 0.0f;
                         float illumination_proportion = MATH::Vector3f::DotProduct(unit_surface_normal, unit_direction_from_point_to_light);
                         illumination_proportion = std::max(NO_ILLUMINATION, illumination_proportion);
-                        Color current_light_color = Color::ScaleRedGreenBlue(illumination_proportion, light.Color);
-                        if (ShadingType::MATERIAL == world_space_triangle.Material->Shading)
-                        {
-                            light_total_color += Color::ComponentMultiplyRedGreenBlue(current_light_color, world_space_triangle.Material->DiffuseColor);
-                        }
-                        else
+                        // Diffuse light is already included in any lightmap.
+                        if (!object_3D.Lightmap)
                         {
-                            light_total_color += current_light_color;
+                            Color current_light_color = Color::ScaleRedGreenBlue(illumination_proportion, light.Color);
+                            if (ShadingType::MATERIAL == world_space_triangle.Material->Shading)
+                            {
+                                light_total_color += Color::ComponentMultiplyRedGreenBlue(current_light_color, world_space_triangle.Material->DiffuseColor);
+                            }
+                            else
+                            {
+                                light_total_color += current_light_color;
+                            }
                         }
 
                         // ADD SPECULAR COLOR FROM THE CURRENT LIGHT.
@@ -263,6 +278,30 @@ namespace GRAPHICS
                         }
                     }
                 }
+
+                // ADD DIFFUSE LIGHT FROM ANY LIGHTMAP.
+                if (object_3D.Lightmap)
+                {
+                    // Filled triangles sample the lightmap for each pixel so that lighting changes (like shadow edges)
+                    // within triangles are kept, leaving only the material's response to light for each vertex.
+                    // Wireframes only have their vertices lit.
+                    ShadingType shading = world_space_triangle.Material->Shading;
+                    Color diffuse_response_color = (ShadingType::MATERIAL == shading) ?
+                        world_space_triangle.Material->DiffuseColor :
+                        Color(1.0f, 1.0f, 1.0f, 1.0f);
+                    bool lightmap_sampled_per_pixel = (
+                        (ShadingType::WIREFRAME != shading) &&
+                        (ShadingType::WIREFRAME_VERTEX_COLOR_INTERPOLATION != shading));
+                    if (lightmap_sampled_per_pixel)
+                    {
+                        triangle_lightmap_vertex_colors[vertex_index] = Color::ComponentMultiplyRedGreenBlue(vertex_color, diffuse_response_color);
+                    }
+                    else
+                    {
+                        Color lightmap_color = object_3D.Lightmap->SampleBilinear(world_space_triangle.LightmapTextureCoordinates[vertex_index]);
+                        light_total_color += Color::ComponentMultiplyRedGreenBlue(lightmap_color, diffuse_response_color);
+                    }
+                }
                 vertex_color = Color::ComponentMultiplyRedGreenBlue(vertex_color, light_total_color);
                 vertex_color.Clamp();
                 triangle_vertex_colors[vertex_index] = vertex_color;
@@ -293,7 +332,7 @@ namespace GRAPHICS
             if (triangle_within_camera_z_boundaries)
             {
                 /// @todo   Collapse triangle + vertex colors into single data type?
-                Render(screen_space_triangle, triangle_vertex_colors, render_target);
+                Render(screen_space_triangle, triangle_vertex_colors, triangle_lightmap_vertex_colors, object_3D.Lightmap.get(), render_target);
             }
         }
     }
@@ -301,8 +340,16 @@ namespace GRAPHICS
     /// Renders a single triangle to the render target.
     /// @param[in]  triangle - The triangle to render (in screen-space coordinates).
     /// @param[in]  triangle_vertex_colors - The vertex colors of the triangle.
+    /// @param[in]  triangle_lightmap_vertex_colors - The vertex colors of the triangle's response to light from
+    ///     any lightmap.  For filled pixels, these are multiplied by the lightmap and added to the vertex colors.
+    /// @param[in]  lightmap - Any lightmap to light filled pixels of the triangle with.
     /// @param[in,out]  render_target - The target to render to.
-    void Renderer::Render(const Triangle& triangle, const std::array<GRAPHICS::Color, Triangle::VERTEX_COUNT>& triangle_vertex_colors, RenderTarget& render_target) const
+    void Renderer::Render(
+        const Triangle& triangle,
+        const std::array<GRAPHICS::Color, Triangle::VERTEX_COUNT>& triangle_vertex_colors,
+        const std::array<GRAPHICS::Color, Triangle::VERTEX_COUNT>& triangle_lightmap_vertex_colors,
+        const Texture* const lightmap,
+        RenderTarget& render_target) const
     {
         // GET THE VERTICES.
         // They're needed for all kinds of shading.
@@ -459,6 +506,16 @@ namespace GRAPHICS
                             // GET THE COLOR.
                             /// @todo   Assuming all vertices have the same color here.
                             Color face_color = triangle_vertex_colors[0];
+                            if (lightmap)
+                            {
+                                Color lightmap_color = LightmapColor(
+                                    triangle,
+                                    *lightmap,
+                                    scaled_signed_distance_of_current_pixel_relative_to_bottom_edge,
+                                    scaled_signed_distance_of_current_pixel_relative_to_left_edge,
+                                    scaled_signed_distance_of_current_pixel_relative_to_right_edge);
+                                face_color += Color::ComponentMultiplyRedGreenBlue(triangle_lightmap_vertex_colors[0], lightmap_color);
+                            }
 
                             // DRAW THE COLORED PIXEL.
                             // The coordinates need to be rounded to integer in order
@@ -566,6 +623,32 @@ namespace GRAPHICS
                                 (scaled_signed_distance_of_current_pixel_relative_to_bottom_edge * first_vertex_color.Blue));
                             interpolated_color.Clamp();
 
+                            if (lightmap)
+                            {
+                                // ADD THE LIGHT FROM THE LIGHTMAP.
+                                Color lightmap_color = LightmapColor(
+                                    triangle,
+                                    *lightmap,
+                                    scaled_signed_distance_of_current_pixel_relative_to_bottom_edge,
+                                    scaled_signed_distance_of_current_pixel_relative_to_left_edge,
+                                    scaled_signed_distance_of_current_pixel_relative_to_right_edge);
+                                const Color& first_lightmap_vertex_color = triangle_lightmap_vertex_colors[0];
+                                const Color& second_lightmap_vertex_color = triangle_lightmap_vertex_colors[1];
+                                const Color& third_lightmap_vertex_color = triangle_lightmap_vertex_colors[2];
+                                Color interpolated_lightmap_vertex_color(
+                                    (scaled_signed_distance_of_current_pixel_relative_to_right_edge * third_lightmap_vertex_color.Red) +
+                                    (scaled_signed_distance_of_current_pixel_relative_to_left_edge * second_lightmap_vertex_color.Red) +
+                                    (scaled_signed_distance_of_current_pixel_relative_to_bottom_edge * first_lightmap_vertex_color.Red),
+                                    (scaled_signed_distance_of_current_pixel_relative_to_right_edge * third_lightmap_vertex_color.Green) +
+                                    (scaled_signed_distance_of_current_pixel_relative_to_left_edge * second_lightmap_vertex_color.Green) +
+                                    (scaled_signed_distance_of_current_pixel_relative_to_bottom_edge * first_lightmap_vertex_color.Green),
+                                    (scaled_signed_distance_of_current_pixel_relative_to_right_edge * third_lightmap_vertex_color.Blue) +
+                                    (scaled_signed_distance_of_current_pixel_relative_to_left_edge * second_lightmap_vertex_color.Blue) +
+                                    (scaled_signed_distance_of_current_pixel_relative_to_bottom_edge * first_lightmap_vertex_color.Blue),
+                                    Color::MAX_FLOAT_COLOR_COMPONENT);
+                                interpolated_color += Color::ComponentMultiplyRedGreenBlue(interpolated_lightmap_vertex_color, lightmap_color);
+                            }
+
                             if (ShadingType::TEXTURED == triangle.Material->Shading)
                             {
                                 // INTERPOLATE THE TEXTURE COORDINATES.
@@ -719,6 +802,34 @@ namespace GRAPHICS
 #endif
     }
 
+    /// Looks up the precomputed lighting at a point within a triangle from a lightmap.
+    /// @param[in]  triangle - The triangle whose lightmap texture coordinates to use.
+    /// @param[in]  lightmap - The lightmap to sample.
+    /// @param[in]  first_vertex_weight - The barycentric weight of the triangle's first vertex for the point.
+    /// @param[in]  second_vertex_weight - The barycentric weight of the triangle's second vertex for the point.
+    /// @param[in]  third_vertex_weight - The barycentric weight of the triangle's third vertex for the point.
+    /// @return The light at the point.
+    Color Renderer::LightmapColor(
+        const Triangle& triangle,
+        const Texture& lightmap,
+        const float first_vertex_weight,
+        const float second_vertex_weight,
+        const float third_vertex_weight)
+    {
+        const MATH::Vector2f& first_texture_coordinate = triangle.LightmapTextureCoordinates[0];
+        const MATH::Vector2f& second_texture_coordinate = triangle.LightmapTextureCoordinates[1];
+        const MATH::Vector2f& third_texture_coordinate = triangle.LightmapTextureCoordinates[2];
+        MATH::Vector2f interpolated_texture_coordinate(
+            (first_vertex_weight * first_texture_coordinate.X) +
+            (second_vertex_weight * second_texture_coordinate.X) +
+            (third_vertex_weight * third_texture_coordinate.X),
+            (first_vertex_weight * first_texture_coordinate.Y) +
+            (second_vertex_weight * second_texture_coordinate.Y) +
+            (third_vertex_weight * third_texture_coordinate.Y));
+        Color lightmap_color = lightmap.SampleBilinear(interpolated_texture_coordinate);
+        return lightmap_color;
+    }
+
     /// Renders a line with the specified endpoints (in screen coordinates).
     /// @param[in]  start_x - The starting x coordinate of the line.
     /// @param[in]  start_y - The starting y coordinate of the line.
@@ -8,6 +8,7 @@
 #include "Graphics/Light.h"
 #include "Graphics/Object3D.h"
 #include "Graphics/RenderTarget.h"
+#include "Graphics/Texture.h"
 #include "Graphics/Triangle.h"
 
 namespace GRAPHICS
@@ -26,7 +27,18 @@ namespace GRAPHICS
 
     private:
         // RENDERING.
-        void Render(const Triangle& triangle, const std::array<GRAPHICS::Color, Triangle::VERTEX_COUNT>& triangle_vertex_colors, RenderTarget& render_target) const;
+        void Render(
+            const Triangle& triangle,
+            const std::array<GRAPHICS::Color, Triangle::VERTEX_COUNT>& triangle_vertex_colors,
+            const std::array<GRAPHICS::Color, Triangle::VERTEX_COUNT>& triangle_lightmap_vertex_colors,
+            const Texture* const lightmap,
+            RenderTarget& render_target) const;
+        static Color LightmapColor(
+            const Triangle& triangle,
+            const Texture& lightmap,
+            const float first_vertex_weight,
+            const float second_vertex_weight,
+            const float third_vertex_weight);
 
         void DrawLine(
             const float start_x,
@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <cmath>
 #include <fstream>
 #include <Windows.h>
 #include "Graphics/Texture.h"
@@ -86,4 +88,34 @@ namespace GRAPHICS
         const ColorFormat color_format) :
     Bitmap(width_in_pixels, height_in_pixels, color_format)
     {}
+
+    /// Samples the texture by blending the 4 pixels nearest to the texture coordinates, which avoids
+    /// blocky results when the texture is magnified (as is typical for low-resolution textures like lightmaps).
+    /// @param[in]  texture_coordinates - The coordinates [0,1] to sample at, with (0,0) at the top-left corner
+    ///     of the top-left pixel and (1,1) at the bottom-right corner of the bottom-right pixel.
+    ///     Coordinates outside of this range are clamped to the nearest edge.
+    /// @return The sampled color.
+    Color Texture::SampleBilinear(const MATH::Vector2f& texture_coordinates) const
+    {
+        // FIND THE PIXELS SURROUNDING THE COORDINATES.
+        // Pixel centers are half a pixel from their top-left corners.
+        unsigned int width_in_pixels = Bitmap.GetWidthInPixels();
+        unsigned int height_in_pixels = Bitmap.GetHeightInPixels();
+        float max_x = static_cast<float>(width_in_pixels - 1);
+        float max_y = static_cast<float>(height_in_pixels - 1);
+        float x = std::clamp(texture_coordinates.X * static_cast<float>(width_in_pixels) - 0.5f, 0.0f, max_x);
+        float y = std::clamp(texture_coordinates.Y * static_cast<float>(height_in_pixels) - 0.5f, 0.0f, max_y);
+        unsigned int left_x = static_cast<unsigned int>(x);
+        unsigned int top_y = static_cast<unsigned int>(y);
+        unsigned int right_x = std::min(left_x + 1, width_in_pixels - 1);
+        unsigned int bottom_y = std::min(top_y + 1, height_in_pixels - 1);
+
+        // BLEND THE PIXELS BASED ON HOW CLOSE THE COORDINATES ARE TO EACH.
+        float ratio_toward_right = x - static_cast<float>(left_x);
+        float ratio_toward_bottom = y - static_cast<float>(top_y);
+        Color top_color = Color::InterpolateRedGreenBlue(Bitmap.GetPixel(left_x, top_y), Bitmap.GetPixel(right_x, top_y), ratio_toward_right);
+        Color bottom_color = Color::InterpolateRedGreenBlue(Bitmap.GetPixel(left_x, bottom_y), Bitmap.GetPixel(right_x, bottom_y), ratio_toward_right);
+        Color color = Color::InterpolateRedGreenBlue(top_color, bottom_color, ratio_toward_bottom);
+        return color;
+    }
 }
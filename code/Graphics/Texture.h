@@ -2,8 +2,10 @@
 
 #include <filesystem>
 #include <memory>
+#include "Graphics/Color.h"
 #include "Graphics/ColorFormat.h"
 #include "Graphics/RenderTarget.h"
+#include "Math/Vector2.h"
 
 namespace GRAPHICS
 {
@@ -18,6 +20,8 @@ namespace GRAPHICS
             const unsigned int height_in_pixels,
             const ColorFormat color_format);
 
+        Color SampleBilinear(const MATH::Vector2f& texture_coordinates) const;
+
         RenderTarget Bitmap;
     };
 }
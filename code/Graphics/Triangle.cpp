@@ -130,4 +130,26 @@ namespace GRAPHICS
         intersection.Object = this;
         return intersection;
     }
+
+    /// Computes the bounds of the triangle.
+    /// @return A box containing the entire triangle.
+    RAY_TRACING::AxisAlignedBoundingBox Triangle::Bounds() const
+    {
+        RAY_TRACING::AxisAlignedBoundingBox bounds;
+        for (const MATH::Vector3f& vertex : Vertices)
+        {
+            bounds.Expand(vertex);
+        }
+        return bounds;
+    }
+
+    /// Gets the triangle's vertices as a single triangle, allowing it to be rasterized.
+    /// The vertices are already in world space.
+    /// @param[out]  world_triangles - The vertices of this triangle.
+    /// @return True since triangles are always composed of a triangle.
+    bool Triangle::WorldTriangles(std::vector< std::array<MATH::Vector3f, VERTEX_COUNT> >& world_triangles) const
+    {
+        world_triangles.assign(1, Vertices);
+        return true;
+    }
 }
@@ -3,10 +3,12 @@
 #include <array>
 #include <cstddef>
 #include <memory>
+#include <vector>
 #include "Graphics/Material.h"
 #include "Graphics/RayTracing/IObject3D.h"
 #include "Graphics/RayTracing/Ray.h"
 #include "Graphics/RayTracing/RayObjectIntersection.h"
+#include "Math/Vector2.h"
 #include "Math/Vector3.h"
 
 namespace GRAPHICS
@@ -29,6 +31,8 @@ namespace GRAPHICS
         MATH::Vector3f SurfaceNormal(const MATH::Vector3f& surface_point) const override;
         const Material* GetMaterial() const override;
         std::optional<RAY_TRACING::RayObjectIntersection> Intersect(const RAY_TRACING::Ray& ray) const override;
+        RAY_TRACING::AxisAlignedBoundingBox Bounds() const override;
+        bool WorldTriangles(std::vector< std::array<MATH::Vector3f, VERTEX_COUNT> >& world_triangles) const override;
 
         // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
         /// The material of the triangle.
@@ -36,5 +40,12 @@ namespace GRAPHICS
         /// The vertices of the triangle.
         /// Should be in counter-clockwise order.
         std::array<MATH::Vector3f, VERTEX_COUNT> Vertices = {};
+        /// The proportion [0, 1] of ambient light reaching each vertex, with 0 for fully occluded
+        /// and 1 for unoccluded vertices.  Typically baked with an \ref RAY_TRACING::AmbientOcclusionBaker.
+        std::array<float, VERTEX_COUNT> VertexAmbientOcclusion = { 1.0f, 1.0f, 1.0f };
+        /// The coordinates [0,1] of each vertex within the lightmap of the object containing the triangle.
+        /// Only used if the object has a lightmap.  Unlike material texture coordinates, these are
+        /// per triangle since each triangle needs its own area of the lightmap.
+        std::array<MATH::Vector2f, VERTEX_COUNT> LightmapTextureCoordinates = {};
     };
 }
@@ -0,0 +1,69 @@
+#include <cstring>
+#include "Math/CounterBasedRandomNumberGenerator.h"
+
+namespace MATH
+{
+    /// Hashes a value so that similar inputs produce very different outputs.
+    /// This is the permuted congruential generator (PCG) output permutation applied to a single step of its
+    /// linear congruential generator, which is cheap and mixes all input bits well.
+    /// @param[in]  value - The value to hash.
+    /// @return The hashed value.
+    std::uint32_t CounterBasedRandomNumberGenerator::Hash(const std::uint32_t value)
+    {
+        std::uint32_t state = value * 747796405u + 2891336453u;
+        std::uint32_t word = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+        std::uint32_t hash = (word >> 22u) ^ word;
+        return hash;
+    }
+
+    /// Combines an additional value into an existing hash.
+    /// @param[in]  hash - The existing hash.
+    /// @param[in]  value - The value to combine into the hash.
+    /// @return The combined hash.
+    std::uint32_t CounterBasedRandomNumberGenerator::HashCombine(const std::uint32_t hash, const std::uint32_t value)
+    {
+        std::uint32_t combined_hash = Hash(hash ^ Hash(value));
+        return combined_hash;
+    }
+
+    /// Combines the exact bits of a floating-point value into an existing hash.
+    /// @param[in]  hash - The existing hash.
+    /// @param[in]  value - The value to combine into the hash.
+    /// @return The combined hash.
+    std::uint32_t CounterBasedRandomNumberGenerator::HashFloat(const std::uint32_t hash, const float value)
+    {
+        static_assert(sizeof(std::uint32_t) == sizeof(float), "Floats must be 32 bits to be hashed.");
+        std::uint32_t value_bits = 0;
+        std::memcpy(&value_bits, &value, sizeof(value_bits));
+        std::uint32_t combined_hash = HashCombine(hash, value_bits);
+        return combined_hash;
+    }
+
+    /// Constructor.
+    /// @param[in]  key - The key identifying the sequence of random numbers.
+    CounterBasedRandomNumberGenerator::CounterBasedRandomNumberGenerator(const std::uint32_t key) :
+        Key(key),
+        Counter(0)
+    {}
+
+    /// Gets the next random integer in the sequence.
+    /// @return A random integer uniformly distributed over all 32-bit values.
+    std::uint32_t CounterBasedRandomNumberGenerator::NextUint32()
+    {
+        std::uint32_t random_number = HashCombine(Key, Counter);
+        ++Counter;
+        return random_number;
+    }
+
+    /// Gets the next random floating-point number in the sequence.
+    /// @return A random number uniformly distributed in [0, 1).
+    float CounterBasedRandomNumberGenerator::NextUniformFloat()
+    {
+        // USE THE UPPER 24 BITS SINCE THAT'S ALL A FLOAT CAN EXACTLY REPRESENT.
+        // This guarantees the result is strictly less than 1.
+        constexpr float INVERSE_2_TO_THE_24 = 1.0f / 16777216.0f;
+        std::uint32_t random_bits = NextUint32() >> 8u;
+        float random_number = static_cast<float>(random_bits) * INVERSE_2_TO_THE_24;
+        return random_number;
+    }
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+
+namespace MATH
+{
+    /// A random number generator whose numbers are computed directly by hashing a key and a counter,
+    /// rather than by advancing some hidden state.  The same key always produces the same sequence,
+    /// so independent sequences can be created wherever they're needed (for example, one per pixel
+    /// or per surface point) without any shared state, allowing deterministic results even when
+    /// work is split across threads in different ways.
+    class CounterBasedRandomNumberGenerator
+    {
+    public:
+        // STATIC HASHING METHODS.
+        static std::uint32_t Hash(const std::uint32_t value);
+        static std::uint32_t HashCombine(const std::uint32_t hash, const std::uint32_t value);
+        static std::uint32_t HashFloat(const std::uint32_t hash, const float value);
+
+        // CONSTRUCTION.
+        explicit CounterBasedRandomNumberGenerator(const std::uint32_t key);
+
+        // RANDOM NUMBERS.
+        std::uint32_t NextUint32();
+        float NextUniformFloat();
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The key identifying the sequence of random numbers.
+        std::uint32_t Key = 0;
+        /// The index of the next random number in the sequence.
+        std::uint32_t Counter = 0;
+    };
+}
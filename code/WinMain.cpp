@@ -20,13 +20,16 @@
 #include <Windows.h>
 #include "Graphics/Camera.h"
 #include "Graphics/Cube.h"
+#include "Graphics/ExampleLighting.h"
+#include "Graphics/ExampleMaterials.h"
 #include "Graphics/Gui/Font.h"
 #include "Graphics/Light.h"
 #include "Graphics/Material.h"
 #include "Graphics/Modeling/WavefrontObjectModel.h"
 #include "Graphics/Object3D.h"
+#include "Graphics/RayTracing/BackgroundRenderJob.h"
+#include "Graphics/RayTracing/ExampleScenes.h"
 #include "Graphics/RayTracing/RayTracingAlgorithm.h"
-#include "Graphics/RayTracing/Sphere.h"
 #include "Graphics/Renderer.h"
 #include "Graphics/RenderTarget.h"
 #include "Graphics/Texture.h"
@@ -46,183 +49,7 @@ static std::size_t g_current_material_index = 0;
 /// The objects currently being rendered.
 static std::vector<GRAPHICS::Object3D> g_objects;
 /// The available lighting configurations.
-static std::vector< std::vector<GRAPHICS::Light> > g_light_configurations =
-{
-    // Full white ambient light.
-    std::vector<GRAPHICS::Light>
-    {
-        GRAPHICS::Light
-        {
-            .Type = GRAPHICS::LightType::AMBIENT,
-            .Color = GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f),
-        },
-    },
-    // Half strength ambient light.
-    std::vector<GRAPHICS::Light>
-    {
-        GRAPHICS::Light
-        {
-            .Type = GRAPHICS::LightType::AMBIENT,
-            .Color = GRAPHICS::Color(0.5f, 0.5f, 0.5f, 1.0f)
-        },
-    },
-    // Pitch-black ambient lighting.
-    std::vector<GRAPHICS::Light>
-    {
-        GRAPHICS::Light
-        {
-            .Type = GRAPHICS::LightType::AMBIENT,
-            .Color = GRAPHICS::Color(0.0f, 0.0f, 0.0f, 1.0f)
-        },
-    },
-    // Red ambient light.
-    std::vector<GRAPHICS::Light>
-    {
-        GRAPHICS::Light
-        {
-            .Type = GRAPHICS::LightType::AMBIENT,
-            .Color = GRAPHICS::Color(1.0f, 0.0f, 0.0f, 1.0f)
-        },
-    },
-    // Green ambient light.
-    std::vector<GRAPHICS::Light>
-    {
-        GRAPHICS::Light
-        {
-            .Type = GRAPHICS::LightType::AMBIENT,
-            .Color = GRAPHICS::Color(0.0f, 1.0f, 0.0f, 1.0f)
-        },
-    },
-    // Blue ambient light.
-    std::vector<GRAPHICS::Light>
-    {
-        GRAPHICS::Light
-        {
-            .Type = GRAPHICS::LightType::AMBIENT,
-            .Color = GRAPHICS::Color(0.0f, 0.0f, 1.0f, 1.0f)
-        },
-    },
-    // White directional light going left.
-    std::vector<GRAPHICS::Light>
-    {
-        GRAPHICS::Light
-        {
-            .Type = GRAPHICS::LightType::DIRECTIONAL,
-            .Color = GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f),
-            .DirectionalLightDirection = MATH::Vector3f(-1.0f, 0.0f, 0.0f)
-        },
-    },
-    // White directional light going right.
-    std::vector<GRAPHICS::Light>
-    {
-        GRAPHICS::Light
-        {
-            .Type = GRAPHICS::LightType::DIRECTIONAL,
-            .Color = GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f),
-            .DirectionalLightDirection = MATH::Vector3f(1.0f, 0.0f, 0.0f)
-        },
-    },
-    // White directional light going down.
-    std::vector<GRAPHICS::Light>
-    {
-        GRAPHICS::Light
-        {
-            .Type = GRAPHICS::LightType::DIRECTIONAL,
-            .Color = GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f),
-            .DirectionalLightDirection = MATH::Vector3f(0.0f, -1.0f, 0.0f)
-        },
-    },
-    // White directional light going up.
-    std::vector<GRAPHICS::Light>
-    {
-        GRAPHICS::Light
-        {
-            .Type = GRAPHICS::LightType::DIRECTIONAL,
-            .Color = GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f),
-            .DirectionalLightDirection = MATH::Vector3f(0.0f, 1.0f, 0.0f)
-        },
-    },
-    // Red directional light at an angle.
-    std::vector<GRAPHICS::Light>
-    {
-        GRAPHICS::Light
-        {
-            .Type = GRAPHICS::LightType::DIRECTIONAL,
-            .Color = GRAPHICS::Color(1.0f, 0.0f, 0.0f, 1.0f),
-            .DirectionalLightDirection = MATH::Vector3f::Normalize(MATH::Vector3f(1.0f, 1.0f, 0.0f))
-        },
-    },
-    // Green directional light at an angle.
-    std::vector<GRAPHICS::Light>
-    {
-        GRAPHICS::Light
-        {
-            .Type = GRAPHICS::LightType::DIRECTIONAL,
-            .Color = GRAPHICS::Color(0.0f, 1.0f, 0.0f, 1.0f),
-            .DirectionalLightDirection = MATH::Vector3f::Normalize(MATH::Vector3f(0.0f, 1.0f, 1.0f))
-        },
-    },
-    // Blue directional light at an angle.
-    std::vector<GRAPHICS::Light>
-    {
-        GRAPHICS::Light
-        {
-            .Type = GRAPHICS::LightType::DIRECTIONAL,
-            .Color = GRAPHICS::Color(0.0f, 0.0f, 1.0f, 1.0f),
-            .DirectionalLightDirection = MATH::Vector3f::Normalize(MATH::Vector3f(1.0f, 0.0f, 1.0f))
-        },
-    },
-    // White point light at center.
-    std::vector<GRAPHICS::Light>
-    {
-        GRAPHICS::Light
-        {
-            .Type = GRAPHICS::LightType::POINT,
-            .Color = GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f),
-            .PointLightWorldPosition = MATH::Vector3f(0.0f, 0.0f, 0.0f)
-        },
-    },
-    // Red-green light at left.
-    std::vector<GRAPHICS::Light>
-    {
-        GRAPHICS::Light
-        {
-            .Type = GRAPHICS::LightType::POINT,
-            .Color = GRAPHICS::Color(1.0f, 1.0f, 0.0f, 1.0f),
-            .PointLightWorldPosition = MATH::Vector3f(-50.0f, 0.0f, 0.0f)
-        },
-    },
-    // Green-blue light at right.
-    std::vector<GRAPHICS::Light>
-    {
-        GRAPHICS::Light
-        {
-            .Type = GRAPHICS::LightType::POINT,
-            .Color = GRAPHICS::Color(0.0f, 1.0f, 1.0f, 1.0f),
-            .PointLightWorldPosition = MATH::Vector3f(50.0f, 0.0f, 0.0f)
-        },
-    },
-    // Blue-red light at top.
-    std::vector<GRAPHICS::Light>
-    {
-        GRAPHICS::Light
-        {
-            .Type = GRAPHICS::LightType::POINT,
-            .Color = GRAPHICS::Color(1.0f, 0.0f, 1.0f, 1.0f),
-            .PointLightWorldPosition = MATH::Vector3f(0.0f, 50.0f, 0.0f)
-        },
-    },
-    // Green-blue light at bottom.
-    std::vector<GRAPHICS::Light>
-    {
-        GRAPHICS::Light
-        {
-            .Type = GRAPHICS::LightType::POINT,
-            .Color = GRAPHICS::Color(0.0f, 1.0f, 1.0f, 1.0f),
-            .PointLightWorldPosition = MATH::Vector3f(0.0f, -50.0f, 0.0f)
-        },
-    },
-};
+static std::vector< std::vector<GRAPHICS::Light> > g_light_configurations = GRAPHICS::ExampleLighting::CreateConfigurations();
 /// Current light index into array above.
 static std::size_t g_current_light_index = 0;
 /// The lights currently being used in the scene.
@@ -230,326 +57,10 @@ static std::vector<GRAPHICS::Light>* g_lights = &g_light_configurations[g_curren
 
 #define USE_RAY_TRACING 0
 #if USE_RAY_TRACING
-static std::unique_ptr<GRAPHICS::RAY_TRACING::Scene> g_scene = nullptr;
+static std::shared_ptr<GRAPHICS::RAY_TRACING::Scene> g_scene = nullptr;
 static GRAPHICS::RAY_TRACING::RayTracingAlgorithm* g_ray_tracer = nullptr;
 static GRAPHICS::RenderTarget* g_render_target = nullptr;
-std::unique_ptr<GRAPHICS::RAY_TRACING::Scene> CreateScene(const unsigned int scene_number)
-{
-    switch (scene_number)
-    {
-        case 0:
-        {
-            // BASIC TRIANGLE.
-            auto scene = std::make_unique<GRAPHICS::RAY_TRACING::Scene>();
-            scene->PointLights.push_back(GRAPHICS::Light
-            {
-                .Color = GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f),
-                .PointLightWorldPosition = MATH::Vector3f(0.0f, 0.0f, 0.0f),
-            });
-            scene->BackgroundColor = GRAPHICS::Color(0.3f, 0.3f, 0.7f, 0.0f);
-
-            auto material = std::make_shared<GRAPHICS::Material>();
-            material->DiffuseColor = GRAPHICS::Color(0.8f, 0.8f, 0.8f, 1.0f);
-            material->AmbientColor = GRAPHICS::Color(0.0f, 0.0f, 0.0f, 1.0f);
-            material->SpecularColor = GRAPHICS::Color(0.0f, 0.0f, 0.0f, 1.0f);
-            material->SpecularPower = 1.0f;
-            material->ReflectivityProportion = 0.0f;
-
-            auto triangle = std::make_unique<GRAPHICS::Triangle>();
-            triangle->Vertices =
-            {
-                MATH::Vector3f(-1.0f, -1.0f, -2.0f),
-                MATH::Vector3f(1.0f, -1.0f, -2.0f),
-                MATH::Vector3f(0.0f, 1.0f, -2.0f),
-            };
-            triangle->Material = material;
-            scene->Objects.push_back(std::move(triangle));
-            return scene;
-        }
-        case 1:
-        {
-            // MULTIPLE TRIANGLES.
-            auto scene = std::make_unique<GRAPHICS::RAY_TRACING::Scene>();
-            scene->PointLights.push_back(GRAPHICS::Light
-            {
-                .Color = GRAPHICS::Color(0.7f, 0.7f, 0.7f, 1.0f),
-                .PointLightWorldPosition = MATH::Vector3f(4.0f, 4.0f, 8.0f),
-            });
-            scene->BackgroundColor = GRAPHICS::Color(0.2f, 0.2f, 1.0f, 0.0f);
-
-            auto material = std::make_shared<GRAPHICS::Material>();
-            material->DiffuseColor = GRAPHICS::Color(0.8f, 0.8f, 0.8f, 1.0f);
-            material->AmbientColor = GRAPHICS::Color(0.2f, 0.2f, 0.2f, 1.0f);
-            material->SpecularColor = GRAPHICS::Color(0.0f, 0.0f, 0.0f, 1.0f);
-            material->SpecularPower = 1.0f;
-            material->ReflectivityProportion = 0.0f;
-
-            auto triangle = std::make_unique<GRAPHICS::Triangle>();
-            triangle->Vertices =
-            {
-                MATH::Vector3f(-0.1f, -0.1f, -2.0f),
-                MATH::Vector3f(0.1f, -0.1f, -2.0f),
-                MATH::Vector3f(0.0f, 0.1f, -2.0f),
-            };
-            triangle->Material = material;
-            scene->Objects.push_back(std::move(triangle));
-
-            triangle = std::make_unique<GRAPHICS::Triangle>();
-            triangle->Vertices =
-            {
-                MATH::Vector3f(-0.9f, -0.9f, -2.0f),
-                MATH::Vector3f(0.7f, -0.7f, -2.0f),
-                MATH::Vector3f(-0.7f, -0.6f, -2.0f),
-            };
-            triangle->Material = material;
-            scene->Objects.push_back(std::move(triangle));
-
-            triangle = std::make_unique<GRAPHICS::Triangle>();
-            triangle->Vertices =
-            {
-                MATH::Vector3f(0.5f, -0.5f, -2.0f),
-                MATH::Vector3f(0.8f, -0.7f, -2.0f),
-                MATH::Vector3f(0.6f, 0.6f, -2.0f),
-            };
-            triangle->Material = material;
-            scene->Objects.push_back(std::move(triangle));
-        
-            return scene;
-        }
-        case 2:
-        {
-            auto scene = std::make_unique<GRAPHICS::RAY_TRACING::Scene>();
-            scene->PointLights.push_back(GRAPHICS::Light
-            {
-                .Color = GRAPHICS::Color(0.7f, 0.7f, 0.7f, 1.0f),
-                .PointLightWorldPosition = MATH::Vector3f(4.0f, 4.0f, 8.0f),
-            });
-            scene->BackgroundColor = GRAPHICS::Color(0.2f, 0.2f, 1.0f, 0.0f);
-
-            // TRIANLGE + SPHERE.
-            auto material = std::make_shared<GRAPHICS::Material>();
-            material->DiffuseColor = GRAPHICS::Color(0.8f, 0.8f, 0.8f, 1.0f);
-            material->AmbientColor = GRAPHICS::Color(0.2f, 0.2f, 0.2f, 1.0f);
-            material->SpecularColor = GRAPHICS::Color(0.0f, 0.0f, 0.0f, 1.0f);
-            material->SpecularPower = 1.0f;
-            material->ReflectivityProportion = 0.0f;
-
-            auto triangle = std::make_unique<GRAPHICS::Triangle>();
-            triangle->Vertices =
-            {
-                MATH::Vector3f(-1.0f, -1.0f, -3.0f),
-                MATH::Vector3f(1.0f, -1.0f, -3.0f),
-                MATH::Vector3f(0.0f, 1.0f, -3.0f),
-            };
-            triangle->Material = material;
-            scene->Objects.push_back(std::move(triangle));
-
-            // SPHERE.
-            auto sphere_material = std::make_shared<GRAPHICS::Material>();
-            sphere_material->DiffuseColor = GRAPHICS::Color(0.8f, 0.2f, 0.7f, 1.0f);
-            sphere_material->AmbientColor = GRAPHICS::Color(0.3f, 0.1f, 0.6f, 1.0f);
-            sphere_material->SpecularColor = GRAPHICS::Color(0.0f, 0.0f, 0.0f, 1.0f);
-            sphere_material->SpecularPower = 1.0f;
-            sphere_material->ReflectivityProportion = 0.0f;
-
-            auto sphere = std::make_unique<GRAPHICS::RAY_TRACING::Sphere>();
-            sphere->CenterPosition = MATH::Vector3f(0.0f, 0.0f, -3.0f);
-            sphere->Radius = 0.87f;
-            sphere->Material = sphere_material;
-
-            scene->Objects.push_back(std::move(sphere));
-
-            return scene;
-        }
-        case 3:
-        {
-            // MULTIPLE LIGHTS.
-            auto scene = std::make_unique<GRAPHICS::RAY_TRACING::Scene>();
-            scene->PointLights.push_back(GRAPHICS::Light
-            {
-                .Color = GRAPHICS::Color(0.9f, 0.0f, 0.0f, 1.0f),
-                .PointLightWorldPosition = MATH::Vector3f(3.0f, 4.0f, 0.0f),
-            });
-            scene->PointLights.push_back(GRAPHICS::Light
-            {
-                .Color = GRAPHICS::Color(0.0f, 0.9f, 0.0f, 1.0f),
-                .PointLightWorldPosition = MATH::Vector3f(-4.0f, 5.0f, 0.0f),
-            });
-            scene->PointLights.push_back(GRAPHICS::Light
-            {
-                .Color = GRAPHICS::Color(0.0f, 0.0f, 0.9f, 1.0f),
-                .PointLightWorldPosition = MATH::Vector3f(0.0f, 4.0f, -5.0f),
-            });
-            scene->BackgroundColor = GRAPHICS::Color(0.2f, 0.2f, 1.0f, 0.0f);
-
-            // Ground plane.
-            auto material = std::make_shared<GRAPHICS::Material>();
-            material->DiffuseColor = GRAPHICS::Color(0.8f, 0.8f, 0.8f, 1.0f);
-            material->AmbientColor = GRAPHICS::Color(0.2f, 0.2f, 0.2f, 1.0f);
-            material->SpecularColor = GRAPHICS::Color(0.1f, 0.1f, 0.1f, 1.0f);
-            material->SpecularPower = 1.0f;
-            material->ReflectivityProportion = 0.5f;
-
-            auto triangle = std::make_unique<GRAPHICS::Triangle>();
-            triangle->Vertices =
-            {
-                MATH::Vector3f(-100.0f, -1.0f, -100.0f),
-                MATH::Vector3f(100.0f, -1.0f, 100.0f),
-                MATH::Vector3f(100.0f, -1.0f, -100.0f)
-            };
-            triangle->Material = material;
-            scene->Objects.push_back(std::move(triangle));
-
-            triangle = std::make_unique<GRAPHICS::Triangle>();
-            triangle->Vertices =
-            {
-                MATH::Vector3f(100.0f, -1.0f, 100.0f),
-                MATH::Vector3f(-100.0f, -1.0f, -100.0f),
-                MATH::Vector3f(-100.0f, -1.0f, 100.0f)
-            };
-            triangle->Material = material;
-            scene->Objects.push_back(std::move(triangle));
-
-            // SPHERE.
-            auto sphere_material = std::make_shared<GRAPHICS::Material>();
-            sphere_material->DiffuseColor = GRAPHICS::Color(0.8f, 0.8f, 0.8f, 1.0f);
-            sphere_material->AmbientColor = GRAPHICS::Color(0.2f, 0.2f, 0.2f, 1.0f);
-            sphere_material->SpecularColor = GRAPHICS::Color(0.1f, 0.1f, 0.1f, 1.0f);
-            sphere_material->SpecularPower = 1.0f;
-            sphere_material->ReflectivityProportion = 0.5f;
-
-            auto sphere = std::make_unique<GRAPHICS::RAY_TRACING::Sphere>();
-            sphere->CenterPosition = MATH::Vector3f(0.0f, 0.5f, -3.0f);
-            sphere->Radius = 0.7f;
-            sphere->Material = sphere_material;
-
-            scene->Objects.push_back(std::move(sphere));
-
-            return scene;
-        }
-        case 4:
-        {
-            // MULTIPLE REFLECTIVE SPHERES.
-            auto scene = std::make_unique<GRAPHICS::RAY_TRACING::Scene>();
-            scene->PointLights.push_back(GRAPHICS::Light
-            {
-                .Color = GRAPHICS::Color(0.7f, 0.7f, 0.7f, 1.0f),
-                .PointLightWorldPosition = MATH::Vector3f(8.0f, 8.0f, 3.0f),
-            });
-            scene->PointLights.push_back(GRAPHICS::Light
-            {
-                .Color = GRAPHICS::Color(0.3f, 0.3f, 0.3f, 1.0f),
-                .PointLightWorldPosition = MATH::Vector3f(-4.0f, 2.0f, 0.0f),
-            });
-            scene->BackgroundColor = GRAPHICS::Color(0.2f, 0.2f, 1.0f, 0.0f);
-
-            // Ground plane.
-            auto material = std::make_shared<GRAPHICS::Material>();
-            material->DiffuseColor = GRAPHICS::Color(0.8f, 0.8f, 0.8f, 1.0f);
-            material->AmbientColor = GRAPHICS::Color(0.2f, 0.2f, 0.2f, 1.0f);
-            material->SpecularColor = GRAPHICS::Color(0.0f, 0.0f, 0.0f, 1.0f);
-            material->SpecularPower = 1.0f;
-            material->ReflectivityProportion = 0.5f;
-
-            auto triangle = std::make_unique<GRAPHICS::Triangle>();
-            triangle->Vertices =
-            {
-                MATH::Vector3f(-100.0f, -1.0f, -100.0f),
-                MATH::Vector3f(100.0f, -1.0f, 100.0f),
-                MATH::Vector3f(100.0f, -1.0f, -100.0f)
-            };
-            triangle->Material = material;
-            scene->Objects.push_back(std::move(triangle));
-
-            triangle = std::make_unique<GRAPHICS::Triangle>();
-            triangle->Vertices =
-            {
-                MATH::Vector3f(100.0f, -1.0f, 100.0f),
-                MATH::Vector3f(-100.0f, -1.0f, -100.0f),
-                MATH::Vector3f(-100.0f, -1.0f, 100.0f)
-            };
-            triangle->Material = material;
-            scene->Objects.push_back(std::move(triangle));
-
-            // SPHERE.
-            auto sphere_material = std::make_shared<GRAPHICS::Material>();
-            sphere_material->DiffuseColor = GRAPHICS::Color(0.6f, 0.6f, 0.6f, 1.0f);
-            sphere_material->AmbientColor = GRAPHICS::Color(0.2f, 0.2f, 0.2f, 1.0f);
-            sphere_material->SpecularColor = GRAPHICS::Color(0.7f, 0.7f, 0.7f, 1.0f);
-            sphere_material->SpecularPower = 20.0f;
-            sphere_material->ReflectivityProportion = 0.7f;
-
-            auto sphere = std::make_unique<GRAPHICS::RAY_TRACING::Sphere>();
-            sphere->CenterPosition = MATH::Vector3f(1.2f, 0.0f, -5.0f);
-            sphere->Radius = 1.0f;
-            sphere_material->AmbientColor = GRAPHICS::Color(1.0f, 0.0f, 0.0f, 1.0f);
-            sphere_material->DiffuseColor = sphere_material->AmbientColor;
-            sphere->Material = sphere_material;
-            scene->Objects.push_back(std::move(sphere));
-
-            sphere = std::make_unique<GRAPHICS::RAY_TRACING::Sphere>();
-            sphere->CenterPosition = MATH::Vector3f(0.0f, 0.3f, -1.5f);
-            sphere->Radius = 0.2f;
-            sphere_material->AmbientColor = GRAPHICS::Color(0.0f, 1.0f, 0.0f, 1.0f);
-            sphere_material->DiffuseColor = sphere_material->AmbientColor;
-            sphere->Material = sphere_material;
-            scene->Objects.push_back(std::move(sphere));
-
-            sphere = std::make_unique<GRAPHICS::RAY_TRACING::Sphere>();
-            sphere->CenterPosition = MATH::Vector3f(-1.0f, -0.5f, -3.0f);
-            sphere->Radius = 0.5f;
-            sphere_material->AmbientColor = GRAPHICS::Color(0.0f, 0.0f, 1.0f, 1.0f);
-            sphere_material->DiffuseColor = sphere_material->AmbientColor;
-            sphere->Material = sphere_material;
-            scene->Objects.push_back(std::move(sphere));
-
-            return scene;
-        }
-        case 5:
-        {
-            auto scene = std::make_unique<GRAPHICS::RAY_TRACING::Scene>();
-            scene->PointLights.push_back(GRAPHICS::Light
-            {
-                .Color = GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f),
-                .PointLightWorldPosition = MATH::Vector3f(-5.0f, 2.0f, 5.0f),
-            });
-            scene->BackgroundColor = GRAPHICS::Color::BLACK;
-
-            // SPHERE 1.
-            auto sphere_material = std::make_shared<GRAPHICS::Material>();
-            sphere_material->DiffuseColor = GRAPHICS::Color(0.5f, 0.0f, 0.5f, 1.0f);
-            sphere_material->AmbientColor = GRAPHICS::Color(0.2f, 0.0f, 0.2f, 1.0f);
-            sphere_material->SpecularColor = GRAPHICS::Color(0.7f, 0.7f, 0.7f, 1.0f);
-            sphere_material->SpecularPower = 20.0f;
-            sphere_material->ReflectivityProportion = 0.8f;
-
-            auto sphere = std::make_unique<GRAPHICS::RAY_TRACING::Sphere>();
-            sphere->CenterPosition = MATH::Vector3f(0.0f, 0.0f, -4.0f);
-            sphere->Radius = 1.0f;
-            sphere->Material = sphere_material;
-            scene->Objects.push_back(std::move(sphere));
-
-            // SPHERE 2.
-            sphere_material = std::make_shared<GRAPHICS::Material>();
-            sphere_material->DiffuseColor = GRAPHICS::Color(0.0f, 0.5f, 0.0f, 1.0f);
-            sphere_material->AmbientColor = GRAPHICS::Color(0.0f, 0.2f, 0.0f, 1.0f);
-            sphere_material->SpecularColor = GRAPHICS::Color(0.0f, 0.2f, 0.0f, 1.0f);
-            sphere_material->SpecularPower = 1.0f;
-            sphere_material->ReflectivityProportion = 0.0f;
-
-            sphere = std::make_unique<GRAPHICS::RAY_TRACING::Sphere>();
-            sphere->CenterPosition = MATH::Vector3f(1.0f, 0.6f, -3.0f);
-            sphere->Radius = 0.3f;
-            sphere->Material = sphere_material;
-            scene->Objects.push_back(std::move(sphere));
-
-            return scene;
-        }
-        default:
-            return nullptr;
-    }
-}
-
+static GRAPHICS::RAY_TRACING::BackgroundRenderJob* g_render_job = nullptr;
 /// The main window callback procedure for processing messages sent to the main application window.
 /// @param[in]  window - Handle to the window.
 /// @param[in]  message - The message.
@@ -627,22 +138,31 @@ LRESULT CALLBACK MainWindowCallback(
                     }
                     break;
                 case 0x51: // Q
-                    g_scene = CreateScene(0);
+                    g_scene = GRAPHICS::RAY_TRACING::ExampleScenes::Create(0);
                     break;
                 case 0x57: // W
-                    g_scene = CreateScene(1);
+                    g_scene = GRAPHICS::RAY_TRACING::ExampleScenes::Create(1);
                     break;
                 case 0x45: // E
-                    g_scene = CreateScene(2);
+                    g_scene = GRAPHICS::RAY_TRACING::ExampleScenes::Create(2);
                     break;
                 case 0x52: // R
-                    g_scene = CreateScene(3);
+                    g_scene = GRAPHICS::RAY_TRACING::ExampleScenes::Create(3);
                     break;
                 case 0x54: // T
-                    g_scene = CreateScene(4);
+                    g_scene = GRAPHICS::RAY_TRACING::ExampleScenes::Create(4);
                     break;
                 case 0x59: // Y
-                    g_scene = CreateScene(5);
+                    g_scene = GRAPHICS::RAY_TRACING::ExampleScenes::Create(5);
+                    break;
+                case 0x55: // U
+                    g_scene = GRAPHICS::RAY_TRACING::ExampleScenes::Create(6);
+                    break;
+                case 0x49: // I
+                    g_scene = GRAPHICS::RAY_TRACING::ExampleScenes::Create(7);
+                    break;
+                case 0x4B: // K
+                    g_ray_tracer->ManyLightSampling = !g_ray_tracer->ManyLightSampling;
                     break;
                 case 0x41: // A
                     g_ray_tracer->Ambient = !g_ray_tracer->Ambient;
@@ -669,7 +189,11 @@ LRESULT CALLBACK MainWindowCallback(
 
             OutputDebugString(std::to_string(g_ray_tracer->Camera.ViewingPlane.FocalLength).c_str());
             OutputDebugString("\n");
-            g_ray_tracer->Render(*g_scene, *g_render_target);
+
+            // RESTART RENDERING SINCE SETTINGS MAY HAVE CHANGED.
+            // Any stale image still being rendered is cancelled without waiting for its threads to stop.  Rendering
+            // happens on background threads so that the window stays responsive regardless of how expensive the scene is.
+            g_render_job->Start(*g_ray_tracer, g_scene, *g_render_target);
             break;
         }
         /// @todo case WM_SETCURSOR:
@@ -754,17 +278,22 @@ int CALLBACK WinMain(
     GRAPHICS::RenderTarget render_target(SCREEN_WIDTH_IN_PIXELS, SCREEN_HEIGHT_IN_PIXELS, GRAPHICS::ColorFormat::ARGB);
 
     // CREATE A SCENE.
-    g_scene = CreateScene(0);
+    g_scene = GRAPHICS::RAY_TRACING::ExampleScenes::Create(0);
 
     // PERFORM RAY TRACING.
     GRAPHICS::RAY_TRACING::RayTracingAlgorithm ray_tracer;
 
     ray_tracer.Camera = GRAPHICS::Camera::LookAtFrom(MATH::Vector3f(0.0f, 0.0f, 0.0f), MATH::Vector3f(0.0f, 0.0f, 1.0f));
 
-    ray_tracer.Render(*g_scene, render_target);
+    GRAPHICS::RAY_TRACING::BackgroundRenderJob render_job;
+    render_job.Start(ray_tracer, g_scene, render_target);
 
     g_render_target = &render_target;
     g_ray_tracer = &ray_tracer;
+    g_render_job = &render_job;
+
+    // The number of the last frame from the render job that was copied for presentation.
+    std::size_t presented_frame_number = 0;
 
     bool running = true;
     while (running)
@@ -804,7 +333,22 @@ int CALLBACK WinMain(
             DispatchMessage(&message);
         }
 
+        // PRESENT THE LATEST FINISHED IMAGE.
+        // The previous image remains displayed while a new image is rendered in the background.
+        // Finished images are only copied once rather than every time the window is updated.
+        const GRAPHICS::RenderTarget* finished_frame = render_job.FinishedFrame();
+        bool new_frame_finished = (finished_frame && (render_job.FrameNumber() != presented_frame_number));
+        if (new_frame_finished)
+        {
+            render_target = *finished_frame;
+            presented_frame_number = render_job.FrameNumber();
+        }
         g_window->Display(render_target);
+
+        // WAIT UNTIL THE NEXT FRAME.
+        // Rendering happens on other threads, so this thread only needs to wake up to handle input.
+        constexpr std::chrono::milliseconds FRAME_DURATION(16);
+        std::this_thread::sleep_for(FRAME_DURATION);
     }
 
     return EXIT_SUCCESS;
@@ -1054,68 +598,7 @@ int CALLBACK WinMain(
     // DEFINE A VARIETY OF MATERIALS.
     // These can't be initialized statically since some of the color constants are also static,
     // and initialization order isn't clearly defined.
-    g_materials_by_shading_type =
-    {
-        std::make_shared<GRAPHICS::Material>(GRAPHICS::Material
-        {
-            .Shading = GRAPHICS::ShadingType::WIREFRAME,
-            .WireframeColor = GRAPHICS::Color::GREEN
-        }),
-        std::make_shared<GRAPHICS::Material>(GRAPHICS::Material
-        {
-            .Shading = GRAPHICS::ShadingType::WIREFRAME_VERTEX_COLOR_INTERPOLATION,
-            .VertexWireframeColors =
-            {
-                GRAPHICS::Color::RED,
-                GRAPHICS::Color::GREEN,
-                GRAPHICS::Color::BLUE,
-            }
-        }),
-        std::make_shared<GRAPHICS::Material>(GRAPHICS::Material
-        {
-            .Shading = GRAPHICS::ShadingType::FLAT,
-            .FaceColor = GRAPHICS::Color::BLUE
-        }),
-        std::make_shared<GRAPHICS::Material>(GRAPHICS::Material
-        {
-            .Shading = GRAPHICS::ShadingType::FACE_VERTEX_COLOR_INTERPOLATION,
-            .VertexFaceColors =
-            {
-                GRAPHICS::Color(1.0f, 0.0f, 0.0f, 1.0f),
-                GRAPHICS::Color(0.0f, 1.0f, 0.0f, 1.0f),
-                GRAPHICS::Color(0.0f, 0.0f, 1.0f, 1.0f),
-            }
-        }),
-        std::make_shared<GRAPHICS::Material>(GRAPHICS::Material
-        {
-            .Shading = GRAPHICS::ShadingType::GOURAUD,
-            .VertexColors =
-            {
-                // Basic grayscale.
-                GRAPHICS::Color(0.5f, 0.5f, 0.5f, 1.0f),
-                GRAPHICS::Color(0.5f, 0.5f, 0.5f, 1.0f),
-                GRAPHICS::Color(0.5f, 0.5f, 0.5f, 1.0f),
-            },
-            .SpecularPower = 20.0f
-        }),
-        std::make_shared<GRAPHICS::Material>(GRAPHICS::Material
-        {
-            .Shading = GRAPHICS::ShadingType::TEXTURED,
-            .VertexColors =
-            {
-                GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f),
-                GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f),
-                GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f),
-            },
-            .Texture = texture,
-            .VertexTextureCoordinates =
-            {
-                MATH::Vector2f(0.0f, 0.0f),
-                MATH::Vector2f(1.0f, 0.0f),
-                MATH::Vector2f(0.0f, 1.0f)
-            }
-        })
-    };
+    g_materials_by_shading_type = GRAPHICS::ExampleMaterials::CreateForEachShadingType(texture);
 
     // CREATE MANY SMALL TRIANGLES FOR RENDERING.
     const std::shared_ptr<GRAPHICS::Material>& default_material = g_materials_by_shading_type.at(g_current_material_index);
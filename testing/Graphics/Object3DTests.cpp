@@ -48,3 +48,26 @@ TEST_CASE("World transform can translate a vector.", "[Object3D][WorldTransform]
     REQUIRE(EXPECTED_RIGHT_WORLD_VERTEX.Z == actual_right_world_vertex.Z);
     REQUIRE(EXPECTED_RIGHT_WORLD_VERTEX.W == actual_right_world_vertex.W);
 }
+
+TEST_CASE("Inverse world transform undoes the world transform.", "[Object3D][InverseWorldTransform]")
+{
+    // CREATE A 3D OBJECT WITH ALL KINDS OF TRANSFORMATIONS.
+    GRAPHICS::Object3D test_object_3D;
+    test_object_3D.WorldPosition = MATH::Vector3f(1.0f, 3.0f, -5.0f);
+    test_object_3D.RotationInRadians = MATH::Vector3< MATH::Angle<float>::Radians >(
+        MATH::Angle<float>::Radians(0.3f),
+        MATH::Angle<float>::Radians(-1.2f),
+        MATH::Angle<float>::Radians(2.0f));
+    test_object_3D.Scale = MATH::Vector3f(2.0f, 0.5f, 3.0f);
+
+    // TRANSFORM A VECTOR TO WORLD SPACE AND BACK.
+    const MATH::Vector4f ORIGINAL_VERTEX(0.7f, -1.1f, 4.0f, 1.0f);
+    MATH::Vector4f world_vertex = test_object_3D.WorldTransform() * ORIGINAL_VERTEX;
+    MATH::Vector4f round_trip_vertex = test_object_3D.InverseWorldTransform() * world_vertex;
+
+    // VERIFY THE ORIGINAL VECTOR WAS RESTORED.
+    REQUIRE(ORIGINAL_VERTEX.X == Approx(round_trip_vertex.X));
+    REQUIRE(ORIGINAL_VERTEX.Y == Approx(round_trip_vertex.Y));
+    REQUIRE(ORIGINAL_VERTEX.Z == Approx(round_trip_vertex.Z));
+    REQUIRE(ORIGINAL_VERTEX.W == Approx(round_trip_vertex.W));
+}
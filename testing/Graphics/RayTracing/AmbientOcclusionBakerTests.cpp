@@ -0,0 +1,117 @@
+#include <filesystem>
+#include <memory>
+#include "Graphics/RayTracing/AmbientOcclusionBaker.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+/// Creates an object with a square floor meeting a square wall along one edge, like the corner of a room.
+/// @return The floor and wall, each 10 units wide.
+static GRAPHICS::Object3D CreateFloorAndWall()
+{
+    auto material = std::make_shared<GRAPHICS::Material>();
+    GRAPHICS::Object3D floor_and_wall;
+
+    // The floor faces up toward the wall's side.
+    floor_and_wall.Triangles.emplace_back(material, std::array<MATH::Vector3f, GRAPHICS::Triangle::VERTEX_COUNT>
+    {
+        MATH::Vector3f(0.0f, 0.0f, 0.0f),
+        MATH::Vector3f(0.0f, 0.0f, 10.0f),
+        MATH::Vector3f(10.0f, 0.0f, 0.0f),
+    });
+    floor_and_wall.Triangles.emplace_back(material, std::array<MATH::Vector3f, GRAPHICS::Triangle::VERTEX_COUNT>
+    {
+        MATH::Vector3f(10.0f, 0.0f, 0.0f),
+        MATH::Vector3f(0.0f, 0.0f, 10.0f),
+        MATH::Vector3f(10.0f, 0.0f, 10.0f),
+    });
+
+    // The wall faces toward the floor.
+    floor_and_wall.Triangles.emplace_back(material, std::array<MATH::Vector3f, GRAPHICS::Triangle::VERTEX_COUNT>
+    {
+        MATH::Vector3f(0.0f, 0.0f, 0.0f),
+        MATH::Vector3f(10.0f, 0.0f, 0.0f),
+        MATH::Vector3f(0.0f, 10.0f, 0.0f),
+    });
+    floor_and_wall.Triangles.emplace_back(material, std::array<MATH::Vector3f, GRAPHICS::Triangle::VERTEX_COUNT>
+    {
+        MATH::Vector3f(10.0f, 0.0f, 0.0f),
+        MATH::Vector3f(10.0f, 10.0f, 0.0f),
+        MATH::Vector3f(0.0f, 10.0f, 0.0f),
+    });
+
+    return floor_and_wall;
+}
+
+TEST_CASE("Ambient occlusion darkens vertices in creases but not open vertices.", "[AmbientOcclusionBaker]")
+{
+    // BAKE AMBIENT OCCLUSION.
+    GRAPHICS::Object3D floor_and_wall = CreateFloorAndWall();
+    GRAPHICS::RAY_TRACING::AmbientOcclusionBaker baker;
+    baker.Bake(floor_and_wall, 1);
+
+    // VERIFY VERTICES ALONG THE CREASE ARE OCCLUDED.
+    // The first vertex of the first floor and wall triangles is in the crease.
+    const GRAPHICS::Triangle& first_floor_triangle = floor_and_wall.Triangles[0];
+    const GRAPHICS::Triangle& first_wall_triangle = floor_and_wall.Triangles[2];
+    REQUIRE(first_floor_triangle.VertexAmbientOcclusion[0] < 1.0f);
+    REQUIRE(first_floor_triangle.VertexAmbientOcclusion[0] == first_wall_triangle.VertexAmbientOcclusion[0]);
+
+    // VERIFY VERTICES FAR FROM THE CREASE ARE UNOCCLUDED.
+    const GRAPHICS::Triangle& second_floor_triangle = floor_and_wall.Triangles[1];
+    const GRAPHICS::Triangle& second_wall_triangle = floor_and_wall.Triangles[3];
+    REQUIRE(1.0f == second_floor_triangle.VertexAmbientOcclusion[2]);
+    REQUIRE(1.0f == second_wall_triangle.VertexAmbientOcclusion[2]);
+}
+
+TEST_CASE("Baked ambient occlusion doesn't depend on the number of threads.", "[AmbientOcclusionBaker]")
+{
+    // BAKE WITH DIFFERENT NUMBERS OF THREADS.
+    GRAPHICS::RAY_TRACING::AmbientOcclusionBaker baker;
+    GRAPHICS::Object3D single_threaded_object = CreateFloorAndWall();
+    baker.Bake(single_threaded_object, 1);
+    GRAPHICS::Object3D multi_threaded_object = CreateFloorAndWall();
+    baker.Bake(multi_threaded_object, 4);
+
+    // VERIFY THE RESULTS ARE IDENTICAL.
+    for (std::size_t triangle_index = 0; triangle_index < single_threaded_object.Triangles.size(); ++triangle_index)
+    {
+        REQUIRE(single_threaded_object.Triangles[triangle_index].VertexAmbientOcclusion == multi_threaded_object.Triangles[triangle_index].VertexAmbientOcclusion);
+    }
+}
+
+TEST_CASE("Cached ambient occlusion is reused for the same object and settings.", "[AmbientOcclusionBaker]")
+{
+    // START WITH AN EMPTY CACHE.
+    std::filesystem::path cache_folder_path = std::filesystem::temp_directory_path() / "SoftwareRendererAmbientOcclusionBakerTests";
+    std::filesystem::remove_all(cache_folder_path);
+
+    // BAKE AMBIENT OCCLUSION FOR THE FIRST TIME.
+    GRAPHICS::RAY_TRACING::AmbientOcclusionBaker baker;
+    GRAPHICS::Object3D baked_object = CreateFloorAndWall();
+    bool first_bake_cached = baker.BakeCached(baked_object, cache_folder_path, 1);
+    REQUIRE_FALSE(first_bake_cached);
+    REQUIRE(std::filesystem::exists(baker.CacheFilepath(baked_object, cache_folder_path)));
+    std::uint32_t hash = baker.Hash(baked_object);
+    REQUIRE(baker.CacheFilepath(baked_object, cache_folder_path) == GRAPHICS::RAY_TRACING::AmbientOcclusionBaker::CacheFilepath(hash, cache_folder_path));
+
+    // VERIFY THE BAKE IS REUSED FOR THE SAME OBJECT.
+    GRAPHICS::Object3D reloaded_object = CreateFloorAndWall();
+    bool second_bake_cached = baker.BakeCached(reloaded_object, cache_folder_path, 1);
+    REQUIRE(second_bake_cached);
+    for (std::size_t triangle_index = 0; triangle_index < baked_object.Triangles.size(); ++triangle_index)
+    {
+        for (std::size_t vertex_index = 0; vertex_index < GRAPHICS::Triangle::VERTEX_COUNT; ++vertex_index)
+        {
+            float baked_ambient_occlusion = baked_object.Triangles[triangle_index].VertexAmbientOcclusion[vertex_index];
+            float reloaded_ambient_occlusion = reloaded_object.Triangles[triangle_index].VertexAmbientOcclusion[vertex_index];
+            REQUIRE(reloaded_ambient_occlusion == Approx(baked_ambient_occlusion).margin(1.0f / 255.0f));
+        }
+    }
+
+    // VERIFY THE BAKE ISN'T REUSED WITH DIFFERENT SETTINGS.
+    baker.SampleCountPerVertex *= 2;
+    GRAPHICS::Object3D rebaked_object = CreateFloorAndWall();
+    bool third_bake_cached = baker.BakeCached(rebaked_object, cache_folder_path, 1);
+    REQUIRE_FALSE(third_bake_cached);
+
+    std::filesystem::remove_all(cache_folder_path);
+}
@@ -0,0 +1,59 @@
+#include <array>
+#include <limits>
+#include <optional>
+#include "Graphics/RayTracing/AxisAlignedBox.h"
+#include "Graphics/RayTracing/RayPacket.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+TEST_CASE("A ray intersects the closest face of a box.", "[AxisAlignedBox][Intersect]")
+{
+    GRAPHICS::RAY_TRACING::AxisAlignedBox box;
+    box.MinimumCorner = MATH::Vector3f(-1.0f, -1.0f, -6.0f);
+    box.MaximumCorner = MATH::Vector3f(1.0f, 2.0f, -4.0f);
+
+    // A RAY FROM OUTSIDE THE BOX SHOULD HIT THE NEAR FACE.
+    GRAPHICS::RAY_TRACING::Ray ray_from_outside(MATH::Vector3f(0.5f, 0.5f, 0.0f), MATH::Vector3f(0.0f, 0.0f, -1.0f));
+    std::optional<GRAPHICS::RAY_TRACING::RayObjectIntersection> intersection = box.Intersect(ray_from_outside);
+    REQUIRE(intersection);
+    REQUIRE(4.0f == intersection->DistanceFromRayToObject);
+    REQUIRE(MATH::Vector3f(0.0f, 0.0f, 1.0f) == box.SurfaceNormal(intersection->IntersectionPoint()));
+
+    // A RAY FROM INSIDE THE BOX SHOULD HIT THE FACE IT EXITS THROUGH.
+    GRAPHICS::RAY_TRACING::Ray ray_from_inside(MATH::Vector3f(0.0f, 0.0f, -5.0f), MATH::Vector3f(0.0f, 1.0f, 0.0f));
+    intersection = box.Intersect(ray_from_inside);
+    REQUIRE(intersection);
+    REQUIRE(2.0f == intersection->DistanceFromRayToObject);
+    REQUIRE(MATH::Vector3f(0.0f, 1.0f, 0.0f) == box.SurfaceNormal(intersection->IntersectionPoint()));
+
+    // RAYS PASSING BESIDE OR POINTING AWAY FROM THE BOX SHOULD MISS.
+    GRAPHICS::RAY_TRACING::Ray ray_beside_box(MATH::Vector3f(1.5f, 0.5f, 0.0f), MATH::Vector3f(0.0f, 0.0f, -1.0f));
+    REQUIRE_FALSE(box.Intersect(ray_beside_box));
+    GRAPHICS::RAY_TRACING::Ray ray_away_from_box(MATH::Vector3f(0.5f, 0.5f, 0.0f), MATH::Vector3f(0.0f, 0.0f, 1.0f));
+    REQUIRE_FALSE(box.Intersect(ray_away_from_box));
+}
+
+TEST_CASE("Packet intersections with boxes match single ray intersections.", "[AxisAlignedBox][IntersectPacket]")
+{
+    GRAPHICS::RAY_TRACING::AxisAlignedBox box;
+    box.MinimumCorner = MATH::Vector3f(-1.0f, -1.0f, -6.0f);
+    box.MaximumCorner = MATH::Vector3f(1.0f, 2.0f, -4.0f);
+
+    GRAPHICS::RAY_TRACING::RayPacket ray_packet;
+    MATH::Vector3f origin(0.0f, 0.0f, 0.0f);
+    ray_packet.Add(GRAPHICS::RAY_TRACING::Ray(origin, MATH::Vector3f(0.0f, 0.0f, -1.0f)));
+    ray_packet.Add(GRAPHICS::RAY_TRACING::Ray(origin, MATH::Vector3f(0.1f, 0.3f, -1.0f)));
+    ray_packet.Add(GRAPHICS::RAY_TRACING::Ray(origin, MATH::Vector3f(0.5f, 0.0f, -1.0f)));
+    ray_packet.Add(GRAPHICS::RAY_TRACING::Ray(origin, MATH::Vector3f(0.0f, 0.0f, 1.0f)));
+    ray_packet.Add(GRAPHICS::RAY_TRACING::Ray(MATH::Vector3f(0.0f, 0.0f, -5.0f), MATH::Vector3f(1.0f, 1.0f, 0.5f)));
+    REQUIRE(5 == ray_packet.RayCount);
+
+    std::array<float, GRAPHICS::RAY_TRACING::RayPacket::MAX_RAY_COUNT> distances;
+    box.IntersectPacket(ray_packet, distances);
+    for (std::size_t ray_index = 0; ray_index < ray_packet.RayCount; ++ray_index)
+    {
+        GRAPHICS::RAY_TRACING::Ray ray = ray_packet.GetRay(ray_index);
+        std::optional<GRAPHICS::RAY_TRACING::RayObjectIntersection> intersection = box.Intersect(ray);
+        float expected_distance = intersection ? intersection->DistanceFromRayToObject : std::numeric_limits<float>::infinity();
+        REQUIRE(distances[ray_index] == Approx(expected_distance));
+    }
+}
@@ -0,0 +1,131 @@
+#include <memory>
+#include <thread>
+#include "Graphics/RayTracing/BackgroundRenderJob.h"
+#include "Graphics/RayTracing/Sphere.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+TEST_CASE("A job that hasn't been started has no finished frame.", "[BackgroundRenderJob]")
+{
+    GRAPHICS::RAY_TRACING::BackgroundRenderJob render_job;
+
+    REQUIRE_FALSE(render_job.IsComplete());
+    REQUIRE(0.0f == render_job.CompletionPercentage());
+    REQUIRE(nullptr == render_job.FinishedFrame());
+}
+
+TEST_CASE("A background render produces the same image as a synchronous render.", "[BackgroundRenderJob]")
+{
+    // CREATE A SCENE WITH A SPHERE IN VIEW.
+    auto scene = std::make_shared<GRAPHICS::RAY_TRACING::Scene>();
+    scene->BackgroundColor = GRAPHICS::Color(0.2f, 0.2f, 1.0f, 1.0f);
+    scene->PointLights.push_back(GRAPHICS::Light
+    {
+        .Color = GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f),
+        .PointLightWorldPosition = MATH::Vector3f(2.0f, 2.0f, 2.0f),
+    });
+    auto sphere = std::make_unique<GRAPHICS::RAY_TRACING::Sphere>();
+    sphere->CenterPosition = MATH::Vector3f(0.2f, -0.1f, -3.0f);
+    sphere->Radius = 1.0f;
+    sphere->Material = std::make_shared<GRAPHICS::Material>();
+    sphere->Material->DiffuseColor = GRAPHICS::Color(0.8f, 0.3f, 0.3f, 1.0f);
+    scene->Objects.push_back(std::move(sphere));
+
+    // RENDER THE SCENE SYNCHRONOUSLY.
+    // The dimensions are intentionally not multiples of the tile size.
+    constexpr unsigned int WIDTH_IN_PIXELS = 37;
+    constexpr unsigned int HEIGHT_IN_PIXELS = 29;
+    GRAPHICS::RAY_TRACING::RayTracingAlgorithm ray_tracer;
+    GRAPHICS::RenderTarget expected_render_target(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    ray_tracer.Render(*scene, expected_render_target);
+
+    // RENDER THE SCENE IN THE BACKGROUND.
+    GRAPHICS::RenderTarget render_target(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    GRAPHICS::RAY_TRACING::BackgroundRenderJob render_job;
+    constexpr unsigned int THREAD_COUNT = 3;
+    render_job.Start(ray_tracer, scene, render_target, THREAD_COUNT);
+
+    // Changing the original ray tracer shouldn't affect the image being rendered.
+    ray_tracer.Camera.WorldPosition.X += 1.0f;
+
+    while (!render_job.IsComplete())
+    {
+        std::this_thread::yield();
+    }
+
+    // VERIFY THE BACKGROUND RENDER MATCHES THE SYNCHRONOUS RENDER.
+    REQUIRE(100.0f == render_job.CompletionPercentage());
+    const GRAPHICS::RenderTarget* finished_frame = render_job.FinishedFrame();
+    REQUIRE(nullptr != finished_frame);
+    const GRAPHICS::ColorFormat COLOR_FORMAT = GRAPHICS::ColorFormat::RGBA;
+    unsigned int mismatched_pixel_count = 0;
+    for (unsigned int y = 0; y < HEIGHT_IN_PIXELS; ++y)
+    {
+        for (unsigned int x = 0; x < WIDTH_IN_PIXELS; ++x)
+        {
+            uint32_t expected_color = expected_render_target.GetPixel(x, y).Pack(COLOR_FORMAT);
+            uint32_t actual_color = finished_frame->GetPixel(x, y).Pack(COLOR_FORMAT);
+            if (expected_color != actual_color)
+            {
+                ++mismatched_pixel_count;
+            }
+        }
+    }
+    REQUIRE(0 == mismatched_pixel_count);
+}
+
+TEST_CASE("Restarting a background render cancels the previous image and finishes the new image.", "[BackgroundRenderJob]")
+{
+    // CREATE A SCENE WITH A SPHERE IN VIEW.
+    auto scene = std::make_shared<GRAPHICS::RAY_TRACING::Scene>();
+    scene->PointLights.push_back(GRAPHICS::Light
+    {
+        .Color = GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f),
+        .PointLightWorldPosition = MATH::Vector3f(2.0f, 2.0f, 2.0f),
+    });
+    auto sphere = std::make_unique<GRAPHICS::RAY_TRACING::Sphere>();
+    sphere->CenterPosition = MATH::Vector3f(0.0f, 0.0f, -3.0f);
+    sphere->Radius = 1.0f;
+    sphere->Material = std::make_shared<GRAPHICS::Material>();
+    sphere->Material->DiffuseColor = GRAPHICS::Color(0.3f, 0.8f, 0.3f, 1.0f);
+    scene->Objects.push_back(std::move(sphere));
+
+    // START RENDERING AN IMAGE AND IMMEDIATELY RESTART FROM A DIFFERENT CAMERA POSITION.
+    constexpr unsigned int DIMENSION_IN_PIXELS = 64;
+    GRAPHICS::RenderTarget render_target(DIMENSION_IN_PIXELS, DIMENSION_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    GRAPHICS::RAY_TRACING::RayTracingAlgorithm ray_tracer;
+    GRAPHICS::RAY_TRACING::BackgroundRenderJob render_job;
+    REQUIRE(0 == render_job.FrameNumber());
+    render_job.Start(ray_tracer, scene, render_target);
+    REQUIRE(1 == render_job.FrameNumber());
+
+    ray_tracer.Camera.WorldPosition.X += 0.5f;
+    render_job.Start(ray_tracer, scene, render_target);
+    REQUIRE(2 == render_job.FrameNumber());
+
+    while (!render_job.IsComplete())
+    {
+        std::this_thread::yield();
+    }
+
+    // VERIFY THE FINISHED FRAME IS FROM THE LATEST CAMERA POSITION.
+    GRAPHICS::RenderTarget expected_render_target(DIMENSION_IN_PIXELS, DIMENSION_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    ray_tracer.Render(*scene, expected_render_target);
+    const GRAPHICS::RenderTarget* finished_frame = render_job.FinishedFrame();
+    REQUIRE(nullptr != finished_frame);
+    const GRAPHICS::ColorFormat COLOR_FORMAT = GRAPHICS::ColorFormat::RGBA;
+    unsigned int mismatched_pixel_count = 0;
+    for (unsigned int y = 0; y < DIMENSION_IN_PIXELS; ++y)
+    {
+        for (unsigned int x = 0; x < DIMENSION_IN_PIXELS; ++x)
+        {
+            uint32_t expected_color = expected_render_target.GetPixel(x, y).Pack(COLOR_FORMAT);
+            uint32_t actual_color = finished_frame->GetPixel(x, y).Pack(COLOR_FORMAT);
+            if (expected_color != actual_color)
+            {
+                ++mismatched_pixel_count;
+            }
+        }
+    }
+    REQUIRE(0 == mismatched_pixel_count);
+    REQUIRE(2 == render_job.FrameNumber());
+}
@@ -351,3 +351,39 @@ TEST_CASE("An orthographic viewing ray for the bottom-right quadrant can be corr
     REQUIRE(EXPECTED_RAY_DIRECTION.Y == actual_viewing_ray.Direction.Y);
     REQUIRE(EXPECTED_RAY_DIRECTION.Z == actual_viewing_ray.Direction.Z);
 }
+
+TEST_CASE("Screen positions are the inverse of viewing rays for both projections.", "[Camera][ScreenPosition]")
+{
+    // CREATE A RENDER TARGET.
+    constexpr unsigned int RENDER_TARGET_WIDTH_IN_PIXELS = 40;
+    constexpr unsigned int RENDER_TARGET_HEIGHT_IN_PIXELS = 30;
+    GRAPHICS::RenderTarget render_target(
+        RENDER_TARGET_WIDTH_IN_PIXELS,
+        RENDER_TARGET_HEIGHT_IN_PIXELS,
+        GRAPHICS::ColorFormat::RGBA);
+
+    // DEFINE A CAMERA LOOKING AT AN ANGLE.
+    GRAPHICS::Camera camera = GRAPHICS::Camera::LookAtFrom(MATH::Vector3f(0.0f, 0.0f, 0.0f), MATH::Vector3f(1.0f, 2.0f, 5.0f));
+
+    const GRAPHICS::ProjectionType PROJECTIONS[] = { GRAPHICS::ProjectionType::ORTHOGRAPHIC, GRAPHICS::ProjectionType::PERSPECTIVE };
+    for (const GRAPHICS::ProjectionType projection : PROJECTIONS)
+    {
+        camera.Projection = projection;
+
+        // PROJECT A POINT ALONG A VIEWING RAY BACK ONTO THE SCREEN.
+        const MATH::Vector2f SCREEN_POSITION(7.25f, 21.5f);
+        GRAPHICS::RAY_TRACING::Ray viewing_ray = camera.ViewingRay(SCREEN_POSITION, render_target);
+        constexpr float DISTANCE_ALONG_RAY = 3.0f;
+        MATH::Vector3f world_position = viewing_ray.Origin + MATH::Vector3f::Scale(DISTANCE_ALONG_RAY, viewing_ray.Direction);
+        std::optional<MATH::Vector2f> actual_screen_position = camera.ScreenPosition(world_position, render_target);
+
+        // VERIFY THE ORIGINAL SCREEN POSITION WAS COMPUTED.
+        REQUIRE(actual_screen_position);
+        REQUIRE(SCREEN_POSITION.X == Approx(actual_screen_position->X).margin(0.001f));
+        REQUIRE(SCREEN_POSITION.Y == Approx(actual_screen_position->Y).margin(0.001f));
+
+        // VERIFY POSITIONS BEHIND THE CAMERA AREN'T ON SCREEN.
+        MATH::Vector3f position_behind_camera = camera.WorldPosition + camera.CoordinateFrame.Forward;
+        REQUIRE_FALSE(camera.ScreenPosition(position_behind_camera, render_target));
+    }
+}
@@ -0,0 +1,218 @@
+#include <memory>
+#include "Graphics/RayTracing/Denoiser.h"
+#include "Graphics/RayTracing/PathTracingAlgorithm.h"
+#include "Graphics/RayTracing/RayTracingAlgorithm.h"
+#include "Graphics/RayTracing/Plane.h"
+#include "Graphics/RayTracing/Sphere.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+/// Path traces a simple scene with indirect lighting.
+/// @param[in]  sample_count_per_pixel - The number of samples to take for each pixel.
+/// @param[in]  dimension_in_pixels - The width and height of the image.
+/// @return The accumulated samples.
+static GRAPHICS::RAY_TRACING::AccumulationBuffer PathTraceSphereInCorner(
+    const unsigned int sample_count_per_pixel,
+    const unsigned int dimension_in_pixels)
+{
+    // CREATE A SPHERE IN THE CORNER BETWEEN A FLOOR AND WALL.
+    GRAPHICS::RAY_TRACING::Scene scene;
+    scene.PointLights.push_back(GRAPHICS::Light
+    {
+        .Type = GRAPHICS::LightType::POINT,
+        .Color = GRAPHICS::Color(0.8f, 0.8f, 0.8f, 1.0f),
+        .PointLightWorldPosition = MATH::Vector3f(1.5f, 2.0f, -2.0f),
+    });
+
+    auto sphere = std::make_unique<GRAPHICS::RAY_TRACING::Sphere>();
+    sphere->CenterPosition = MATH::Vector3f(0.0f, 0.0f, -4.0f);
+    sphere->Radius = 1.0f;
+    sphere->Material = std::make_shared<GRAPHICS::Material>();
+    sphere->Material->DiffuseColor = GRAPHICS::Color(0.9f, 0.2f, 0.2f, 1.0f);
+    scene.Objects.push_back(std::move(sphere));
+
+    auto floor = std::make_unique<GRAPHICS::RAY_TRACING::Plane>();
+    floor->PointOnPlane = MATH::Vector3f(0.0f, -1.0f, 0.0f);
+    floor->UnitNormal = MATH::Vector3f(0.0f, 1.0f, 0.0f);
+    floor->Material = std::make_shared<GRAPHICS::Material>();
+    floor->Material->DiffuseColor = GRAPHICS::Color(0.7f, 0.7f, 0.7f, 1.0f);
+    scene.Objects.push_back(std::move(floor));
+
+    auto wall = std::make_unique<GRAPHICS::RAY_TRACING::Plane>();
+    wall->PointOnPlane = MATH::Vector3f(0.0f, 0.0f, -6.0f);
+    wall->UnitNormal = MATH::Vector3f(0.0f, 0.0f, 1.0f);
+    wall->Material = std::make_shared<GRAPHICS::Material>();
+    wall->Material->DiffuseColor = GRAPHICS::Color(0.2f, 0.7f, 0.2f, 1.0f);
+    scene.Objects.push_back(std::move(wall));
+
+    // RENDER THE SCENE.
+    GRAPHICS::RAY_TRACING::PathTracingAlgorithm path_tracer;
+    path_tracer.Camera = GRAPHICS::Camera::LookAtFrom(MATH::Vector3f(0.0f, 0.0f, -4.0f), MATH::Vector3f(0.0f, 0.5f, 0.0f));
+    path_tracer.Camera.Projection = GRAPHICS::ProjectionType::PERSPECTIVE;
+    path_tracer.MaxSampleCountPerPixel = sample_count_per_pixel;
+    GRAPHICS::RenderTarget render_target(dimension_in_pixels, dimension_in_pixels, GRAPHICS::ColorFormat::RGBA);
+    path_tracer.StartRender(render_target);
+    bool render_complete = false;
+    while (!render_complete)
+    {
+        render_complete = path_tracer.RenderPass(scene);
+    }
+    return path_tracer.Accumulation;
+}
+
+/// Computes the average squared difference between the colors of two images.
+/// @param[in]  image - The image to compare.
+/// @param[in]  reference_image - The image to compare against.
+/// @return The mean squared error of the red, green, and blue components.
+static float MeanSquaredError(const GRAPHICS::RenderTarget& image, const GRAPHICS::RenderTarget& reference_image)
+{
+    float total_squared_error = 0.0f;
+    for (unsigned int y = 0; y < image.GetHeightInPixels(); ++y)
+    {
+        for (unsigned int x = 0; x < image.GetWidthInPixels(); ++x)
+        {
+            GRAPHICS::Color color = image.GetPixel(x, y);
+            GRAPHICS::Color reference_color = reference_image.GetPixel(x, y);
+            float red_error = color.Red - reference_color.Red;
+            float green_error = color.Green - reference_color.Green;
+            float blue_error = color.Blue - reference_color.Blue;
+            total_squared_error += (red_error * red_error) + (green_error * green_error) + (blue_error * blue_error);
+        }
+    }
+
+    float component_count = 3.0f * static_cast<float>(image.GetWidthInPixels() * image.GetHeightInPixels());
+    return total_squared_error / component_count;
+}
+
+TEST_CASE("Denoising leaves noise-free images unchanged and preserves edges.", "[Denoiser]")
+{
+    // CREATE AN IMAGE WITH TWO SURFACES MEETING IN THE MIDDLE.
+    constexpr unsigned int WIDTH_IN_PIXELS = 24;
+    constexpr unsigned int HEIGHT_IN_PIXELS = 10;
+    GRAPHICS::RAY_TRACING::AccumulationBuffer image(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS);
+    for (unsigned int y = 0; y < HEIGHT_IN_PIXELS; ++y)
+    {
+        for (unsigned int x = 0; x < WIDTH_IN_PIXELS; ++x)
+        {
+            bool left_surface = (x < WIDTH_IN_PIXELS / 2);
+            GRAPHICS::RAY_TRACING::SurfaceFeatures features;
+            features.Albedo = MATH::Vector3f(0.5f, 0.5f, 0.5f);
+            features.Normal = left_surface ? MATH::Vector3f(1.0f, 0.0f, 0.0f) : MATH::Vector3f(0.0f, 1.0f, 0.0f);
+            features.Depth = 3.0f;
+            MATH::Vector3f radiance = left_surface ? MATH::Vector3f(0.8f, 0.6f, 0.4f) : MATH::Vector3f(0.1f, 0.2f, 0.3f);
+            image.AddSample(x, y, radiance, features);
+        }
+    }
+
+    // DENOISE THE IMAGE.
+    GRAPHICS::RAY_TRACING::Denoiser denoiser;
+    GRAPHICS::RenderTarget render_target(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    denoiser.Denoise(image, render_target);
+
+    // VERIFY NEITHER SURFACE BLEEDS INTO THE OTHER.
+    // A negligible amount may cross the edge since weights never become exactly zero.
+    constexpr float MAX_COLOR_DIFFERENCE = 0.01f;
+    for (unsigned int y = 0; y < HEIGHT_IN_PIXELS; ++y)
+    {
+        for (unsigned int x = 0; x < WIDTH_IN_PIXELS; ++x)
+        {
+            MATH::Vector3f expected_radiance = image.MeanRadiance(x, y);
+            GRAPHICS::Color color = render_target.GetPixel(x, y);
+            REQUIRE(expected_radiance.X == Approx(color.Red).margin(MAX_COLOR_DIFFERENCE));
+            REQUIRE(expected_radiance.Y == Approx(color.Green).margin(MAX_COLOR_DIFFERENCE));
+            REQUIRE(expected_radiance.Z == Approx(color.Blue).margin(MAX_COLOR_DIFFERENCE));
+        }
+    }
+}
+
+TEST_CASE("Denoising a path traced image with few samples brings it closer to a converged image.", "[Denoiser][PathTracingAlgorithm]")
+{
+    // RENDER A NOISY IMAGE AND A MOSTLY CONVERGED REFERENCE.
+    constexpr unsigned int DIMENSION_IN_PIXELS = 32;
+    GRAPHICS::RAY_TRACING::AccumulationBuffer noisy_image = PathTraceSphereInCorner(4, DIMENSION_IN_PIXELS);
+    GRAPHICS::RenderTarget noisy_render_target(DIMENSION_IN_PIXELS, DIMENSION_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    noisy_image.ResolveTo(noisy_render_target);
+
+    GRAPHICS::RAY_TRACING::AccumulationBuffer reference_image = PathTraceSphereInCorner(256, DIMENSION_IN_PIXELS);
+    GRAPHICS::RenderTarget reference_render_target(DIMENSION_IN_PIXELS, DIMENSION_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    reference_image.ResolveTo(reference_render_target);
+
+    // DENOISE THE NOISY IMAGE WITH DIFFERENT NUMBERS OF THREADS.
+    GRAPHICS::RAY_TRACING::Denoiser denoiser;
+    GRAPHICS::RenderTarget denoised_render_target(DIMENSION_IN_PIXELS, DIMENSION_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    denoiser.Denoise(noisy_image, denoised_render_target, 1);
+    GRAPHICS::RenderTarget multi_threaded_denoised_render_target(DIMENSION_IN_PIXELS, DIMENSION_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    denoiser.Denoise(noisy_image, multi_threaded_denoised_render_target, 4);
+
+    // VERIFY THE DENOISED IMAGE IS MUCH CLOSER TO THE REFERENCE.
+    float noisy_error = MeanSquaredError(noisy_render_target, reference_render_target);
+    float denoised_error = MeanSquaredError(denoised_render_target, reference_render_target);
+    REQUIRE(noisy_error > 0.0f);
+    REQUIRE(denoised_error < 0.5f * noisy_error);
+
+    // VERIFY THE NUMBER OF THREADS DOESN'T AFFECT THE RESULT.
+    for (unsigned int y = 0; y < DIMENSION_IN_PIXELS; ++y)
+    {
+        for (unsigned int x = 0; x < DIMENSION_IN_PIXELS; ++x)
+        {
+            REQUIRE(denoised_render_target.GetPixel(x, y).Pack(GRAPHICS::ColorFormat::RGBA) == multi_threaded_denoised_render_target.GetPixel(x, y).Pack(GRAPHICS::ColorFormat::RGBA));
+        }
+    }
+}
+
+TEST_CASE("Denoising a ray traced image with sampled lights brings it closer to evaluating all lights.", "[Denoiser][RayTracingAlgorithm]")
+{
+    // CREATE A FLOOR LIT BY MANY LIGHTS.
+    GRAPHICS::RAY_TRACING::Scene scene;
+    constexpr unsigned int LIGHT_COUNT_PER_DIMENSION = 4;
+    for (unsigned int z_index = 0; z_index < LIGHT_COUNT_PER_DIMENSION; ++z_index)
+    {
+        for (unsigned int x_index = 0; x_index < LIGHT_COUNT_PER_DIMENSION; ++x_index)
+        {
+            scene.PointLights.push_back(GRAPHICS::Light
+            {
+                .Type = GRAPHICS::LightType::POINT,
+                .Color = GRAPHICS::Color(0.1f, 0.1f, 0.1f, 1.0f),
+                .PointLightWorldPosition = MATH::Vector3f(
+                    static_cast<float>(x_index) - 1.5f,
+                    1.0f,
+                    -2.0f - static_cast<float>(z_index)),
+            });
+        }
+    }
+    scene.BuildLightDistribution();
+
+    auto floor = std::make_unique<GRAPHICS::RAY_TRACING::Plane>();
+    floor->PointOnPlane = MATH::Vector3f(0.0f, -1.0f, 0.0f);
+    floor->UnitNormal = MATH::Vector3f(0.0f, 1.0f, 0.0f);
+    floor->Material = std::make_shared<GRAPHICS::Material>();
+    floor->Material->DiffuseColor = GRAPHICS::Color(0.8f, 0.8f, 0.8f, 1.0f);
+    scene.Objects.push_back(std::move(floor));
+
+    // RENDER THE SCENE WITH AND WITHOUT SAMPLING LIGHTS.
+    constexpr unsigned int DIMENSION_IN_PIXELS = 32;
+    GRAPHICS::RAY_TRACING::RayTracingAlgorithm ray_tracer;
+    ray_tracer.Camera = GRAPHICS::Camera::LookAtFrom(MATH::Vector3f(0.0f, -1.0f, -3.0f), MATH::Vector3f(0.0f, 1.0f, 0.0f));
+    ray_tracer.Camera.Projection = GRAPHICS::ProjectionType::PERSPECTIVE;
+    ray_tracer.Ambient = false;
+    ray_tracer.Specular = false;
+    ray_tracer.Reflections = false;
+    ray_tracer.CachePrimaryHits = true;
+    GRAPHICS::RenderTarget reference_render_target(DIMENSION_IN_PIXELS, DIMENSION_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    ray_tracer.Render(scene, reference_render_target);
+
+    ray_tracer.ManyLightSampling = true;
+    ray_tracer.LightSampleCountPerHit = 1;
+    GRAPHICS::RenderTarget noisy_render_target(DIMENSION_IN_PIXELS, DIMENSION_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    ray_tracer.Render(scene, noisy_render_target);
+
+    // DENOISE THE NOISY IMAGE.
+    GRAPHICS::RAY_TRACING::Denoiser denoiser;
+    GRAPHICS::RenderTarget denoised_render_target(DIMENSION_IN_PIXELS, DIMENSION_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    denoiser.Denoise(noisy_render_target, ray_tracer.CachedPrimaryHits(), denoised_render_target);
+
+    // VERIFY THE DENOISED IMAGE IS MUCH CLOSER TO THE REFERENCE.
+    float noisy_error = MeanSquaredError(noisy_render_target, reference_render_target);
+    float denoised_error = MeanSquaredError(denoised_render_target, reference_render_target);
+    REQUIRE(noisy_error > 0.0f);
+    REQUIRE(denoised_error < 0.5f * noisy_error);
+}
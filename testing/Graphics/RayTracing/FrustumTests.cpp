@@ -0,0 +1,68 @@
+#include <limits>
+#include "Graphics/Camera.h"
+#include "Graphics/RayTracing/Frustum.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+/// Creates a small box around a point.
+/// @param[in]  center - The center of the box.
+/// @return A box around the point.
+static GRAPHICS::RAY_TRACING::AxisAlignedBoundingBox SmallBoxAround(const MATH::Vector3f& center)
+{
+    constexpr float HALF_SIZE = 0.01f;
+    MATH::Vector3f half_size(HALF_SIZE, HALF_SIZE, HALF_SIZE);
+    return GRAPHICS::RAY_TRACING::AxisAlignedBoundingBox(center - half_size, center + half_size);
+}
+
+TEST_CASE("A tile's frustum only excludes bounds that none of its rays can reach.", "[Frustum]")
+{
+    // CREATE A CAMERA LOOKING DOWN THE NEGATIVE Z AXIS.
+    GRAPHICS::Camera camera = GRAPHICS::Camera::LookAtFrom(MATH::Vector3f(0.0f, 0.0f, -1.0f), MATH::Vector3f(0.0f, 0.0f, 0.0f));
+    GRAPHICS::ProjectionType projection_type = GENERATE(GRAPHICS::ProjectionType::ORTHOGRAPHIC, GRAPHICS::ProjectionType::PERSPECTIVE);
+    camera.Projection = projection_type;
+
+    // CREATE A FRUSTUM FOR THE TOP-LEFT QUARTER OF THE SCREEN.
+    GRAPHICS::RenderTarget render_target(32, 32, GRAPHICS::ColorFormat::RGBA);
+    GRAPHICS::RAY_TRACING::RayGenerator ray_generator(camera, render_target);
+    GRAPHICS::RAY_TRACING::ScreenTile tile;
+    tile.LeftX = 0;
+    tile.TopY = 0;
+    tile.WidthInPixels = 16;
+    tile.HeightInPixels = 16;
+    GRAPHICS::RAY_TRACING::Frustum frustum = GRAPHICS::RAY_TRACING::Frustum::ForTile(ray_generator, tile);
+
+    // VERIFY BOUNDS ALONG RAYS IN THE TILE ARE INCLUDED.
+    constexpr float DISTANCE_ALONG_RAY = 5.0f;
+    for (unsigned int pixel_coordinate : { 0u, 7u, 15u })
+    {
+        GRAPHICS::RAY_TRACING::Ray ray = ray_generator.ViewingRay(MATH::Vector2ui(pixel_coordinate, pixel_coordinate));
+        MATH::Vector3f point_along_ray = ray.Origin + MATH::Vector3f::Scale(DISTANCE_ALONG_RAY, ray.Direction);
+        REQUIRE(frustum.Intersects(SmallBoxAround(point_along_ray)));
+    }
+
+    // VERIFY BOUNDS ALONG RAYS IN OTHER TILES ARE EXCLUDED.
+    for (unsigned int pixel_coordinate : { 17u, 24u, 31u })
+    {
+        GRAPHICS::RAY_TRACING::Ray ray = ray_generator.ViewingRay(MATH::Vector2ui(pixel_coordinate, pixel_coordinate));
+        MATH::Vector3f point_along_ray = ray.Origin + MATH::Vector3f::Scale(DISTANCE_ALONG_RAY, ray.Direction);
+        REQUIRE_FALSE(frustum.Intersects(SmallBoxAround(point_along_ray)));
+    }
+
+    // VERIFY BOUNDS STRADDLING THE TILE'S EDGE ARE INCLUDED.
+    GRAPHICS::RAY_TRACING::Ray inside_ray = ray_generator.ViewingRay(MATH::Vector2ui(15, 15));
+    GRAPHICS::RAY_TRACING::Ray outside_ray = ray_generator.ViewingRay(MATH::Vector2ui(20, 20));
+    GRAPHICS::RAY_TRACING::AxisAlignedBoundingBox straddling_box;
+    straddling_box.Expand(inside_ray.Origin + MATH::Vector3f::Scale(DISTANCE_ALONG_RAY, inside_ray.Direction));
+    straddling_box.Expand(outside_ray.Origin + MATH::Vector3f::Scale(DISTANCE_ALONG_RAY, outside_ray.Direction));
+    REQUIRE(frustum.Intersects(straddling_box));
+
+    // VERIFY BOUNDS BEHIND THE CAMERA ARE EXCLUDED.
+    GRAPHICS::RAY_TRACING::AxisAlignedBoundingBox box_behind_camera(MATH::Vector3f(-10.0f, -10.0f, 2.0f), MATH::Vector3f(10.0f, 10.0f, 3.0f));
+    REQUIRE_FALSE(frustum.Intersects(box_behind_camera));
+
+    // VERIFY UNBOUNDED BOXES ARE ALWAYS INCLUDED.
+    constexpr float INFINITY_VALUE = std::numeric_limits<float>::infinity();
+    GRAPHICS::RAY_TRACING::AxisAlignedBoundingBox unbounded_box(
+        MATH::Vector3f(-INFINITY_VALUE, 100.0f, -INFINITY_VALUE),
+        MATH::Vector3f(INFINITY_VALUE, 100.0f, INFINITY_VALUE));
+    REQUIRE(frustum.Intersects(unbounded_box));
+}
@@ -0,0 +1,194 @@
+#include <memory>
+#include <thread>
+#include <vector>
+#include "Graphics/RayTracing/IrradianceCache.h"
+#include "Graphics/RayTracing/Plane.h"
+#include "Graphics/RayTracing/RayTracingAlgorithm.h"
+#include "Graphics/RayTracing/Sphere.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+TEST_CASE("Irradiance is only interpolated from records valid for a point.", "[IrradianceCache]")
+{
+    // ADD A RECORD TO THE CACHE.
+    GRAPHICS::RAY_TRACING::IrradianceCache cache(GRAPHICS::RAY_TRACING::AxisAlignedBoundingBox(
+        MATH::Vector3f(-10.0f, -10.0f, -10.0f),
+        MATH::Vector3f(10.0f, 10.0f, 10.0f)));
+    const MATH::Vector3f UP(0.0f, 1.0f, 0.0f);
+    cache.Insert(GRAPHICS::RAY_TRACING::IrradianceCache::Record
+    {
+        .Position = MATH::Vector3f(0.0f, 0.0f, 0.0f),
+        .UnitSurfaceNormal = UP,
+        .Irradiance = GRAPHICS::Color(1.0f, 0.0f, 0.0f, 1.0f),
+        .ValidityRadius = 1.0f,
+    });
+    REQUIRE(1 == cache.RecordCount());
+
+    // VERIFY THE RECORD IS USED NEARBY.
+    std::optional<GRAPHICS::Color> nearby_irradiance = cache.Interpolate(MATH::Vector3f(0.5f, 0.0f, 0.0f), UP);
+    REQUIRE(nearby_irradiance);
+    REQUIRE(GRAPHICS::Color::RED.Pack(GRAPHICS::ColorFormat::RGBA) == nearby_irradiance->Pack(GRAPHICS::ColorFormat::RGBA));
+
+    // VERIFY THE RECORD ISN'T USED FAR AWAY OR FOR DIFFERENTLY FACING SURFACES.
+    REQUIRE_FALSE(cache.Interpolate(MATH::Vector3f(2.0f, 0.0f, 0.0f), UP));
+    REQUIRE_FALSE(cache.Interpolate(MATH::Vector3f(0.0f, 0.0f, 0.0f), -UP));
+
+    // VERIFY NEARBY RECORDS ARE BLENDED.
+    cache.Insert(GRAPHICS::RAY_TRACING::IrradianceCache::Record
+    {
+        .Position = MATH::Vector3f(1.0f, 0.0f, 0.0f),
+        .UnitSurfaceNormal = UP,
+        .Irradiance = GRAPHICS::Color(0.0f, 0.0f, 1.0f, 1.0f),
+        .ValidityRadius = 1.0f,
+    });
+    std::optional<GRAPHICS::Color> blended_irradiance = cache.Interpolate(MATH::Vector3f(0.5f, 0.0f, 0.0f), UP);
+    REQUIRE(blended_irradiance);
+    REQUIRE(0.5f == Approx(blended_irradiance->Red));
+    REQUIRE(0.5f == Approx(blended_irradiance->Blue));
+}
+
+TEST_CASE("Irradiance records outside the cache bounds can still be looked up.", "[IrradianceCache]")
+{
+    // ADD RECORDS OUTSIDE AND STRADDLING THE CACHE BOUNDS.
+    GRAPHICS::RAY_TRACING::IrradianceCache cache(GRAPHICS::RAY_TRACING::AxisAlignedBoundingBox(
+        MATH::Vector3f(-1.0f, -1.0f, -1.0f),
+        MATH::Vector3f(1.0f, 1.0f, 1.0f)));
+    const MATH::Vector3f UP(0.0f, 1.0f, 0.0f);
+    cache.Insert(GRAPHICS::RAY_TRACING::IrradianceCache::Record
+    {
+        .Position = MATH::Vector3f(5.0f, 0.0f, 0.0f),
+        .UnitSurfaceNormal = UP,
+        .Irradiance = GRAPHICS::Color(1.0f, 0.0f, 0.0f, 1.0f),
+        .ValidityRadius = 0.1f,
+    });
+    cache.Insert(GRAPHICS::RAY_TRACING::IrradianceCache::Record
+    {
+        .Position = MATH::Vector3f(0.0f, 0.0f, 0.95f),
+        .UnitSurfaceNormal = UP,
+        .Irradiance = GRAPHICS::Color(0.0f, 0.0f, 1.0f, 1.0f),
+        .ValidityRadius = 0.1f,
+    });
+    REQUIRE(2 == cache.RecordCount());
+
+    // VERIFY THE RECORDS ARE FOUND OUTSIDE THE BOUNDS.
+    std::optional<GRAPHICS::Color> outside_irradiance = cache.Interpolate(MATH::Vector3f(5.0f, 0.0f, 0.0f), UP);
+    REQUIRE(outside_irradiance);
+    REQUIRE(GRAPHICS::Color::RED.Pack(GRAPHICS::ColorFormat::RGBA) == outside_irradiance->Pack(GRAPHICS::ColorFormat::RGBA));
+    std::optional<GRAPHICS::Color> straddling_irradiance = cache.Interpolate(MATH::Vector3f(0.0f, 0.0f, 1.02f), UP);
+    REQUIRE(straddling_irradiance);
+    REQUIRE(GRAPHICS::Color::BLUE.Pack(GRAPHICS::ColorFormat::RGBA) == straddling_irradiance->Pack(GRAPHICS::ColorFormat::RGBA));
+}
+
+TEST_CASE("Irradiance records can be inserted from many threads at once.", "[IrradianceCache]")
+{
+    // INSERT RECORDS FROM SEVERAL THREADS.
+    GRAPHICS::RAY_TRACING::IrradianceCache cache(GRAPHICS::RAY_TRACING::AxisAlignedBoundingBox(
+        MATH::Vector3f(0.0f, 0.0f, 0.0f),
+        MATH::Vector3f(16.0f, 16.0f, 16.0f)));
+    const MATH::Vector3f UP(0.0f, 1.0f, 0.0f);
+    constexpr unsigned int THREAD_COUNT = 4;
+    constexpr unsigned int RECORD_COUNT_PER_THREAD = 256;
+    auto insert_records = [&](const unsigned int thread_index)
+    {
+        for (unsigned int record_index = 0; record_index < RECORD_COUNT_PER_THREAD; ++record_index)
+        {
+            cache.Insert(GRAPHICS::RAY_TRACING::IrradianceCache::Record
+            {
+                .Position = MATH::Vector3f(static_cast<float>(record_index % 16), static_cast<float>(record_index / 16), static_cast<float>(thread_index)),
+                .UnitSurfaceNormal = UP,
+                .Irradiance = GRAPHICS::Color(0.0f, 1.0f, 0.0f, 1.0f),
+                .ValidityRadius = 0.25f,
+            });
+        }
+    };
+    std::vector<std::thread> threads;
+    for (unsigned int thread_index = 0; thread_index < THREAD_COUNT; ++thread_index)
+    {
+        threads.emplace_back(insert_records, thread_index);
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    // VERIFY ALL RECORDS WERE INSERTED.
+    REQUIRE(THREAD_COUNT * RECORD_COUNT_PER_THREAD == cache.RecordCount());
+    for (unsigned int thread_index = 0; thread_index < THREAD_COUNT; ++thread_index)
+    {
+        for (unsigned int record_index = 0; record_index < RECORD_COUNT_PER_THREAD; ++record_index)
+        {
+            MATH::Vector3f position(static_cast<float>(record_index % 16), static_cast<float>(record_index / 16), static_cast<float>(thread_index));
+            std::optional<GRAPHICS::Color> irradiance = cache.Interpolate(position, UP);
+            REQUIRE(irradiance);
+            REQUIRE(GRAPHICS::Color::GREEN.Pack(GRAPHICS::ColorFormat::RGBA) == irradiance->Pack(GRAPHICS::ColorFormat::RGBA));
+        }
+    }
+}
+
+TEST_CASE("Indirect diffuse lighting is cached and reused across frames.", "[IrradianceCache][RayTracingAlgorithm]")
+{
+    // CREATE A SCENE WITH A LIT SPHERE ABOVE A FLOOR.
+    GRAPHICS::RAY_TRACING::Scene scene;
+    scene.PointLights.push_back(GRAPHICS::Light
+    {
+        .Type = GRAPHICS::LightType::POINT,
+        .Color = GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f),
+        .PointLightWorldPosition = MATH::Vector3f(0.0f, 5.0f, -2.0f),
+    });
+    auto sphere = std::make_unique<GRAPHICS::RAY_TRACING::Sphere>();
+    sphere->CenterPosition = MATH::Vector3f(0.0f, 0.0f, -4.0f);
+    sphere->Radius = 1.0f;
+    sphere->Material = std::make_shared<GRAPHICS::Material>();
+    sphere->Material->DiffuseColor = GRAPHICS::Color(1.0f, 0.0f, 0.0f, 1.0f);
+    scene.Objects.push_back(std::move(sphere));
+    auto floor = std::make_unique<GRAPHICS::RAY_TRACING::Plane>();
+    floor->PointOnPlane = MATH::Vector3f(0.0f, -1.0f, 0.0f);
+    floor->UnitNormal = MATH::Vector3f(0.0f, 1.0f, 0.0f);
+    floor->Material = std::make_shared<GRAPHICS::Material>();
+    floor->Material->DiffuseColor = GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f);
+    scene.Objects.push_back(std::move(floor));
+
+    // RENDER WITHOUT INDIRECT LIGHTING.
+    GRAPHICS::RAY_TRACING::RayTracingAlgorithm ray_tracer;
+    ray_tracer.Camera = GRAPHICS::Camera::LookAtFrom(MATH::Vector3f(0.0f, 0.0f, -4.0f), MATH::Vector3f(0.0f, 2.0f, 2.0f));
+    ray_tracer.Camera.Projection = GRAPHICS::ProjectionType::PERSPECTIVE;
+    ray_tracer.Specular = false;
+    ray_tracer.Reflections = false;
+    constexpr unsigned int DIMENSION_IN_PIXELS = 16;
+    GRAPHICS::RenderTarget direct_render_target(DIMENSION_IN_PIXELS, DIMENSION_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    ray_tracer.Render(scene, direct_render_target);
+
+    // RENDER WITH CACHED INDIRECT LIGHTING.
+    ray_tracer.IndirectDiffuse = true;
+    ray_tracer.IndirectDiffuseSampleCount = 16;
+    ray_tracer.IndirectDiffuseCache = std::make_shared<GRAPHICS::RAY_TRACING::IrradianceCache>(GRAPHICS::RAY_TRACING::AxisAlignedBoundingBox(
+        MATH::Vector3f(-8.0f, -2.0f, -12.0f),
+        MATH::Vector3f(8.0f, 2.0f, 4.0f)));
+    GRAPHICS::RenderTarget first_indirect_render_target(DIMENSION_IN_PIXELS, DIMENSION_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    ray_tracer.Render(scene, first_indirect_render_target);
+
+    // VERIFY INDIRECT LIGHT ONLY BRIGHTENED THE IMAGE.
+    bool any_pixel_brightened = false;
+    for (unsigned int y = 0; y < DIMENSION_IN_PIXELS; ++y)
+    {
+        for (unsigned int x = 0; x < DIMENSION_IN_PIXELS; ++x)
+        {
+            GRAPHICS::Color direct_color = direct_render_target.GetPixel(x, y);
+            GRAPHICS::Color indirect_color = first_indirect_render_target.GetPixel(x, y);
+            REQUIRE(indirect_color.Red >= direct_color.Red);
+            REQUIRE(indirect_color.Green >= direct_color.Green);
+            REQUIRE(indirect_color.Blue >= direct_color.Blue);
+            any_pixel_brightened = any_pixel_brightened || (indirect_color.Red > direct_color.Red);
+        }
+    }
+    REQUIRE(any_pixel_brightened);
+
+    // VERIFY RECORDS WERE ONLY COMPUTED FOR SOME PIXELS.
+    std::size_t first_frame_record_count = ray_tracer.IndirectDiffuseCache->RecordCount();
+    REQUIRE(first_frame_record_count > 0);
+    REQUIRE(first_frame_record_count < DIMENSION_IN_PIXELS * DIMENSION_IN_PIXELS);
+
+    // VERIFY A LATER FRAME REUSES THE CACHE.
+    GRAPHICS::RenderTarget second_indirect_render_target(DIMENSION_IN_PIXELS, DIMENSION_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    ray_tracer.Render(scene, second_indirect_render_target);
+    REQUIRE(first_frame_record_count == ray_tracer.IndirectDiffuseCache->RecordCount());
+}
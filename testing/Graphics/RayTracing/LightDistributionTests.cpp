@@ -0,0 +1,168 @@
+#include <map>
+#include <memory>
+#include <optional>
+#include <vector>
+#include "Graphics/RayTracing/LightDistribution.h"
+#include "Graphics/RayTracing/Plane.h"
+#include "Graphics/RayTracing/RayTracingAlgorithm.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+/// Creates a grid of equally dim point lights above the XZ plane.
+/// @param[in]  light_count_per_side - The number of lights along each side of the grid.
+/// @return The lights.
+static std::vector<GRAPHICS::Light> CreateGridOfLights(const int light_count_per_side)
+{
+    std::vector<GRAPHICS::Light> lights;
+    for (int x_index = 0; x_index < light_count_per_side; ++x_index)
+    {
+        for (int z_index = 0; z_index < light_count_per_side; ++z_index)
+        {
+            GRAPHICS::Light light;
+            light.Type = GRAPHICS::LightType::POINT;
+            light.Color = GRAPHICS::Color(0.004f, 0.004f, 0.004f, 1.0f);
+            light.PointLightWorldPosition = MATH::Vector3f(
+                static_cast<float>(x_index - (light_count_per_side / 2)),
+                3.0f,
+                static_cast<float>(-z_index));
+            lights.push_back(light);
+        }
+    }
+    return lights;
+}
+
+TEST_CASE("Light sampling probabilities are consistent and proportional to light power.", "[LightDistribution][SampleLight]")
+{
+    // CREATE LIGHTS WITH VARYING POWER.
+    // One light has no power and should never be chosen.
+    std::vector<GRAPHICS::Light> lights = CreateGridOfLights(5);
+    lights[3].Color = GRAPHICS::Color(0.0f, 0.0f, 0.0f, 1.0f);
+    lights[7].Color = GRAPHICS::Color(0.04f, 0.04f, 0.04f, 1.0f);
+    GRAPHICS::RAY_TRACING::LightDistribution light_distribution;
+    light_distribution.Build(lights);
+    REQUIRE(lights.size() == light_distribution.LightCount());
+
+    // SAMPLE LIGHTS ACROSS THE FULL RANGE OF RANDOM NUMBERS.
+    // Each light should be chosen for a range of random numbers whose size equals its probability.
+    constexpr unsigned int SAMPLE_COUNT = 20000;
+    std::map<std::size_t, float> probabilities_by_light_index;
+    std::map<std::size_t, unsigned int> sample_counts_by_light_index;
+    for (unsigned int sample_index = 0; sample_index < SAMPLE_COUNT; ++sample_index)
+    {
+        float random_number = (static_cast<float>(sample_index) + 0.5f) / static_cast<float>(SAMPLE_COUNT);
+        float probability = 0.0f;
+        std::optional<std::size_t> light_index = light_distribution.SampleLight(random_number, probability);
+        REQUIRE(light_index);
+        REQUIRE(probability > 0.0f);
+        probabilities_by_light_index[*light_index] = probability;
+        ++sample_counts_by_light_index[*light_index];
+    }
+
+    // VERIFY THE PROBABILITIES.
+    REQUIRE(probabilities_by_light_index.size() == lights.size() - 1);
+    REQUIRE(probabilities_by_light_index.count(3) == 0);
+    float total_probability = 0.0f;
+    for (const auto& [light_index, probability] : probabilities_by_light_index)
+    {
+        float sampled_proportion = static_cast<float>(sample_counts_by_light_index[light_index]) / static_cast<float>(SAMPLE_COUNT);
+        REQUIRE(probability == Approx(sampled_proportion).margin(0.001f));
+        total_probability += probability;
+    }
+    REQUIRE(1.0f == Approx(total_probability));
+
+    // Point lights aren't attenuated with distance, so equally powerful lights should be equally likely
+    // regardless of position, and the brighter light should be more likely in proportion to its power.
+    REQUIRE(probabilities_by_light_index[10] == Approx(probabilities_by_light_index[4]));
+    REQUIRE(probabilities_by_light_index[7] == Approx(10.0f * probabilities_by_light_index[17]));
+}
+
+TEST_CASE("Lights without power are never sampled, even at the ends of the range of random numbers.", "[LightDistribution][SampleLight]")
+{
+    // CREATE LIGHTS WITHOUT POWER AROUND A SINGLE POWERED LIGHT.
+    std::vector<GRAPHICS::Light> lights = CreateGridOfLights(2);
+    lights[0].Color = GRAPHICS::Color(0.0f, 0.0f, 0.0f, 1.0f);
+    lights[1].Color = GRAPHICS::Color(0.0f, 0.0f, 0.0f, 1.0f);
+    lights[3].Color = GRAPHICS::Color(0.0f, 0.0f, 0.0f, 1.0f);
+    GRAPHICS::RAY_TRACING::LightDistribution light_distribution;
+    light_distribution.Build(lights);
+
+    // VERIFY ONLY THE POWERED LIGHT IS CHOSEN.
+    for (float random_number : { 0.0f, 0.5f, 0.99999994f, 1.0f })
+    {
+        float probability = 0.0f;
+        std::optional<std::size_t> light_index = light_distribution.SampleLight(random_number, probability);
+        REQUIRE(light_index);
+        REQUIRE(2 == *light_index);
+        REQUIRE(1.0f == probability);
+    }
+
+    // VERIFY NO LIGHT IS CHOSEN ONCE NO LIGHTS HAVE POWER.
+    lights[2].Color = GRAPHICS::Color(0.0f, 0.0f, 0.0f, 1.0f);
+    light_distribution.Build(lights);
+    float probability = 1.0f;
+    REQUIRE_FALSE(light_distribution.SampleLight(0.5f, probability));
+    REQUIRE(0.0f == probability);
+}
+
+TEST_CASE("Many-light sampling matches evaluating all lights on average.", "[RayTracingAlgorithm][Render][ManyLightSampling]")
+{
+    // CREATE A GROUND PLANE LIT BY MANY LIGHTS.
+    GRAPHICS::RAY_TRACING::Scene scene;
+    auto ground = std::make_unique<GRAPHICS::RAY_TRACING::Plane>();
+    ground->PointOnPlane = MATH::Vector3f(0.0f, -1.0f, 0.0f);
+    ground->UnitNormal = MATH::Vector3f(0.0f, 1.0f, 0.0f);
+    ground->Material = std::make_shared<GRAPHICS::Material>();
+    ground->Material->DiffuseColor = GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f);
+    scene.Objects.push_back(std::move(ground));
+    scene.PointLights = CreateGridOfLights(12);
+    scene.BuildLightDistribution();
+
+    // RENDER THE SCENE WITH AND WITHOUT SAMPLING LIGHTS.
+    GRAPHICS::RAY_TRACING::RayTracingAlgorithm ray_tracer;
+    ray_tracer.Camera = GRAPHICS::Camera::LookAtFrom(MATH::Vector3f(0.0f, -1.0f, -5.0f), MATH::Vector3f(0.0f, 2.0f, 4.0f));
+    ray_tracer.Camera.Projection = GRAPHICS::ProjectionType::PERSPECTIVE;
+    ray_tracer.Specular = false;
+    ray_tracer.Reflections = false;
+    constexpr unsigned int RENDER_TARGET_DIMENSION_IN_PIXELS = 64;
+    GRAPHICS::RenderTarget all_lights_render_target(RENDER_TARGET_DIMENSION_IN_PIXELS, RENDER_TARGET_DIMENSION_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    ray_tracer.Render(scene, all_lights_render_target);
+
+    ray_tracer.ManyLightSampling = true;
+    GRAPHICS::RenderTarget sampled_lights_render_target(RENDER_TARGET_DIMENSION_IN_PIXELS, RENDER_TARGET_DIMENSION_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    ray_tracer.Render(scene, sampled_lights_render_target);
+
+    // VERIFY THE AVERAGE BRIGHTNESS MATCHES.
+    // Individual pixels are noisy, but the noise should average out across the image.
+    float all_lights_total_red = 0.0f;
+    float sampled_lights_total_red = 0.0f;
+    unsigned int differing_pixel_count = 0;
+    for (unsigned int y = 0; y < RENDER_TARGET_DIMENSION_IN_PIXELS; ++y)
+    {
+        for (unsigned int x = 0; x < RENDER_TARGET_DIMENSION_IN_PIXELS; ++x)
+        {
+            GRAPHICS::Color all_lights_color = all_lights_render_target.GetPixel(x, y);
+            GRAPHICS::Color sampled_lights_color = sampled_lights_render_target.GetPixel(x, y);
+            all_lights_total_red += all_lights_color.Red;
+            sampled_lights_total_red += sampled_lights_color.Red;
+            if (all_lights_color.Red != sampled_lights_color.Red)
+            {
+                ++differing_pixel_count;
+            }
+        }
+    }
+    REQUIRE(differing_pixel_count > 0);
+    REQUIRE(all_lights_total_red > 0.0f);
+    REQUIRE(sampled_lights_total_red == Approx(all_lights_total_red).epsilon(0.05f));
+
+    // VERIFY ALL LIGHTS ARE EVALUATED ONCE THE LIGHT DISTRIBUTION IS OUT OF DATE.
+    scene.PointLights.pop_back();
+    ray_tracer.Render(scene, sampled_lights_render_target);
+    ray_tracer.ManyLightSampling = false;
+    ray_tracer.Render(scene, all_lights_render_target);
+    for (unsigned int y = 0; y < RENDER_TARGET_DIMENSION_IN_PIXELS; ++y)
+    {
+        for (unsigned int x = 0; x < RENDER_TARGET_DIMENSION_IN_PIXELS; ++x)
+        {
+            REQUIRE(all_lights_render_target.GetPixel(x, y).Pack(GRAPHICS::ColorFormat::RGBA) == sampled_lights_render_target.GetPixel(x, y).Pack(GRAPHICS::ColorFormat::RGBA));
+        }
+    }
+}
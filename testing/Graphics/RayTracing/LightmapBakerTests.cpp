@@ -0,0 +1,97 @@
+#include <memory>
+#include "Graphics/RayTracing/LightmapBaker.h"
+#include "Graphics/RayTracing/Sphere.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+/// Computes the lightmap texture coordinates for a point within a triangle.
+/// @param[in]  triangle - The triangle containing the point.
+/// @param[in]  second_vertex_weight - The barycentric weight of the triangle's second vertex for the point.
+/// @param[in]  third_vertex_weight - The barycentric weight of the triangle's third vertex for the point.
+/// @return The lightmap texture coordinates for the point.
+static MATH::Vector2f LightmapTextureCoordinates(const GRAPHICS::Triangle& triangle, const float second_vertex_weight, const float third_vertex_weight)
+{
+    float first_vertex_weight = 1.0f - second_vertex_weight - third_vertex_weight;
+    MATH::Vector2f texture_coordinates = MATH::Vector2f::Scale(first_vertex_weight, triangle.LightmapTextureCoordinates[0]);
+    texture_coordinates += MATH::Vector2f::Scale(second_vertex_weight, triangle.LightmapTextureCoordinates[1]);
+    texture_coordinates += MATH::Vector2f::Scale(third_vertex_weight, triangle.LightmapTextureCoordinates[2]);
+    return texture_coordinates;
+}
+
+TEST_CASE("Generated lightmap texture coordinates give each triangle its own cell.", "[LightmapBaker]")
+{
+    // GENERATE TEXTURE COORDINATES FOR A FEW TRIANGLES.
+    GRAPHICS::Object3D object_3D;
+    constexpr std::size_t TRIANGLE_COUNT = 4;
+    object_3D.Triangles.resize(TRIANGLE_COUNT, GRAPHICS::Triangle::CreateEquilateral(std::make_shared<GRAPHICS::Material>()));
+    constexpr unsigned int LIGHTMAP_DIMENSION_IN_PIXELS = 16;
+    GRAPHICS::RAY_TRACING::LightmapBaker::GenerateLightmapTextureCoordinates(object_3D, LIGHTMAP_DIMENSION_IN_PIXELS);
+
+    // VERIFY EACH TRIANGLE IS INSET WITHIN ITS OWN 8 PIXEL CELL.
+    constexpr float PIXEL = 1.0f / static_cast<float>(LIGHTMAP_DIMENSION_IN_PIXELS);
+    for (std::size_t triangle_index = 0; triangle_index < TRIANGLE_COUNT; ++triangle_index)
+    {
+        float cell_left = static_cast<float>(triangle_index % 2) * 8.0f * PIXEL;
+        float cell_top = static_cast<float>(triangle_index / 2) * 8.0f * PIXEL;
+        const GRAPHICS::Triangle& triangle = object_3D.Triangles[triangle_index];
+        REQUIRE(triangle.LightmapTextureCoordinates[0].X == Approx(cell_left + PIXEL));
+        REQUIRE(triangle.LightmapTextureCoordinates[0].Y == Approx(cell_top + PIXEL));
+        REQUIRE(triangle.LightmapTextureCoordinates[1].X == Approx(cell_left + PIXEL));
+        REQUIRE(triangle.LightmapTextureCoordinates[1].Y == Approx(cell_top + 7.0f * PIXEL));
+        REQUIRE(triangle.LightmapTextureCoordinates[2].X == Approx(cell_left + 7.0f * PIXEL));
+        REQUIRE(triangle.LightmapTextureCoordinates[2].Y == Approx(cell_top + PIXEL));
+    }
+}
+
+TEST_CASE("A baked lightmap includes direct light and shadows.", "[LightmapBaker]")
+{
+    // CREATE A FLOOR FACING UP.
+    auto material = std::make_shared<GRAPHICS::Material>();
+    GRAPHICS::Object3D floor;
+    floor.Triangles.emplace_back(material, std::array<MATH::Vector3f, GRAPHICS::Triangle::VERTEX_COUNT>
+    {
+        MATH::Vector3f(-5.0f, 0.0f, -5.0f),
+        MATH::Vector3f(-5.0f, 0.0f, 5.0f),
+        MATH::Vector3f(5.0f, 0.0f, -5.0f),
+    });
+    floor.Triangles.emplace_back(material, std::array<MATH::Vector3f, GRAPHICS::Triangle::VERTEX_COUNT>
+    {
+        MATH::Vector3f(5.0f, 0.0f, -5.0f),
+        MATH::Vector3f(-5.0f, 0.0f, 5.0f),
+        MATH::Vector3f(5.0f, 0.0f, 5.0f),
+    });
+
+    // CREATE A SCENE WITH A LIGHT ABOVE THE FLOOR AND A SPHERE CASTING A SHADOW ON IT.
+    // The sphere's shadow is centered at (-3.125, 0, -3.125).
+    GRAPHICS::RAY_TRACING::Scene scene;
+    scene.PointLights.push_back(GRAPHICS::Light
+    {
+        .Type = GRAPHICS::LightType::POINT,
+        .Color = GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f),
+        .PointLightWorldPosition = MATH::Vector3f(0.0f, 10.0f, 0.0f),
+    });
+    auto sphere = std::make_unique<GRAPHICS::RAY_TRACING::Sphere>();
+    sphere->CenterPosition = MATH::Vector3f(-2.5f, 2.0f, -2.5f);
+    sphere->Radius = 1.0f;
+    sphere->Material = material;
+    scene.Objects.push_back(std::move(sphere));
+
+    // BAKE THE LIGHTMAP.
+    GRAPHICS::RAY_TRACING::LightmapBaker baker;
+    baker.LightmapDimensionInPixels = 32;
+    GRAPHICS::RAY_TRACING::LightmapBaker::GenerateLightmapTextureCoordinates(floor, baker.LightmapDimensionInPixels);
+    baker.Bake(scene, floor, 4);
+    REQUIRE(nullptr != floor.Lightmap);
+    REQUIRE(32 == floor.Lightmap->Bitmap.GetWidthInPixels());
+
+    // VERIFY A LIT POINT RECEIVES LIGHT BASED ON ITS ANGLE TO THE LIGHT.
+    // The point is at (3, 0, 3) on the second triangle.
+    MATH::Vector2f lit_texture_coordinates = LightmapTextureCoordinates(floor.Triangles[1], 0.2f, 0.6f);
+    GRAPHICS::Color lit_color = floor.Lightmap->SampleBilinear(lit_texture_coordinates);
+    float expected_illumination = 10.0f / std::sqrt(3.0f * 3.0f + 10.0f * 10.0f + 3.0f * 3.0f);
+    REQUIRE(lit_color.Red == Approx(expected_illumination).margin(0.02f));
+
+    // VERIFY A SHADOWED POINT RECEIVES NO LIGHT.
+    MATH::Vector2f shadowed_texture_coordinates = LightmapTextureCoordinates(floor.Triangles[0], 0.1875f, 0.1875f);
+    GRAPHICS::Color shadowed_color = floor.Lightmap->SampleBilinear(shadowed_texture_coordinates);
+    REQUIRE(0.0f == shadowed_color.Red);
+}
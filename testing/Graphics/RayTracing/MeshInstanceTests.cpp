@@ -0,0 +1,102 @@
+#include <memory>
+#include <vector>
+#include "Graphics/Object3D.h"
+#include "Graphics/RayTracing/MeshInstance.h"
+#include "Graphics/RayTracing/RayTracingAlgorithm.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+/// Creates a mesh for a unit square in the XY plane centered at the origin and facing +Z.
+/// @return The square mesh.
+static std::shared_ptr<const GRAPHICS::RAY_TRACING::Mesh> CreateSquareMesh()
+{
+    auto material = std::make_shared<GRAPHICS::Material>();
+    std::vector<GRAPHICS::Triangle> triangles =
+    {
+        GRAPHICS::Triangle(material,
+        {
+            MATH::Vector3f(-0.5f, -0.5f, 0.0f),
+            MATH::Vector3f(0.5f, -0.5f, 0.0f),
+            MATH::Vector3f(0.5f, 0.5f, 0.0f)
+        }),
+        GRAPHICS::Triangle(material,
+        {
+            MATH::Vector3f(-0.5f, -0.5f, 0.0f),
+            MATH::Vector3f(0.5f, 0.5f, 0.0f),
+            MATH::Vector3f(-0.5f, 0.5f, 0.0f)
+        }),
+    };
+    auto mesh = std::make_shared<const GRAPHICS::RAY_TRACING::Mesh>(triangles);
+    return mesh;
+}
+
+TEST_CASE("A ray intersects a translated and scaled mesh instance.", "[MeshInstance][Intersect]")
+{
+    // PLACE A SQUARE FURTHER AWAY AND SCALED UP.
+    GRAPHICS::Object3D placement;
+    placement.WorldPosition = MATH::Vector3f(0.0f, 0.0f, -5.0f);
+    placement.Scale = MATH::Vector3f(4.0f, 4.0f, 4.0f);
+    GRAPHICS::RAY_TRACING::MeshInstance mesh_instance(CreateSquareMesh(), placement.WorldTransform(), placement.InverseWorldTransform());
+
+    // INTERSECT A RAY THAT WOULD ONLY HIT THE SQUARE DUE TO ITS SCALING.
+    GRAPHICS::RAY_TRACING::Ray ray(MATH::Vector3f(1.5f, 1.0f, 0.0f), MATH::Vector3f(0.0f, 0.0f, -1.0f));
+    std::optional<GRAPHICS::RAY_TRACING::RayObjectIntersection> intersection = mesh_instance.Intersect(ray);
+
+    // VERIFY THE INTERSECTION IS IN TERMS OF THE WORLD RAY.
+    REQUIRE(intersection);
+    REQUIRE(&ray == intersection->Ray);
+    REQUIRE(&mesh_instance == intersection->Object);
+    REQUIRE(5.0f == Approx(intersection->DistanceFromRayToObject));
+
+    // VERIFY THE SURFACE NORMAL.
+    MATH::Vector3f surface_normal = mesh_instance.IntersectionSurfaceNormal(*intersection);
+    REQUIRE(0.0f == Approx(surface_normal.X).margin(0.0001f));
+    REQUIRE(0.0f == Approx(surface_normal.Y).margin(0.0001f));
+    REQUIRE(1.0f == Approx(surface_normal.Z));
+}
+
+TEST_CASE("A mesh instance's surface normal reflects its rotation.", "[MeshInstance][IntersectionSurfaceNormal]")
+{
+    // PLACE A SQUARE ROTATED TO FACE +X.
+    GRAPHICS::Object3D placement;
+    placement.WorldPosition = MATH::Vector3f(-5.0f, 0.0f, 0.0f);
+    placement.RotationInRadians.Y = MATH::Angle<float>::DegreesToRadians(MATH::Angle<float>::Degrees(90.0f));
+    GRAPHICS::RAY_TRACING::MeshInstance mesh_instance(CreateSquareMesh(), placement.WorldTransform(), placement.InverseWorldTransform());
+
+    // INTERSECT A RAY TRAVELING TOWARD THE SQUARE.
+    GRAPHICS::RAY_TRACING::Ray ray(MATH::Vector3f(0.0f, 0.0f, 0.0f), MATH::Vector3f(-1.0f, 0.0f, 0.0f));
+    std::optional<GRAPHICS::RAY_TRACING::RayObjectIntersection> intersection = mesh_instance.Intersect(ray);
+
+    // VERIFY THE SURFACE NORMAL FACES BACK TOWARD THE RAY.
+    REQUIRE(intersection);
+    REQUIRE(5.0f == Approx(intersection->DistanceFromRayToObject));
+    MATH::Vector3f surface_normal = mesh_instance.IntersectionSurfaceNormal(*intersection);
+    REQUIRE(1.0f == Approx(surface_normal.X));
+    REQUIRE(0.0f == Approx(surface_normal.Y).margin(0.0001f));
+    REQUIRE(0.0f == Approx(surface_normal.Z).margin(0.0001f));
+}
+
+TEST_CASE("Mesh instances sharing a mesh can occlude rays through the scene hierarchy.", "[MeshInstance][Scene][Occluded]")
+{
+    // CREATE A ROW OF INSTANCES OF THE SAME MESH.
+    std::shared_ptr<const GRAPHICS::RAY_TRACING::Mesh> mesh = CreateSquareMesh();
+    GRAPHICS::RAY_TRACING::Scene scene;
+    constexpr unsigned int INSTANCE_COUNT = 16;
+    for (unsigned int instance_index = 0; instance_index < INSTANCE_COUNT; ++instance_index)
+    {
+        GRAPHICS::Object3D placement;
+        placement.WorldPosition = MATH::Vector3f(static_cast<float>(instance_index) * 2.0f, 0.0f, -5.0f);
+        scene.Objects.push_back(std::make_unique<GRAPHICS::RAY_TRACING::MeshInstance>(
+            mesh,
+            placement.WorldTransform(),
+            placement.InverseWorldTransform()));
+    }
+    scene.BuildAccelerationStructure();
+    REQUIRE(scene.AccelerationStructureIsCurrent());
+
+    // VERIFY RAYS ARE ONLY OCCLUDED WHERE INSTANCES EXIST.
+    GRAPHICS::RAY_TRACING::RayTracingAlgorithm ray_tracer;
+    GRAPHICS::RAY_TRACING::Ray ray_toward_instance(MATH::Vector3f(20.0f, 0.0f, 0.0f), MATH::Vector3f(0.0f, 0.0f, -10.0f));
+    REQUIRE(ray_tracer.Occluded(scene, ray_toward_instance, 0.0f, 1.0f));
+    GRAPHICS::RAY_TRACING::Ray ray_between_instances(MATH::Vector3f(21.0f, 0.0f, 0.0f), MATH::Vector3f(0.0f, 0.0f, -10.0f));
+    REQUIRE_FALSE(ray_tracer.Occluded(scene, ray_between_instances, 0.0f, 1.0f));
+}
@@ -0,0 +1,230 @@
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include "Graphics/RayTracing/PathTracingAlgorithm.h"
+#include "Graphics/RayTracing/Plane.h"
+#include "Graphics/RayTracing/RayTracingAlgorithm.h"
+#include "Graphics/RayTracing/Sphere.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+/// Creates a scene with a sphere resting on a ground plane, lit by a single light.
+/// @return The scene.
+static GRAPHICS::RAY_TRACING::Scene CreateSphereOnGroundScene()
+{
+    GRAPHICS::RAY_TRACING::Scene scene;
+    scene.BackgroundColor = GRAPHICS::Color(0.2f, 0.2f, 0.4f, 1.0f);
+    scene.PointLights.push_back(GRAPHICS::Light
+    {
+        .Type = GRAPHICS::LightType::POINT,
+        .Color = GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f),
+        .PointLightWorldPosition = MATH::Vector3f(2.0f, 3.0f, 0.0f),
+    });
+
+    auto sphere = std::make_unique<GRAPHICS::RAY_TRACING::Sphere>();
+    sphere->CenterPosition = MATH::Vector3f(0.0f, 0.0f, -4.0f);
+    sphere->Radius = 1.0f;
+    sphere->Material = std::make_shared<GRAPHICS::Material>();
+    sphere->Material->DiffuseColor = GRAPHICS::Color(0.8f, 0.3f, 0.3f, 1.0f);
+    sphere->Material->ReflectivityProportion = 0.25f;
+    scene.Objects.push_back(std::move(sphere));
+
+    auto ground = std::make_unique<GRAPHICS::RAY_TRACING::Plane>();
+    ground->PointOnPlane = MATH::Vector3f(0.0f, -1.0f, 0.0f);
+    ground->UnitNormal = MATH::Vector3f(0.0f, 1.0f, 0.0f);
+    ground->Material = std::make_shared<GRAPHICS::Material>();
+    ground->Material->DiffuseColor = GRAPHICS::Color(0.5f, 0.5f, 0.5f, 1.0f);
+    scene.Objects.push_back(std::move(ground));
+
+    return scene;
+}
+
+TEST_CASE("Path tracing a scene without objects accumulates the background color.", "[PathTracingAlgorithm]")
+{
+    // CREATE AN EMPTY SCENE.
+    GRAPHICS::RAY_TRACING::Scene scene;
+    scene.BackgroundColor = GRAPHICS::Color(0.25f, 0.5f, 0.75f, 1.0f);
+
+    // RENDER UNTIL THE IMAGE CONVERGES.
+    // Every sample is identical, so tiles should stop as soon as variance can be checked.
+    GRAPHICS::RAY_TRACING::PathTracingAlgorithm path_tracer;
+    path_tracer.MinSampleCountPerPixel = 4;
+    path_tracer.VarianceThreshold = 0.0001f;
+    GRAPHICS::RenderTarget render_target(20, 18, GRAPHICS::ColorFormat::RGBA);
+    REQUIRE_FALSE(path_tracer.RenderPass(scene));
+    path_tracer.StartRender(render_target);
+    bool render_complete = false;
+    while (!render_complete)
+    {
+        render_complete = path_tracer.RenderPass(scene);
+    }
+    REQUIRE(path_tracer.IsComplete());
+    REQUIRE(path_tracer.MinSampleCountPerPixel == path_tracer.CompletedPassCount());
+
+    // VERIFY THE RESOLVED IMAGE IS THE BACKGROUND COLOR.
+    path_tracer.Accumulation.ResolveTo(render_target);
+    for (unsigned int y = 0; y < render_target.GetHeightInPixels(); ++y)
+    {
+        for (unsigned int x = 0; x < render_target.GetWidthInPixels(); ++x)
+        {
+            REQUIRE(path_tracer.MinSampleCountPerPixel == path_tracer.Accumulation.Pixels(x, y).SampleCount);
+            REQUIRE(0.0f == path_tracer.Accumulation.VarianceOfMean(x, y));
+            REQUIRE(scene.BackgroundColor.Pack(GRAPHICS::ColorFormat::RGBA) == render_target.GetPixel(x, y).Pack(GRAPHICS::ColorFormat::RGBA));
+        }
+    }
+}
+
+TEST_CASE("Path tracing stops at the maximum sample count without a variance threshold.", "[PathTracingAlgorithm]")
+{
+    GRAPHICS::RAY_TRACING::Scene scene = CreateSphereOnGroundScene();
+    GRAPHICS::RAY_TRACING::PathTracingAlgorithm path_tracer;
+    path_tracer.MaxSampleCountPerPixel = 3;
+    GRAPHICS::RenderTarget render_target(16, 16, GRAPHICS::ColorFormat::RGBA);
+    path_tracer.StartRender(render_target);
+
+    REQUIRE_FALSE(path_tracer.RenderPass(scene));
+    REQUIRE_FALSE(path_tracer.RenderPass(scene));
+    REQUIRE(path_tracer.RenderPass(scene));
+    REQUIRE(path_tracer.IsComplete());
+    REQUIRE(path_tracer.RenderPass(scene));
+    REQUIRE(3 == path_tracer.CompletedPassCount());
+}
+
+TEST_CASE("Timed path tracing renders the noisiest tile first.", "[PathTracingAlgorithm][RenderUntil]")
+{
+    // RENDER ENOUGH PASSES TO ESTIMATE THE ERROR IN EACH TILE.
+    GRAPHICS::RAY_TRACING::Scene scene = CreateSphereOnGroundScene();
+    GRAPHICS::RAY_TRACING::PathTracingAlgorithm path_tracer;
+    path_tracer.MaxSampleCountPerPixel = 4;
+    constexpr unsigned int WIDTH_IN_PIXELS = 3 * GRAPHICS::RAY_TRACING::ScreenTile::DEFAULT_DIMENSION_IN_PIXELS;
+    constexpr unsigned int HEIGHT_IN_PIXELS = 2 * GRAPHICS::RAY_TRACING::ScreenTile::DEFAULT_DIMENSION_IN_PIXELS;
+    GRAPHICS::RenderTarget render_target(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    REQUIRE_FALSE(path_tracer.RenderUntil(scene, std::chrono::steady_clock::now()));
+    path_tracer.StartRender(render_target);
+    path_tracer.RenderPass(scene);
+    path_tracer.RenderPass(scene);
+
+    // FIND THE NOISIEST TILE.
+    std::vector<GRAPHICS::RAY_TRACING::ScreenTile> tiles = GRAPHICS::RAY_TRACING::ScreenTile::Partition(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS);
+    auto noisiest_tile = std::max_element(
+        tiles.cbegin(),
+        tiles.cend(),
+        [&](const GRAPHICS::RAY_TRACING::ScreenTile& lhs_tile, const GRAPHICS::RAY_TRACING::ScreenTile& rhs_tile)
+        {
+            return path_tracer.Accumulation.AverageVarianceOfMean(lhs_tile) < path_tracer.Accumulation.AverageVarianceOfMean(rhs_tile);
+        });
+    REQUIRE(path_tracer.Accumulation.AverageVarianceOfMean(*noisiest_tile) > 0.0f);
+
+    // RENDER WITH A DEADLINE THAT HAS ALREADY PASSED.
+    // Only the noisiest tile should get another sample.
+    std::chrono::steady_clock::time_point passed_deadline = std::chrono::steady_clock::now();
+    REQUIRE_FALSE(path_tracer.RenderUntil(scene, passed_deadline));
+    for (const GRAPHICS::RAY_TRACING::ScreenTile& tile : tiles)
+    {
+        unsigned int expected_sample_count = (tile.Index == noisiest_tile->Index) ? 3 : 2;
+        REQUIRE(expected_sample_count == path_tracer.Accumulation.MinSampleCount(tile));
+    }
+    REQUIRE(2 == path_tracer.CompletedPassCount());
+
+    // FINISH RENDERING WITH A DISTANT DEADLINE.
+    std::chrono::steady_clock::time_point distant_deadline = std::chrono::steady_clock::now() + std::chrono::hours(1);
+    REQUIRE(path_tracer.RenderUntil(scene, distant_deadline));
+    REQUIRE(path_tracer.IsComplete());
+    REQUIRE(4 == path_tracer.CompletedPassCount());
+    for (const GRAPHICS::RAY_TRACING::ScreenTile& tile : tiles)
+    {
+        REQUIRE(4 == path_tracer.Accumulation.MinSampleCount(tile));
+    }
+}
+
+TEST_CASE("Path traced images are identical regardless of thread count.", "[PathTracingAlgorithm]")
+{
+    // RENDER THE SAME SCENE WITH DIFFERENT NUMBERS OF THREADS.
+    // The dimensions are intentionally not multiples of the tile size.
+    GRAPHICS::RAY_TRACING::Scene scene = CreateSphereOnGroundScene();
+    GRAPHICS::RenderTarget render_target(37, 29, GRAPHICS::ColorFormat::RGBA);
+    constexpr unsigned int PASS_COUNT = 4;
+
+    GRAPHICS::RAY_TRACING::PathTracingAlgorithm single_threaded_path_tracer;
+    single_threaded_path_tracer.StartRender(render_target);
+    GRAPHICS::RAY_TRACING::PathTracingAlgorithm multi_threaded_path_tracer;
+    multi_threaded_path_tracer.StartRender(render_target);
+    for (unsigned int pass_index = 0; pass_index < PASS_COUNT; ++pass_index)
+    {
+        single_threaded_path_tracer.RenderPass(scene, 1);
+        multi_threaded_path_tracer.RenderPass(scene, 4);
+    }
+
+    // VERIFY THE ACCUMULATED SAMPLES MATCH EXACTLY.
+    for (unsigned int y = 0; y < render_target.GetHeightInPixels(); ++y)
+    {
+        for (unsigned int x = 0; x < render_target.GetWidthInPixels(); ++x)
+        {
+            const GRAPHICS::RAY_TRACING::AccumulationBuffer::Pixel& single_threaded_pixel = single_threaded_path_tracer.Accumulation.Pixels(x, y);
+            const GRAPHICS::RAY_TRACING::AccumulationBuffer::Pixel& multi_threaded_pixel = multi_threaded_path_tracer.Accumulation.Pixels(x, y);
+            REQUIRE(PASS_COUNT == single_threaded_pixel.SampleCount);
+            REQUIRE(PASS_COUNT == multi_threaded_pixel.SampleCount);
+            REQUIRE(single_threaded_pixel.RadianceSum == multi_threaded_pixel.RadianceSum);
+            REQUIRE(single_threaded_pixel.SquaredLuminanceSum == multi_threaded_pixel.SquaredLuminanceSum);
+        }
+    }
+}
+
+TEST_CASE("Path traced direct lighting matches ray traced diffuse lighting on average.", "[PathTracingAlgorithm]")
+{
+    // CREATE A SINGLE LIT GROUND PLANE.
+    // Nothing else is in the scene, so all light bouncing off the plane escapes into the black background.
+    GRAPHICS::RAY_TRACING::Scene scene;
+    scene.PointLights.push_back(GRAPHICS::Light
+    {
+        .Type = GRAPHICS::LightType::POINT,
+        .Color = GRAPHICS::Color(0.9f, 0.9f, 0.9f, 1.0f),
+        .PointLightWorldPosition = MATH::Vector3f(0.0f, 2.0f, -4.0f),
+    });
+    auto ground = std::make_unique<GRAPHICS::RAY_TRACING::Plane>();
+    ground->PointOnPlane = MATH::Vector3f(0.0f, -1.0f, 0.0f);
+    ground->UnitNormal = MATH::Vector3f(0.0f, 1.0f, 0.0f);
+    ground->Material = std::make_shared<GRAPHICS::Material>();
+    ground->Material->DiffuseColor = GRAPHICS::Color(1.0f, 0.5f, 0.25f, 1.0f);
+    scene.Objects.push_back(std::move(ground));
+
+    // RENDER THE SCENE WITH BOTH ALGORITHMS.
+    constexpr unsigned int RENDER_TARGET_DIMENSION_IN_PIXELS = 32;
+    const MATH::Vector3f CAMERA_POSITION(0.0f, 0.0f, 0.0f);
+    const MATH::Vector3f LOOK_AT_POSITION(0.0f, -1.0f, -4.0f);
+
+    GRAPHICS::RAY_TRACING::RayTracingAlgorithm ray_tracer;
+    ray_tracer.Camera = GRAPHICS::Camera::LookAtFrom(LOOK_AT_POSITION, CAMERA_POSITION);
+    ray_tracer.Camera.Projection = GRAPHICS::ProjectionType::PERSPECTIVE;
+    ray_tracer.Ambient = false;
+    ray_tracer.Specular = false;
+    ray_tracer.Reflections = false;
+    GRAPHICS::RenderTarget ray_traced_render_target(RENDER_TARGET_DIMENSION_IN_PIXELS, RENDER_TARGET_DIMENSION_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    ray_tracer.Render(scene, ray_traced_render_target);
+
+    GRAPHICS::RAY_TRACING::PathTracingAlgorithm path_tracer;
+    path_tracer.Camera = ray_tracer.Camera;
+    path_tracer.MaxSampleCountPerPixel = 8;
+    GRAPHICS::RenderTarget path_traced_render_target(RENDER_TARGET_DIMENSION_IN_PIXELS, RENDER_TARGET_DIMENSION_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    path_tracer.StartRender(path_traced_render_target);
+    bool render_complete = false;
+    while (!render_complete)
+    {
+        render_complete = path_tracer.RenderPass(scene);
+    }
+    path_tracer.Accumulation.ResolveTo(path_traced_render_target);
+
+    // VERIFY THE TOTAL BRIGHTNESS MATCHES.
+    // Jittered samples differ slightly from rays through pixel centers, but these differences average out.
+    float ray_traced_total_green = 0.0f;
+    float path_traced_total_green = 0.0f;
+    for (unsigned int y = 0; y < RENDER_TARGET_DIMENSION_IN_PIXELS; ++y)
+    {
+        for (unsigned int x = 0; x < RENDER_TARGET_DIMENSION_IN_PIXELS; ++x)
+        {
+            ray_traced_total_green += ray_traced_render_target.GetPixel(x, y).Green;
+            path_traced_total_green += path_traced_render_target.GetPixel(x, y).Green;
+        }
+    }
+    REQUIRE(ray_traced_total_green > 0.0f);
+    REQUIRE(path_traced_total_green == Approx(ray_traced_total_green).epsilon(0.02f));
+}
@@ -0,0 +1,95 @@
+#include <array>
+#include <limits>
+#include <optional>
+#include "Graphics/RayTracing/Disc.h"
+#include "Graphics/RayTracing/Plane.h"
+#include "Graphics/RayTracing/RayPacket.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+/// Creates a packet of rays pointing in various directions from above the origin,
+/// including rays parallel to and pointing away from the XZ plane.
+/// @return The ray packet.
+static GRAPHICS::RAY_TRACING::RayPacket CreateRaysFromAboveOrigin()
+{
+    GRAPHICS::RAY_TRACING::RayPacket ray_packet;
+    MATH::Vector3f origin(0.0f, 2.0f, 0.0f);
+    ray_packet.Add(GRAPHICS::RAY_TRACING::Ray(origin, MATH::Vector3f(0.0f, -1.0f, 0.0f)));
+    ray_packet.Add(GRAPHICS::RAY_TRACING::Ray(origin, MATH::Vector3f(0.5f, -1.0f, 0.0f)));
+    ray_packet.Add(GRAPHICS::RAY_TRACING::Ray(origin, MATH::Vector3f(0.0f, -1.0f, 3.0f)));
+    ray_packet.Add(GRAPHICS::RAY_TRACING::Ray(origin, MATH::Vector3f(-2.0f, -0.5f, 0.0f)));
+    ray_packet.Add(GRAPHICS::RAY_TRACING::Ray(origin, MATH::Vector3f(1.0f, 0.0f, 0.0f)));
+    ray_packet.Add(GRAPHICS::RAY_TRACING::Ray(origin, MATH::Vector3f(0.0f, 1.0f, 0.0f)));
+    ray_packet.Add(GRAPHICS::RAY_TRACING::Ray(origin, MATH::Vector3f(0.2f, -2.0f, -0.2f)));
+    ray_packet.Add(GRAPHICS::RAY_TRACING::Ray(origin, MATH::Vector3f(0.0f, -0.1f, -1.0f)));
+    return ray_packet;
+}
+
+TEST_CASE("A ray intersects a plane in front of it.", "[Plane][Intersect]")
+{
+    GRAPHICS::RAY_TRACING::Plane plane;
+    plane.PointOnPlane = MATH::Vector3f(5.0f, -1.0f, 3.0f);
+    plane.UnitNormal = MATH::Vector3f(0.0f, 1.0f, 0.0f);
+
+    GRAPHICS::RAY_TRACING::Ray downward_ray(MATH::Vector3f(0.0f, 1.0f, 0.0f), MATH::Vector3f(0.0f, -0.5f, 0.0f));
+    std::optional<GRAPHICS::RAY_TRACING::RayObjectIntersection> intersection = plane.Intersect(downward_ray);
+    REQUIRE(intersection);
+    REQUIRE(4.0f == intersection->DistanceFromRayToObject);
+    REQUIRE(MATH::Vector3f(0.0f, 1.0f, 0.0f) == plane.SurfaceNormal(intersection->IntersectionPoint()));
+
+    GRAPHICS::RAY_TRACING::Ray upward_ray(MATH::Vector3f(0.0f, 1.0f, 0.0f), MATH::Vector3f(0.0f, 1.0f, 0.0f));
+    REQUIRE_FALSE(plane.Intersect(upward_ray));
+    GRAPHICS::RAY_TRACING::Ray parallel_ray(MATH::Vector3f(0.0f, 1.0f, 0.0f), MATH::Vector3f(1.0f, 0.0f, 0.0f));
+    REQUIRE_FALSE(plane.Intersect(parallel_ray));
+    REQUIRE_FALSE(plane.Bounds().IsFinite());
+}
+
+TEST_CASE("A disc is only intersected within its radius.", "[Disc][Intersect]")
+{
+    GRAPHICS::RAY_TRACING::Disc disc;
+    disc.CenterPosition = MATH::Vector3f(0.0f, 0.0f, 0.0f);
+    disc.UnitNormal = MATH::Vector3f(0.0f, 1.0f, 0.0f);
+    disc.Radius = 1.0f;
+
+    GRAPHICS::RAY_TRACING::Ray ray_inside_radius(MATH::Vector3f(0.9f, 1.0f, 0.0f), MATH::Vector3f(0.0f, -1.0f, 0.0f));
+    std::optional<GRAPHICS::RAY_TRACING::RayObjectIntersection> intersection = disc.Intersect(ray_inside_radius);
+    REQUIRE(intersection);
+    REQUIRE(1.0f == intersection->DistanceFromRayToObject);
+    GRAPHICS::RAY_TRACING::Ray ray_outside_radius(MATH::Vector3f(0.8f, 1.0f, 0.8f), MATH::Vector3f(0.0f, -1.0f, 0.0f));
+    REQUIRE_FALSE(disc.Intersect(ray_outside_radius));
+
+    // A disc facing along an axis has no thickness along that axis.
+    GRAPHICS::RAY_TRACING::AxisAlignedBoundingBox bounds = disc.Bounds();
+    REQUIRE(MATH::Vector3f(-1.0f, 0.0f, -1.0f) == bounds.MinimumCorner);
+    REQUIRE(MATH::Vector3f(1.0f, 0.0f, 1.0f) == bounds.MaximumCorner);
+}
+
+TEST_CASE("Packet intersections with planes and discs match single ray intersections.", "[Plane][Disc][IntersectPacket]")
+{
+    GRAPHICS::RAY_TRACING::RayPacket ray_packet = CreateRaysFromAboveOrigin();
+    REQUIRE(GRAPHICS::RAY_TRACING::RayPacket::MAX_RAY_COUNT == ray_packet.RayCount);
+
+    GRAPHICS::RAY_TRACING::Plane plane;
+    plane.PointOnPlane = MATH::Vector3f(0.0f, -1.0f, 0.0f);
+    plane.UnitNormal = MATH::Vector3f::Normalize(MATH::Vector3f(0.1f, 1.0f, 0.0f));
+    GRAPHICS::RAY_TRACING::Disc disc;
+    disc.CenterPosition = MATH::Vector3f(0.0f, -1.0f, 0.0f);
+    disc.UnitNormal = plane.UnitNormal;
+    disc.Radius = 2.0f;
+
+    std::array<float, GRAPHICS::RAY_TRACING::RayPacket::MAX_RAY_COUNT> plane_distances;
+    plane.IntersectPacket(ray_packet, plane_distances);
+    std::array<float, GRAPHICS::RAY_TRACING::RayPacket::MAX_RAY_COUNT> disc_distances;
+    disc.IntersectPacket(ray_packet, disc_distances);
+    for (std::size_t ray_index = 0; ray_index < ray_packet.RayCount; ++ray_index)
+    {
+        GRAPHICS::RAY_TRACING::Ray ray = ray_packet.GetRay(ray_index);
+
+        std::optional<GRAPHICS::RAY_TRACING::RayObjectIntersection> plane_intersection = plane.Intersect(ray);
+        float expected_plane_distance = plane_intersection ? plane_intersection->DistanceFromRayToObject : std::numeric_limits<float>::infinity();
+        REQUIRE(plane_distances[ray_index] == Approx(expected_plane_distance));
+
+        std::optional<GRAPHICS::RAY_TRACING::RayObjectIntersection> disc_intersection = disc.Intersect(ray);
+        float expected_disc_distance = disc_intersection ? disc_intersection->DistanceFromRayToObject : std::numeric_limits<float>::infinity();
+        REQUIRE(disc_distances[ray_index] == Approx(expected_disc_distance));
+    }
+}
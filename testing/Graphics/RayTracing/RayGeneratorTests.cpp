@@ -0,0 +1,114 @@
+#include "Graphics/Camera.h"
+#include "Graphics/RayTracing/RayGenerator.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+/// Requires two rays to be approximately equal.
+/// @param[in]  expected_ray - The expected ray.
+/// @param[in]  actual_ray - The actual ray.
+void RequireApproximatelyEqualRays(const GRAPHICS::RAY_TRACING::Ray& expected_ray, const GRAPHICS::RAY_TRACING::Ray& actual_ray)
+{
+    constexpr float TOLERANCE = 0.0001f;
+    REQUIRE(expected_ray.Origin.X == Approx(actual_ray.Origin.X).margin(TOLERANCE));
+    REQUIRE(expected_ray.Origin.Y == Approx(actual_ray.Origin.Y).margin(TOLERANCE));
+    REQUIRE(expected_ray.Origin.Z == Approx(actual_ray.Origin.Z).margin(TOLERANCE));
+    REQUIRE(expected_ray.Direction.X == Approx(actual_ray.Direction.X).margin(TOLERANCE));
+    REQUIRE(expected_ray.Direction.Y == Approx(actual_ray.Direction.Y).margin(TOLERANCE));
+    REQUIRE(expected_ray.Direction.Z == Approx(actual_ray.Direction.Z).margin(TOLERANCE));
+}
+
+TEST_CASE("Generated viewing rays match the camera's viewing rays.", "[RayGenerator]")
+{
+    // CREATE A NON-SQUARE RENDER TARGET.
+    constexpr unsigned int RENDER_TARGET_WIDTH_IN_PIXELS = 24;
+    constexpr unsigned int RENDER_TARGET_HEIGHT_IN_PIXELS = 18;
+    GRAPHICS::RenderTarget render_target(
+        RENDER_TARGET_WIDTH_IN_PIXELS,
+        RENDER_TARGET_HEIGHT_IN_PIXELS,
+        GRAPHICS::ColorFormat::RGBA);
+
+    // CREATE A CAMERA LOOKING AT AN ANGLE.
+    // Looking down at an angle results in a camera frame whose axes aren't all perpendicular.
+    GRAPHICS::Camera camera = GRAPHICS::Camera::LookAtFrom(MATH::Vector3f(1.0f, -1.0f, 0.0f), MATH::Vector3f(-2.0f, 3.0f, 6.0f));
+    camera.FieldOfView = MATH::Angle<float>::Degrees(60.0f);
+    GRAPHICS::ProjectionType projection_type = GENERATE(GRAPHICS::ProjectionType::ORTHOGRAPHIC, GRAPHICS::ProjectionType::PERSPECTIVE);
+    camera.Projection = projection_type;
+
+    // GENERATE RAYS IN EACH SUPPORTED WAY.
+    GRAPHICS::RAY_TRACING::RayGenerator ray_generator(camera, render_target);
+    SECTION("Rays through pixel centers")
+    {
+        for (unsigned int y = 0; y < RENDER_TARGET_HEIGHT_IN_PIXELS; ++y)
+        {
+            for (unsigned int x = 0; x < RENDER_TARGET_WIDTH_IN_PIXELS; ++x)
+            {
+                MATH::Vector2ui pixel_coordinates(x, y);
+                GRAPHICS::RAY_TRACING::Ray expected_ray = camera.ViewingRay(pixel_coordinates, render_target);
+                GRAPHICS::RAY_TRACING::Ray actual_ray = ray_generator.ViewingRay(pixel_coordinates);
+                RequireApproximatelyEqualRays(expected_ray, actual_ray);
+            }
+        }
+    }
+
+    SECTION("Rays through arbitrary screen positions")
+    {
+        const MATH::Vector2f SCREEN_POSITIONS[] =
+        {
+            MATH::Vector2f(0.0f, 0.0f),
+            MATH::Vector2f(3.25f, 17.9f),
+            MATH::Vector2f(12.0f, 9.0f),
+            MATH::Vector2f(24.0f, 18.0f),
+        };
+        for (const MATH::Vector2f& screen_position : SCREEN_POSITIONS)
+        {
+            GRAPHICS::RAY_TRACING::Ray expected_ray = camera.ViewingRay(screen_position, render_target);
+            GRAPHICS::RAY_TRACING::Ray actual_ray = ray_generator.ViewingRay(screen_position);
+            RequireApproximatelyEqualRays(expected_ray, actual_ray);
+        }
+    }
+
+    SECTION("Rays incrementally generated across a tile")
+    {
+        GRAPHICS::RAY_TRACING::ScreenTile tile;
+        tile.LeftX = 5;
+        tile.TopY = 3;
+        tile.WidthInPixels = 16;
+        tile.HeightInPixels = 11;
+
+        unsigned int visited_pixel_count = 0;
+        ray_generator.VisitTileRays(tile, [&](const MATH::Vector2ui& pixel_coordinates, const GRAPHICS::RAY_TRACING::Ray& actual_ray)
+        {
+            // The visit order should be row-major.
+            unsigned int expected_x = tile.LeftX + (visited_pixel_count % tile.WidthInPixels);
+            unsigned int expected_y = tile.TopY + (visited_pixel_count / tile.WidthInPixels);
+            REQUIRE(expected_x == pixel_coordinates.X);
+            REQUIRE(expected_y == pixel_coordinates.Y);
+
+            GRAPHICS::RAY_TRACING::Ray expected_ray = camera.ViewingRay(pixel_coordinates, render_target);
+            RequireApproximatelyEqualRays(expected_ray, actual_ray);
+            ++visited_pixel_count;
+        });
+        REQUIRE(tile.PixelCount() == visited_pixel_count);
+    }
+
+    SECTION("Packets of rays along a row")
+    {
+        // The packet starting near the end of the row should be clipped.
+        constexpr unsigned int Y = 7;
+        for (unsigned int start_x = 0; start_x < RENDER_TARGET_WIDTH_IN_PIXELS; start_x += 5)
+        {
+            GRAPHICS::RAY_TRACING::RayPacket ray_packet;
+            ray_generator.RowPacket(start_x, Y, ray_packet);
+
+            std::size_t expected_ray_count = std::min<std::size_t>(
+                GRAPHICS::RAY_TRACING::RayPacket::MAX_RAY_COUNT,
+                RENDER_TARGET_WIDTH_IN_PIXELS - start_x);
+            REQUIRE(expected_ray_count == ray_packet.RayCount);
+            for (std::size_t ray_index = 0; ray_index < ray_packet.RayCount; ++ray_index)
+            {
+                MATH::Vector2ui pixel_coordinates(start_x + static_cast<unsigned int>(ray_index), Y);
+                GRAPHICS::RAY_TRACING::Ray expected_ray = camera.ViewingRay(pixel_coordinates, render_target);
+                RequireApproximatelyEqualRays(expected_ray, ray_packet.GetRay(ray_index));
+            }
+        }
+    }
+}
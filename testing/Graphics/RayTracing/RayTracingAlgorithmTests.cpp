@@ -0,0 +1,609 @@
+#include <cmath>
+#include <memory>
+#include "Graphics/RayTracing/AxisAlignedBox.h"
+#include "Graphics/RayTracing/Disc.h"
+#include "Graphics/RayTracing/Plane.h"
+#include "Graphics/RayTracing/RayTracingAlgorithm.h"
+#include "Graphics/RayTracing/Sphere.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+TEST_CASE("A ray is occluded by an object between its endpoints.", "[RayTracingAlgorithm][Occluded]")
+{
+    // CREATE A SCENE WITH A SPHERE BETWEEN THE RAY ENDPOINTS.
+    GRAPHICS::RAY_TRACING::Scene scene;
+    auto sphere = std::make_unique<GRAPHICS::RAY_TRACING::Sphere>();
+    sphere->CenterPosition = MATH::Vector3f(0.0f, 0.0f, -5.0f);
+    sphere->Radius = 1.0f;
+    sphere->Material = std::make_shared<GRAPHICS::Material>();
+    scene.Objects.push_back(std::move(sphere));
+
+    // CHECK IF THE RAY IS OCCLUDED.
+    // The ray's direction spans the full distance to the endpoint so that [0, 1] covers the segment.
+    GRAPHICS::RAY_TRACING::Ray ray(MATH::Vector3f(0.0f, 0.0f, 0.0f), MATH::Vector3f(0.0f, 0.0f, -10.0f));
+    GRAPHICS::RAY_TRACING::RayTracingAlgorithm ray_tracer;
+    bool occluded = ray_tracer.Occluded(scene, ray, 0.0f, 1.0f);
+
+    // VERIFY THE RAY WAS OCCLUDED.
+    REQUIRE(occluded);
+}
+
+TEST_CASE("A ray is not occluded by an object beyond its maximum distance.", "[RayTracingAlgorithm][Occluded]")
+{
+    // CREATE A SCENE WITH A SPHERE BEYOND THE RAY ENDPOINT.
+    GRAPHICS::RAY_TRACING::Scene scene;
+    auto sphere = std::make_unique<GRAPHICS::RAY_TRACING::Sphere>();
+    sphere->CenterPosition = MATH::Vector3f(0.0f, 0.0f, -20.0f);
+    sphere->Radius = 1.0f;
+    sphere->Material = std::make_shared<GRAPHICS::Material>();
+    scene.Objects.push_back(std::move(sphere));
+
+    // CHECK IF THE RAY IS OCCLUDED.
+    GRAPHICS::RAY_TRACING::Ray ray(MATH::Vector3f(0.0f, 0.0f, 0.0f), MATH::Vector3f(0.0f, 0.0f, -10.0f));
+    GRAPHICS::RAY_TRACING::RayTracingAlgorithm ray_tracer;
+    bool occluded = ray_tracer.Occluded(scene, ray, 0.0f, 1.0f);
+
+    // VERIFY THE RAY WAS NOT OCCLUDED.
+    REQUIRE_FALSE(occluded);
+}
+
+TEST_CASE("A ray is not occluded by an object that doesn't cast shadows.", "[RayTracingAlgorithm][Occluded]")
+{
+    // CREATE A SCENE WITH A NON-SHADOW-CASTING SPHERE BETWEEN THE RAY ENDPOINTS.
+    GRAPHICS::RAY_TRACING::Scene scene;
+    auto sphere = std::make_unique<GRAPHICS::RAY_TRACING::Sphere>();
+    sphere->CenterPosition = MATH::Vector3f(0.0f, 0.0f, -5.0f);
+    sphere->Radius = 1.0f;
+    sphere->Material = std::make_shared<GRAPHICS::Material>();
+    sphere->Material->CastsShadows = false;
+    scene.Objects.push_back(std::move(sphere));
+
+    // CHECK IF THE RAY IS OCCLUDED.
+    GRAPHICS::RAY_TRACING::Ray ray(MATH::Vector3f(0.0f, 0.0f, 0.0f), MATH::Vector3f(0.0f, 0.0f, -10.0f));
+    GRAPHICS::RAY_TRACING::RayTracingAlgorithm ray_tracer;
+    bool occluded = ray_tracer.Occluded(scene, ray, 0.0f, 1.0f);
+
+    // VERIFY THE RAY WAS NOT OCCLUDED.
+    REQUIRE_FALSE(occluded);
+}
+
+TEST_CASE("A ray is not occluded by an ignored object.", "[RayTracingAlgorithm][Occluded]")
+{
+    // CREATE A SCENE WITH A SPHERE BETWEEN THE RAY ENDPOINTS.
+    GRAPHICS::RAY_TRACING::Scene scene;
+    auto sphere = std::make_unique<GRAPHICS::RAY_TRACING::Sphere>();
+    sphere->CenterPosition = MATH::Vector3f(0.0f, 0.0f, -5.0f);
+    sphere->Radius = 1.0f;
+    sphere->Material = std::make_shared<GRAPHICS::Material>();
+    const GRAPHICS::RAY_TRACING::IObject3D* ignored_object = sphere.get();
+    scene.Objects.push_back(std::move(sphere));
+
+    // CHECK IF THE RAY IS OCCLUDED WHILE IGNORING THE SPHERE.
+    GRAPHICS::RAY_TRACING::Ray ray(MATH::Vector3f(0.0f, 0.0f, 0.0f), MATH::Vector3f(0.0f, 0.0f, -10.0f));
+    GRAPHICS::RAY_TRACING::RayTracingAlgorithm ray_tracer;
+    bool occluded = ray_tracer.Occluded(scene, ray, 0.0f, 1.0f, ignored_object);
+
+    // VERIFY THE RAY WAS NOT OCCLUDED.
+    REQUIRE_FALSE(occluded);
+}
+
+TEST_CASE("Progressive rendering matches full rendering using exactly one ray per pixel.", "[RayTracingAlgorithm][RenderStep]")
+{
+    // CREATE A SCENE WITH A SPHERE IN VIEW.
+    GRAPHICS::RAY_TRACING::Scene scene;
+    scene.BackgroundColor = GRAPHICS::Color(0.2f, 0.2f, 1.0f, 1.0f);
+    scene.PointLights.push_back(GRAPHICS::Light
+    {
+        .Color = GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f),
+        .PointLightWorldPosition = MATH::Vector3f(2.0f, 2.0f, 2.0f),
+    });
+    auto sphere = std::make_unique<GRAPHICS::RAY_TRACING::Sphere>();
+    sphere->CenterPosition = MATH::Vector3f(0.2f, -0.1f, -3.0f);
+    sphere->Radius = 1.0f;
+    sphere->Material = std::make_shared<GRAPHICS::Material>();
+    sphere->Material->DiffuseColor = GRAPHICS::Color(0.8f, 0.3f, 0.3f, 1.0f);
+    scene.Objects.push_back(std::move(sphere));
+
+    // RENDER THE SCENE FULLY.
+    // The dimensions are intentionally not multiples of the coarsest block size.
+    constexpr unsigned int WIDTH_IN_PIXELS = 21;
+    constexpr unsigned int HEIGHT_IN_PIXELS = 13;
+    GRAPHICS::RAY_TRACING::RayTracingAlgorithm ray_tracer;
+    GRAPHICS::RenderTarget expected_render_target(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    ray_tracer.Render(scene, expected_render_target);
+
+    // RENDER THE SCENE PROGRESSIVELY.
+    // The coarse pass traces 1 ray per 8x8 block (3x2 blocks here).
+    GRAPHICS::RenderTarget progressive_render_target(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    ray_tracer.StartProgressiveRender();
+    constexpr unsigned int COARSE_PASS_RAY_COUNT = 6;
+    bool render_complete = ray_tracer.RenderStep(scene, progressive_render_target, COARSE_PASS_RAY_COUNT);
+    REQUIRE_FALSE(render_complete);
+
+    // The coarse pass should have filled the entire render target.
+    const GRAPHICS::ColorFormat COLOR_FORMAT = GRAPHICS::ColorFormat::RGBA;
+    REQUIRE(expected_render_target.GetPixel(16, 8).Pack(COLOR_FORMAT) == progressive_render_target.GetPixel(20, 12).Pack(COLOR_FORMAT));
+
+    // Finishing the image should require exactly 1 ray per remaining pixel.
+    constexpr unsigned int REMAINING_RAY_COUNT = (WIDTH_IN_PIXELS * HEIGHT_IN_PIXELS) - COARSE_PASS_RAY_COUNT;
+    render_complete = ray_tracer.RenderStep(scene, progressive_render_target, REMAINING_RAY_COUNT - 1);
+    REQUIRE_FALSE(render_complete);
+    constexpr unsigned int FINAL_RAY_COUNT = 1;
+    render_complete = ray_tracer.RenderStep(scene, progressive_render_target, FINAL_RAY_COUNT);
+    REQUIRE(render_complete);
+    REQUIRE(ray_tracer.ProgressiveRenderComplete());
+
+    // VERIFY THE PROGRESSIVE RENDER MATCHES THE FULL RENDER.
+    unsigned int mismatched_pixel_count = 0;
+    for (unsigned int y = 0; y < HEIGHT_IN_PIXELS; ++y)
+    {
+        for (unsigned int x = 0; x < WIDTH_IN_PIXELS; ++x)
+        {
+            uint32_t expected_color = expected_render_target.GetPixel(x, y).Pack(COLOR_FORMAT);
+            uint32_t actual_color = progressive_render_target.GetPixel(x, y).Pack(COLOR_FORMAT);
+            if (expected_color != actual_color)
+            {
+                ++mismatched_pixel_count;
+            }
+        }
+    }
+    REQUIRE(0 == mismatched_pixel_count);
+}
+
+TEST_CASE("Timed rendering carries unfinished tiles over to later calls.", "[RayTracingAlgorithm][RenderUntil]")
+{
+    // CREATE AN EMPTY SCENE.
+    GRAPHICS::RAY_TRACING::Scene scene;
+    scene.BackgroundColor = GRAPHICS::Color(0.2f, 0.2f, 1.0f, 1.0f);
+
+    // START A TIMED RENDER OF 4 TILES.
+    constexpr unsigned int WIDTH_IN_PIXELS = 2 * GRAPHICS::RAY_TRACING::ScreenTile::DEFAULT_DIMENSION_IN_PIXELS;
+    constexpr unsigned int HEIGHT_IN_PIXELS = 2 * GRAPHICS::RAY_TRACING::ScreenTile::DEFAULT_DIMENSION_IN_PIXELS;
+    GRAPHICS::RenderTarget render_target(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    GRAPHICS::RAY_TRACING::RayTracingAlgorithm ray_tracer;
+    ray_tracer.StartTimedRender(render_target);
+    REQUIRE(0.0f == ray_tracer.TimedRenderCompletionPercentage());
+
+    // RENDER WITH A DEADLINE THAT HAS ALREADY PASSED.
+    // A single tile should still be rendered to guarantee progress.
+    std::chrono::steady_clock::time_point passed_deadline = std::chrono::steady_clock::now();
+    float completion_percentage = ray_tracer.RenderUntil(scene, render_target, passed_deadline);
+    REQUIRE(25.0f == completion_percentage);
+
+    // FINISH RENDERING WITH A DISTANT DEADLINE.
+    std::chrono::steady_clock::time_point distant_deadline = std::chrono::steady_clock::now() + std::chrono::hours(1);
+    completion_percentage = ray_tracer.RenderUntil(scene, render_target, distant_deadline);
+    REQUIRE(100.0f == completion_percentage);
+
+    // VERIFY ALL PIXELS WERE RENDERED.
+    const GRAPHICS::ColorFormat COLOR_FORMAT = GRAPHICS::ColorFormat::RGBA;
+    REQUIRE(scene.BackgroundColor.Pack(COLOR_FORMAT) == render_target.GetPixel(0, 0).Pack(COLOR_FORMAT));
+    REQUIRE(scene.BackgroundColor.Pack(COLOR_FORMAT) == render_target.GetPixel(WIDTH_IN_PIXELS - 1, HEIGHT_IN_PIXELS - 1).Pack(COLOR_FORMAT));
+}
+
+TEST_CASE("Adaptive antialiasing only smooths pixels along edges.", "[RayTracingAlgorithm][Render][Antialiasing]")
+{
+    // CREATE A SCENE WITH A FLAT WHITE SPHERE ON A BLACK BACKGROUND.
+    GRAPHICS::RAY_TRACING::Scene scene;
+    scene.BackgroundColor = GRAPHICS::Color::BLACK;
+    auto sphere = std::make_unique<GRAPHICS::RAY_TRACING::Sphere>();
+    sphere->CenterPosition = MATH::Vector3f(0.0f, 0.0f, -3.0f);
+    sphere->Radius = 1.0f;
+    sphere->Material = std::make_shared<GRAPHICS::Material>();
+    sphere->Material->AmbientColor = GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f);
+    scene.Objects.push_back(std::move(sphere));
+
+    // CONFIGURE THE RAY TRACER TO ONLY USE AMBIENT LIGHTING.
+    // This makes every pixel either pure white or pure black without antialiasing.
+    GRAPHICS::RAY_TRACING::RayTracingAlgorithm ray_tracer;
+    ray_tracer.Shadows = false;
+    ray_tracer.Diffuse = false;
+    ray_tracer.Specular = false;
+    ray_tracer.Reflections = false;
+
+    // RENDER THE SCENE WITH AND WITHOUT ANTIALIASING.
+    constexpr unsigned int WIDTH_IN_PIXELS = 32;
+    constexpr unsigned int HEIGHT_IN_PIXELS = 32;
+    GRAPHICS::RenderTarget aliased_render_target(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    ray_tracer.Render(scene, aliased_render_target);
+
+    ray_tracer.AdaptiveAntialiasing = true;
+    GRAPHICS::RenderTarget antialiased_render_target(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    ray_tracer.Render(scene, antialiased_render_target);
+
+    // VERIFY ONLY EDGE PIXELS WERE SMOOTHED.
+    const GRAPHICS::ColorFormat COLOR_FORMAT = GRAPHICS::ColorFormat::RGBA;
+    const uint32_t BLACK = GRAPHICS::Color::BLACK.Pack(COLOR_FORMAT);
+    const uint32_t WHITE = GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f).Pack(COLOR_FORMAT);
+    unsigned int aliased_intermediate_pixel_count = 0;
+    unsigned int antialiased_intermediate_pixel_count = 0;
+    for (unsigned int y = 0; y < HEIGHT_IN_PIXELS; ++y)
+    {
+        for (unsigned int x = 0; x < WIDTH_IN_PIXELS; ++x)
+        {
+            uint32_t aliased_color = aliased_render_target.GetPixel(x, y).Pack(COLOR_FORMAT);
+            if (aliased_color != BLACK && aliased_color != WHITE)
+            {
+                ++aliased_intermediate_pixel_count;
+            }
+
+            uint32_t antialiased_color = antialiased_render_target.GetPixel(x, y).Pack(COLOR_FORMAT);
+            if (antialiased_color != BLACK && antialiased_color != WHITE)
+            {
+                ++antialiased_intermediate_pixel_count;
+            }
+        }
+    }
+    REQUIRE(0 == aliased_intermediate_pixel_count);
+    REQUIRE(antialiased_intermediate_pixel_count > 0);
+
+    // Pixels far from the sphere's edge should be unchanged.
+    REQUIRE(WHITE == antialiased_render_target.GetPixel(WIDTH_IN_PIXELS / 2, HEIGHT_IN_PIXELS / 2).Pack(COLOR_FORMAT));
+    REQUIRE(BLACK == antialiased_render_target.GetPixel(0, 0).Pack(COLOR_FORMAT));
+}
+
+TEST_CASE("Cached primary hits are reused only until the camera or geometry changes.", "[RayTracingAlgorithm][Render][CachePrimaryHits]")
+{
+    // CREATE A SCENE WITH A LIT SPHERE.
+    GRAPHICS::RAY_TRACING::Scene scene;
+    scene.BackgroundColor = GRAPHICS::Color(0.2f, 0.2f, 1.0f, 1.0f);
+    scene.PointLights.push_back(GRAPHICS::Light
+    {
+        .Color = GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f),
+        .PointLightWorldPosition = MATH::Vector3f(2.0f, 2.0f, 2.0f),
+    });
+    auto sphere = std::make_unique<GRAPHICS::RAY_TRACING::Sphere>();
+    GRAPHICS::RAY_TRACING::Sphere* sphere_in_scene = sphere.get();
+    sphere->CenterPosition = MATH::Vector3f(0.2f, -0.1f, -3.0f);
+    sphere->Radius = 1.0f;
+    sphere->Material = std::make_shared<GRAPHICS::Material>();
+    sphere->Material->DiffuseColor = GRAPHICS::Color(0.8f, 0.3f, 0.3f, 1.0f);
+    scene.Objects.push_back(std::move(sphere));
+
+    constexpr unsigned int WIDTH_IN_PIXELS = 24;
+    constexpr unsigned int HEIGHT_IN_PIXELS = 24;
+    const GRAPHICS::ColorFormat COLOR_FORMAT = GRAPHICS::ColorFormat::RGBA;
+    GRAPHICS::RAY_TRACING::RayTracingAlgorithm uncached_ray_tracer;
+    GRAPHICS::RAY_TRACING::RayTracingAlgorithm cached_ray_tracer;
+    cached_ray_tracer.CachePrimaryHits = true;
+    auto count_mismatched_pixels = [&]()
+    {
+        GRAPHICS::RenderTarget expected_render_target(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, COLOR_FORMAT);
+        uncached_ray_tracer.Render(scene, expected_render_target);
+        GRAPHICS::RenderTarget actual_render_target(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, COLOR_FORMAT);
+        cached_ray_tracer.Render(scene, actual_render_target);
+
+        unsigned int mismatched_pixel_count = 0;
+        for (unsigned int y = 0; y < HEIGHT_IN_PIXELS; ++y)
+        {
+            for (unsigned int x = 0; x < WIDTH_IN_PIXELS; ++x)
+            {
+                uint32_t expected_color = expected_render_target.GetPixel(x, y).Pack(COLOR_FORMAT);
+                uint32_t actual_color = actual_render_target.GetPixel(x, y).Pack(COLOR_FORMAT);
+                if (expected_color != actual_color)
+                {
+                    ++mismatched_pixel_count;
+                }
+            }
+        }
+        return mismatched_pixel_count;
+    };
+
+    // RENDER THE INITIAL IMAGE TO FILL THE CACHE.
+    REQUIRE(0 == count_mismatched_pixels());
+
+    // CHANGE LIGHTING AND MATERIALS.
+    // Shading should be redone using the cached primary hits.
+    scene.PointLights[0].PointLightWorldPosition = MATH::Vector3f(-2.0f, 1.0f, 0.0f);
+    sphere_in_scene->Material->DiffuseColor = GRAPHICS::Color(0.3f, 0.8f, 0.3f, 1.0f);
+    REQUIRE(0 == count_mismatched_pixels());
+
+    // MOVE THE SPHERE WITHOUT INDICATING THAT GEOMETRY CHANGED.
+    // The stale cached hits should be reused, demonstrating that primary rays weren't re-traced.
+    sphere_in_scene->CenterPosition.X += 0.5f;
+    REQUIRE(0 < count_mismatched_pixels());
+
+    // INDICATE THAT GEOMETRY CHANGED.
+    ++scene.GeometryVersion;
+    REQUIRE(0 == count_mismatched_pixels());
+
+    // MOVE THE CAMERA.
+    uncached_ray_tracer.Camera.WorldPosition.Y += 0.25f;
+    cached_ray_tracer.Camera.WorldPosition.Y += 0.25f;
+    REQUIRE(0 == count_mismatched_pixels());
+}
+
+TEST_CASE("Wavefront reflections render the same image as following each pixel's reflections in turn.", "[RayTracingAlgorithm][RenderTile][WavefrontReflections]")
+{
+    // CREATE A SCENE WITH SPHERES REFLECTING EACH OTHER.
+    GRAPHICS::RAY_TRACING::Scene scene;
+    scene.BackgroundColor = GRAPHICS::Color(0.2f, 0.2f, 1.0f, 1.0f);
+    scene.PointLights.push_back(GRAPHICS::Light
+    {
+        .Color = GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f),
+        .PointLightWorldPosition = MATH::Vector3f(2.0f, 4.0f, 2.0f),
+    });
+    for (float x = -1.5f; x <= 1.5f; x += 1.0f)
+    {
+        auto sphere = std::make_unique<GRAPHICS::RAY_TRACING::Sphere>();
+        sphere->CenterPosition = MATH::Vector3f(x, 0.0f, -4.0f + std::abs(x));
+        sphere->Radius = 0.5f;
+        sphere->Material = std::make_shared<GRAPHICS::Material>();
+        sphere->Material->DiffuseColor = GRAPHICS::Color(0.2f, 0.3f + 0.1f * x, 0.3f, 1.0f);
+        sphere->Material->ReflectivityProportion = 0.7f;
+        scene.Objects.push_back(std::move(sphere));
+    }
+
+    // RENDER THE SCENE IN TILES, FOLLOWING REFLECTIONS FOR EACH PIXEL IN TURN.
+    constexpr unsigned int WIDTH_IN_PIXELS = 40;
+    constexpr unsigned int HEIGHT_IN_PIXELS = 24;
+    std::vector<GRAPHICS::RAY_TRACING::ScreenTile> tiles = GRAPHICS::RAY_TRACING::ScreenTile::Partition(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS);
+    GRAPHICS::RAY_TRACING::RayTracingAlgorithm ray_tracer;
+    ray_tracer.Camera = GRAPHICS::Camera::LookAtFrom(MATH::Vector3f(0.0f, 0.0f, -3.0f), MATH::Vector3f(0.0f, 0.5f, 1.0f));
+    ray_tracer.Camera.Projection = GRAPHICS::ProjectionType::PERSPECTIVE;
+    GRAPHICS::RenderTarget expected_render_target(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    for (const GRAPHICS::RAY_TRACING::ScreenTile& tile : tiles)
+    {
+        ray_tracer.RenderTile(scene, expected_render_target, tile);
+    }
+
+    // RENDER THE SCENE IN TILES WITH WAVEFRONT REFLECTIONS.
+    ray_tracer.WavefrontReflections = true;
+    GRAPHICS::RenderTarget wavefront_render_target(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    for (const GRAPHICS::RAY_TRACING::ScreenTile& tile : tiles)
+    {
+        ray_tracer.RenderTile(scene, wavefront_render_target, tile);
+    }
+
+    // VERIFY THE IMAGES MATCH.
+    const GRAPHICS::ColorFormat COLOR_FORMAT = GRAPHICS::ColorFormat::RGBA;
+    unsigned int mismatched_pixel_count = 0;
+    for (unsigned int y = 0; y < HEIGHT_IN_PIXELS; ++y)
+    {
+        for (unsigned int x = 0; x < WIDTH_IN_PIXELS; ++x)
+        {
+            uint32_t expected_color = expected_render_target.GetPixel(x, y).Pack(COLOR_FORMAT);
+            uint32_t actual_color = wavefront_render_target.GetPixel(x, y).Pack(COLOR_FORMAT);
+            if (expected_color != actual_color)
+            {
+                ++mismatched_pixel_count;
+            }
+        }
+    }
+    REQUIRE(0 == mismatched_pixel_count);
+}
+
+TEST_CASE("Culling objects against each tile's frustum renders the same image.", "[RayTracingAlgorithm][RenderTile][TileFrustumCulling]")
+{
+    // CREATE A SCENE WITH SPHERES SPREAD ACROSS THE SCREEN.
+    GRAPHICS::RAY_TRACING::Scene scene;
+    scene.BackgroundColor = GRAPHICS::Color(0.2f, 0.2f, 1.0f, 1.0f);
+    scene.PointLights.push_back(GRAPHICS::Light
+    {
+        .Color = GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f),
+        .PointLightWorldPosition = MATH::Vector3f(0.0f, 4.0f, 0.0f),
+    });
+    for (float x = -3.0f; x <= 3.0f; x += 1.0f)
+    {
+        for (float y = -2.0f; y <= 2.0f; y += 1.0f)
+        {
+            auto sphere = std::make_unique<GRAPHICS::RAY_TRACING::Sphere>();
+            sphere->CenterPosition = MATH::Vector3f(x, y, -8.0f);
+            sphere->Radius = 0.3f;
+            sphere->Material = std::make_shared<GRAPHICS::Material>();
+            sphere->Material->DiffuseColor = GRAPHICS::Color(0.8f, 0.3f, 0.3f, 1.0f);
+            sphere->Material->ReflectivityProportion = 0.3f;
+            scene.Objects.push_back(std::move(sphere));
+        }
+    }
+    bool use_hierarchy = GENERATE(false, true);
+    if (use_hierarchy)
+    {
+        scene.AccelerationStructure = GRAPHICS::RAY_TRACING::AccelerationStructureType::BOUNDING_VOLUME_HIERARCHY;
+        scene.BuildAccelerationStructure();
+    }
+
+    // RENDER THE SCENE IN TILES WITH AND WITHOUT CULLING.
+    constexpr unsigned int WIDTH_IN_PIXELS = 48;
+    constexpr unsigned int HEIGHT_IN_PIXELS = 32;
+    std::vector<GRAPHICS::RAY_TRACING::ScreenTile> tiles = GRAPHICS::RAY_TRACING::ScreenTile::Partition(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, 8);
+    GRAPHICS::RAY_TRACING::RayTracingAlgorithm ray_tracer;
+    ray_tracer.Camera = GRAPHICS::Camera::LookAtFrom(MATH::Vector3f(0.0f, 0.0f, -8.0f), MATH::Vector3f(0.0f, 0.0f, 0.0f));
+    ray_tracer.Camera.Projection = GRAPHICS::ProjectionType::PERSPECTIVE;
+    ray_tracer.Camera.FieldOfView = MATH::Angle<float>::Degrees(60.0f);
+    GRAPHICS::RenderTarget expected_render_target(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    for (const GRAPHICS::RAY_TRACING::ScreenTile& tile : tiles)
+    {
+        ray_tracer.RenderTile(scene, expected_render_target, tile);
+    }
+
+    ray_tracer.TileFrustumCulling = true;
+    ray_tracer.WavefrontReflections = GENERATE(false, true);
+    GRAPHICS::RenderTarget culled_render_target(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    for (const GRAPHICS::RAY_TRACING::ScreenTile& tile : tiles)
+    {
+        ray_tracer.RenderTile(scene, culled_render_target, tile);
+    }
+
+    // VERIFY THE IMAGES MATCH.
+    const GRAPHICS::ColorFormat COLOR_FORMAT = GRAPHICS::ColorFormat::RGBA;
+    unsigned int mismatched_pixel_count = 0;
+    unsigned int background_pixel_count = 0;
+    for (unsigned int y = 0; y < HEIGHT_IN_PIXELS; ++y)
+    {
+        for (unsigned int x = 0; x < WIDTH_IN_PIXELS; ++x)
+        {
+            uint32_t expected_color = expected_render_target.GetPixel(x, y).Pack(COLOR_FORMAT);
+            uint32_t actual_color = culled_render_target.GetPixel(x, y).Pack(COLOR_FORMAT);
+            if (expected_color != actual_color)
+            {
+                ++mismatched_pixel_count;
+            }
+            if (scene.BackgroundColor.Pack(COLOR_FORMAT) == expected_color)
+            {
+                ++background_pixel_count;
+            }
+        }
+    }
+    REQUIRE(0 == mismatched_pixel_count);
+    REQUIRE(background_pixel_count > 0);
+    REQUIRE(background_pixel_count < WIDTH_IN_PIXELS * HEIGHT_IN_PIXELS);
+}
+
+TEST_CASE("Tracing primary rays in packets renders the same image.", "[RayTracingAlgorithm][RenderTile][PacketPrimaryRays]")
+{
+    // CREATE A SCENE WITH OBJECTS BOTH SUPPORTING AND NOT SUPPORTING PACKET INTERSECTIONS.
+    GRAPHICS::RAY_TRACING::Scene scene;
+    scene.BackgroundColor = GRAPHICS::Color(0.2f, 0.2f, 1.0f, 1.0f);
+    scene.PointLights.push_back(GRAPHICS::Light
+    {
+        .Color = GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f),
+        .PointLightWorldPosition = MATH::Vector3f(0.0f, 4.0f, 0.0f),
+    });
+    auto floor = std::make_unique<GRAPHICS::RAY_TRACING::Plane>();
+    floor->PointOnPlane = MATH::Vector3f(0.0f, -2.0f, 0.0f);
+    floor->UnitNormal = MATH::Vector3f(0.0f, 1.0f, 0.0f);
+    floor->Material = std::make_shared<GRAPHICS::Material>();
+    floor->Material->DiffuseColor = GRAPHICS::Color(0.5f, 0.5f, 0.5f, 1.0f);
+    floor->Material->ReflectivityProportion = 0.3f;
+    scene.Objects.push_back(std::move(floor));
+    auto disc = std::make_unique<GRAPHICS::RAY_TRACING::Disc>();
+    disc->CenterPosition = MATH::Vector3f(-1.5f, 0.5f, -9.0f);
+    disc->UnitNormal = MATH::Vector3f(0.0f, 0.0f, 1.0f);
+    disc->Radius = 1.0f;
+    disc->Material = std::make_shared<GRAPHICS::Material>();
+    disc->Material->DiffuseColor = GRAPHICS::Color(0.3f, 0.8f, 0.3f, 1.0f);
+    scene.Objects.push_back(std::move(disc));
+    auto box = std::make_unique<GRAPHICS::RAY_TRACING::AxisAlignedBox>();
+    box->MinimumCorner = MATH::Vector3f(0.5f, -2.0f, -9.0f);
+    box->MaximumCorner = MATH::Vector3f(2.0f, -0.5f, -7.5f);
+    box->Material = std::make_shared<GRAPHICS::Material>();
+    box->Material->DiffuseColor = GRAPHICS::Color(0.3f, 0.3f, 0.8f, 1.0f);
+    scene.Objects.push_back(std::move(box));
+    auto sphere = std::make_unique<GRAPHICS::RAY_TRACING::Sphere>();
+    sphere->CenterPosition = MATH::Vector3f(0.0f, 0.0f, -6.0f);
+    sphere->Radius = 0.75f;
+    sphere->Material = std::make_shared<GRAPHICS::Material>();
+    sphere->Material->DiffuseColor = GRAPHICS::Color(0.8f, 0.3f, 0.3f, 1.0f);
+    sphere->Material->ReflectivityProportion = 0.3f;
+    scene.Objects.push_back(std::move(sphere));
+
+    // RENDER THE SCENE IN TILES WITH AND WITHOUT PACKETS.
+    // Tiles aren't a multiple of the packet size wide so that partially filled packets are also traced.
+    constexpr unsigned int WIDTH_IN_PIXELS = 44;
+    constexpr unsigned int HEIGHT_IN_PIXELS = 32;
+    std::vector<GRAPHICS::RAY_TRACING::ScreenTile> tiles = GRAPHICS::RAY_TRACING::ScreenTile::Partition(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, 12);
+    GRAPHICS::RAY_TRACING::RayTracingAlgorithm ray_tracer;
+    ray_tracer.Camera = GRAPHICS::Camera::LookAtFrom(MATH::Vector3f(0.0f, 0.0f, -8.0f), MATH::Vector3f(0.0f, 0.0f, 0.0f));
+    ray_tracer.Camera.Projection = GRAPHICS::ProjectionType::PERSPECTIVE;
+    ray_tracer.Camera.FieldOfView = MATH::Angle<float>::Degrees(60.0f);
+    GRAPHICS::RenderTarget expected_render_target(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    for (const GRAPHICS::RAY_TRACING::ScreenTile& tile : tiles)
+    {
+        ray_tracer.RenderTile(scene, expected_render_target, tile);
+    }
+
+    ray_tracer.PacketPrimaryRays = true;
+    GRAPHICS::RenderTarget packet_render_target(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    for (const GRAPHICS::RAY_TRACING::ScreenTile& tile : tiles)
+    {
+        ray_tracer.RenderTile(scene, packet_render_target, tile);
+    }
+
+    // VERIFY THE IMAGES MATCH.
+    // Tiny differences are allowed since packet intersections may round slightly differently.
+    constexpr float COLOR_COMPONENT_TOLERANCE = 1.0f / 255.0f;
+    unsigned int background_pixel_count = 0;
+    for (unsigned int y = 0; y < HEIGHT_IN_PIXELS; ++y)
+    {
+        for (unsigned int x = 0; x < WIDTH_IN_PIXELS; ++x)
+        {
+            GRAPHICS::Color expected_color = expected_render_target.GetPixel(x, y);
+            GRAPHICS::Color actual_color = packet_render_target.GetPixel(x, y);
+            REQUIRE(expected_color.Red == Approx(actual_color.Red).margin(COLOR_COMPONENT_TOLERANCE));
+            REQUIRE(expected_color.Green == Approx(actual_color.Green).margin(COLOR_COMPONENT_TOLERANCE));
+            REQUIRE(expected_color.Blue == Approx(actual_color.Blue).margin(COLOR_COMPONENT_TOLERANCE));
+            if (scene.BackgroundColor.Pack(GRAPHICS::ColorFormat::RGBA) == expected_color.Pack(GRAPHICS::ColorFormat::RGBA))
+            {
+                ++background_pixel_count;
+            }
+        }
+    }
+    REQUIRE(background_pixel_count > 0);
+    REQUIRE(background_pixel_count < WIDTH_IN_PIXELS * HEIGHT_IN_PIXELS);
+}
+
+TEST_CASE("Reflections between facing mirrors stop at the reflection count.", "[RayTracingAlgorithm][Render][Reflections]")
+{
+    // CREATE A SCENE WITH 2 HALF-REFLECTIVE MIRRORS FACING EACH OTHER.
+    // Only ambient light is used so that each surface along a path adds a known color.
+    GRAPHICS::RAY_TRACING::Scene scene;
+    scene.BackgroundColor = GRAPHICS::Color(0.0f, 1.0f, 0.0f, 1.0f);
+    constexpr float MIRROR_REFLECTIVITY = 0.5f;
+    auto front_mirror = std::make_unique<GRAPHICS::RAY_TRACING::Plane>();
+    front_mirror->PointOnPlane = MATH::Vector3f(0.0f, 0.0f, -5.0f);
+    front_mirror->UnitNormal = MATH::Vector3f(0.0f, 0.0f, 1.0f);
+    front_mirror->Material = std::make_shared<GRAPHICS::Material>();
+    front_mirror->Material->AmbientColor = GRAPHICS::Color(0.6f, 0.0f, 0.0f, 1.0f);
+    front_mirror->Material->ReflectivityProportion = MIRROR_REFLECTIVITY;
+    scene.Objects.push_back(std::move(front_mirror));
+    auto back_mirror = std::make_unique<GRAPHICS::RAY_TRACING::Plane>();
+    back_mirror->PointOnPlane = MATH::Vector3f(0.0f, 0.0f, 5.0f);
+    back_mirror->UnitNormal = MATH::Vector3f(0.0f, 0.0f, -1.0f);
+    back_mirror->Material = std::make_shared<GRAPHICS::Material>();
+    back_mirror->Material->AmbientColor = GRAPHICS::Color(0.0f, 0.0f, 0.6f, 1.0f);
+    back_mirror->Material->ReflectivityProportion = MIRROR_REFLECTIVITY;
+    scene.Objects.push_back(std::move(back_mirror));
+
+    // CONFIGURE THE RAY TRACER TO FOLLOW EVERY REFLECTION UP TO THE LIMIT.
+    GRAPHICS::RAY_TRACING::RayTracingAlgorithm ray_tracer;
+    ray_tracer.Camera = GRAPHICS::Camera::LookAtFrom(MATH::Vector3f(0.0f, 0.0f, -1.0f), MATH::Vector3f(0.0f, 0.0f, 0.0f));
+    ray_tracer.Camera.Projection = GRAPHICS::ProjectionType::PERSPECTIVE;
+    ray_tracer.Ambient = true;
+    ray_tracer.Diffuse = false;
+    ray_tracer.Specular = false;
+    ray_tracer.MinReflectionContribution = 0.0f;
+
+    // VERIFY THE COLOR FOR EACH REFLECTION COUNT.
+    // Paths alternate between the front and back mirrors, with each bounce contributing half as much,
+    // and the background is never reached since the mirrors are infinite.
+    struct ExpectedColor
+    {
+        unsigned int ReflectionCount;
+        float Red;
+        float Blue;
+    };
+    const ExpectedColor EXPECTED_COLORS[] =
+    {
+        { .ReflectionCount = 0, .Red = 0.6f, .Blue = 0.0f },
+        { .ReflectionCount = 1, .Red = 0.6f, .Blue = 0.3f },
+        { .ReflectionCount = 2, .Red = 0.75f, .Blue = 0.3f },
+        { .ReflectionCount = 3, .Red = 0.75f, .Blue = 0.375f },
+    };
+    // Tiles are rendered both with and without wavefront reflections since they follow paths separately.
+    constexpr unsigned int DIMENSION_IN_PIXELS = 8;
+    constexpr float COLOR_COMPONENT_TOLERANCE = 1.0f / 255.0f;
+    std::vector<GRAPHICS::RAY_TRACING::ScreenTile> tiles = GRAPHICS::RAY_TRACING::ScreenTile::Partition(DIMENSION_IN_PIXELS, DIMENSION_IN_PIXELS);
+    for (bool wavefront_reflections : { false, true })
+    {
+        ray_tracer.WavefrontReflections = wavefront_reflections;
+        for (const ExpectedColor& expected_color : EXPECTED_COLORS)
+        {
+            ray_tracer.ReflectionCount = expected_color.ReflectionCount;
+            GRAPHICS::RenderTarget render_target(DIMENSION_IN_PIXELS, DIMENSION_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+            for (const GRAPHICS::RAY_TRACING::ScreenTile& tile : tiles)
+            {
+                ray_tracer.RenderTile(scene, render_target, tile);
+            }
+            for (unsigned int y = 0; y < DIMENSION_IN_PIXELS; ++y)
+            {
+                for (unsigned int x = 0; x < DIMENSION_IN_PIXELS; ++x)
+                {
+                    GRAPHICS::Color actual_color = render_target.GetPixel(x, y);
+                    REQUIRE(expected_color.Red == Approx(actual_color.Red).margin(COLOR_COMPONENT_TOLERANCE));
+                    REQUIRE(0.0f == Approx(actual_color.Green).margin(COLOR_COMPONENT_TOLERANCE));
+                    REQUIRE(expected_color.Blue == Approx(actual_color.Blue).margin(COLOR_COMPONENT_TOLERANCE));
+                }
+            }
+        }
+    }
+}
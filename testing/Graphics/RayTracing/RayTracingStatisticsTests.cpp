@@ -0,0 +1,142 @@
+#include <memory>
+#include <string>
+#include "Graphics/RayTracing/Plane.h"
+#include "Graphics/RayTracing/RayTracingAlgorithm.h"
+#include "Graphics/RayTracing/Sphere.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+/// Creates a scene with a sphere above a reflective floor lit by a single light.
+/// @param[out]  scene - The scene to populate.
+static void CreateSphereAboveReflectiveFloor(GRAPHICS::RAY_TRACING::Scene& scene)
+{
+    scene.PointLights.push_back(GRAPHICS::Light
+    {
+        .Type = GRAPHICS::LightType::POINT,
+        .Color = GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f),
+        .PointLightWorldPosition = MATH::Vector3f(0.0f, 5.0f, 0.0f),
+    });
+
+    auto sphere = std::make_unique<GRAPHICS::RAY_TRACING::Sphere>();
+    sphere->CenterPosition = MATH::Vector3f(0.0f, 0.0f, -4.0f);
+    sphere->Radius = 1.0f;
+    sphere->Material = std::make_shared<GRAPHICS::Material>();
+    sphere->Material->DiffuseColor = GRAPHICS::Color(1.0f, 0.0f, 0.0f, 1.0f);
+    scene.Objects.push_back(std::move(sphere));
+
+    auto floor = std::make_unique<GRAPHICS::RAY_TRACING::Plane>();
+    floor->PointOnPlane = MATH::Vector3f(0.0f, -1.0f, 0.0f);
+    floor->UnitNormal = MATH::Vector3f(0.0f, 1.0f, 0.0f);
+    floor->Material = std::make_shared<GRAPHICS::Material>();
+    floor->Material->DiffuseColor = GRAPHICS::Color(0.5f, 0.5f, 0.5f, 1.0f);
+    floor->Material->ReflectivityProportion = 0.5f;
+    scene.Objects.push_back(std::move(floor));
+}
+
+TEST_CASE("Statistics count the rays and intersection tests for each pixel and the frame.", "[RayTracingStatistics][RayTracingAlgorithm]")
+{
+    // RENDER A SCENE WITH STATISTICS.
+    GRAPHICS::RAY_TRACING::Scene scene;
+    CreateSphereAboveReflectiveFloor(scene);
+
+    GRAPHICS::RAY_TRACING::RayTracingAlgorithm ray_tracer;
+    ray_tracer.Camera = GRAPHICS::Camera::LookAtFrom(MATH::Vector3f(0.0f, 0.0f, -4.0f), MATH::Vector3f(0.0f, 1.0f, 0.0f));
+    ray_tracer.Camera.Projection = GRAPHICS::ProjectionType::PERSPECTIVE;
+    ray_tracer.CollectStatistics = true;
+    ray_tracer.CollectPixelStatistics = true;
+    constexpr unsigned int DIMENSION_IN_PIXELS = 16;
+    GRAPHICS::RenderTarget render_target(DIMENSION_IN_PIXELS, DIMENSION_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    ray_tracer.Render(scene, render_target);
+
+    // VERIFY THE FRAME'S COUNTS.
+    const GRAPHICS::RAY_TRACING::RayTracingStatistics::Counts& frame_counts = ray_tracer.Statistics.Frame;
+    REQUIRE(DIMENSION_IN_PIXELS * DIMENSION_IN_PIXELS == frame_counts.PrimaryRayCount);
+    REQUIRE(frame_counts.ShadowRayCount > 0);
+    REQUIRE(frame_counts.ReflectionRayCount > 0);
+    std::size_t sphere_test_count = frame_counts.IntersectionTestCountsByObjectType[static_cast<std::size_t>(GRAPHICS::RAY_TRACING::ObjectType::SPHERE)];
+    std::size_t plane_test_count = frame_counts.IntersectionTestCountsByObjectType[static_cast<std::size_t>(GRAPHICS::RAY_TRACING::ObjectType::PLANE)];
+    REQUIRE(sphere_test_count > 0);
+    REQUIRE(plane_test_count > 0);
+    REQUIRE(sphere_test_count + plane_test_count == frame_counts.IntersectionTestCount());
+    REQUIRE(0 == frame_counts.TraversalStepCount);
+    REQUIRE(frame_counts.Time.count() > 0);
+
+    // VERIFY THE PIXELS' COUNTS ADD UP TO THE FRAME'S COUNTS.
+    GRAPHICS::RAY_TRACING::RayTracingStatistics::Counts total_pixel_counts;
+    for (unsigned int y = 0; y < DIMENSION_IN_PIXELS; ++y)
+    {
+        for (unsigned int x = 0; x < DIMENSION_IN_PIXELS; ++x)
+        {
+            REQUIRE(1 == ray_tracer.Statistics.Pixels(x, y).PrimaryRayCount);
+            total_pixel_counts += ray_tracer.Statistics.Pixels(x, y);
+        }
+    }
+    REQUIRE(total_pixel_counts.RayCount() == frame_counts.RayCount());
+    REQUIRE(total_pixel_counts.IntersectionTestCountsByObjectType == frame_counts.IntersectionTestCountsByObjectType);
+
+    // VERIFY THE JSON INCLUDES THE COUNTS.
+    std::string json = ray_tracer.Statistics.ToJson();
+    REQUIRE(std::string::npos != json.find("\"primary_ray_count\":" + std::to_string(frame_counts.PrimaryRayCount)));
+    REQUIRE(std::string::npos != json.find("\"sphere\":" + std::to_string(sphere_test_count)));
+    REQUIRE(std::string::npos != json.find("\"plane\":" + std::to_string(plane_test_count)));
+    REQUIRE(std::string::npos != json.find("\"traversal_step_count\":0"));
+    REQUIRE(std::string::npos != json.find("\"per_pixel\":true"));
+}
+
+TEST_CASE("Statistics count traversal steps through acceleration structures.", "[RayTracingStatistics][RayTracingAlgorithm]")
+{
+    // CREATE A SCENE WITH A ROW OF SPHERES.
+    GRAPHICS::RAY_TRACING::Scene scene;
+    constexpr unsigned int SPHERE_COUNT = 32;
+    for (unsigned int sphere_index = 0; sphere_index < SPHERE_COUNT; ++sphere_index)
+    {
+        auto sphere = std::make_unique<GRAPHICS::RAY_TRACING::Sphere>();
+        sphere->CenterPosition = MATH::Vector3f(static_cast<float>(sphere_index) - 16.0f, 0.0f, -10.0f);
+        sphere->Radius = 0.4f;
+        sphere->Material = std::make_shared<GRAPHICS::Material>();
+        sphere->Material->DiffuseColor = GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f);
+        scene.Objects.push_back(std::move(sphere));
+    }
+
+    // RENDER WITHOUT AN ACCELERATION STRUCTURE.
+    GRAPHICS::RAY_TRACING::RayTracingAlgorithm ray_tracer;
+    ray_tracer.Camera = GRAPHICS::Camera::LookAtFrom(MATH::Vector3f(0.0f, 0.0f, -10.0f), MATH::Vector3f(0.0f, 0.0f, 0.0f));
+    ray_tracer.Camera.Projection = GRAPHICS::ProjectionType::PERSPECTIVE;
+    ray_tracer.CollectStatistics = true;
+    GRAPHICS::RenderTarget render_target(16, 16, GRAPHICS::ColorFormat::RGBA);
+    ray_tracer.Render(scene, render_target);
+    std::size_t brute_force_test_count = ray_tracer.Statistics.Frame.IntersectionTestCount();
+    REQUIRE(16 * 16 * SPHERE_COUNT == brute_force_test_count);
+    REQUIRE(0 == ray_tracer.Statistics.Frame.TraversalStepCount);
+    REQUIRE(0 == ray_tracer.Statistics.Pixels.GetWidth());
+
+    // RENDER WITH EACH ACCELERATION STRUCTURE.
+    auto acceleration_structure = GENERATE(
+        GRAPHICS::RAY_TRACING::AccelerationStructureType::BOUNDING_VOLUME_HIERARCHY,
+        GRAPHICS::RAY_TRACING::AccelerationStructureType::UNIFORM_GRID);
+    scene.AccelerationStructure = acceleration_structure;
+    scene.BuildAccelerationStructure();
+    ray_tracer.Render(scene, render_target);
+
+    // VERIFY TRAVERSAL WAS COUNTED AND AVOIDED INTERSECTION TESTS.
+    REQUIRE(ray_tracer.Statistics.Frame.TraversalStepCount > 0);
+    REQUIRE(ray_tracer.Statistics.Frame.IntersectionTestCount() < brute_force_test_count);
+}
+
+TEST_CASE("A heatmap colors the most expensive pixels red and the cheapest blue.", "[RayTracingStatistics]")
+{
+    // CREATE STATISTICS WITH A RANGE OF COSTS.
+    GRAPHICS::RAY_TRACING::RayTracingStatistics statistics;
+    statistics.Reset(true, 3, 1);
+    statistics.Pixels(0, 0).ShadowRayCount = 0;
+    statistics.Pixels(1, 0).ShadowRayCount = 2;
+    statistics.Pixels(2, 0).ShadowRayCount = 4;
+
+    // WRITE THE HEATMAP.
+    GRAPHICS::RenderTarget render_target(3, 1, GRAPHICS::ColorFormat::RGBA);
+    statistics.WriteHeatmap(GRAPHICS::RAY_TRACING::RayTracingStatistics::Metric::RAYS, render_target);
+
+    // VERIFY THE COLORS.
+    REQUIRE(GRAPHICS::Color::BLUE.Pack(GRAPHICS::ColorFormat::RGBA) == render_target.GetPixel(0, 0).Pack(GRAPHICS::ColorFormat::RGBA));
+    REQUIRE(GRAPHICS::Color::GREEN.Pack(GRAPHICS::ColorFormat::RGBA) == render_target.GetPixel(1, 0).Pack(GRAPHICS::ColorFormat::RGBA));
+    REQUIRE(GRAPHICS::Color::RED.Pack(GRAPHICS::ColorFormat::RGBA) == render_target.GetPixel(2, 0).Pack(GRAPHICS::ColorFormat::RGBA));
+}
@@ -0,0 +1,345 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+#include "Graphics/RayTracing/Plane.h"
+#include "Graphics/RayTracing/RayTracingAlgorithm.h"
+#include "Graphics/RayTracing/Scene.h"
+#include "Graphics/RayTracing/Sphere.h"
+#include "Graphics/RayTracing/UniformGrid.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+/// Creates a scene with a row of spheres along the X axis, with the acceleration structure built.
+/// @param[in]  sphere_count - The number of spheres to create.
+/// @return The scene.
+static std::unique_ptr<GRAPHICS::RAY_TRACING::Scene> CreateRowOfSpheres(const unsigned int sphere_count)
+{
+    auto scene = std::make_unique<GRAPHICS::RAY_TRACING::Scene>();
+    for (unsigned int sphere_index = 0; sphere_index < sphere_count; ++sphere_index)
+    {
+        auto sphere = std::make_unique<GRAPHICS::RAY_TRACING::Sphere>();
+        sphere->CenterPosition = MATH::Vector3f(static_cast<float>(sphere_index) * 3.0f, 0.0f, -5.0f);
+        sphere->Radius = 1.0f;
+        sphere->Material = std::make_shared<GRAPHICS::Material>();
+        scene->Objects.push_back(std::move(sphere));
+    }
+    scene->BuildAccelerationStructure();
+    return scene;
+}
+
+/// Creates a scene with randomly scattered spheres in front of the origin, with the acceleration structure built.
+/// @param[in]  sphere_count - The number of spheres to create.
+/// @param[in]  acceleration_structure - The type of acceleration structure to build.
+/// @return The scene.
+static std::unique_ptr<GRAPHICS::RAY_TRACING::Scene> CreateScatteredSpheres(
+    const unsigned int sphere_count,
+    const GRAPHICS::RAY_TRACING::AccelerationStructureType acceleration_structure)
+{
+    auto scene = std::make_unique<GRAPHICS::RAY_TRACING::Scene>();
+    scene->AccelerationStructure = acceleration_structure;
+    scene->PointLights.push_back(GRAPHICS::Light
+    {
+        .Color = GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f),
+        .PointLightWorldPosition = MATH::Vector3f(0.0f, 10.0f, 0.0f),
+    });
+
+    // A fixed seed keeps the scene identical across runs.
+    std::minstd_rand random_number_generator(1);
+    std::uniform_real_distribution<float> x_or_y_distribution(-8.0f, 8.0f);
+    std::uniform_real_distribution<float> z_distribution(-30.0f, -5.0f);
+    std::uniform_real_distribution<float> radius_distribution(0.1f, 1.0f);
+    auto material = std::make_shared<GRAPHICS::Material>();
+    material->DiffuseColor = GRAPHICS::Color(0.8f, 0.4f, 0.2f, 1.0f);
+    for (unsigned int sphere_index = 0; sphere_index < sphere_count; ++sphere_index)
+    {
+        auto sphere = std::make_unique<GRAPHICS::RAY_TRACING::Sphere>();
+        sphere->CenterPosition = MATH::Vector3f(
+            x_or_y_distribution(random_number_generator),
+            x_or_y_distribution(random_number_generator),
+            z_distribution(random_number_generator));
+        sphere->Radius = radius_distribution(random_number_generator);
+        sphere->Material = material;
+        scene->Objects.push_back(std::move(sphere));
+    }
+    scene->BuildAccelerationStructure();
+    return scene;
+}
+
+TEST_CASE("A refit hierarchy keeps moved objects traceable.", "[Scene][UpdateAccelerationStructure]")
+{
+    // CREATE A SCENE.
+    constexpr unsigned int SPHERE_COUNT = 16;
+    std::unique_ptr<GRAPHICS::RAY_TRACING::Scene> scene = CreateRowOfSpheres(SPHERE_COUNT);
+    unsigned int original_geometry_version = scene->GeometryVersion;
+
+    // MOVE A SPHERE SLIGHTLY UP.
+    auto& moved_sphere = static_cast<GRAPHICS::RAY_TRACING::Sphere&>(*scene->Objects[5]);
+    moved_sphere.CenterPosition.Y += 1.5f;
+    scene->MarkObjectMoved(5);
+    scene->UpdateAccelerationStructure();
+    REQUIRE(scene->AccelerationStructureIsCurrent());
+    REQUIRE(original_geometry_version != scene->GeometryVersion);
+    REQUIRE_FALSE(scene->AccelerationStructureRebuildPending());
+
+    // VERIFY THE SPHERE CAN ONLY BE HIT AT ITS NEW POSITION.
+    GRAPHICS::RAY_TRACING::RayTracingAlgorithm ray_tracer;
+    GRAPHICS::RAY_TRACING::Ray ray_toward_new_position(MATH::Vector3f(15.0f, 2.0f, 0.0f), MATH::Vector3f(0.0f, 0.0f, -10.0f));
+    REQUIRE(ray_tracer.Occluded(*scene, ray_toward_new_position, 0.0f, 1.0f));
+    GRAPHICS::RAY_TRACING::Ray ray_toward_old_position(MATH::Vector3f(15.0f, -0.8f, 0.0f), MATH::Vector3f(0.0f, 0.0f, -10.0f));
+    REQUIRE_FALSE(ray_tracer.Occluded(*scene, ray_toward_old_position, 0.0f, 1.0f));
+}
+
+TEST_CASE("A heavily degraded hierarchy is rebuilt in the background.", "[Scene][UpdateAccelerationStructure]")
+{
+    // CREATE A SCENE.
+    constexpr unsigned int SPHERE_COUNT = 64;
+    std::unique_ptr<GRAPHICS::RAY_TRACING::Scene> scene = CreateRowOfSpheres(SPHERE_COUNT);
+    float built_cost = scene->ObjectHierarchy.SurfaceAreaHeuristicCost();
+
+    // SHUFFLE THE POSITIONS OF THE SPHERES.
+    // This leaves spheres near each other in the hierarchy at opposite ends of the row.
+    for (unsigned int sphere_index = 0; sphere_index < SPHERE_COUNT; ++sphere_index)
+    {
+        auto& sphere = static_cast<GRAPHICS::RAY_TRACING::Sphere&>(*scene->Objects[sphere_index]);
+        sphere.CenterPosition = MATH::Vector3f(static_cast<float>((sphere_index * 37) % SPHERE_COUNT) * 3.0f, 0.0f, -5.0f);
+        scene->MarkObjectMoved(sphere_index);
+    }
+    scene->UpdateAccelerationStructure();
+    float refit_cost = scene->ObjectHierarchy.SurfaceAreaHeuristicCost();
+    REQUIRE(refit_cost > built_cost * scene->RebuildCostRatioThreshold);
+    REQUIRE(scene->AccelerationStructureRebuildPending());
+
+    // WAIT FOR THE REBUILT HIERARCHY TO BE SWAPPED IN.
+    while (scene->AccelerationStructureRebuildPending())
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        scene->UpdateAccelerationStructure();
+    }
+    float rebuilt_cost = scene->ObjectHierarchy.SurfaceAreaHeuristicCost();
+    REQUIRE(rebuilt_cost == Approx(built_cost));
+
+    // VERIFY ALL SPHERES ARE STILL TRACEABLE.
+    GRAPHICS::RAY_TRACING::RayTracingAlgorithm ray_tracer;
+    for (unsigned int sphere_index = 0; sphere_index < SPHERE_COUNT; ++sphere_index)
+    {
+        float x = static_cast<float>(sphere_index) * 3.0f;
+        GRAPHICS::RAY_TRACING::Ray ray_toward_sphere(MATH::Vector3f(x, 0.0f, 0.0f), MATH::Vector3f(0.0f, 0.0f, -10.0f));
+        REQUIRE(ray_tracer.Occluded(*scene, ray_toward_sphere, 0.0f, 1.0f));
+    }
+}
+
+TEST_CASE("A uniform grid finds the same objects as a hierarchy.", "[Scene][UniformGrid]")
+{
+    // CREATE THE SAME SCENE WITH EACH ACCELERATION STRUCTURE.
+    constexpr unsigned int SPHERE_COUNT = 500;
+    std::unique_ptr<GRAPHICS::RAY_TRACING::Scene> hierarchy_scene = CreateScatteredSpheres(
+        SPHERE_COUNT,
+        GRAPHICS::RAY_TRACING::AccelerationStructureType::BOUNDING_VOLUME_HIERARCHY);
+    std::unique_ptr<GRAPHICS::RAY_TRACING::Scene> grid_scene = CreateScatteredSpheres(
+        SPHERE_COUNT,
+        GRAPHICS::RAY_TRACING::AccelerationStructureType::UNIFORM_GRID);
+    REQUIRE(GRAPHICS::RAY_TRACING::AccelerationStructureType::UNIFORM_GRID == grid_scene->CurrentAccelerationStructure());
+    REQUIRE(grid_scene->AccelerationStructureIsCurrent());
+
+    // RENDER BOTH SCENES.
+    GRAPHICS::RAY_TRACING::RayTracingAlgorithm ray_tracer;
+    ray_tracer.Camera = GRAPHICS::Camera::LookAtFrom(MATH::Vector3f(0.0f, 0.0f, -10.0f), MATH::Vector3f(0.0f, 0.0f, 0.0f));
+    ray_tracer.Camera.Projection = GRAPHICS::ProjectionType::PERSPECTIVE;
+    constexpr unsigned int WIDTH_IN_PIXELS = 48;
+    constexpr unsigned int HEIGHT_IN_PIXELS = 48;
+    GRAPHICS::RenderTarget hierarchy_render_target(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    ray_tracer.Render(*hierarchy_scene, hierarchy_render_target);
+    GRAPHICS::RenderTarget grid_render_target(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    ray_tracer.Render(*grid_scene, grid_render_target);
+
+    // VERIFY THE IMAGES MATCH.
+    const GRAPHICS::ColorFormat COLOR_FORMAT = GRAPHICS::ColorFormat::RGBA;
+    for (unsigned int y = 0; y < HEIGHT_IN_PIXELS; ++y)
+    {
+        for (unsigned int x = 0; x < WIDTH_IN_PIXELS; ++x)
+        {
+            uint32_t expected_color = hierarchy_render_target.GetPixel(x, y).Pack(COLOR_FORMAT);
+            uint32_t actual_color = grid_render_target.GetPixel(x, y).Pack(COLOR_FORMAT);
+            REQUIRE(expected_color == actual_color);
+        }
+    }
+}
+
+TEST_CASE("Automatic acceleration structures switch to a grid while most objects move.", "[Scene][UpdateAccelerationStructure][UniformGrid]")
+{
+    // CREATE A SCENE WITH MANY OBJECTS.
+    constexpr unsigned int SPHERE_COUNT = 300;
+    std::unique_ptr<GRAPHICS::RAY_TRACING::Scene> scene = CreateScatteredSpheres(
+        SPHERE_COUNT,
+        GRAPHICS::RAY_TRACING::AccelerationStructureType::AUTOMATIC);
+    REQUIRE(GRAPHICS::RAY_TRACING::AccelerationStructureType::BOUNDING_VOLUME_HIERARCHY == scene->CurrentAccelerationStructure());
+
+    // MOVE ALL OBJECTS.
+    auto move_sphere = [&](const std::size_t sphere_index)
+    {
+        auto& sphere = static_cast<GRAPHICS::RAY_TRACING::Sphere&>(*scene->Objects[sphere_index]);
+        sphere.CenterPosition.Y += 0.5f;
+        scene->MarkObjectMoved(sphere_index);
+    };
+    for (std::size_t sphere_index = 0; sphere_index < SPHERE_COUNT; ++sphere_index)
+    {
+        move_sphere(sphere_index);
+    }
+    scene->UpdateAccelerationStructure();
+    REQUIRE(GRAPHICS::RAY_TRACING::AccelerationStructureType::UNIFORM_GRID == scene->CurrentAccelerationStructure());
+    REQUIRE(scene->AccelerationStructureIsCurrent());
+
+    // VERIFY A MOVED SPHERE IS FOUND AT ITS NEW POSITION.
+    auto& first_sphere = static_cast<const GRAPHICS::RAY_TRACING::Sphere&>(*scene->Objects[0]);
+    MATH::Vector3f ray_origin = first_sphere.CenterPosition;
+    ray_origin.Z = 0.0f;
+    GRAPHICS::RAY_TRACING::Ray ray_toward_sphere(ray_origin, MATH::Vector3f(0.0f, 0.0f, -40.0f));
+    GRAPHICS::RAY_TRACING::RayTracingAlgorithm ray_tracer;
+    REQUIRE(ray_tracer.Occluded(*scene, ray_toward_sphere, 0.0f, 1.0f));
+
+    // MOVE ONLY A SINGLE OBJECT.
+    move_sphere(0);
+    scene->UpdateAccelerationStructure();
+    REQUIRE(GRAPHICS::RAY_TRACING::AccelerationStructureType::BOUNDING_VOLUME_HIERARCHY == scene->CurrentAccelerationStructure());
+    REQUIRE(scene->AccelerationStructureIsCurrent());
+}
+
+TEST_CASE("A uniform grid built on multiple threads matches one built on a single thread.", "[UniformGrid][Build]")
+{
+    // GET THE BOUNDS OF MANY OBJECTS.
+    constexpr unsigned int SPHERE_COUNT = 5000;
+    std::unique_ptr<GRAPHICS::RAY_TRACING::Scene> scene = CreateScatteredSpheres(
+        SPHERE_COUNT,
+        GRAPHICS::RAY_TRACING::AccelerationStructureType::BOUNDING_VOLUME_HIERARCHY);
+    std::vector<GRAPHICS::RAY_TRACING::AxisAlignedBoundingBox> object_bounds;
+    for (const auto& object : scene->Objects)
+    {
+        object_bounds.push_back(object->Bounds());
+    }
+
+    // BUILD GRIDS WITH DIFFERENT NUMBERS OF THREADS.
+    GRAPHICS::RAY_TRACING::UniformGrid single_threaded_grid;
+    single_threaded_grid.Build(object_bounds, 1);
+    GRAPHICS::RAY_TRACING::UniformGrid multi_threaded_grid;
+    multi_threaded_grid.Build(object_bounds, 4);
+
+    // VERIFY THE GRIDS MATCH.
+    REQUIRE(SPHERE_COUNT == multi_threaded_grid.PrimitiveCount());
+    REQUIRE(single_threaded_grid.CellPrimitiveStartIndices == multi_threaded_grid.CellPrimitiveStartIndices);
+    REQUIRE(single_threaded_grid.CellPrimitiveIndices == multi_threaded_grid.CellPrimitiveIndices);
+}
+
+TEST_CASE("Infinite planes are kept out of the scene's acceleration structures.", "[Scene][Plane]")
+{
+    // CREATE A SCENE WITH A GROUND PLANE.
+    constexpr unsigned int SPHERE_COUNT = 16;
+    std::unique_ptr<GRAPHICS::RAY_TRACING::Scene> scene = CreateRowOfSpheres(SPHERE_COUNT);
+    auto ground_plane = std::make_unique<GRAPHICS::RAY_TRACING::Plane>();
+    ground_plane->PointOnPlane = MATH::Vector3f(0.0f, -1.0f, 0.0f);
+    ground_plane->UnitNormal = MATH::Vector3f(0.0f, 1.0f, 0.0f);
+    ground_plane->Material = std::make_shared<GRAPHICS::Material>();
+    scene->Objects.push_back(std::move(ground_plane));
+
+    // VERIFY THE PLANE DOESN'T ENLARGE A HIERARCHY BUT CAN STILL BE HIT.
+    GRAPHICS::RAY_TRACING::Ray ray_toward_plane(MATH::Vector3f(-50.0f, 0.0f, 50.0f), MATH::Vector3f(0.0f, -2.0f, 0.0f));
+    GRAPHICS::RAY_TRACING::RayTracingAlgorithm ray_tracer;
+    scene->AccelerationStructure = GRAPHICS::RAY_TRACING::AccelerationStructureType::BOUNDING_VOLUME_HIERARCHY;
+    scene->BuildAccelerationStructure();
+    REQUIRE(scene->AccelerationStructureIsCurrent());
+    REQUIRE(scene->ObjectHierarchy.Bounds().IsFinite());
+    REQUIRE(ray_tracer.Occluded(*scene, ray_toward_plane, 0.0f, 1.0f));
+
+    // VERIFY THE PLANE DOESN'T ENLARGE A GRID BUT CAN STILL BE HIT.
+    scene->AccelerationStructure = GRAPHICS::RAY_TRACING::AccelerationStructureType::UNIFORM_GRID;
+    scene->BuildAccelerationStructure();
+    REQUIRE(scene->AccelerationStructureIsCurrent());
+    REQUIRE(scene->ObjectGrid.Bounds().IsFinite());
+    REQUIRE(ray_tracer.Occluded(*scene, ray_toward_plane, 0.0f, 1.0f));
+}
+
+TEST_CASE("A scene with only infinite planes keeps its acceleration structure current.", "[Scene][Plane][UpdateAccelerationStructure]")
+{
+    // CREATE A SCENE WITH ONLY A GROUND PLANE.
+    GRAPHICS::RAY_TRACING::Scene scene;
+    auto ground_plane = std::make_unique<GRAPHICS::RAY_TRACING::Plane>();
+    ground_plane->PointOnPlane = MATH::Vector3f(0.0f, -1.0f, 0.0f);
+    ground_plane->UnitNormal = MATH::Vector3f(0.0f, 1.0f, 0.0f);
+    ground_plane->Material = std::make_shared<GRAPHICS::Material>();
+    scene.Objects.push_back(std::move(ground_plane));
+    GRAPHICS::RAY_TRACING::Ray ray_toward_plane(MATH::Vector3f(0.0f, 0.0f, 0.0f), MATH::Vector3f(0.0f, -2.0f, 0.0f));
+    GRAPHICS::RAY_TRACING::RayTracingAlgorithm ray_tracer;
+
+    // VERIFY EACH TYPE OF STRUCTURE IS CURRENT AFTER BEING BUILT AND UPDATED.
+    for (GRAPHICS::RAY_TRACING::AccelerationStructureType acceleration_structure :
+        { GRAPHICS::RAY_TRACING::AccelerationStructureType::BOUNDING_VOLUME_HIERARCHY, GRAPHICS::RAY_TRACING::AccelerationStructureType::UNIFORM_GRID })
+    {
+        scene.AccelerationStructure = acceleration_structure;
+        scene.BuildAccelerationStructure();
+        REQUIRE(scene.AccelerationStructureIsCurrent());
+        scene.UpdateAccelerationStructure();
+        REQUIRE(scene.AccelerationStructureIsCurrent());
+        REQUIRE(acceleration_structure == scene.CurrentAccelerationStructure());
+        REQUIRE(ray_tracer.Occluded(scene, ray_toward_plane, 0.0f, 1.0f));
+    }
+
+    // VERIFY ADDING AN OBJECT MAKES THE STRUCTURE STALE.
+    auto sphere = std::make_unique<GRAPHICS::RAY_TRACING::Sphere>();
+    sphere->Radius = 1.0f;
+    sphere->Material = std::make_shared<GRAPHICS::Material>();
+    scene.Objects.push_back(std::move(sphere));
+    REQUIRE_FALSE(scene.AccelerationStructureIsCurrent());
+}
+
+TEST_CASE("A hierarchy keeps primitives with unusable bounds out of its tree.", "[BoundingVolumeHierarchy][Build][Plane]")
+{
+    // CREATE BOUNDS FOR SPHERES MIXED WITH A PLANE AND DEGENERATE PRIMITIVES.
+    constexpr unsigned int SPHERE_COUNT = 16;
+    std::unique_ptr<GRAPHICS::RAY_TRACING::Scene> scene = CreateRowOfSpheres(SPHERE_COUNT);
+    std::vector<GRAPHICS::RAY_TRACING::AxisAlignedBoundingBox> primitive_bounds;
+    for (const std::unique_ptr<GRAPHICS::RAY_TRACING::IObject3D>& object : scene->Objects)
+    {
+        primitive_bounds.push_back(object->Bounds());
+    }
+    GRAPHICS::RAY_TRACING::Plane ground_plane;
+    ground_plane.PointOnPlane = MATH::Vector3f(0.0f, -1.0f, 0.0f);
+    ground_plane.UnitNormal = MATH::Vector3f(0.0f, 1.0f, 0.0f);
+    const std::size_t PLANE_PRIMITIVE_INDEX = primitive_bounds.size();
+    primitive_bounds.push_back(ground_plane.Bounds());
+    const std::size_t EMPTY_PRIMITIVE_INDEX = primitive_bounds.size();
+    primitive_bounds.push_back(GRAPHICS::RAY_TRACING::AxisAlignedBoundingBox());
+    const std::size_t NOT_A_NUMBER_PRIMITIVE_INDEX = primitive_bounds.size();
+    const float NOT_A_NUMBER = std::numeric_limits<float>::quiet_NaN();
+    primitive_bounds.push_back(GRAPHICS::RAY_TRACING::AxisAlignedBoundingBox(
+        MATH::Vector3f(NOT_A_NUMBER, 0.0f, 0.0f),
+        MATH::Vector3f(1.0f, NOT_A_NUMBER, 1.0f)));
+
+    // BUILD A HIERARCHY OVER THE PRIMITIVES.
+    GRAPHICS::RAY_TRACING::BoundingVolumeHierarchy hierarchy;
+    hierarchy.Build(primitive_bounds);
+
+    // VERIFY ONLY PRIMITIVES WITH FINITE BOUNDS ARE IN THE TREE.
+    REQUIRE(primitive_bounds.size() == hierarchy.PrimitiveCount());
+    REQUIRE(SPHERE_COUNT == hierarchy.PrimitiveIndices.size());
+    REQUIRE(hierarchy.Bounds().IsFinite());
+    for (std::size_t primitive_index : hierarchy.PrimitiveIndices)
+    {
+        REQUIRE(primitive_bounds[primitive_index].IsFinite());
+    }
+    REQUIRE(std::ranges::count(hierarchy.UnboundedPrimitiveIndices, PLANE_PRIMITIVE_INDEX) == 1);
+    REQUIRE(std::ranges::count(hierarchy.UnboundedPrimitiveIndices, EMPTY_PRIMITIVE_INDEX) == 1);
+    REQUIRE(std::ranges::count(hierarchy.UnboundedPrimitiveIndices, NOT_A_NUMBER_PRIMITIVE_INDEX) == 1);
+
+    // VERIFY A RAY STILL VISITS EVERY PRIMITIVE OUTSIDE THE TREE.
+    GRAPHICS::RAY_TRACING::Ray ray(MATH::Vector3f(-50.0f, 0.0f, 50.0f), MATH::Vector3f(0.0f, -2.0f, 0.0f));
+    std::vector<std::size_t> visited_primitive_indices;
+    hierarchy.VisitPrimitives(ray, 1.0f, [&](const std::size_t primitive_index)
+    {
+        visited_primitive_indices.push_back(primitive_index);
+        return false;
+    });
+    REQUIRE(hierarchy.UnboundedPrimitiveIndices == visited_primitive_indices);
+}
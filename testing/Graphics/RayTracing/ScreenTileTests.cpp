@@ -0,0 +1,33 @@
+#include "Graphics/RayTracing/ScreenTile.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+TEST_CASE("A screen can be partitioned into tiles covering all pixels.", "[ScreenTile][Partition]")
+{
+    // PARTITION A SCREEN WHOSE DIMENSIONS AREN'T MULTIPLES OF THE TILE SIZE.
+    constexpr unsigned int SCREEN_WIDTH_IN_PIXELS = 40;
+    constexpr unsigned int SCREEN_HEIGHT_IN_PIXELS = 20;
+    constexpr unsigned int TILE_DIMENSION_IN_PIXELS = 16;
+    std::vector<GRAPHICS::RAY_TRACING::ScreenTile> tiles = GRAPHICS::RAY_TRACING::ScreenTile::Partition(
+        SCREEN_WIDTH_IN_PIXELS,
+        SCREEN_HEIGHT_IN_PIXELS,
+        TILE_DIMENSION_IN_PIXELS);
+
+    // VERIFY THE TILES.
+    // There should be 3 columns and 2 rows of tiles.
+    REQUIRE(6 == tiles.size());
+
+    unsigned int total_pixel_count = 0;
+    for (std::size_t tile_index = 0; tile_index < tiles.size(); ++tile_index)
+    {
+        REQUIRE(tile_index == tiles[tile_index].Index);
+        total_pixel_count += tiles[tile_index].PixelCount();
+    }
+    REQUIRE(SCREEN_WIDTH_IN_PIXELS * SCREEN_HEIGHT_IN_PIXELS == total_pixel_count);
+
+    // The bottom-right tile should be clipped by the screen.
+    const GRAPHICS::RAY_TRACING::ScreenTile& bottom_right_tile = tiles.back();
+    REQUIRE(32 == bottom_right_tile.LeftX);
+    REQUIRE(16 == bottom_right_tile.TopY);
+    REQUIRE(8 == bottom_right_tile.WidthInPixels);
+    REQUIRE(4 == bottom_right_tile.HeightInPixels);
+}
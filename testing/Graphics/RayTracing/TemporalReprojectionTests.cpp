@@ -0,0 +1,101 @@
+#include <memory>
+#include "Graphics/RayTracing/Sphere.h"
+#include "Graphics/RayTracing/TemporalReprojection.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+/// Creates a scene with a few spheres for testing reprojection.
+/// @return The test scene.
+static GRAPHICS::RAY_TRACING::Scene CreateTestScene()
+{
+    GRAPHICS::RAY_TRACING::Scene scene;
+    scene.BackgroundColor = GRAPHICS::Color(0.2f, 0.2f, 1.0f, 1.0f);
+    scene.PointLights.push_back(GRAPHICS::Light
+    {
+        .Color = GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f),
+        .PointLightWorldPosition = MATH::Vector3f(2.0f, 2.0f, 2.0f),
+    });
+    const MATH::Vector3f SPHERE_CENTERS[] =
+    {
+        MATH::Vector3f(-1.0f, 0.0f, -4.0f),
+        MATH::Vector3f(1.0f, 0.5f, -6.0f),
+    };
+    for (const MATH::Vector3f& sphere_center : SPHERE_CENTERS)
+    {
+        auto sphere = std::make_unique<GRAPHICS::RAY_TRACING::Sphere>();
+        sphere->CenterPosition = sphere_center;
+        sphere->Radius = 1.0f;
+        sphere->Material = std::make_shared<GRAPHICS::Material>();
+        sphere->Material->DiffuseColor = GRAPHICS::Color(0.8f, 0.3f, 0.3f, 1.0f);
+        scene.Objects.push_back(std::move(sphere));
+    }
+    return scene;
+}
+
+TEST_CASE("A frame from an unchanged camera only re-traces the refreshed pixels.", "[TemporalReprojection]")
+{
+    // RENDER AN INITIAL FRAME.
+    GRAPHICS::RAY_TRACING::Scene scene = CreateTestScene();
+    GRAPHICS::RAY_TRACING::RayTracingAlgorithm ray_tracer;
+    ray_tracer.Camera = GRAPHICS::Camera::LookAtFrom(MATH::Vector3f(0.0f, 0.0f, -5.0f), MATH::Vector3f(0.0f, 0.0f, 0.0f));
+    ray_tracer.Camera.Projection = GRAPHICS::ProjectionType::PERSPECTIVE;
+    constexpr unsigned int WIDTH_IN_PIXELS = 32;
+    constexpr unsigned int HEIGHT_IN_PIXELS = 32;
+    constexpr std::size_t PIXEL_COUNT = WIDTH_IN_PIXELS * HEIGHT_IN_PIXELS;
+    GRAPHICS::RenderTarget render_target(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    GRAPHICS::RAY_TRACING::TemporalReprojection reprojection;
+    std::size_t retraced_pixel_count = reprojection.RenderFrame(ray_tracer, scene, render_target);
+    REQUIRE(PIXEL_COUNT == retraced_pixel_count);
+
+    // RENDER ANOTHER FRAME FROM THE SAME VIEW.
+    retraced_pixel_count = reprojection.RenderFrame(ray_tracer, scene, render_target);
+
+    // VERIFY ONLY THE REFRESHED PIXELS WERE RE-TRACED.
+    REQUIRE((PIXEL_COUNT / reprojection.RefreshIntervalInFrames) == retraced_pixel_count);
+
+    // VERIFY THE FRAME MATCHES A FULL RENDER.
+    GRAPHICS::RenderTarget expected_render_target(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    ray_tracer.Render(scene, expected_render_target);
+    const GRAPHICS::ColorFormat COLOR_FORMAT = GRAPHICS::ColorFormat::RGBA;
+    unsigned int mismatched_pixel_count = 0;
+    for (unsigned int y = 0; y < HEIGHT_IN_PIXELS; ++y)
+    {
+        for (unsigned int x = 0; x < WIDTH_IN_PIXELS; ++x)
+        {
+            uint32_t expected_color = expected_render_target.GetPixel(x, y).Pack(COLOR_FORMAT);
+            uint32_t actual_color = render_target.GetPixel(x, y).Pack(COLOR_FORMAT);
+            if (expected_color != actual_color)
+            {
+                ++mismatched_pixel_count;
+            }
+        }
+    }
+    REQUIRE(0 == mismatched_pixel_count);
+}
+
+TEST_CASE("A frame from a slightly moved camera re-traces only part of the image.", "[TemporalReprojection]")
+{
+    // RENDER AN INITIAL FRAME.
+    GRAPHICS::RAY_TRACING::Scene scene = CreateTestScene();
+    GRAPHICS::RAY_TRACING::RayTracingAlgorithm ray_tracer;
+    ray_tracer.Camera = GRAPHICS::Camera::LookAtFrom(MATH::Vector3f(0.0f, 0.0f, -5.0f), MATH::Vector3f(0.0f, 0.0f, 0.0f));
+    ray_tracer.Camera.Projection = GRAPHICS::ProjectionType::PERSPECTIVE;
+    constexpr unsigned int WIDTH_IN_PIXELS = 32;
+    constexpr unsigned int HEIGHT_IN_PIXELS = 32;
+    constexpr std::size_t PIXEL_COUNT = WIDTH_IN_PIXELS * HEIGHT_IN_PIXELS;
+    GRAPHICS::RenderTarget render_target(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    GRAPHICS::RAY_TRACING::TemporalReprojection reprojection;
+    reprojection.RenderFrame(ray_tracer, scene, render_target);
+
+    // MOVE THE CAMERA SLIGHTLY AND RENDER ANOTHER FRAME.
+    ray_tracer.Camera.WorldPosition.X += 0.05f;
+    std::size_t retraced_pixel_count = reprojection.RenderFrame(ray_tracer, scene, render_target);
+
+    // VERIFY MOST OF THE IMAGE WAS REPROJECTED.
+    REQUIRE(retraced_pixel_count > 0);
+    REQUIRE(retraced_pixel_count < PIXEL_COUNT / 2);
+
+    // CHANGING GEOMETRY SHOULD FORCE A FULL RE-TRACE.
+    ++scene.GeometryVersion;
+    retraced_pixel_count = reprojection.RenderFrame(ray_tracer, scene, render_target);
+    REQUIRE(PIXEL_COUNT == retraced_pixel_count);
+}
@@ -0,0 +1,146 @@
+#include <memory>
+#include <vector>
+#include "Graphics/Object3D.h"
+#include "Graphics/RayTracing/MeshInstance.h"
+#include "Graphics/RayTracing/RayTracingAlgorithm.h"
+#include "Graphics/RayTracing/Sphere.h"
+#include "Graphics/RayTracing/VisibilityBuffer.h"
+#include "Graphics/Triangle.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+/// Creates a scene mixing rasterizable and non-rasterizable objects.
+/// @return The test scene.
+static GRAPHICS::RAY_TRACING::Scene CreateMixedScene()
+{
+    GRAPHICS::RAY_TRACING::Scene scene;
+    scene.BackgroundColor = GRAPHICS::Color(0.2f, 0.2f, 1.0f, 1.0f);
+    scene.PointLights.push_back(GRAPHICS::Light
+    {
+        .Color = GRAPHICS::Color(1.0f, 1.0f, 1.0f, 1.0f),
+        .PointLightWorldPosition = MATH::Vector3f(2.0f, 3.0f, 0.0f),
+    });
+
+    // ADD A REFLECTIVE FLOOR MADE OF A MESH INSTANCE.
+    auto floor_material = std::make_shared<GRAPHICS::Material>();
+    floor_material->DiffuseColor = GRAPHICS::Color(0.5f, 0.5f, 0.5f, 1.0f);
+    floor_material->ReflectivityProportion = 0.5f;
+    std::vector<GRAPHICS::Triangle> floor_triangles =
+    {
+        GRAPHICS::Triangle(floor_material,
+        {
+            MATH::Vector3f(-0.5f, -0.5f, 0.0f),
+            MATH::Vector3f(0.5f, -0.5f, 0.0f),
+            MATH::Vector3f(0.5f, 0.5f, 0.0f)
+        }),
+        GRAPHICS::Triangle(floor_material,
+        {
+            MATH::Vector3f(-0.5f, -0.5f, 0.0f),
+            MATH::Vector3f(0.5f, 0.5f, 0.0f),
+            MATH::Vector3f(-0.5f, 0.5f, 0.0f)
+        }),
+    };
+    auto floor_mesh = std::make_shared<const GRAPHICS::RAY_TRACING::Mesh>(floor_triangles);
+    GRAPHICS::Object3D floor_placement;
+    floor_placement.WorldPosition = MATH::Vector3f(0.0f, -1.0f, -5.0f);
+    floor_placement.Scale = MATH::Vector3f(6.0f, 6.0f, 6.0f);
+    floor_placement.RotationInRadians.X = MATH::Angle<float>::Radians(-1.5707963f);
+    scene.Objects.push_back(std::make_unique<GRAPHICS::RAY_TRACING::MeshInstance>(
+        floor_mesh,
+        floor_placement.WorldTransform(),
+        floor_placement.InverseWorldTransform()));
+
+    // ADD A STANDALONE TRIANGLE.
+    auto triangle_material = std::make_shared<GRAPHICS::Material>();
+    triangle_material->DiffuseColor = GRAPHICS::Color(0.2f, 0.8f, 0.2f, 1.0f);
+    scene.Objects.push_back(std::make_unique<GRAPHICS::Triangle>(
+        triangle_material,
+        std::array<MATH::Vector3f, GRAPHICS::Triangle::VERTEX_COUNT>
+        {
+            MATH::Vector3f(0.5f, -1.0f, -6.0f),
+            MATH::Vector3f(2.0f, -1.0f, -6.0f),
+            MATH::Vector3f(1.25f, 1.0f, -6.0f),
+        }));
+
+    // ADD A SPHERE THAT CAN'T BE RASTERIZED.
+    auto sphere = std::make_unique<GRAPHICS::RAY_TRACING::Sphere>();
+    sphere->CenterPosition = MATH::Vector3f(-1.0f, 0.0f, -5.0f);
+    sphere->Radius = 1.0f;
+    sphere->Material = std::make_shared<GRAPHICS::Material>();
+    sphere->Material->DiffuseColor = GRAPHICS::Color(0.8f, 0.3f, 0.3f, 1.0f);
+    scene.Objects.push_back(std::move(sphere));
+
+    return scene;
+}
+
+TEST_CASE("Only objects composed of triangles are rasterized.", "[VisibilityBuffer][Rasterize]")
+{
+    // RASTERIZE THE SCENE.
+    GRAPHICS::RAY_TRACING::Scene scene = CreateMixedScene();
+    GRAPHICS::Camera camera = GRAPHICS::Camera::LookAtFrom(MATH::Vector3f(0.0f, 0.0f, -5.0f), MATH::Vector3f(0.0f, 0.5f, 0.0f));
+    camera.Projection = GRAPHICS::ProjectionType::PERSPECTIVE;
+    GRAPHICS::RenderTarget render_target(32, 32, GRAPHICS::ColorFormat::RGBA);
+    GRAPHICS::RAY_TRACING::VisibilityBuffer visibility_buffer;
+    visibility_buffer.Rasterize(camera, scene, render_target);
+
+    // VERIFY THE SPHERE MUST BE RAY TRACED.
+    REQUIRE(1 == visibility_buffer.UnrasterizedObjects.size());
+    REQUIRE(scene.Objects[2].get() == visibility_buffer.UnrasterizedObjects[0]);
+
+    // VERIFY THE RASTERIZED DEPTHS MATCH RAY TRACING.
+    unsigned int covered_pixel_count = 0;
+    for (unsigned int y = 0; y < render_target.GetHeightInPixels(); ++y)
+    {
+        for (unsigned int x = 0; x < render_target.GetWidthInPixels(); ++x)
+        {
+            const GRAPHICS::RAY_TRACING::VisibilityBuffer::Sample& sample = visibility_buffer.Samples(x, y);
+            if (!sample.Object)
+            {
+                continue;
+            }
+
+            ++covered_pixel_count;
+            GRAPHICS::RAY_TRACING::Ray ray = camera.ViewingRay(MATH::Vector2ui(x, y), render_target);
+            std::optional<GRAPHICS::RAY_TRACING::RayObjectIntersection> intersection = sample.Object->Intersect(ray);
+            if (intersection)
+            {
+                REQUIRE(intersection->DistanceFromRayToObject == Approx(sample.DistanceFromRayToObject).epsilon(0.001f));
+            }
+        }
+    }
+    REQUIRE(covered_pixel_count > 0);
+}
+
+TEST_CASE("Hybrid rendering matches full ray tracing.", "[RayTracingAlgorithm][RenderHybrid]")
+{
+    // RENDER THE SCENE BOTH WAYS.
+    GRAPHICS::RAY_TRACING::Scene scene = CreateMixedScene();
+    GRAPHICS::RAY_TRACING::RayTracingAlgorithm ray_tracer;
+    ray_tracer.Camera = GRAPHICS::Camera::LookAtFrom(MATH::Vector3f(0.0f, 0.0f, -5.0f), MATH::Vector3f(0.0f, 0.5f, 0.0f));
+    ray_tracer.Camera.Projection = GRAPHICS::ProjectionType::PERSPECTIVE;
+    constexpr unsigned int WIDTH_IN_PIXELS = 48;
+    constexpr unsigned int HEIGHT_IN_PIXELS = 48;
+    GRAPHICS::RenderTarget expected_render_target(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    ray_tracer.Render(scene, expected_render_target);
+    GRAPHICS::RenderTarget hybrid_render_target(WIDTH_IN_PIXELS, HEIGHT_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    ray_tracer.RenderHybrid(scene, hybrid_render_target);
+
+    // VERIFY THE IMAGES MATCH.
+    // Pixel centers lying exactly along triangle edges may be resolved differently,
+    // so a handful of differing pixels is allowed.
+    const GRAPHICS::ColorFormat COLOR_FORMAT = GRAPHICS::ColorFormat::RGBA;
+    unsigned int mismatched_pixel_count = 0;
+    for (unsigned int y = 0; y < HEIGHT_IN_PIXELS; ++y)
+    {
+        for (unsigned int x = 0; x < WIDTH_IN_PIXELS; ++x)
+        {
+            uint32_t expected_color = expected_render_target.GetPixel(x, y).Pack(COLOR_FORMAT);
+            uint32_t actual_color = hybrid_render_target.GetPixel(x, y).Pack(COLOR_FORMAT);
+            if (expected_color != actual_color)
+            {
+                ++mismatched_pixel_count;
+            }
+        }
+    }
+    constexpr unsigned int MAX_MISMATCHED_PIXEL_COUNT = WIDTH_IN_PIXELS;
+    REQUIRE(mismatched_pixel_count <= MAX_MISMATCHED_PIXEL_COUNT);
+}
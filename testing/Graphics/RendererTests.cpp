@@ -0,0 +1,97 @@
+#include <memory>
+#include <vector>
+#include "Graphics/Renderer.h"
+#include "ThirdParty/Catch/catch.hpp"
+
+TEST_CASE("A lightmap only replaces diffuse light from non-ambient lights.", "[Renderer][Lightmap]")
+{
+    // CREATE LIGHTS FACING A TRIANGLE.
+    // The directional light shines straight at the triangle so that it's evenly lit.
+    // Light is kept dim enough for the total light to never be clamped.
+    const GRAPHICS::Color DIRECTIONAL_LIGHT_COLOR(0.3f, 0.3f, 0.3f, 1.0f);
+    std::vector<GRAPHICS::Light> lights;
+    lights.push_back(GRAPHICS::Light
+    {
+        .Type = GRAPHICS::LightType::AMBIENT,
+        .Color = GRAPHICS::Color(0.2f, 0.2f, 0.2f, 1.0f),
+    });
+    lights.push_back(GRAPHICS::Light
+    {
+        .Type = GRAPHICS::LightType::DIRECTIONAL,
+        .Color = DIRECTIONAL_LIGHT_COLOR,
+        .DirectionalLightDirection = MATH::Vector3f(0.0f, 0.0f, -1.0f),
+    });
+
+    // CREATE A LIGHTMAP CONTAINING THE SAME DIFFUSE LIGHT.
+    constexpr unsigned int LIGHTMAP_DIMENSION_IN_PIXELS = 4;
+    auto lightmap = std::make_shared<GRAPHICS::Texture>(LIGHTMAP_DIMENSION_IN_PIXELS, LIGHTMAP_DIMENSION_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+    for (unsigned int y = 0; y < LIGHTMAP_DIMENSION_IN_PIXELS; ++y)
+    {
+        for (unsigned int x = 0; x < LIGHTMAP_DIMENSION_IN_PIXELS; ++x)
+        {
+            lightmap->Bitmap.WritePixel(x, y, DIRECTIONAL_LIGHT_COLOR);
+        }
+    }
+
+    // VERIFY THE TRIANGLE LOOKS THE SAME WITH AND WITHOUT THE LIGHTMAP FOR DIFFERENT KINDS OF SHADING.
+    for (GRAPHICS::ShadingType shading : { GRAPHICS::ShadingType::FLAT, GRAPHICS::ShadingType::MATERIAL })
+    {
+        // CREATE A TRIANGLE WITH AMBIENT OCCLUSION AND A SPECULAR MATERIAL.
+        auto material = std::make_shared<GRAPHICS::Material>();
+        material->Shading = shading;
+        material->FaceColor = GRAPHICS::Color(0.9f, 0.8f, 0.7f, 1.0f);
+        material->AmbientColor = GRAPHICS::Color(0.6f, 0.2f, 0.2f, 1.0f);
+        material->DiffuseColor = GRAPHICS::Color(0.2f, 0.6f, 0.2f, 1.0f);
+        material->SpecularColor = GRAPHICS::Color(0.2f, 0.2f, 0.6f, 1.0f);
+        material->SpecularPower = 2.0f;
+        GRAPHICS::Triangle triangle(material, std::array<MATH::Vector3f, GRAPHICS::Triangle::VERTEX_COUNT>
+        {
+            MATH::Vector3f(0.0f, 1.0f, 0.0f),
+            MATH::Vector3f(1.0f, -1.0f, 0.0f),
+            MATH::Vector3f(-1.0f, -1.0f, 0.0f),
+        });
+        triangle.VertexAmbientOcclusion = { 0.5f, 0.75f, 1.0f };
+        triangle.LightmapTextureCoordinates =
+        {
+            MATH::Vector2f(0.5f, 0.25f),
+            MATH::Vector2f(0.75f, 0.75f),
+            MATH::Vector2f(0.25f, 0.75f),
+        };
+        GRAPHICS::Object3D object_3D;
+        object_3D.Triangles.push_back(triangle);
+        object_3D.Scale = MATH::Vector3f(50.0f, 50.0f, 1.0f);
+        object_3D.WorldPosition = MATH::Vector3f(0.0f, 0.0f, -100.0f);
+
+        // RENDER THE TRIANGLE WITH AND WITHOUT THE LIGHTMAP.
+        // The camera is moved back from the origin so that its near plane doesn't collapse the projection.
+        GRAPHICS::Renderer renderer;
+        renderer.Camera.WorldPosition = MATH::Vector3f(0.0f, 0.0f, 10.0f);
+        constexpr unsigned int DIMENSION_IN_PIXELS = 32;
+        GRAPHICS::RenderTarget lit_render_target(DIMENSION_IN_PIXELS, DIMENSION_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+        renderer.Render(object_3D, lights, lit_render_target);
+        object_3D.Lightmap = lightmap;
+        GRAPHICS::RenderTarget lightmapped_render_target(DIMENSION_IN_PIXELS, DIMENSION_IN_PIXELS, GRAPHICS::ColorFormat::RGBA);
+        renderer.Render(object_3D, lights, lightmapped_render_target);
+
+        // VERIFY THE IMAGES MATCH.
+        // Small differences are allowed since the lightmap stores light with limited precision.
+        constexpr float COLOR_COMPONENT_TOLERANCE = 2.0f / 255.0f;
+        unsigned int rendered_pixel_count = 0;
+        for (unsigned int y = 0; y < DIMENSION_IN_PIXELS; ++y)
+        {
+            for (unsigned int x = 0; x < DIMENSION_IN_PIXELS; ++x)
+            {
+                GRAPHICS::Color lit_color = lit_render_target.GetPixel(x, y);
+                GRAPHICS::Color lightmapped_color = lightmapped_render_target.GetPixel(x, y);
+                REQUIRE(lit_color.Red == Approx(lightmapped_color.Red).margin(COLOR_COMPONENT_TOLERANCE));
+                REQUIRE(lit_color.Green == Approx(lightmapped_color.Green).margin(COLOR_COMPONENT_TOLERANCE));
+                REQUIRE(lit_color.Blue == Approx(lightmapped_color.Blue).margin(COLOR_COMPONENT_TOLERANCE));
+                if (lit_color.Red > 0.0f)
+                {
+                    ++rendered_pixel_count;
+                }
+            }
+        }
+        REQUIRE(rendered_pixel_count > 0);
+    }
+}